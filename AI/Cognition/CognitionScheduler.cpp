@@ -0,0 +1,269 @@
+// Mythic Living World — Cognition Scheduler Implementation
+// Bucketed due queues, one background wave per pass, one game-thread commit loop per wave.
+
+#include "AI/Cognition/CognitionScheduler.h"
+#include "AI/Cognition/CognitiveBrainComponent.h"
+#include "World/LivingWorld/LivingWorldSubsystem.h"
+#include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/CausalFabric/CausalFabric.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+// ─────────────────────────────────────────────────────────────
+// Subsystem Lifecycle
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicCognitionScheduler::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UMythicCognitionScheduler::Initialize(FSubsystemCollectionBase &Collection) {
+    Super::Initialize(Collection);
+
+    if (UGameInstance *GI = GetWorld()->GetGameInstance()) {
+        if (UMythicLivingWorldSubsystem *LW = GI->GetSubsystem<UMythicLivingWorldSubsystem>()) {
+            CausalFabric = LW->GetCausalFabric();
+            Settings = LW->GetSettings();
+        }
+    }
+
+    if (!CausalFabric || !Settings) {
+        UE_LOG(LogMythCognition, Warning, TEXT("CognitionScheduler: Living world references not available. Cognition disabled."));
+        return;
+    }
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMythicCognitionScheduler::Tick), 0.0f);
+}
+
+void UMythicCognitionScheduler::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+
+    // The wave's worker dereferences raw brain pointers and the fabric — never let it outlive the world.
+    if (WaveTask.IsValid() && !WaveTask.IsCompleted()) {
+        WaveTask.Wait();
+    }
+    WaveTask = UE::Tasks::FTask();
+    WaveBrains.Reset();
+    Buckets.Reset();
+    BrainBuckets.Reset();
+
+    Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// Registration
+// ─────────────────────────────────────────────────────────────
+
+void UMythicCognitionScheduler::RegisterBrain(UMythicCognitiveBrainComponent *Brain, float Interval, float InitialDelay) {
+    const UWorld *World = GetWorld();
+    if (!Brain || !World) {
+        return;
+    }
+    UnregisterBrain(Brain);
+
+    // New brains start in the Tier2 bucket; the first think reads the entity's real tier and re-buckets if it differs.
+    const int32 BucketIndex = FindOrAddBucket(QuantizeThinkInterval(Interval), EMythicSignificanceTier::Tier2_Cognitive);
+    const TObjectKey<UMythicCognitiveBrainComponent> Key(Brain);
+    InsertByDueTime(Buckets[BucketIndex], FThinkEntry{Key, World->GetTimeSeconds() + FMath::Max(0.0f, InitialDelay)});
+    BrainBuckets.Add(Key, BucketIndex);
+}
+
+void UMythicCognitionScheduler::UnregisterBrain(UMythicCognitiveBrainComponent *Brain) {
+    int32 BucketIndex = INDEX_NONE;
+    if (Brain && BrainBuckets.RemoveAndCopyValue(TObjectKey<UMythicCognitiveBrainComponent>(Brain), BucketIndex)) {
+        RemoveFromBucket(BucketIndex, Brain);
+    }
+}
+
+void UMythicCognitionScheduler::RequestImmediateThink(UMythicCognitiveBrainComponent *Brain) {
+    const UWorld *World = GetWorld();
+    const int32 *BucketIndex = Brain ? BrainBuckets.Find(TObjectKey<UMythicCognitiveBrainComponent>(Brain)) : nullptr;
+    if (!World || !BucketIndex) {
+        return; // not thinking (never started, or stopped) — an event must not restart a halted brain
+    }
+    // Due now → dispatched on the next pass; ComputeNextDueTime then restarts the cadence from that think, as the old
+    // clear-timer + re-arm did.
+    RemoveFromBucket(*BucketIndex, Brain);
+    InsertByDueTime(Buckets[*BucketIndex], FThinkEntry{TObjectKey<UMythicCognitiveBrainComponent>(Brain), World->GetTimeSeconds()});
+}
+
+int32 UMythicCognitionScheduler::FindOrAddBucket(float Interval, EMythicSignificanceTier Tier) {
+    for (int32 i = 0; i < Buckets.Num(); ++i) {
+        if (Buckets[i].Tier == Tier && FMath::IsNearlyEqual(Buckets[i].Interval, Interval)) {
+            return i;
+        }
+    }
+    // Buckets are never removed (there are only a handful: interval range / quantum × tiers), so indices stay stable.
+    const int32 Index = Buckets.AddDefaulted();
+    Buckets[Index].Interval = Interval;
+    Buckets[Index].Tier = Tier;
+    return Index;
+}
+
+void UMythicCognitionScheduler::InsertByDueTime(FThinkBucket &Bucket, const FThinkEntry &Entry) {
+    // Upper bound: equal due times keep FIFO order. Almost every insert is a reschedule, which lands at or near the back.
+    int32 Index = Bucket.Queue.Num();
+    while (Index > 0 && Bucket.Queue[Index - 1].DueTime > Entry.DueTime) {
+        --Index;
+    }
+    Bucket.Queue.Insert(Entry, Index);
+}
+
+bool UMythicCognitionScheduler::RemoveFromBucket(int32 BucketIndex, const UMythicCognitiveBrainComponent *Brain) {
+    if (!Buckets.IsValidIndex(BucketIndex)) {
+        return false;
+    }
+    const TObjectKey<UMythicCognitiveBrainComponent> Key(Brain);
+    TArray<FThinkEntry> &Queue = Buckets[BucketIndex].Queue;
+    const int32 Index = Queue.IndexOfByPredicate([&Key](const FThinkEntry &Entry) { return Entry.Brain == Key; });
+    if (Index == INDEX_NONE) {
+        return false;
+    }
+    Queue.RemoveAt(Index, EAllowShrinking::No); // keep the due-time order (no swap)
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Pure helpers
+// ─────────────────────────────────────────────────────────────
+
+float UMythicCognitionScheduler::QuantizeThinkInterval(float Interval) {
+    return FMath::Max(ThinkIntervalQuantum, FMath::RoundToFloat(Interval / ThinkIntervalQuantum) * ThinkIntervalQuantum);
+}
+
+double UMythicCognitionScheduler::ComputeNextDueTime(double DueTime, double Now, float Interval) {
+    const double Next = DueTime + Interval;
+    return Next > Now ? Next : Now + Interval;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Think waves
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicCognitionScheduler::Tick(float /*DeltaTime*/) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitionScheduler_Tick);
+
+    if (WaveTask.IsValid()) {
+        if (!WaveTask.IsCompleted()) {
+            return true; // one wave at a time — due brains wait for the next pass
+        }
+        CommitCompletedWave();
+    }
+
+    UWorld *World = GetWorld();
+    if (!World || !CausalFabric || !Settings || BrainBuckets.Num() == 0) {
+        return true;
+    }
+    const double Now = World->GetTimeSeconds();
+
+    // Highest tier first so persistent (companion) brains lead the wave and land in the first batches.
+    TArray<int32, TInlineAllocator<16>> BucketOrder;
+    for (int32 i = 0; i < Buckets.Num(); ++i) {
+        if (Buckets[i].Queue.Num() > 0 && Buckets[i].Queue[0].DueTime <= Now) {
+            BucketOrder.Add(i);
+        }
+    }
+    if (BucketOrder.IsEmpty()) {
+        return true;
+    }
+    BucketOrder.Sort([this](int32 A, int32 B) { return Buckets[A].Tier > Buckets[B].Tier; });
+
+    // ─── Gather (game thread) ───
+    // Pop each bucket's due prefix, let every due brain copy its game-thread inputs, and reschedule it straight away
+    // (a skipped brain keeps its cadence, as a looping timer would). Re-inserted entries are due strictly after Now, so
+    // nothing is visited twice in one pass.
+    TArray<UMythicCognitiveBrainComponent *> Wave;
+    TArray<FThinkEntry> Due;
+    for (const int32 BucketIndex : BucketOrder) {
+        const float Interval = Buckets[BucketIndex].Interval;
+        const EMythicSignificanceTier BucketTier = Buckets[BucketIndex].Tier;
+
+        TArray<FThinkEntry> &Queue = Buckets[BucketIndex].Queue;
+        int32 NumDue = 0;
+        while (NumDue < Queue.Num() && Queue[NumDue].DueTime <= Now) {
+            ++NumDue;
+        }
+        Due.Reset();
+        Due.Append(Queue.GetData(), NumDue);
+        Queue.RemoveAt(0, NumDue, EAllowShrinking::No);
+
+        for (const FThinkEntry &Entry : Due) {
+            UMythicCognitiveBrainComponent *Brain = Entry.Brain.ResolveObjectPtr();
+            if (!Brain) {
+                BrainBuckets.Remove(Entry.Brain); // destroyed without EndPlay reaching UnregisterBrain
+                continue;
+            }
+
+            EMythicSignificanceTier Tier = BucketTier;
+            if (Brain->BeginScheduledThink(Now, Tier)) {
+                Wave.Add(Brain);
+            }
+
+            // Tier moved (e.g. recruited as a companion) → re-bucket. FindOrAddBucket may grow Buckets, so index it
+            // afresh rather than through the Queue reference taken above.
+            const int32 TargetBucket = (Tier == BucketTier) ? BucketIndex : FindOrAddBucket(Interval, Tier);
+            BrainBuckets.Add(Entry.Brain, TargetBucket);
+            InsertByDueTime(Buckets[TargetBucket], FThinkEntry{Entry.Brain, ComputeNextDueTime(Entry.DueTime, Now, Interval)});
+        }
+    }
+
+    LastWaveSize = Wave.Num();
+    if (Wave.IsEmpty()) {
+        return true;
+    }
+
+    // ─── Launch (one background task, ParallelFor over contiguous batches) ───
+    // Each brain's belief update pins the fabric's published view for its own cell walk only. See
+    // UMythicCognitiveBrainComponent::ThinkBatch.
+    const int32 BatchSize = FMath::Max(1, Settings->CognitiveThinkBatchSize);
+    const UMythicCausalFabric *Fabric = CausalFabric;
+
+    WaveWorldTime = Now;
+    WaveBrains.Reset(Wave.Num());
+    for (UMythicCognitiveBrainComponent *Brain : Wave) {
+        WaveBrains.Add(Brain);
+    }
+
+    TArray<UMythicCognitiveBrainComponent *> WaveCopy = Wave;
+    WaveTask = UE::Tasks::Launch(
+        TEXT("BDI_ThinkWave"),
+        [Brains = MoveTemp(WaveCopy), Fabric, Now, BatchSize]() {
+            TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitionScheduler_Wave);
+            const int32 NumBatches = FMath::DivideAndRoundUp(Brains.Num(), BatchSize);
+            ParallelFor(NumBatches, [&Brains, Fabric, Now, BatchSize](int32 BatchIndex) {
+                const int32 First = BatchIndex * BatchSize;
+                const int32 Count = FMath::Min(BatchSize, Brains.Num() - First);
+                UMythicCognitiveBrainComponent::ThinkBatch(
+                    TConstArrayView<UMythicCognitiveBrainComponent *>(Brains.GetData() + First, Count), *Fabric, Now);
+            });
+        },
+        UE::Tasks::ETaskPriority::BackgroundNormal
+        );
+
+    // StopThinking/EndPlay join this handle before the brain can be destroyed.
+    for (UMythicCognitiveBrainComponent *Brain : Wave) {
+        Brain->AsyncThinkTask = WaveTask;
+    }
+    return true;
+}
+
+void UMythicCognitionScheduler::CommitCompletedWave() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitionScheduler_Commit);
+
+    // One game-thread loop validates + commits the whole wave (CurrentIntention is only ever written here).
+    for (const TWeakObjectPtr<UMythicCognitiveBrainComponent> &WeakBrain : WaveBrains) {
+        if (UMythicCognitiveBrainComponent *Brain = WeakBrain.Get()) {
+            Brain->OnAsyncThinkCompleted(WaveWorldTime);
+        }
+    }
+    WaveBrains.Reset();
+    WaveTask = UE::Tasks::FTask();
+}
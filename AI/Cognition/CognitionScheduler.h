@@ -0,0 +1,133 @@
+// Mythic Living World — Cognition Scheduler
+// Central batched think scheduler for UMythicCognitiveBrainComponent (replaces one timer + one task per brain).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+#include "World/LivingWorld/LivingWorldTypes.h" // EMythicSignificanceTier (bucket key)
+#include "CognitionScheduler.generated.h"
+
+class UMythicCognitiveBrainComponent;
+class UMythicCausalFabric;
+class UMythicLivingWorldSettings;
+
+/**
+ * Cognition Scheduler — drives every cognitive brain's think loop from one core-ticker pass.
+ *
+ * Previously each brain armed its own looping FTimerHandle and launched its own UE::Tasks task per Think; each task
+ * queried the fabric for its cell walk and posted its own game-thread completion. 200 cognitive NPCs meant 200
+ * timers, 200 tiny tasks and 200 game-thread completions per interval. Now:
+ *
+ * - Brains are bucketed by (quantized ThinkInterval, significance tier). Every brain in a bucket shares one period, so
+ *   each bucket's queue stays sorted by due time and collecting the due brains is a pop from the front — O(due), not
+ *   O(registered).
+ * - Due brains gather their game-thread inputs (pressure, schedule phase) in one pass, then a single background task
+ *   runs UpdateBeliefs/ScoreDesires in a ParallelFor over contiguous batches. Each brain's cell walk pins the fabric's
+ *   published view only for that walk, so no batch keeps a view pinned long enough to defer a commit.
+ * - When that task completes, the next ticker pass validates + commits every intention of the wave on the game thread
+ *   in one loop (CurrentIntention stays game-thread-only, exactly as before).
+ *
+ * One wave is in flight at a time; brains that fall due meanwhile simply wait for the next pass. Each brain's
+ * AsyncThinkTask is the wave task, so StopThinking/EndPlay still join the worker before the brain can be destroyed.
+ *
+ * Server-side by use (brains only StartThinking with authority); created for every game world like the party subsystem.
+ */
+UCLASS()
+class MYTHIC_API UMythicCognitionScheduler : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    //~ End USubsystem Interface
+
+    /**
+     * Add (or re-add) a brain. Its first think falls due InitialDelay seconds from now, then every Interval (quantized to
+     * ThinkIntervalQuantum). Re-registering an already-scheduled brain moves it to its new bucket/due time.
+     */
+    void RegisterBrain(UMythicCognitiveBrainComponent *Brain, float Interval, float InitialDelay);
+
+    /** Remove a brain from its bucket. Does NOT join an in-flight wave — StopThinking/EndPlay do that. */
+    void UnregisterBrain(UMythicCognitiveBrainComponent *Brain);
+
+    /** Pull a registered brain's next think forward to the next scheduler pass (significant nearby event). */
+    void RequestImmediateThink(UMythicCognitiveBrainComponent *Brain);
+
+    /** Registered brains across all buckets (debug/stats) */
+    int32 GetRegisteredBrainCount() const { return BrainBuckets.Num(); }
+
+    /** Live buckets (debug/stats) */
+    int32 GetBucketCount() const { return Buckets.Num(); }
+
+    /** Brains dispatched in the most recent wave (debug/stats) */
+    int32 GetLastWaveSize() const { return LastWaveSize; }
+
+    // ─── Pure helpers (static for tests) ─────────────────
+
+    /** Think-interval bucketing granularity (seconds) */
+    static constexpr float ThinkIntervalQuantum = 0.25f;
+
+    /** Round Interval to the nearest ThinkIntervalQuantum, never below one quantum */
+    static float QuantizeThinkInterval(float Interval);
+
+    /**
+     * Next due time after a think that was due at DueTime and dispatched at Now. Keeps the brain's phase (a looping
+     * timer's cadence) unless it fell a whole interval behind, in which case it re-phases to Now + Interval instead of
+     * bursting through the missed periods.
+     */
+    static double ComputeNextDueTime(double DueTime, double Now, float Interval);
+
+private:
+    /** One scheduled brain */
+    struct FThinkEntry {
+        TObjectKey<UMythicCognitiveBrainComponent> Brain;
+        double DueTime = 0.0;
+    };
+
+    /** All brains sharing one (interval, tier) — Queue ascending by DueTime */
+    struct FThinkBucket {
+        float Interval = 1.0f;
+        EMythicSignificanceTier Tier{};
+        TArray<FThinkEntry> Queue;
+    };
+
+    /** Core-ticker callback: commit a finished wave, then launch the next one */
+    bool Tick(float DeltaTime);
+
+    /** Validate + commit every brain of the finished wave on the game thread */
+    void CommitCompletedWave();
+
+    /** Find-or-add the bucket for (Interval, Tier) */
+    int32 FindOrAddBucket(float Interval, EMythicSignificanceTier Tier);
+
+    /** Sorted insert into a bucket's queue */
+    static void InsertByDueTime(FThinkBucket &Bucket, const FThinkEntry &Entry);
+
+    /** Remove Brain from bucket BucketIndex's queue; returns true if found */
+    bool RemoveFromBucket(int32 BucketIndex, const UMythicCognitiveBrainComponent *Brain);
+
+    TArray<FThinkBucket> Buckets;
+
+    /** Brain → index into Buckets */
+    TMap<TObjectKey<UMythicCognitiveBrainComponent>, int32> BrainBuckets;
+
+    /** The in-flight wave: its brains (weak for the commit pass), think time and background task */
+    TArray<TWeakObjectPtr<UMythicCognitiveBrainComponent>> WaveBrains;
+    double WaveWorldTime = 0.0;
+    UE::Tasks::FTask WaveTask;
+
+    int32 LastWaveSize = 0;
+
+    UPROPERTY()
+    TObjectPtr<UMythicCausalFabric> CausalFabric;
+
+    const UMythicLivingWorldSettings *Settings = nullptr;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
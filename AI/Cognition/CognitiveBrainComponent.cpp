@@ -1,8 +1,9 @@
 // Mythic Living World — Cognitive Brain Component Implementation
-// BDI brain for Tier 2-3 NPCs. Staggered think tick, personality-biased beliefs,
+// BDI brain for Tier 2-3 NPCs. Scheduler-batched thinks, personality-biased beliefs,
 // utility-scored desires, hysteretic intentions.
 
 #include "AI/Cognition/CognitiveBrainComponent.h"
+#include "AI/Cognition/CognitionScheduler.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/CausalFabric/CausalFabric.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h"
@@ -22,7 +23,6 @@
 #include "World/LivingWorld/Dialogue/MythicDialogueTypes.h"
 #include "World/LivingWorld/Chronicle/MythicWorldChronicleSubsystem.h" // EventTagToReadable for the {recent_event} var
 #include "World/LivingWorld/Settlements/MythicSettlement.h" // FMythicSettlementData for the {settlement_name} var
-#include "TimerManager.h"
 #include "Engine/GameInstance.h"
 
 DEFINE_LOG_CATEGORY(LogMythCognition);
@@ -32,10 +32,10 @@ DEFINE_LOG_CATEGORY(LogMythCognition);
 // ─────────────────────────────────────────────────────────────
 
 UMythicCognitiveBrainComponent::UMythicCognitiveBrainComponent() {
-    PrimaryComponentTick.bCanEverTick = false; // Uses timer, not tick
+    PrimaryComponentTick.bCanEverTick = false; // Driven by UMythicCognitionScheduler, not tick
     bWantsInitializeComponent = false;
     // Default to Idle (NOT the enum's first value Work) so a not-yet-thought / non-embodied brain never scores the
-    // Work-phase boost in ScoreFollowSchedule and routes to a default (0,0) WorkCell. Think() overwrites it.
+    // Work-phase boost in ScoreFollowSchedule and routes to a default (0,0) WorkCell. BeginScheduledThink overwrites it.
     CachedSchedulePhase = EMythicSchedulePhase::Idle;
 }
 
@@ -65,8 +65,8 @@ void UMythicCognitiveBrainComponent::BeginPlay() {
     Beliefs.Reserve(MaxBeliefsPerNPC);
     LastDesires.Reserve(DesireTypeCount);
 
-    // Arm the staggered think timer through the single shared arm site (the actor pool re-arms via StartThinking()
-    // on reuse, since BeginPlay does not re-run for a recycled actor).
+    // Register with the cognition scheduler through the single shared arm site (the actor pool re-arms via
+    // StartThinking() on reuse, since BeginPlay does not re-run for a recycled actor).
     StartThinking();
 }
 
@@ -83,26 +83,23 @@ void UMythicCognitiveBrainComponent::StartThinking() {
         return;
     }
 
-    // Stagger the think timer — a random offset prevents all NPCs (and all reused actors) from thinking on the same
+    // Stagger the first think — a random offset prevents all NPCs (and all reused actors) from thinking on the same
     // frame. Re-rolled on every arm so a recycled actor re-staggers rather than inheriting its predecessor's phase.
+    // The scheduler quantizes the interval into a shared bucket; the random delay keeps the per-brain phase.
     const float MinInterval = Settings->CognitiveThinkIntervalMin;
     const float MaxInterval = Settings->CognitiveThinkIntervalMax;
     ThinkInterval = FMath::RandRange(MinInterval, MaxInterval);
 
     const float InitialDelay = FMath::RandRange(0.0f, ThinkInterval);
 
-    World->GetTimerManager().SetTimer(
-        ThinkTimerHandle,
-        this,
-        &UMythicCognitiveBrainComponent::Think,
-        ThinkInterval,
-        /*bLoop=*/true,
-        InitialDelay);
+    if (UMythicCognitionScheduler *Scheduler = World->GetSubsystem<UMythicCognitionScheduler>()) {
+        Scheduler->RegisterBrain(this, ThinkInterval, InitialDelay);
+    }
 }
 
 void UMythicCognitiveBrainComponent::ResetForReuse() {
-    // Caller (AMythicNPCCharacter::SleepToPool) MUST have already run StopThinking() — which clears the think timer
-    // AND joins the in-flight async worker — before this point. With the worker joined, no other thread touches
+    // Caller (AMythicNPCCharacter::SleepToPool) MUST have already run StopThinking() — which unregisters from the
+    // scheduler AND joins the in-flight think wave — before this point. With the worker joined, no other thread touches
     // Beliefs/LastDesires, but we still take BeliefsLock to satisfy the documented invariant (and to be correct if a
     // future caller reorders). The remaining members are written only on the game thread.
     {
@@ -119,7 +116,9 @@ void UMythicCognitiveBrainComponent::ResetForReuse() {
 
 void UMythicCognitiveBrainComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
     if (UWorld *World = GetWorld()) {
-        World->GetTimerManager().ClearTimer(ThinkTimerHandle);
+        if (UMythicCognitionScheduler *Scheduler = World->GetSubsystem<UMythicCognitionScheduler>()) {
+            Scheduler->UnregisterBrain(this);
+        }
 
         // Remove the entity->actor reverse link on ANY actor teardown path (combat death, level/world teardown,
         // seamless travel, explicit Destroy) — not just the demotion despawn loop, which is the only OTHER site
@@ -134,7 +133,7 @@ void UMythicCognitiveBrainComponent::EndPlay(const EEndPlayReason::Type EndPlayR
         }
     }
 
-    // Join the in-flight background BDI task before destruction. Its body dereferences raw `this`
+    // Join the in-flight think wave before destruction. Its worker dereferences raw `this`
     // (PressureChannels[], Settings, Beliefs, Personality) on a worker thread; without this wait the component
     // can be GC'd mid-think on a no-delay teardown path → cross-thread use-after-free. Wait() is safe on the game
     // thread and the body is ~hundreds of ops, so the stall is negligible.
@@ -147,12 +146,14 @@ void UMythicCognitiveBrainComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 
 void UMythicCognitiveBrainComponent::StopThinking() {
     if (UWorld *World = GetWorld()) {
-        World->GetTimerManager().ClearTimer(ThinkTimerHandle);
+        if (UMythicCognitionScheduler *Scheduler = World->GetSubsystem<UMythicCognitionScheduler>()) {
+            Scheduler->UnregisterBrain(this);
+        }
     }
-    // Double-guard: any think tick already queued for this frame will see bInitialized=false and early-return.
+    // Double-guard: a scheduler gather that still reaches this brain sees bInitialized=false and skips it.
     bInitialized = false;
 
-    // Join any in-flight background BDI task so the worker is done touching `this` before the corpse is destroyed
+    // Join any in-flight think wave so the worker is done touching `this` before the corpse is destroyed
     // (StopThinking is the documented pre-corpse-destroy halt). A weak-pointer check alone is insufficient — the
     // object can be freed mid-body — so we block here on the game thread.
     if (AsyncThinkTask.IsValid() && !AsyncThinkTask.IsCompleted()) {
@@ -391,18 +392,12 @@ void UMythicCognitiveBrainComponent::InjectBeliefInternal(const FMythicBelief &B
 }
 
 void UMythicCognitiveBrainComponent::OnSignificantEvent(const FGameplayTag &EventTag, FMythicCellCoord EventCell) {
-    // Force immediate re-think
-    if (GetWorld()) {
-        GetWorld()->GetTimerManager().ClearTimer(ThinkTimerHandle);
-        Think();
-
-        // Re-arm the timer
-        GetWorld()->GetTimerManager().SetTimer(
-            ThinkTimerHandle,
-            this,
-            &UMythicCognitiveBrainComponent::Think,
-            ThinkInterval,
-            /*bLoop=*/true);
+    // Force a re-think on the scheduler's next pass (same frame or the next). A brain that isn't registered (never
+    // started, or StopThinking'd) stays halted.
+    if (UWorld *World = GetWorld()) {
+        if (UMythicCognitionScheduler *Scheduler = World->GetSubsystem<UMythicCognitionScheduler>()) {
+            Scheduler->RequestImmediateThink(this);
+        }
     }
 }
 
@@ -410,28 +405,26 @@ void UMythicCognitiveBrainComponent::OnSignificantEvent(const FGameplayTag &Even
 // Core BDI Loop
 // ─────────────────────────────────────────────────────────────
 
-void UMythicCognitiveBrainComponent::Think() {
-    TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitiveBrain_Think);
+bool UMythicCognitiveBrainComponent::BeginScheduledThink(double WorldTime, EMythicSignificanceTier &OutTier) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitiveBrain_BeginThink);
 
     if (!bInitialized || !CausalFabric || !FactionDB) {
-        return;
+        return false;
     }
 
-    // Skip if already thinking asynchronously
+    // Skip if the previous think's wave hasn't been committed yet
     if (bIsThinkingAsync.exchange(true)) {
-        return;
+        return false;
     }
 
-    const double WorldTime = GetWorld()->GetTimeSeconds();
-
     // Pull the live psychodynamic pressure from MASS into the brain's working array — on the GAME THREAD, BEFORE
-    // the async BDI task launches below. The lambda (UpdateBeliefs/ScoreDesires) reads PressureChannels[] off a
-    // background task, so the MASS EntityManager read must happen here (reading it inside the task would be an
-    // unsafe cross-thread access). The PressureProcessor writes FMythicPsychodynamicFragment::Pressure[] every sim
-    // tick; without this copy the entire emotional model (Fear/Grief/Despair -> desire utilities + the despair
-    // penalty) scores against all-zeros. Indexed by the shared PressureChannelCount so the arrays are guaranteed
-    // compatible (single source of truth). If the entity/fragment is absent (non-embodied), pressure stays zero —
-    // the legitimate empty state, not a fabricated value.
+    // the wave's background batches run. UpdateBeliefs/ScoreDesires read PressureChannels[] off a worker, so the
+    // MASS EntityManager read must happen here (reading it inside the wave would be an unsafe cross-thread access).
+    // The PressureProcessor writes FMythicPsychodynamicFragment::Pressure[] every sim tick; without this copy the
+    // entire emotional model (Fear/Grief/Despair -> desire utilities + the despair penalty) scores against all-zeros.
+    // Indexed by the shared PressureChannelCount so the arrays are guaranteed compatible (single source of truth). If
+    // the entity/fragment is absent (non-embodied), pressure stays zero — the legitimate empty state, not a
+    // fabricated value.
     if (SourceEntity.IsSet()) {
         if (UMassEntitySubsystem *Ess = UWorld::GetSubsystem<UMassEntitySubsystem>(GetWorld())) {
             if (Ess->GetEntityManager().IsEntityValid(SourceEntity)) {
@@ -448,48 +441,41 @@ void UMythicCognitiveBrainComponent::Think() {
                     CachedSchedulePhase = Schedule->Phase;
                     CachedWorkCell = Schedule->WorkCell;
                 }
+                // Tier for the scheduler's bucketing (a Tier2 embodied NPC recruited as a companion becomes Tier3).
+                if (const FMythicSignificanceFragment *Significance =
+                    Ess->GetEntityManager().GetFragmentDataPtr<FMythicSignificanceFragment>(SourceEntity)) {
+                    OutTier = Significance->Tier;
+                }
             }
         }
     }
+    return true;
+}
 
-    // Launch background task for heavy BDI evaluation
-    TWeakObjectPtr<UMythicCognitiveBrainComponent> WeakThis(this);
-    AsyncThinkTask = UE::Tasks::Launch(
-        TEXT("BDI_Think"),
-        [this, WorldTime, WeakThis]() {
-            {
-                // Hold BeliefsLock across the whole belief-touching pass: UpdateBeliefs decays/adds + ScoreDesires
-                // iterates Beliefs here on the worker, while the GAME thread may InjectBelief / GetBeliefsCopy. One
-                // coarse lock (contention is rare — only party rest-phase/betrayal) avoids a TArray realloc racing an
-                // iterator. UpdateBeliefs calls the lock-free InjectBeliefInternal (no recursion on this non-recursive lock).
-                FScopeLock BeliefsScope(&BeliefsLock);
-
-                // Step 1: Update beliefs from causal fabric (lock-free read)
-                UpdateBeliefs(WorldTime);
-
-                // Step 2: Score all desires
-                ScoreDesires(WorldTime);
-            }
+void UMythicCognitiveBrainComponent::ThinkBatch(TConstArrayView<UMythicCognitiveBrainComponent *> Batch,
+                                                const UMythicCausalFabric &Fabric, double WorldTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitiveBrain_ThinkBatch);
 
-            // Steps 3-4 (Validate + Commit) are deliberately NOT done here: they write CurrentIntention, which the
-            // game thread reads (AIController flee gate + the emotion-tag logic). Doing them on this worker would be
-            // a data race on CurrentIntention. They run in OnAsyncThinkCompleted on the game thread instead, so
-            // CurrentIntention is only ever touched on the game thread. LastDesires (written above) is read there
-            // too, safely, because this worker has finished before the completion task runs.
-            AsyncTask(ENamedThreads::GameThread, [WeakThis, WorldTime]() {
-                if (UMythicCognitiveBrainComponent *StrongThis = WeakThis.Get()) {
-                    StrongThis->OnAsyncThinkCompleted(WorldTime);
-                }
-            });
-        },
-        UE::Tasks::ETaskPriority::BackgroundNormal
-        );
+    // Steps 1-2 per brain: update beliefs, then score desires. UpdateBeliefs pins the fabric's published view only for
+    // its own cell walk and takes BeliefsLock after it, so no brain keeps a view pinned across a whole batch (which
+    // could defer a sim-thread commit). BeliefsLock guards Beliefs against the GAME thread's InjectBelief /
+    // GetBeliefsCopy while the worker decays / adds / scores here.
+    for (UMythicCognitiveBrainComponent *Brain : Batch) {
+        Brain->UpdateBeliefs(WorldTime, Fabric);
+        FScopeLock BeliefsScope(&Brain->BeliefsLock);
+        Brain->ScoreDesires(WorldTime);
+    }
+
+    // Steps 3-4 (Validate + Commit) are deliberately NOT done here: they write CurrentIntention, which the game
+    // thread reads (AIController flee gate + the emotion-tag logic). Doing them on this worker would be a data race
+    // on CurrentIntention. The scheduler runs them for the whole wave in its game-thread commit pass instead
+    // (OnAsyncThinkCompleted), after the wave task has finished — so LastDesires (written above) is read there safely.
 }
 
 void UMythicCognitiveBrainComponent::OnAsyncThinkCompleted(double WorldTime) {
     // Steps 3-4 on the GAME THREAD: validate + commit the intention here (not on the worker) so CurrentIntention is
     // only ever written on the game thread — the AIController + emotion-tag logic read it here. Do this BEFORE
-    // clearing bIsThinkingAsync, so a new Think() can't launch a worker that writes LastDesires while we read it.
+    // clearing bIsThinkingAsync, so a new wave can't pick this brain up and write LastDesires while we read it.
     ValidateIntention(WorldTime);
     CommitIntention(WorldTime);
 
@@ -544,63 +530,66 @@ void UMythicCognitiveBrainComponent::OnAsyncThinkCompleted(double WorldTime) {
     }
 }
 
-void UMythicCognitiveBrainComponent::UpdateBeliefs(double WorldTime) {
+void UMythicCognitiveBrainComponent::UpdateBeliefs(double WorldTime, const UMythicCausalFabric &Fabric) {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicCognitiveBrain_UpdateBeliefs);
 
-    if (!CausalFabric) {
-        return;
-    }
-
-    // Query recent events near home cell (personality biases which events are noticed)
-    TArray<FMythicWorldEvent> NearbyEvents;
-    CausalFabric->QueryEventsByCell(
+    // Visit recent events near home cell (personality biases which events are noticed). Zero-copy: the visitor reads
+    // the pinned view in place and keeps the noticed ones as candidate beliefs on the stack; they are merged into
+    // Beliefs under BeliefsLock only after the walk has returned, keeping the pin as short as the walk.
+    constexpr int32 MaxEventsPerThink = 8; // Budget: max 8 events per think
+    TArray<FMythicBelief, TInlineAllocator<MaxEventsPerThink>> Noticed;
+    int32 EventsSeen = 0;
+    Fabric.VisitEventsByCell(
         HomeCell,
         WorldTime - 120.0, // Look back 2 minutes
         WorldTime,
-        8, // Budget: max 8 events per think
-        NearbyEvents);
+        [&](const FMythicWorldEvent &Event) {
+            const bool bBudgetLeft = ++EventsSeen < MaxEventsPerThink;
 
-    for (const FMythicWorldEvent &EventRef : NearbyEvents) {
-        const FMythicWorldEvent *Event = &EventRef; // value copies (no ReadBuffer aliasing); ptr alias keeps body unchanged
+            // Personality bias: skip events that don't match this NPC's personality
+            // Fight-heavy personality notices combat; Tend-heavy notices healing
+            float RelevanceWeight = 0.3f; // Base relevance
 
-        // Personality bias: skip events that don't match this NPC's personality
-        // Fight-heavy personality notices combat; Tend-heavy notices healing
-        float RelevanceWeight = 0.3f; // Base relevance
+            if (Event.CategoryFlags & EMythicEventCategory::Combat) {
+                RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Fight)] * 0.5f;
+            }
+            if (Event.CategoryFlags & EMythicEventCategory::Crime) {
+                RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Enforce)] * 0.5f;
+                RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Report)] * 0.3f;
+            }
+            if (Event.CategoryFlags & EMythicEventCategory::Social) {
+                RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Rally)] * 0.3f;
+                RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Tend)] * 0.3f;
+            }
 
-        if (Event->CategoryFlags & EMythicEventCategory::Combat) {
-            RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Fight)] * 0.5f;
-        }
-        if (Event->CategoryFlags & EMythicEventCategory::Crime) {
-            RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Enforce)] * 0.5f;
-            RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Report)] * 0.3f;
-        }
-        if (Event->CategoryFlags & EMythicEventCategory::Social) {
-            RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Rally)] * 0.3f;
-            RelevanceWeight += Personality.VentWeights[static_cast<int32>(EMythicVentChannel::Tend)] * 0.3f;
-        }
+            // Only form belief if relevance passes threshold (personality filter)
+            if (RelevanceWeight < 0.4f) {
+                return bBudgetLeft;
+            }
 
-        // Only form belief if relevance passes threshold (personality filter)
-        if (RelevanceWeight < 0.4f) {
-            continue;
-        }
+            FMythicBelief NewBelief;
+            NewBelief.EventTag = Event.EventTag;
+            NewBelief.Cell = Event.Cell;
+            NewBelief.InvolvedFaction = Event.PrimaryFaction;
+            NewBelief.Confidence = FMath::Clamp(Event.Significance * RelevanceWeight, 0.1f, 1.0f);
+            NewBelief.FormationTime = WorldTime;
+            NewBelief.LastDecayTime = WorldTime; // decay against the delta since this, NOT the full age (see the decay loop)
+            NewBelief.PropagationHops = 0;
+            NewBelief.SourceEventId = Event.EventId;
+
+            // Spy routing: Spies evaluate events based on their true faction's stance,
+            // rather than their cover faction.
+            if (TrueFaction.IsValid() && TrueFaction != Faction) {
+                NewBelief.InvolvedFaction = TrueFaction;
+            }
 
-        FMythicBelief NewBelief;
-        NewBelief.EventTag = Event->EventTag;
-        NewBelief.Cell = Event->Cell;
-        NewBelief.InvolvedFaction = Event->PrimaryFaction;
-        NewBelief.Confidence = FMath::Clamp(Event->Significance * RelevanceWeight, 0.1f, 1.0f);
-        NewBelief.FormationTime = WorldTime;
-        NewBelief.LastDecayTime = WorldTime; // decay against the delta since this, NOT the full age (see the decay loop)
-        NewBelief.PropagationHops = 0;
-        NewBelief.SourceEventId = Event->EventId;
-
-        // Spy routing: Spies evaluate events based on their true faction's stance,
-        // rather than their cover faction.
-        if (TrueFaction.IsValid() && TrueFaction != Faction) {
-            NewBelief.InvolvedFaction = TrueFaction;
-        }
+            Noticed.Add(NewBelief);
+            return bBudgetLeft;
+        });
 
-        InjectBeliefInternal(NewBelief); // already under BeliefsLock (held across the whole think on the worker)
+    FScopeLock BeliefsScope(&BeliefsLock);
+    for (const FMythicBelief &NewBelief : Noticed) {
+        InjectBeliefInternal(NewBelief);
     }
 
     // Decay old beliefs by the time DELTA since their last decay, NOT the full age — otherwise the per-tick exp(-rate*age)
@@ -876,22 +865,20 @@ float UMythicCognitiveBrainComponent::ScoreJoinPlayer(double WorldTime) const {
 
     // ---- Factor 1: Social connection to a player ----
     // Check if any edge connected to this NPC involves a player entity (via Debt or Friend relation)
-    TArray<FMythicSocialEdge> AllEdges;
-    SocialGraph->GetEdges(SourceEntity, WorldTime, AllEdges);
-
     float BestPlayerRelationStrength = 0.0f;
     bool bHasLifeDebt = false;
-    for (const FMythicSocialEdge &Edge : AllEdges) {
+    SocialGraph->VisitEdges(SourceEntity, WorldTime, [&](const FMythicSocialEdge &Edge, float Strength) {
         // In a full implementation, we'd check if Edge.TargetEntity is a player.
         // For now, Debt edges and strong Friend edges contribute.
         if (Edge.Relation == EMythicSocialRelation::Debt) {
             bHasLifeDebt = true;
-            BestPlayerRelationStrength = FMath::Max(BestPlayerRelationStrength, Edge.Strength);
+            BestPlayerRelationStrength = FMath::Max(BestPlayerRelationStrength, Strength);
         }
-        else if (Edge.Relation == EMythicSocialRelation::Friend && Edge.Strength > 0.6f) {
-            BestPlayerRelationStrength = FMath::Max(BestPlayerRelationStrength, Edge.Strength);
+        else if (Edge.Relation == EMythicSocialRelation::Friend && Strength > 0.6f) {
+            BestPlayerRelationStrength = FMath::Max(BestPlayerRelationStrength, Strength);
         }
-    }
+        return true;
+    });
 
     // No social connection to anyone meaningful = no interest in joining
     if (BestPlayerRelationStrength < 0.1f) {
@@ -939,23 +926,21 @@ float UMythicCognitiveBrainComponent::ScoreFlee(double WorldTime) const {
 
     // Sacrifice override: if loyalty to a nearby entity is high, we might sacrifice self-preservation
     if (Settings && SocialGraph) {
-        TArray<FMythicSocialEdge> SocialEdges;
         // Use the game-thread-captured WorldTime param — NOT GetWorld()->GetTimeSeconds(), which would read UWorld
         // state off the BDI worker thread (a non-atomic cross-thread read / UB). Matches ScoreJoinPlayer.
-        if (SocialGraph->GetEdges(SourceEntity, WorldTime, SocialEdges)) {
-            for (const FMythicSocialEdge &Edge : SocialEdges) {
-                // Suppress flee to defend kin, life-debtors, and friends. (The prior static_cast<EMythicSocialRelation>(1)
-                // "LifeDebt" was a magic-ordinal bug: 1 is Family, while a life debt is Debt(=3) — so debtors never
-                // triggered self-sacrifice, unlike the companion scorer above which correctly uses the named Debt.)
-                if (Edge.Relation == EMythicSocialRelation::Debt || Edge.Relation == EMythicSocialRelation::Family ||
-                    Edge.Relation == EMythicSocialRelation::Friend) {
-                    if (Edge.Strength > Settings->SacrificeThreshold) {
-                        FleeScore *= 0.1f; // Suppress flee to defend the friend
-                        break;
-                    }
+        SocialGraph->VisitEdges(SourceEntity, WorldTime, [&](const FMythicSocialEdge &Edge, float Strength) {
+            // Suppress flee to defend kin, life-debtors, and friends. (The prior static_cast<EMythicSocialRelation>(1)
+            // "LifeDebt" was a magic-ordinal bug: 1 is Family, while a life debt is Debt(=3) — so debtors never
+            // triggered self-sacrifice, unlike the companion scorer above which correctly uses the named Debt.)
+            if (Edge.Relation == EMythicSocialRelation::Debt || Edge.Relation == EMythicSocialRelation::Family ||
+                Edge.Relation == EMythicSocialRelation::Friend) {
+                if (Strength > Settings->SacrificeThreshold) {
+                    FleeScore *= 0.1f; // Suppress flee to defend the friend
+                    return false;
                 }
             }
-        }
+            return true;
+        });
     }
 
     return FleeScore;
@@ -965,7 +950,7 @@ float UMythicCognitiveBrainComponent::ScoreRest(double WorldTime) const {
     // Rises sharply during the Rest schedule phase (night) so an idle NPC commits to Rest — the AI controller's idle
     // dispatch then routes it to its HomeCell (Rest's TargetCell, populated in ScoreDesires). A real combat/threat
     // desire (Survive/Flee/Defend) still scores higher and overrides it. CachedSchedulePhase is copied on the game
-    // thread in Think(). Low baseline outside the Rest phase.
+    // thread in BeginScheduledThink. Low baseline outside the Rest phase.
     if (CachedSchedulePhase == EMythicSchedulePhase::Rest) {
         return 0.8f;
     }
@@ -1023,6 +1008,6 @@ float UMythicCognitiveBrainComponent::ScoreFollowSchedule(double WorldTime) cons
     // Rises during the Work schedule phase so an idle NPC commits to it + the AI controller routes it to its WorkCell
     // (FollowSchedule's TargetCell, populated in ScoreDesires). A real threat (Survive/Flee/Defend) still outscores it.
     // Outside the Work phase it stays a near-zero baseline so it never wins idle arbitration with a stale/unset
-    // WorkCell (which would steer to (0,0)). CachedSchedulePhase is copied on the game thread in Think().
+    // WorkCell (which would steer to (0,0)). CachedSchedulePhase is copied on the game thread in BeginScheduledThink.
     return (CachedSchedulePhase == EMythicSchedulePhase::Work) ? 0.7f : 0.05f;
 }
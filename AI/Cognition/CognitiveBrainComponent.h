@@ -1,6 +1,6 @@
 // Mythic Living World — Cognitive Brain Component
 // BDI (Beliefs-Desires-Intentions) brain for Tier 2-3 cognitive NPC actors.
-// Attaches to AMythicNPCCharacter. Think tick is staggered across actors.
+// Attaches to AMythicNPCCharacter. Thinks are batched across actors by UMythicCognitionScheduler.
 
 #pragma once
 
@@ -22,16 +22,16 @@ enum class EMythicSchedulePhase : uint8;
  * BDI cognitive brain attached to Tier 2-3 NPC actors.
  *
  * Architecture:
- * - Think() runs on a staggered timer (0.5-2.0s, configurable)
+ * - Thinks are driven by UMythicCognitionScheduler at a staggered per-brain interval (0.5-2.0s, configurable)
  * - Belief layer queries the Causal Fabric with personality-weighted filtering
  * - Desire layer scores each desire type via utility functions
  * - Intention layer commits the highest-utility desire with hysteresis
  * - Execution communicates to the behavior system via gameplay tags
  *
  * Performance:
- * - NOT a tick component — uses FTimerHandle for staggered think
+ * - NOT a tick component and owns no timer — the scheduler batches due brains into one background wave per pass
  * - Max 30 cognitive actors at once (budgeted by LivingWorldSettings::MaxCognitiveActors)
- * - Each Think() is O(beliefs × desires) = O(16 × 13) = ~200 operations
+ * - Each think is O(beliefs × desires) = O(16 × 13) = ~200 operations
  * - Total per-frame cost distributed across ~15 actors per second at 0.5s interval
  */
 UCLASS(ClassGroup=(LivingWorld), meta=(BlueprintSpawnableComponent))
@@ -117,7 +117,7 @@ public:
     // ─── Debug context (game-thread cached identity/schedule) ─────────────────
     // These expose write-once / game-thread-cached members for the gameplay debugger's Cognition pane. No lock: Role,
     // Faction, TrueFaction, HomeCell are write-once at InitializeBrain; CachedSchedulePhase/CachedWorkCell are written
-    // on the GAME thread in Think() (same thread the debugger's CollectData runs on). Race-free reads.
+    // on the GAME thread in BeginScheduledThink (same thread the debugger's CollectData runs on). Race-free reads.
 
     /** True if this NPC is a spy (its public Faction differs from its TrueFaction). */
     bool IsSpyBrain() const { return TrueFaction.IsValid() && TrueFaction.Index != Faction.Index; }
@@ -131,10 +131,10 @@ public:
     /** The brain's home cell (Rest anchor). */
     FMythicCellCoord GetHomeCell() const { return HomeCell; }
 
-    /** Game-thread-cached schedule phase copied from the entity's FMythicScheduleFragment in Think(). */
+    /** Game-thread-cached schedule phase copied from the entity's FMythicScheduleFragment in BeginScheduledThink. */
     EMythicSchedulePhase GetCachedSchedulePhase() const { return CachedSchedulePhase; }
 
-    /** Game-thread-cached work destination cell copied from the schedule fragment in Think(). */
+    /** Game-thread-cached work destination cell copied from the schedule fragment in BeginScheduledThink. */
     FMythicCellCoord GetCachedWorkCell() const { return CachedWorkCell; }
 
     /** Get the MASS entity this NPC was promoted from */
@@ -160,20 +160,20 @@ public:
 
     /**
      * Notify the brain that a significant event occurred nearby.
-     * This forces an immediate re-think (bypasses the timer).
+     * Pulls its next think forward to the scheduler's next pass (and restarts its cadence from there).
      */
     void OnSignificantEvent(const FGameplayTag &EventTag, FMythicCellCoord EventCell);
 
     /**
      * SERVER: halt the think loop immediately (used when the embodied NPC dies, before its corpse is destroyed).
-     * Clears the think timer so no new ticks fire and flips bInitialized=false so any already-queued tick
-     * early-returns, then JOINS the in-flight async think task (AsyncThinkTask.Wait()) so the background worker is
-     * guaranteed to have finished dereferencing `this` before destruction (EndPlay does the same).
+     * Unregisters from the cognition scheduler so no new thinks are dispatched and flips bInitialized=false so a
+     * gather already underway skips it, then JOINS the in-flight think wave (AsyncThinkTask.Wait()) so the background
+     * worker is guaranteed to have finished dereferencing `this` before destruction (EndPlay does the same).
      */
     void StopThinking();
 
     /**
-     * SERVER: (re-)arm the staggered think timer. The SINGLE timer-arm site — BeginPlay calls this on first life and
+     * SERVER: (re-)register with the cognition scheduler. The SINGLE arm site — BeginPlay calls this on first life and
      * the actor pool's WakeFromPool calls it again on reuse (BeginPlay does NOT re-run for a recycled actor). Picks a
      * fresh ThinkInterval in [CognitiveThinkIntervalMin, Max] with a random initial delay so reused actors re-stagger
      * instead of all thinking on the same frame. No-op (with a warning at the BeginPlay call) if the living-world
@@ -192,17 +192,31 @@ public:
     void ResetForReuse();
 
 private:
+    friend class UMythicCognitionScheduler;
+
     // ─── Core BDI Loop ────────────────────────────────────
 
-    /** Main think function. Called on staggered timer. */
-    void Think();
+    /**
+     * Scheduler gather step (GAME thread): copy the MASS-owned inputs the off-thread scorers read (pressure, schedule
+     * phase/work cell) and claim the async-think flag. Returns false if this brain should not think this pass (not
+     * initialized, or a previous think still in flight). OutTier receives the entity's current significance tier (left
+     * unchanged when there is no entity/fragment) so the scheduler can re-bucket it.
+     */
+    bool BeginScheduledThink(double WorldTime, EMythicSignificanceTier &OutTier);
+
+    /**
+     * Scheduler worker step: one contiguous batch of a think wave (background thread). Each brain updates its beliefs
+     * (one short fabric walk of its own) and scores its desires; its BeliefsLock is held around its own belief-touching
+     * work, exactly as the per-brain task did.
+     */
+    static void ThinkBatch(TConstArrayView<UMythicCognitiveBrainComponent *> Batch, const UMythicCausalFabric &Fabric,
+                           double WorldTime);
 
-    /** Update beliefs by querying the causal fabric with personality bias */
-    void UpdateBeliefs(double WorldTime);
+    /** Update beliefs by walking the causal fabric with personality bias. Takes BeliefsLock itself, after the walk. */
+    void UpdateBeliefs(double WorldTime, const UMythicCausalFabric &Fabric);
 
     /** Lock-free belief insertion (dedup-merge / evict-weakest / add). The CALLER must hold BeliefsLock — the public
-     *  InjectBelief() wraps this with the lock for game-thread callers; the think worker calls it under the coarse
-     *  BeliefsLock it already holds around UpdateBeliefs/ScoreDesires. */
+     *  InjectBelief() wraps this with the lock for game-thread callers; UpdateBeliefs calls it under its own. */
     void InjectBeliefInternal(const FMythicBelief &Belief);
 
     /** Score all desire types and populate the desires array */
@@ -214,9 +228,9 @@ private:
     /** Check if the current intention should be abandoned (timeout, invalid target) */
     void ValidateIntention(double WorldTime);
 
-    /** Called on the game thread when the async Think task completes. Runs Validate+Commit (which write
-     *  CurrentIntention) here so that struct is only ever touched on the game thread. WorldTime is the Think-time
-     *  stamp, threaded through so commit hysteresis/timeout match the scoring pass. */
+    /** Called on the game thread by the scheduler's commit pass once this brain's think wave completes. Runs
+     *  Validate+Commit (which write CurrentIntention) here so that struct is only ever touched on the game thread.
+     *  WorldTime is the wave's think-time stamp, threaded through so commit hysteresis/timeout match the scoring pass. */
     void OnAsyncThinkCompleted(double WorldTime);
 
     // ─── Utility Scoring Functions ────────────────────────
@@ -256,13 +270,13 @@ private:
     FMassEntityHandle SourceEntity;
     float PressureChannels[PressureChannelCount] = {};
 
-    // Cached schedule phase, copied from the entity's FMythicScheduleFragment on the GAME thread in Think() (same
+    // Cached schedule phase, copied from the entity's FMythicScheduleFragment on the GAME thread in BeginScheduledThink (same
     // cross-thread-safe pattern as PressureChannels above) so the async scorers (ScoreRest/ScoreFollowSchedule) can
     // read it without racing the MASS ScheduleTransitionProcessor that writes it every sim tick. Defaults to the
-    // first enumerator for non-embodied NPCs (no schedule); Think() overwrites it for embodied ones.
+    // first enumerator for non-embodied NPCs (no schedule); BeginScheduledThink overwrites it for embodied ones.
     EMythicSchedulePhase CachedSchedulePhase{};
 
-    // Cached work destination, copied from the entity's FMythicScheduleFragment alongside the phase in Think(). The
+    // Cached work destination, copied from the entity's FMythicScheduleFragment alongside the phase. The
     // FollowSchedule desire targets this during the Work phase (HomeCell — the brain's own member — covers Rest).
     FMythicCellCoord CachedWorkCell;
 
@@ -276,15 +290,14 @@ private:
     TArray<FMythicDesire> LastDesires;
     FMythicIntention CurrentIntention;
 
-    /** Handle to the currently running async think task */
+    /** The scheduler wave this brain's current think belongs to (shared by every brain in that wave) */
     UE::Tasks::FTask AsyncThinkTask;
 
-    /** If true, an async think task is currently running */
+    /** If true, this brain is in a think wave that has not been committed yet */
     std::atomic<bool> bIsThinkingAsync{false};
 
-    // ─── Timer ────────────────────────────────────────────
+    // ─── Scheduling ───────────────────────────────────────
 
-    FTimerHandle ThinkTimerHandle;
     float ThinkInterval = 1.0f;
     bool bInitialized = false;
 };
@@ -19,6 +19,7 @@
 #include "Player/MythicPlayerRegistrySubsystem.h" // resolve leader canonical key -> pawn
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"          // ActivityCatalog soft-ptr (Step 3)
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h" // live-cell refresh re-buckets the entity
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Settlements/MythicSettlement.h" // FMythicSettlementData (Socialize -> settlement centre)
@@ -794,6 +795,10 @@ void AMythicAIController::RefreshLiveCell() {
     FMythicIdentityFragment &Identity = EntityManager.GetFragmentDataChecked<FMythicIdentityFragment>(SourceEntity);
     if (Identity.Cell.X != NewCell.X || Identity.Cell.Y != NewCell.Y) {
         Identity.Cell = NewCell;
+        // Keep the shared cell index in step with the embodied body (one of its two runtime movers).
+        if (UMythicCellEntityIndexSubsystem *CellIndex = GetWorld()->GetSubsystem<UMythicCellEntityIndexSubsystem>()) {
+            CellIndex->MoveEntity(SourceEntity, NewCell);
+        }
         // Tie the proximity rescore to the cell change: SignificanceProcessor only recomputes ProximityScore for bDirty
         // entities, and nothing else dirties on movement (the existing dirties are event-driven). Cheap — boundary only.
         if (FMythicSignificanceFragment *Sig = EntityManager.GetFragmentDataPtr<FMythicSignificanceFragment>(SourceEntity)) {
@@ -234,10 +234,10 @@ void AMythicNPCCharacter::SleepToPool() {
         return;
     }
 
-    // (2) Halt cognition FIRST. StopThinking() clears the think timer AND joins the in-flight async BDI worker, so by
-    //     the time the steps below tear down GAS / clear beliefs, no background thread is still dereferencing `this`.
-    //     A creature's brain is never InitializeBrain'd, but StopThinking is a safe no-op then (clears an empty timer,
-    //     waits on an invalid task).
+    // (2) Halt cognition FIRST. StopThinking() unregisters from the cognition scheduler AND joins the in-flight think
+    //     wave, so by the time the steps below tear down GAS / clear beliefs, no background thread is still
+    //     dereferencing `this`. A creature's brain is never InitializeBrain'd, but StopThinking is a safe no-op then
+    //     (unregisters nothing, waits on an invalid task).
     if (CognitiveBrain) {
         CognitiveBrain->StopThinking();
     }
@@ -330,7 +330,7 @@ AMythicNPCCharacter::AMythicNPCCharacter() {
     // which already defaults bCanEverTick=false). All AI is fully timer-driven and self-throttling, NOT per-frame:
     //   - AMythicAIController: Idle / Attack / Companion-follow run on IdleTimerHandle / AttackTimerHandle /
     //     FollowTimerHandle (the "Tick*" method names there are timer callbacks, not engine tick).
-    //   - UMythicCognitiveBrainComponent: PrimaryComponentTick.bCanEverTick=false; the BDI loop runs on ThinkTimerHandle.
+    //   - UMythicCognitiveBrainComponent: PrimaryComponentTick.bCanEverTick=false; the BDI loop is driven by UMythicCognitionScheduler.
     // CharacterMovementComponent ticks on its OWN component tick (independent of the actor's bCanEverTick), so locomotion
     // and animation are unaffected — this only removes a dead per-actor tick that would otherwise scale with embodied
     // NPC count. WakeFromPool's SetActorTickEnabled(PrimaryActorTick.bCanEverTick) therefore becomes a no-op for the base
@@ -1072,7 +1072,8 @@ FMassEntityHandle UMythicPartySubsystem::CreateLoadedCompanionEntity(const FMyth
     FMassArchetypeHandle Archetype = EntityManager.CreateArchetype(MakeArrayView(Composition));
 
     TArray<FMassEntityHandle> Spawned;
-    EntityManager.BatchCreateEntities(Archetype, 1, Spawned);
+    // Held until the fragments below are written — the cell-index observers fire on its release.
+    const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = EntityManager.BatchCreateEntities(Archetype, 1, Spawned);
     if (Spawned.Num() != 1) { return FMassEntityHandle(); }
     const FMassEntityHandle Entity = Spawned[0];
 
@@ -37,6 +37,8 @@
 #include "World/LivingWorld/Encounters/EncounterDirector.h"
 #include "World/LivingWorld/Encounters/EncounterTemplate.h"
 #include "World/LivingWorld/Persistence/PersistentNPCRegistry.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldTelemetrySubsystem.h"
 
 #include "World/EnvironmentController/MythicEnvironmentSubsystem.h"
 #include "World/EnvironmentController/MythicEnvironmentController.h"
@@ -868,6 +870,50 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
             NpcMgr->GetActiveNPCCount(), NpcMgr->GetCachedNPCCount(),
             NpcMgr->GetActiveFamilyCount(), NpcMgr->GetCachedFamilyCount(), NpcMgr->GetPooledNPCCount());
     }
+    // #9b EMBODIMENT POOL (server; predictive time-sliced warmer — hit rate, warm cost, per-archetype parked/target).
+    {
+        const FMythicEmbodimentPoolStats &Pool = LW->GetEmbodimentPoolStats();
+        const int32 Acquires = Pool.Hits + Pool.Misses;
+        Header += FString::Printf(
+            TEXT("{white}EmbodyPool: hit {green}%d{white} miss {red}%d{white} (%s%.0f%%{white}) warmed {yellow}%d{white} in {yellow}%.1fms{white} (last %.2f peak %.2f) trimmed {grey}%d{white} | NPC %d/%d Creature %d/%d\n"),
+            Pool.Hits, Pool.Misses, Acquires > 0 && Pool.Misses * 4 > Acquires ? TEXT("{red}") : TEXT("{green}"),
+            Acquires > 0 ? 100.0 * Pool.Hits / Acquires : 100.0, Pool.Warmed, Pool.WarmMs, Pool.LastTickWarmMs,
+            Pool.PeakTickWarmMs, Pool.Trimmed, Pool.HumanoidParked, Pool.HumanoidTarget, Pool.CreatureParked, Pool.CreatureTarget);
+    }
+    // #9c SIGNIFICANCE (server; ranked promotion — totals, hot-set swaps, last-pass candidates/backlog and cost).
+    {
+        const FMythicSignificanceStats &Sig = LW->GetSignificanceStats();
+        Header += FString::Printf(
+            TEXT("{white}Significance: promoted {green}%d{white} demoted {yellow}%d{white} swapped {yellow}%d{white} | last pass %d cand, backlog %s%d{white}, %.2fms (peak %.2f)\n"),
+            Sig.Promotions, Sig.Demotions, Sig.Swaps, Sig.LastCandidates,
+            Sig.LastBacklog > 0 ? TEXT("{red}") : TEXT("{green}"), Sig.LastBacklog, Sig.LastPassMs, Sig.PeakPassMs);
+    }
+    // #9d PERF TELEMETRY (world subsystem; the same numbers as `stat MythicLivingWorld` / the CSV category, plus
+    // histogram p95s). Lanes print units done / budget for each processor that has reported a pass.
+    if (const UMythicLivingWorldTelemetrySubsystem *Telemetry = World->GetSubsystem<UMythicLivingWorldTelemetrySubsystem>()) {
+        const FMythicLivingWorldTelemetry &T = Telemetry->GetLatest();
+        Header += FString::Printf(
+            TEXT("{white}Perf: sim {yellow}%.2fms{white} (p95 %.2f, commit %.2f) | lock wait %s%.2fms{white} x%d (p99 %.2f) | fabric %.1f ev/s, %.1fKB/commit, %d q/frame | tiers %d/%d/%d/%d\n"),
+            T.SimTickMs, Telemetry->GetSimTickHistogram().GetPercentile(0.95), T.SimCommitMs,
+            T.SimLockWaitMs > 1.0f ? TEXT("{red}") : TEXT("{green}"), T.SimLockWaitMs, T.SimLockContended,
+            Telemetry->GetSimLockWaitHistogram().GetPercentile(0.99), T.FabricAppendsPerSecond, T.FabricCommitKB, T.FabricQueries,
+            T.TierPopulation[0], T.TierPopulation[1], T.TierPopulation[2], T.TierPopulation[3]);
+    }
+    if (const UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>()) {
+        FString Lanes;
+        for (int32 l = 0; l < static_cast<int32>(EMythicLivingWorldBudgetLane::Count); ++l) {
+            const EMythicLivingWorldBudgetLane Lane = static_cast<EMythicLivingWorldBudgetLane>(l);
+            if (Budgets->GetLaneReportCount(Lane) == 0) {
+                continue;
+            }
+            const int32 Done = Budgets->GetLaneUnitsDone(Lane);
+            const int32 Budget = Budgets->GetLaneBudget(Lane);
+            Lanes += FString::Printf(TEXT(" %s %s%d{white}/%d"), UMythicLivingWorldBudgetSubsystem::GetLaneName(Lane),
+                                     Done >= Budget ? TEXT("{yellow}") : TEXT("{green}"), Done, Budget);
+        }
+        Header += FString::Printf(TEXT("{white}Budgets (%s, %.2f/%.2fms):%s\n"), Budgets->IsAdapting() ? TEXT("adaptive") : TEXT("static"),
+                                  Budgets->GetProjectedMs(), Budgets->GetEffectiveBudgetMs(), Lanes.IsEmpty() ? TEXT(" -") : *Lanes);
+    }
     // #10 GAME DIRECTOR STREAMING (a LocalPlayerSubsystem — viewing client only; null-guarded).
     if (const ULocalPlayer *LP = OwnerPC->GetLocalPlayer()) {
         if (const UMythicGameDirectorSubsystem *GD = LP->GetSubsystem<UMythicGameDirectorSubsystem>()) {
@@ -973,7 +1019,7 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
     if (bShowEvents) {
         // Causal events.
         if (UMythicCausalFabric *Fabric = LW->GetCausalFabric()) {
-            const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(20); // copy under FabricLock
+            const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(20); // pinned-view copy
             for (const FMythicWorldEvent &Ev : Recent) {
                 if (ShapesDrawn >= GMaxShapes) {
                     break;
@@ -1183,7 +1229,7 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
             break;
         }
         Detail += TEXT("{white}Legend: {green}A=Allied/F=Friendly {white}N=Neutral {yellow}u=Unfriendly {red}H=Hostile\n");
-        // Pass 1: collect ids+names WITHOUT nesting a second DB read (SnapshotLock held across this callback).
+        // Pass 1: collect ids+names, then build the matrix from the copied list (keeps the callback trivial).
         struct FFac {
             FMythicFactionId Id;
             FString Name;
@@ -1192,7 +1238,7 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
         FDB->ForEachAliveFaction([&Facs](FMythicFactionId Id, const FMythicFactionData &D) { Facs.Add({Id, D.DisplayName.ToString()}); });
         static const TCHAR *RelGlyph[] = {TEXT("A"), TEXT("F"), TEXT("N"), TEXT("u"), TEXT("H")};
         static const TCHAR *RelColor[] = {TEXT("{green}"), TEXT("{green}"), TEXT("{white}"), TEXT("{yellow}"), TEXT("{red}")};
-        // Pass 2: build the matrix (each GetRelationship locks independently — no nesting).
+        // Pass 2: build the matrix (each GetRelationship is a lock-free snapshot read).
         for (int32 r = 0; r < Facs.Num(); ++r) {
             FString Row = FString::Printf(TEXT("{white}[%d] %s : "), Facs[r].Id.Index, *Facs[r].Name);
             int32 Allies = 0;
@@ -1507,7 +1553,7 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
         Detail += TEXT("{white}=== DETAIL: CAUSAL EVENTS ===\n");
         if (UMythicCausalFabric *Fabric = LW->GetCausalFabric()) {
             const int32 MaxRecent = 14;
-            const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(MaxRecent); // copy under FabricLock, oldest-first
+            const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(MaxRecent); // pinned-view copy, oldest-first
             Detail += FString::Printf(TEXT("{white}Total ever: {yellow}%u{white}  capacity: {yellow}%d{white}  showing last {yellow}%d{white}\n"),
                                       Fabric->GetTotalEventCount(), Fabric->GetCapacity(), Recent.Num());
             for (int32 i = Recent.Num() - 1; i >= 0; --i) { // print newest first
@@ -1986,6 +2032,8 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
                     WarMap->GetGridWidth(), WarMap->GetGridHeight(), WarMap->GetAccumulatedClaimedCellCount(),
                     WarMap->GetLastSettlementMarkerCount(), WarMap->GetLastEncounterMarkerCount(),
                     WarMap->GetLastLegendEntryCount());
+                Detail += FString::Printf(TEXT("  {white}dirty rects {yellow}%d{white}  last upload {yellow}%d{white} texels\n"),
+                                          WarMap->GetPendingDirtyRectCount(), WarMap->GetLastUploadedTexelCount());
                 // Cells per faction (from the legend; bounded by the active faction count).
                 TArray<FMythicWarMapLegendEntry> Legend;
                 WarMap->GetLegendEntries(Legend);
@@ -2062,7 +2110,7 @@ void FGameplayDebuggerCategory_MythicLivingWorld::CollectData(APlayerController
         // ── (2) CONTESTED-BORDER GARRISON TARGETS — re-derive, read-only, the per-cell soldier target the patrol spawner
         //    computes (ownership×influence×biome, then the at-war contested-border boost) over a small window around the
         //    player so a war's frontline thickening is visible. Mirrors TerritoryPatrolSpawnerProcessor's probe EXACTLY:
-        //    lock-free GetCell value-copies + GetRelationship (SnapshotLock) + the SAME static helpers it spawns from. We
+        //    lock-free GetCell value-copies + GetRelationship (faction snapshot) + the SAME static helpers it spawns from. We
         //    do NOT spawn — pure surfacing. Bounded to a 7x7 window, contested cells reported first. ──
         if (bHasPlayerCell && FDB) {
             static const FMythicCellCoord NeighborOffsets[4] = {
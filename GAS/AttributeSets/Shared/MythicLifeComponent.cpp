@@ -24,6 +24,7 @@
 #include "AbilitySystemGlobals.h"
 #include "AI/Cognition/CognitiveBrainComponent.h"
 #include "AI/Party/PartySubsystem.h" // companion loyalty reacts to player kills (OnPlayerAction)
+#include "MythicLifeRegenSubsystem.h"    // batched Health / Shield / Stamina regen
 #include "Player/MythicPlayerState.h"
 #include "Itemization/Inventory/MythicEncumbrance.h"        // ComputeTier / SpeedMultiplierForTier (carry-weight slow)
 #include "Itemization/Inventory/MythicInventoryComponent.h" // GetTotalCarriedWeight
@@ -121,12 +122,19 @@ void UMythicLifeComponent::InitializeWithAbilitySystem(UAbilitySystemComponent *
 
     // Encumbrance: recompute move speed when carried weight changes, not only on CC events. This init runs post-
     // possession (the ASC/avatar is ready), so the owner's controller + inventory provider exist for a player; binds
-    // are skipped (no-op) for an owner with no inventory provider (NPC). Re-init re-binds cleanly (Unbind-first).
+    // are skipped (no-op) for an owner with no inventory provider (NPC). Re-init re-binds cleanly (Unbind-first). A
+    // new controller (re-possession without a re-init) re-binds through HandleOwnerControllerChanged.
     BindEncumbranceInventoryDelegates();
+    EncumbranceSpeedScale = ComputeEncumbranceSpeedScale();
+    if (APawn *OwnerPawn = Cast<APawn>(GetOwner())) {
+        OwnerPawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &ThisClass::HandleOwnerControllerChanged);
+    }
 
-    // Start the server-side regen tick (Health / Shield / Stamina toward max).
+    // Join the server-side batched regen pass (Health / Shield / Stamina toward max).
     if (GetOwner()->HasAuthority() && RegenInterval > 0.0f && GetWorld()) {
-        GetWorld()->GetTimerManager().SetTimer(RegenTimerHandle, this, &ThisClass::ApplyRegen, RegenInterval, true);
+        if (UMythicLifeRegenSubsystem *Regen = GetWorld()->GetSubsystem<UMythicLifeRegenSubsystem>()) {
+            Regen->RegisterLife(this, RegenInterval);
+        }
     }
 
     auto HealthAttr = UMythicAttributeSet_Life::GetHealthAttribute();
@@ -167,9 +175,12 @@ void UMythicLifeComponent::UninitializeFromAbilitySystem() {
     // Drop the encumbrance inventory-change subscriptions so no dangling delegate points at this torn-down component
     // (the inventories outlive the pawn — they live on the controller — so this must be explicit).
     UnbindEncumbranceInventoryDelegates();
+    if (APawn *OwnerPawn = Cast<APawn>(GetOwner())) {
+        OwnerPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &ThisClass::HandleOwnerControllerChanged);
+    }
 
-    if (GetWorld()) {
-        GetWorld()->GetTimerManager().ClearTimer(RegenTimerHandle);
+    if (UMythicLifeRegenSubsystem *Regen = GetWorld() ? GetWorld()->GetSubsystem<UMythicLifeRegenSubsystem>() : nullptr) {
+        Regen->UnregisterLife(this);
     }
 
     // Tear down any in-flight stagger (timer + transient loose STUNNED tag) via the single-source helper, so the
@@ -633,7 +644,7 @@ void UMythicLifeComponent::ReevaluateCrowdControl() {
     }
 
     // encumbrance: an over-capacity carry load composes as one more multiplier on the captured base, stacking with slow/haste
-    SpeedScale *= ComputeEncumbranceSpeedScale();
+    SpeedScale *= EncumbranceSpeedScale;
     Move->MaxWalkSpeed = BaseWalkSpeed * SpeedScale;
 }
 
@@ -652,9 +663,9 @@ float UMythicLifeComponent::ComputeEncumbranceSpeedScale() const {
         return 1.0f; // feature off → no penalty
     }
     float TotalWeight = 0.0f;
-    for (const UMythicInventoryComponent *Inv : GetOwnerInventoryComponents()) {
-        if (Inv) {
-            TotalWeight += Inv->GetTotalCarriedWeight();
+    for (const TWeakObjectPtr<UMythicInventoryComponent> &InvPtr : EncumbranceBoundInventories) {
+        if (const UMythicInventoryComponent *Inv = InvPtr.Get()) {
+            TotalWeight += Inv->GetTotalCarriedWeight(); // O(1): the inventory keeps a running total
         }
     }
     const EMythicEncumbranceTier Tier =
@@ -664,15 +675,43 @@ float UMythicLifeComponent::ComputeEncumbranceSpeedScale() const {
 
 void UMythicLifeComponent::HandleInventoryChanged(int32 /*Slot*/) {
     // Carried weight just changed (pickup/drop/stack). Recompute move speed — but only when encumbrance is enabled, so
-    // the default-off path adds zero work on every inventory mutation. ReevaluateCrowdControl is idempotent.
+    // the default-off path adds zero work on every inventory mutation, and only when the tier multiplier actually moved
+    // (most pickups stay within a tier). ReevaluateCrowdControl is idempotent.
     const UMythicDeveloperSettings *Settings = GetDefault<UMythicDeveloperSettings>();
-    if (Settings && Settings->bEncumbranceEnabled) {
+    if (!Settings || !Settings->bEncumbranceEnabled) {
+        return;
+    }
+    RefreshEncumbranceBinding(); // a bag gained or lost since the bind changes which inventories the weight sums
+    const float NewScale = ComputeEncumbranceSpeedScale();
+    if (NewScale != EncumbranceSpeedScale) {
+        EncumbranceSpeedScale = NewScale;
         ReevaluateCrowdControl();
     }
 }
 
+void UMythicLifeComponent::HandleOwnerControllerChanged(APawn * /*Pawn*/, AController * /*OldController*/, AController * /*NewController*/) {
+    // The inventories live on the controller: a new one (or none) means a different set to sum.
+    RefreshEncumbranceBinding();
+    HandleInventoryChanged(INDEX_NONE);
+}
+
+void UMythicLifeComponent::RefreshEncumbranceBinding() {
+    const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+    AController *OwnerController = OwnerPawn ? OwnerPawn->GetController() : nullptr;
+    const IInventoryProviderInterface *Provider = Cast<IInventoryProviderInterface>(OwnerController);
+    const uint32 Serial = Provider ? Provider->GetInventorySetSerial() : 0;
+    if (OwnerController != EncumbranceBoundController.Get() || Serial != EncumbranceBoundSerial) {
+        BindEncumbranceInventoryDelegates();
+    }
+}
+
 void UMythicLifeComponent::BindEncumbranceInventoryDelegates() {
     UnbindEncumbranceInventoryDelegates(); // idempotent: drop any prior binds (re-init / re-possession safe)
+    const APawn *OwnerPawn = Cast<APawn>(GetOwner());
+    AController *OwnerController = OwnerPawn ? OwnerPawn->GetController() : nullptr;
+    const IInventoryProviderInterface *Provider = Cast<IInventoryProviderInterface>(OwnerController);
+    EncumbranceBoundController = OwnerController;
+    EncumbranceBoundSerial = Provider ? Provider->GetInventorySetSerial() : 0;
     for (UMythicInventoryComponent *Inv : GetOwnerInventoryComponents()) {
         if (Inv) {
             Inv->OnSlotUpdated.AddDynamic(this, &UMythicLifeComponent::HandleInventoryChanged);
@@ -688,13 +727,15 @@ void UMythicLifeComponent::UnbindEncumbranceInventoryDelegates() {
         }
     }
     EncumbranceBoundInventories.Reset();
+    EncumbranceBoundController.Reset();
+    EncumbranceBoundSerial = 0;
 }
 
 void UMythicLifeComponent::HandleDamageDelivered(const struct FGameplayEventData *Payload) {
     // LIFESTEAL. Fired on the INSTIGATOR's ASC when this owner lands damage (SendEventToInstigator from the victim's
     // Life set, GAS_EVENT_DMG_DELIVERED — only raised when DamageDone > 0, so every call is a real landed hit). Heal a
     // FLAT LifePerHit per hit (the Defense attr's documented meaning: "life restored when dealing damage"). Server-
-    // authoritative + dead-gated + capped at MaxHealth, mirroring ApplyRegen's health heal. The per-KILL sibling is
+    // authoritative + dead-gated + capped at MaxHealth, mirroring the regen Health lane. The per-KILL sibling is
     // HandleKill below, which consumes GAS_EVENT_KILL emitted by UMythicAttributeSet_Life::PostGameplayEffectExecute.
     if (!AbilitySystemComponent || !AbilitySystemComponent->IsOwnerActorAuthoritative()) {
         return;
@@ -745,12 +786,16 @@ void UMythicLifeComponent::HandleKill(const struct FGameplayEventData *Payload)
     }
 }
 
-void UMythicLifeComponent::ApplyRegen() {
+bool UMythicLifeComponent::GatherRegenLanes(TArrayView<float> OutCur, TArrayView<float> OutMax, TArrayView<float> OutRate) const {
+    check(OutCur.Num() == static_cast<int32>(EMythicRegenLane::Count) && OutMax.Num() == OutCur.Num() && OutRate.Num() == OutCur.Num());
     if (!AbilitySystemComponent || !AbilitySystemComponent->IsOwnerActorAuthoritative()) {
-        return;
+        return false;
     }
     if (AbilitySystemComponent->HasMatchingGameplayTag(GAS_STATE_DEAD)) {
-        return; // corpses don't regenerate
+        return false; // corpses don't regenerate
+    }
+    for (int32 l = 0; l < OutCur.Num(); ++l) {
+        OutCur[l] = OutMax[l] = OutRate[l] = 0.0f;
     }
 
     const UMythicAttributeSet_Defense *Def = AbilitySystemComponent->GetSet<UMythicAttributeSet_Defense>();
@@ -758,30 +803,49 @@ void UMythicLifeComponent::ApplyRegen() {
     // Health (rate lives on the Defense set; value on the Life set). Only regen while ALIVE (Cur > 0 — never
     // self-revive) and below max.
     if (LifeSet && Def) {
-        const float Cur = LifeSet->GetHealth();
-        const float NewV = ComputeRegenTarget(Cur, LifeSet->GetMaxHealth(), Def->GetHealthRegenRate(), RegenInterval);
-        if (Cur > 0.0f && NewV > Cur) {
-            AbilitySystemComponent->SetNumericAttributeBase(UMythicAttributeSet_Life::GetHealthAttribute(), NewV);
-        }
+        const int32 L = static_cast<int32>(EMythicRegenLane::Health);
+        OutCur[L] = LifeSet->GetHealth();
+        OutMax[L] = LifeSet->GetMaxHealth();
+        OutRate[L] = OutCur[L] > 0.0f ? Def->GetHealthRegenRate() : 0.0f;
     }
 
     // Shield (recharges from 0 — no alive gate).
     if (Def) {
-        const float Cur = Def->GetShield();
-        const float NewV = ComputeRegenTarget(Cur, Def->GetMaxShield(), Def->GetShieldRegenRate(), RegenInterval);
-        if (NewV > Cur) {
-            AbilitySystemComponent->SetNumericAttributeBase(UMythicAttributeSet_Defense::GetShieldAttribute(), NewV);
-        }
+        const int32 L = static_cast<int32>(EMythicRegenLane::Shield);
+        OutCur[L] = Def->GetShield();
+        OutMax[L] = Def->GetMaxShield();
+        OutRate[L] = Def->GetShieldRegenRate();
     }
 
     // Stamina (recharges from 0 — no alive gate).
     if (const UMythicAttributeSet_Utility *Util = AbilitySystemComponent->GetSet<UMythicAttributeSet_Utility>()) {
-        const float Cur = Util->GetCurrentStamina();
-        const float NewV = ComputeRegenTarget(Cur, Util->GetMaxStamina(), Util->GetStaminaRegenRate(), RegenInterval);
-        if (NewV > Cur) {
-            AbilitySystemComponent->SetNumericAttributeBase(UMythicAttributeSet_Utility::GetCurrentStaminaAttribute(), NewV);
+        const int32 L = static_cast<int32>(EMythicRegenLane::Stamina);
+        OutCur[L] = Util->GetCurrentStamina();
+        OutMax[L] = Util->GetMaxStamina();
+        OutRate[L] = Util->GetStaminaRegenRate();
+    }
+    return true;
+}
+
+int32 UMythicLifeComponent::CommitRegenLanes(TConstArrayView<float> Cur, TConstArrayView<float> New) {
+    check(Cur.Num() == static_cast<int32>(EMythicRegenLane::Count) && New.Num() == Cur.Num());
+    if (!AbilitySystemComponent) {
+        return 0;
+    }
+    // Lane order matches EMythicRegenLane. A lane only rises when its set was present at gather (else its rate was 0).
+    const FGameplayAttribute LaneAttributes[] = {
+        UMythicAttributeSet_Life::GetHealthAttribute(),
+        UMythicAttributeSet_Defense::GetShieldAttribute(),
+        UMythicAttributeSet_Utility::GetCurrentStaminaAttribute(),
+    };
+    int32 Writes = 0;
+    for (int32 l = 0; l < Cur.Num(); ++l) {
+        if (New[l] > Cur[l]) {
+            AbilitySystemComponent->SetNumericAttributeBase(LaneAttributes[l], New[l]);
+            ++Writes;
         }
     }
+    return Writes;
 }
 
 float UMythicLifeComponent::ComputeRegenTarget(float Cur, float Max, float Rate, float DeltaSeconds) {
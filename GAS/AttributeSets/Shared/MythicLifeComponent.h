@@ -13,6 +13,8 @@
 #include "MythicLifeComponent.generated.h"
 
 class UMythicAbilitySystemComponent;
+class AController;
+class APawn;
 
 UCLASS(Blueprintable, BlueprintType)
 class UDamageResult : public UObject {
@@ -31,6 +33,14 @@ public:
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FMythicHealthChanged, float, New, float, Old, FGameplayAttribute,
                                               Attribute, const FGameplayEffectContextHandle&, ContextHandle);
 
+// The regen lanes a life component exposes to the batched regen pass (UMythicLifeRegenSubsystem), in packed order.
+enum class EMythicRegenLane : uint8 {
+    Health,
+    Shield,
+    Stamina,
+    Count
+};
+
 // SERVER: fired when the owner dies (Health reached 0). Bind to diverge behaviour (NPC pooling, drop loot, etc.).
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMythicOnDeath, AActor*, DeadActor);
 
@@ -172,7 +182,7 @@ public:
     static bool CanReviveTarget(bool bTargetDowned, bool bReviverDowned);
 
     // SERVER: seconds between regen ticks. Each tick regenerates Health / Shield / Stamina toward their max at
-    // the corresponding *RegenRate attribute. 0 disables regen.
+    // the corresponding *RegenRate attribute. 0 disables regen. Driven by UMythicLifeRegenSubsystem's batched pass.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythic|Health")
     float RegenInterval = 0.5f;
 
@@ -226,9 +236,17 @@ public:
     // One regeneration step for a Cur→Max attribute: Cur + Rate*DeltaSeconds, CLAMPED to Max (never overshoots).
     // Returns Cur UNCHANGED when there's nothing to do (Rate <= 0, or already at/above Max), so a caller can cheaply
     // detect "did it regen?" with `result > Cur` and skip a redundant attribute set. Single source for the regen
-    // math shared by Health/Shield/Stamina in ApplyRegen. Pure + static for unit testing.
+    // math shared by Health/Shield/Stamina in the batched regen pass. Pure + static for unit testing.
     static float ComputeRegenTarget(float Cur, float Max, float Rate, float DeltaSeconds);
 
+    // SERVER: snapshot this owner's regen lanes (Cur / Max / Rate, indexed by EMythicRegenLane) for the batched regen
+    // pass. False when it cannot regenerate at all (uninitialized, off authority, dead). A missing attribute set — or
+    // Health at 0, since regen never self-revives — reports a zero rate, which ComputeRegenTarget leaves unchanged.
+    bool GatherRegenLanes(TArrayView<float> OutCur, TArrayView<float> OutMax, TArrayView<float> OutRate) const;
+
+    // SERVER: write back only the lanes the batched step raised (New > Cur). Returns the attribute sets issued.
+    int32 CommitRegenLanes(TConstArrayView<float> Cur, TConstArrayView<float> New);
+
     // Tear down any in-flight stagger: clear the recovery timer, remove the transient loose STUNNED tag, reset state.
     // Single source for the stagger teardown — called by StartDeath, Uninitialize, AND the pool-return path (so a
     // reused actor never inherits a leftover loose STUNNED tag + orphaned timer and spawn movement-frozen).
@@ -289,23 +307,44 @@ protected:
     void ReevaluateCrowdControl();
 
     // The encumbrance move-speed multiplier folded into ReevaluateCrowdControl's SpeedScale. 1.0 when encumbrance is
-    // disabled (default) or the owner carries within capacity; <1 when Heavy/Overloaded. Pulls the owner's carried
-    // weight from its inventory provider (players); NPCs/inventory-less owners are always 1.0.
+    // disabled (default) or the owner carries within capacity; <1 when Heavy/Overloaded. Sums the bound inventories'
+    // incrementally maintained carried weight (O(inventories), no slot walk); NPCs/inventory-less owners are always 1.0.
     float ComputeEncumbranceSpeedScale() const;
 
+    // The last ComputeEncumbranceSpeedScale result, refreshed on init and on inventory changes. ReevaluateCrowdControl
+    // reads this instead of re-summing on every CC tag change; an inventory change that leaves the tier (and so the
+    // multiplier) unchanged skips the movement recompute entirely.
+    float EncumbranceSpeedScale = 1.0f;
+
     // The owner's inventory components, reached via its controller's inventory provider (players). Empty for an owner
-    // with no provider (NPC / inventory-less). Single source for both the weight read and the change-binding below.
+    // with no provider (NPC / inventory-less). Resolved by the change-binding below (again only when
+    // RefreshEncumbranceBinding sees the set change); the weight read sums the bound set without re-resolving.
     TArray<class UMythicInventoryComponent *> GetOwnerInventoryComponents() const;
 
     // Bound to each owner inventory's OnSlotUpdated so carried-weight changes (pickup/drop/stack) recompute move speed
-    // immediately, not only on a CC tag change. UFUNCTION (the inventory delegate is dynamic). Recompute is gated on
-    // bEncumbranceEnabled so the default-off path stays zero-cost.
+    // immediately, not only on a CC tag change; the recompute only runs when the multiplier actually changed. A
+    // UFUNCTION because the inventory delegate is dynamic. Gated on bEncumbranceEnabled so the default-off path stays
+    // zero-cost.
     UFUNCTION()
     void HandleInventoryChanged(int32 Slot);
 
     // The inventories this component bound HandleInventoryChanged to (for a clean RemoveDynamic on teardown / re-init).
     TArray<TWeakObjectPtr<class UMythicInventoryComponent>> EncumbranceBoundInventories;
 
+    // The controller and provider GetInventorySetSerial the bound set was resolved from. Either moving on means the set
+    // above is stale (re-possession, a bag gained or lost) — RefreshEncumbranceBinding re-binds.
+    TWeakObjectPtr<AController> EncumbranceBoundController;
+    uint32 EncumbranceBoundSerial = 0;
+
+    // Re-bind when the owner's controller or its provider's inventory-set serial no longer matches the bound set.
+    // Checked on every inventory change (a bag arrives through one) and on a controller change.
+    void RefreshEncumbranceBinding();
+
+    // Bound to the owner pawn's ReceiveControllerChangedDelegate: re-possession swaps the controller that owns the
+    // inventories without necessarily re-initializing this component.
+    UFUNCTION()
+    void HandleOwnerControllerChanged(APawn *Pawn, AController *OldController, AController *NewController);
+
     // (Un)subscribe HandleInventoryChanged from the owner's inventory OnSlotUpdated delegates. Bind on ASC init (post-
     // possession, when the provider exists); unbind on uninit (re-possession / teardown) so no dangling delegate.
     void BindEncumbranceInventoryDelegates();
@@ -316,7 +355,7 @@ protected:
     void HandleReceivedHit(const struct FGameplayEventData *Payload);
 
     // SERVER: consumes the owner's delivered-hit event (fired on the instigator) and applies LIFESTEAL — heals a flat
-    // LifePerHit per landed hit, capped at MaxHealth (mirrors ApplyRegen).
+    // LifePerHit per landed hit, capped at MaxHealth (mirrors the regen Health lane).
     void HandleDamageDelivered(const struct FGameplayEventData *Payload);
 
     // SERVER: consumes the owner's KILL event (fired on the killer by the victim's Life set on a lethal blow) and
@@ -338,10 +377,6 @@ protected:
     // True if the owner is a player-controlled pawn (the only thing that can be downed/revived; NPCs die outright).
     bool IsOwnerRevivablePlayer() const;
 
-    // SERVER: periodic regen tick (Health / Shield / Stamina toward max). Paused while dead.
-    void ApplyRegen();
-    FTimerHandle RegenTimerHandle;
-
     // Internal handler which when the health is changed, sends out the gameplay events.
     virtual void HandleHealthChanged(AActor *DamageInstigator, AActor *DamageCauser, const FGameplayEffectSpec *DamageEffectSpec, float DamageMagnitude,
                                      float OldValue, float NewValue);
@@ -0,0 +1,197 @@
+// Mythic — Life Regen Subsystem Implementation
+// Packed registry, one gather / step / commit pass per tick.
+
+#include "MythicLifeRegenSubsystem.h"
+#include "MythicLifeComponent.h"
+#include "Engine/World.h"
+
+// ─────────────────────────────────────────────────────────────
+// Subsystem Lifecycle
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLifeRegenSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UMythicLifeRegenSubsystem::Initialize(FSubsystemCollectionBase &Collection) {
+    Super::Initialize(Collection);
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMythicLifeRegenSubsystem::Tick), 0.0f);
+}
+
+void UMythicLifeRegenSubsystem::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    Lives.Reset();
+    LifeKeys.Reset();
+    Intervals.Reset();
+    DueTimes.Reset();
+    LifeIndices.Reset();
+
+    Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// Registration
+// ─────────────────────────────────────────────────────────────
+
+void UMythicLifeRegenSubsystem::RegisterLife(UMythicLifeComponent *Life, float Interval) {
+    const UWorld *World = GetWorld();
+    if (!Life || !World || Interval <= 0.0f) {
+        return;
+    }
+    UnregisterLife(Life);
+
+    const TObjectKey<UMythicLifeComponent> Key(Life);
+    const int32 Slot = Lives.Add(Life);
+    LifeKeys.Add(Key);
+    Intervals.Add(Interval);
+    DueTimes.Add(World->GetTimeSeconds() + Interval); // a looping timer's first fire is one interval out
+    LifeIndices.Add(Key, Slot);
+}
+
+void UMythicLifeRegenSubsystem::UnregisterLife(UMythicLifeComponent *Life) {
+    int32 Slot = INDEX_NONE;
+    if (Life && LifeIndices.RemoveAndCopyValue(TObjectKey<UMythicLifeComponent>(Life), Slot)) {
+        if (bCommitting) {
+            Lives[Slot].Reset(); // the commit loop skips it; RemoveEmptySlots drops it once the loop is done
+            return;
+        }
+        RemoveAtSwap(Slot);
+    }
+}
+
+void UMythicLifeRegenSubsystem::RemoveAtSwap(int32 Index) {
+    const int32 Last = Lives.Num() - 1;
+    if (Index != Last) {
+        LifeIndices.Add(LifeKeys[Last], Index); // the last slot moves into Index
+    }
+    Lives.RemoveAtSwap(Index, EAllowShrinking::No);
+    LifeKeys.RemoveAtSwap(Index, EAllowShrinking::No);
+    Intervals.RemoveAtSwap(Index, EAllowShrinking::No);
+    DueTimes.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UMythicLifeRegenSubsystem::RemoveEmptySlots() {
+    // Backwards, so the slot swapped into Slot has already been checked.
+    for (int32 Slot = Lives.Num() - 1; Slot >= 0; --Slot) {
+        if (Lives[Slot].IsValid()) {
+            continue;
+        }
+        // A deferred unregistration already dropped its key, and may have re-registered into a new slot since.
+        if (const int32 *Indexed = LifeIndices.Find(LifeKeys[Slot]); Indexed && *Indexed == Slot) {
+            LifeIndices.Remove(LifeKeys[Slot]);
+        }
+        RemoveAtSwap(Slot);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Pure helpers
+// ─────────────────────────────────────────────────────────────
+
+int32 UMythicLifeRegenSubsystem::ComputeRegenTargets(TConstArrayView<float> Cur, TConstArrayView<float> Max,
+                                                     TConstArrayView<float> Rate, TConstArrayView<float> Delta,
+                                                     TArrayView<float> Out) {
+    check(Max.Num() == Cur.Num() && Rate.Num() == Cur.Num() && Delta.Num() == Cur.Num() && Out.Num() == Cur.Num());
+    int32 Raised = 0;
+    for (int32 i = 0; i < Cur.Num(); ++i) {
+        Out[i] = UMythicLifeComponent::ComputeRegenTarget(Cur[i], Max[i], Rate[i], Delta[i]);
+        Raised += (Out[i] > Cur[i]) ? 1 : 0;
+    }
+    return Raised;
+}
+
+double UMythicLifeRegenSubsystem::ComputeNextDueTime(double DueTime, double Now, float Interval) {
+    const double Next = DueTime + Interval;
+    return Next > Now ? Next : Now + Interval;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Tick — gather, step, commit
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLifeRegenSubsystem::Tick(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicLifeRegen_Tick);
+
+    const UWorld *World = GetWorld();
+    if (!World || Lives.IsEmpty()) {
+        return true;
+    }
+    const double Now = World->GetTimeSeconds();
+
+    // ─── Drop components destroyed without unregistering ───
+    RemoveEmptySlots();
+
+    // ─── Due scan ───
+    DueSlots.Reset();
+    for (int32 Slot = 0; Slot < DueTimes.Num(); ++Slot) {
+        if (DueTimes[Slot] <= Now) {
+            DueSlots.Add(Slot);
+        }
+    }
+    LastBatchSize = 0;
+    LastWriteCount = 0;
+    if (DueSlots.IsEmpty()) {
+        return true;
+    }
+
+    // ─── Gather: every due component's lanes into the packed arrays ───
+    constexpr int32 NumLanes = static_cast<int32>(EMythicRegenLane::Count);
+    const int32 NumLaneValues = DueSlots.Num() * NumLanes;
+    LaneCur.SetNumUninitialized(NumLaneValues, EAllowShrinking::No);
+    LaneMax.SetNumUninitialized(NumLaneValues, EAllowShrinking::No);
+    LaneRate.SetNumUninitialized(NumLaneValues, EAllowShrinking::No);
+    LaneDelta.SetNumUninitialized(NumLaneValues, EAllowShrinking::No);
+    LaneOut.SetNumUninitialized(NumLaneValues, EAllowShrinking::No);
+
+    for (int32 d = 0; d < DueSlots.Num(); ++d) {
+        const int32 Slot = DueSlots[d];
+        const int32 Base = d * NumLanes;
+        DueTimes[Slot] = ComputeNextDueTime(DueTimes[Slot], Now, Intervals[Slot]);
+        // Same step size as the old looping timer (a fixed RegenInterval per fire, not the measured frame gap).
+        for (int32 l = 0; l < NumLanes; ++l) {
+            LaneDelta[Base + l] = Intervals[Slot];
+        }
+        if (!Lives[Slot]->GatherRegenLanes(MakeArrayView(LaneCur.GetData() + Base, NumLanes),
+                                           MakeArrayView(LaneMax.GetData() + Base, NumLanes),
+                                           MakeArrayView(LaneRate.GetData() + Base, NumLanes))) {
+            // Not regenerating this pass (dead / off authority): zero rates leave every lane unchanged.
+            for (int32 l = 0; l < NumLanes; ++l) {
+                LaneCur[Base + l] = 0.0f;
+                LaneMax[Base + l] = 0.0f;
+                LaneRate[Base + l] = 0.0f;
+            }
+        }
+    }
+
+    // ─── Step: one loop over every lane ───
+    const int32 Raised = ComputeRegenTargets(LaneCur, LaneMax, LaneRate, LaneDelta, LaneOut);
+    LastBatchSize = DueSlots.Num();
+    if (Raised == 0) {
+        return true;
+    }
+
+    // ─── Commit: only the lanes that rose ───
+    // A write can end its owner (death → uninit → UnregisterLife) or register another component; neither may move a
+    // registry slot under DueSlots, so unregistration only empties the slot until the loop is done.
+    bCommitting = true;
+    for (int32 d = 0; d < DueSlots.Num(); ++d) {
+        UMythicLifeComponent *Life = Lives[DueSlots[d]].Get();
+        if (!Life) {
+            continue;
+        }
+        const int32 Base = d * NumLanes;
+        LastWriteCount += Life->CommitRegenLanes(MakeArrayView(LaneCur.GetData() + Base, NumLanes),
+                                                 MakeArrayView(LaneOut.GetData() + Base, NumLanes));
+    }
+    bCommitting = false;
+    RemoveEmptySlots();
+    return true;
+}
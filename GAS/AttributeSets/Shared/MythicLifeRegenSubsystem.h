@@ -0,0 +1,103 @@
+// Mythic — Life Regen Subsystem
+// One batched regen pass for every UMythicLifeComponent (replaces one looping RegenTimerHandle per component).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "MythicLifeRegenSubsystem.generated.h"
+
+class UMythicLifeComponent;
+
+/**
+ * Life Regen Subsystem — drives Health / Shield / Stamina regeneration for every authoritative life component.
+ *
+ * Previously each life component armed its own looping FTimerHandle at RegenInterval (0.5s) and ApplyRegen read three
+ * attribute sets and issued up to three attribute sets per callback. Hundreds of embodied NPCs + players meant hundreds
+ * of timer callbacks per second, each touching its own ASC in isolation. Now:
+ *
+ * - Components register once (server, on ASC init) with their interval. The registry is packed parallel arrays
+ *   (component, interval, due time) so the due scan is a linear walk over doubles.
+ * - Every due component gathers its lanes (Cur / Max / Rate per EMythicRegenLane) into packed arrays, then ONE loop runs
+ *   ComputeRegenTarget over all of them — the same clamp-to-max step the per-actor path used.
+ * - The commit loop writes back ONLY the lanes that actually rose; a full or zero-rate lane costs no attribute set.
+ *
+ * Cadence matches the old looping timer: each component keeps its own phase (due += interval) and re-phases rather than
+ * bursting if the world hitches past a whole interval. Server-side by use; created for every game world.
+ */
+UCLASS()
+class MYTHIC_API UMythicLifeRegenSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    //~ End USubsystem Interface
+
+    /** Add (or re-add) a component. Its first regen step falls due one Interval from now. Interval <= 0 is ignored. */
+    void RegisterLife(UMythicLifeComponent *Life, float Interval);
+
+    /** Remove a component from the pass (uninit / teardown). Safe for an unregistered component, and from inside a
+     *  commit (an attribute write can kill / tear down its owner): the slot is only emptied then and dropped after it. */
+    void UnregisterLife(UMythicLifeComponent *Life);
+
+    /** Registered components (debug/stats) */
+    int32 GetRegisteredCount() const { return Lives.Num(); }
+
+    /** Components stepped in the most recent pass (debug/stats) */
+    int32 GetLastBatchSize() const { return LastBatchSize; }
+
+    /** Attribute writes issued by the most recent pass (debug/stats) */
+    int32 GetLastWriteCount() const { return LastWriteCount; }
+
+    // ─── Pure helpers (static for tests) ─────────────────
+
+    /**
+     * One regen step over packed lanes: Out[i] = ComputeRegenTarget(Cur[i], Max[i], Rate[i], Delta[i]). All views must be
+     * the same length. Returns how many lanes rose (Out[i] > Cur[i]) — the writes the commit loop will issue.
+     */
+    static int32 ComputeRegenTargets(TConstArrayView<float> Cur, TConstArrayView<float> Max, TConstArrayView<float> Rate,
+                                     TConstArrayView<float> Delta, TArrayView<float> Out);
+
+    /** Next due time after a step due at DueTime ran at Now: keeps the phase unless a whole interval was missed. */
+    static double ComputeNextDueTime(double DueTime, double Now, float Interval);
+
+private:
+    /** Core-ticker callback: gather every due component, step all lanes, commit the risen ones */
+    bool Tick(float DeltaTime);
+
+    /** Remove registry slot Index (swap-remove; fixes the moved component's index) */
+    void RemoveAtSwap(int32 Index);
+
+    /** Drop every emptied slot: components destroyed without unregistering, and unregistrations deferred by a commit */
+    void RemoveEmptySlots();
+
+    /** Registry — parallel arrays, one slot per registered component */
+    TArray<TWeakObjectPtr<UMythicLifeComponent>> Lives;
+    TArray<TObjectKey<UMythicLifeComponent>> LifeKeys;
+    TArray<float> Intervals;
+    TArray<double> DueTimes;
+
+    /** Component → registry slot */
+    TMap<TObjectKey<UMythicLifeComponent>, int32> LifeIndices;
+
+    /** Per-pass scratch (retained between passes): due registry slots + their packed lanes */
+    TArray<int32> DueSlots;
+    TArray<float> LaneCur;
+    TArray<float> LaneMax;
+    TArray<float> LaneRate;
+    TArray<float> LaneDelta;
+    TArray<float> LaneOut;
+
+    int32 LastBatchSize = 0;
+    int32 LastWriteCount = 0;
+
+    /** True while the commit loop runs: DueSlots holds registry indices, so UnregisterLife must not swap-remove */
+    bool bCommitting = false;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
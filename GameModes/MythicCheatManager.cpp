@@ -21,6 +21,7 @@
 #include "Mythic/World/LivingWorld/Territory/TerritoryGrid.h"
 #include "Mythic/World/LivingWorld/Settlements/SettlementRegistry.h"
 #include "Mythic/World/LivingWorld/CausalFabric/CausalFabric.h"
+#include "Mythic/World/LivingWorld/MythicLivingWorldTelemetrySubsystem.h"
 #include "MassEntitySubsystem.h"
 #include "MassEntityQuery.h"
 #include "Mythic/Mass/Tags/MythicMassTags.h"
@@ -89,6 +90,7 @@ void UMythicCheatManager::MythHelp() {
     UE_LOG(Myth, Warning, TEXT("  MythLivingWorldPopulation          - MASS entity counts (NPCs, creatures)"));
     UE_LOG(Myth, Warning, TEXT("  MythLivingWorldSettlements         - List all settlements with faction/density"));
     UE_LOG(Myth, Warning, TEXT("  MythLivingWorldTransferSettlement <ID> <Faction> - Force transfer settlement"));
+    UE_LOG(Myth, Warning, TEXT("  MythLivingWorldPerf [Reset]        - Log perf histograms (sim, lock wait, fabric, budgets)"));
     UE_LOG(Myth, Warning, TEXT(""));
 }
 
@@ -928,6 +930,20 @@ void UMythicCheatManager::MythToggleLivingWorldDebug() {
     }
 }
 
+void UMythicCheatManager::MythLivingWorldPerf(bool bReset) {
+    UMythicLivingWorldTelemetrySubsystem *Telemetry = GetWorld() ? GetWorld()->GetSubsystem<UMythicLivingWorldTelemetrySubsystem>() : nullptr;
+    if (!Telemetry) {
+        UE_LOG(Myth, Error, TEXT(">>> Living World telemetry not found"));
+        return;
+    }
+
+    Telemetry->DumpHistograms();
+    if (bReset) {
+        Telemetry->ResetHistograms();
+        UE_LOG(Myth, Warning, TEXT(">>> Living World perf histograms reset"));
+    }
+}
+
 // ============================================================================
 // LIVING WORLD: EVENT PIPELINE (Phase 4)
 // ============================================================================
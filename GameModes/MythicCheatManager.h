@@ -181,6 +181,12 @@ public:
     UFUNCTION(Exec)
     void MythToggleLivingWorldDebug();
 
+    // Log the living-world perf histograms (sim tick/phases, SimulationLock wait, fabric, per-processor units);
+    // pass 1 to reset them afterwards and start a fresh window
+    // Example: LivingWorldPerf 1
+    UFUNCTION(Exec)
+    void MythLivingWorldPerf(bool bReset = false);
+
     // === LIVING WORLD: EVENT PIPELINE (Phase 4) ===
 
     // Fire a test action event at the player's location
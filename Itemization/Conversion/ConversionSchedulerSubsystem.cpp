@@ -0,0 +1,306 @@
+// Mythic — Conversion Scheduler Implementation
+// Hashed timing wheel, budgeted due-order completion, parked cycles for unobserved stations.
+
+#include "ConversionSchedulerSubsystem.h"
+#include "ConversionStationComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/MythicDeveloperSettings.h"
+
+// ─────────────────────────────────────────────────────────────
+// Subsystem Lifecycle
+// ─────────────────────────────────────────────────────────────
+
+bool UConversionSchedulerSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UConversionSchedulerSubsystem::Initialize(FSubsystemCollectionBase &Collection) {
+    Super::Initialize(Collection);
+
+    Slots.SetNum(WheelSlotCount);
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UConversionSchedulerSubsystem::Tick), 0.0f);
+}
+
+void UConversionSchedulerSubsystem::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    Slots.Reset();
+    ReadyQueue.Reset();
+    Stations.Reset();
+    DormantStations.Reset();
+
+    Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// Scheduling
+// ─────────────────────────────────────────────────────────────
+
+void UConversionSchedulerSubsystem::Schedule(UConversionStationComponent *Station, EConversionScheduledWork Work, float Delay) {
+    const UWorld *World = GetWorld();
+    if (!Station || !World || Slots.Num() != WheelSlotCount) {
+        return;
+    }
+    const TObjectKey<UConversionStationComponent> Key(Station);
+    const int32 W = static_cast<int32>(Work);
+
+    FStationRecord &Rec = Stations.FindOrAdd(Key);
+    Rec.Station = Station;
+    ++Rec.Generation[W]; // any entry already in the wheel for this kind is now stale
+    Rec.bPending[W] = true;
+    if (Work == EConversionScheduledWork::CycleComplete && Rec.bDormant) {
+        Rec.bDormant = false;
+        DormantStations.RemoveSwap(Key, EAllowShrinking::No);
+    }
+
+    FWheelEntry Entry;
+    Entry.Station = Key;
+    Entry.DueTime = World->GetTimeSeconds() + FMath::Max(Delay, 0.0f);
+    // Never behind the drain cursor: work due "now" lands in the next slot to drain (the next pass).
+    Entry.Tick = FMath::Max(ComputeWheelTick(Entry.DueTime), NextTick);
+    Entry.Generation = Rec.Generation[W];
+    Entry.Work = Work;
+    Slots[static_cast<int32>(Entry.Tick % WheelSlotCount)].Add(Entry);
+}
+
+void UConversionSchedulerSubsystem::Cancel(UConversionStationComponent *Station, EConversionScheduledWork Work) {
+    if (!Station) {
+        return;
+    }
+    const TObjectKey<UConversionStationComponent> Key(Station);
+    FStationRecord *Rec = Stations.Find(Key);
+    if (!Rec) {
+        return;
+    }
+    const int32 W = static_cast<int32>(Work);
+    ++Rec->Generation[W];
+    Rec->bPending[W] = false;
+    if (Work == EConversionScheduledWork::CycleComplete && Rec->bDormant) {
+        Rec->bDormant = false;
+        DormantStations.RemoveSwap(Key, EAllowShrinking::No);
+    }
+}
+
+bool UConversionSchedulerSubsystem::IsScheduled(const UConversionStationComponent *Station, EConversionScheduledWork Work) const {
+    const FStationRecord *Rec = Station ? Stations.Find(TObjectKey<UConversionStationComponent>(Station)) : nullptr;
+    return Rec && Rec->bPending[static_cast<int32>(Work)];
+}
+
+void UConversionSchedulerSubsystem::UnregisterStation(UConversionStationComponent *Station) {
+    if (!Station) {
+        return;
+    }
+    // Wheel entries for the key are dropped when drained (no record → skipped); TObjectKey never aliases a new object.
+    const TObjectKey<UConversionStationComponent> Key(Station);
+    Stations.Remove(Key);
+    DormantStations.RemoveSwap(Key, EAllowShrinking::No);
+}
+
+void UConversionSchedulerSubsystem::NotifyObserved(UConversionStationComponent *Station) {
+    const FStationRecord *Rec = Station ? Stations.Find(TObjectKey<UConversionStationComponent>(Station)) : nullptr;
+    if (Rec && Rec->bDormant) {
+        WakeStation(Station);
+    }
+}
+
+void UConversionSchedulerSubsystem::WakeStation(UConversionStationComponent *Station) {
+    const TObjectKey<UConversionStationComponent> Key(Station);
+    if (FStationRecord *Rec = Stations.Find(Key)) {
+        constexpr int32 W = static_cast<int32>(EConversionScheduledWork::CycleComplete);
+        ++Rec->Generation[W];
+        Rec->bPending[W] = false;
+        Rec->bDormant = false;
+    }
+    DormantStations.RemoveSwap(Key, EAllowShrinking::No);
+    Station->CatchUpDormantCycles(); // re-arms its in-progress cycle (if any) through Schedule
+}
+
+// ─────────────────────────────────────────────────────────────
+// Pure helpers
+// ─────────────────────────────────────────────────────────────
+
+int64 UConversionSchedulerSubsystem::ComputeWheelTick(double DueTime) {
+    return FMath::FloorToInt64(FMath::Max(DueTime, 0.0) / WheelSlotSeconds);
+}
+
+int32 UConversionSchedulerSubsystem::ComputeElapsedCycles(double CycleStart, float Duration, double Now, int32 RemainingCycles,
+                                                          int32 MaxCycles) {
+    if (Duration <= 0.0f || MaxCycles <= 0 || Now < CycleStart + Duration) {
+        return 0;
+    }
+    int64 Elapsed = FMath::FloorToInt64((Now - CycleStart) / Duration);
+    if (RemainingCycles > 0) {
+        Elapsed = FMath::Min<int64>(Elapsed, RemainingCycles);
+    }
+    return static_cast<int32>(FMath::Clamp<int64>(Elapsed, 0, MaxCycles));
+}
+
+// ─────────────────────────────────────────────────────────────
+// Relevance
+// ─────────────────────────────────────────────────────────────
+
+void UConversionSchedulerSubsystem::GatherPlayerLocations() {
+    PlayerLocations.Reset();
+    const UWorld *World = GetWorld();
+    if (!World) {
+        return;
+    }
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+        if (const APlayerController *PC = It->Get()) {
+            if (const APawn *Pawn = PC->GetPawn()) {
+                PlayerLocations.Add(Pawn->GetActorLocation());
+            }
+        }
+    }
+}
+
+bool UConversionSchedulerSubsystem::IsStationRelevant(const UConversionStationComponent *Station) const {
+    const float Radius = GetDefault<UMythicDeveloperSettings>()->ConversionRelevanceRadius;
+    const AActor *Owner = Station ? Station->GetOwner() : nullptr;
+    if (Radius <= 0.0f || !Owner) {
+        return true;
+    }
+    const FVector StationLocation = Owner->GetActorLocation();
+    const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+    for (const FVector &Location : PlayerLocations) {
+        if (FVector::DistSquared(Location, StationLocation) <= RadiusSq) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Tick — release, run under budget, sweep parked stations
+// ─────────────────────────────────────────────────────────────
+
+void UConversionSchedulerSubsystem::ReleaseElapsedSlots(int64 NowTick) {
+    if (NowTick <= NextTick) {
+        return;
+    }
+    ReleasedScratch.Reset();
+
+    // After a hitch longer than a revolution every slot is visited once (Tick < NowTick still picks out the due entries).
+    const int64 SlotsToVisit = FMath::Min<int64>(NowTick - NextTick, WheelSlotCount);
+    for (int64 i = 0; i < SlotsToVisit; ++i) {
+        TArray<FWheelEntry> &Slot = Slots[static_cast<int32>((NextTick + i) % WheelSlotCount)];
+        for (int32 e = Slot.Num() - 1; e >= 0; --e) {
+            if (Slot[e].Tick < NowTick) {
+                ReleasedScratch.Add(Slot[e]);
+                Slot.RemoveAtSwap(e, EAllowShrinking::No);
+            }
+        }
+    }
+    NextTick = NowTick;
+
+    ReleasedScratch.Sort([](const FWheelEntry &A, const FWheelEntry &B) { return A.DueTime < B.DueTime; });
+    ReadyQueue.Append(ReleasedScratch); // anything still queued (over-budget work, sweep wakes) was due earlier
+}
+
+bool UConversionSchedulerSubsystem::Tick(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(ConversionScheduler_Tick);
+
+    const UWorld *World = GetWorld();
+    if (!World || Stations.IsEmpty()) {
+        return true;
+    }
+    const double Now = World->GetTimeSeconds();
+    const UMythicDeveloperSettings *Settings = GetDefault<UMythicDeveloperSettings>();
+    const int32 Budget = FMath::Max(1, Settings->ConversionMaxCyclesPerFrame);
+    const bool bDormancyEnabled = Settings->ConversionRelevanceRadius > 0.0f;
+    bool bPlayersGathered = false;
+
+    ReleaseElapsedSlots(ComputeWheelTick(Now));
+
+    // ─── Run released work in due order until the budget is spent ───
+    // Station callbacks may Schedule/Cancel re-entrantly: Schedule only ever appends to wheel slots (never ReadyQueue),
+    // and the record is re-found per entry, so nothing here is held across a callback.
+    LastBatchSize = 0;
+    int32 Consumed = 0;
+    while (Consumed < ReadyQueue.Num() && LastBatchSize < Budget) {
+        const FWheelEntry Entry = ReadyQueue[Consumed++];
+        const int32 W = static_cast<int32>(Entry.Work);
+        FStationRecord *Rec = Stations.Find(Entry.Station);
+        if (!Rec || !Rec->bPending[W] || Rec->Generation[W] != Entry.Generation) {
+            continue; // cancelled, re-armed or unregistered since it was scheduled
+        }
+        UConversionStationComponent *Station = Rec->Station.Get();
+        if (!Station) {
+            DormantStations.RemoveSwap(Entry.Station, EAllowShrinking::No);
+            Stations.Remove(Entry.Station);
+            continue;
+        }
+
+        if (Entry.bCatchUp) {
+            Rec->bPending[W] = false;
+            ++LastBatchSize;
+            Station->CatchUpDormantCycles(); // re-arms its in-progress cycle (if any) through Schedule
+            continue;
+        }
+
+        if (Entry.Work == EConversionScheduledWork::CycleComplete && bDormancyEnabled) {
+            if (!bPlayersGathered) {
+                GatherPlayerLocations();
+                bPlayersGathered = true;
+            }
+            if (!IsStationRelevant(Station)) {
+                // Park: the cycle stays pending (IsScheduled) and is caught up analytically once observed.
+                Rec->bDormant = true;
+                DormantStations.Add(Entry.Station);
+                continue;
+            }
+        }
+
+        Rec->bPending[W] = false;
+        ++LastBatchSize;
+        if (Entry.Work == EConversionScheduledWork::CycleComplete) {
+            Station->OnCycleComplete();
+        }
+        else {
+            Station->TryAutoEnqueue();
+        }
+    }
+    ReadyQueue.RemoveAt(0, Consumed, EAllowShrinking::No);
+
+    // ─── Sweep parked stations: queue a wake for any a player has come back to (or all if dormancy was switched off) ───
+    // The wake keeps the parked entry's generation, so a Schedule/Cancel before it runs still supersedes it; it runs
+    // from the next pass on, under the same budget as released cycles.
+    if (!DormantStations.IsEmpty() && Now >= NextDormantSweepTime) {
+        NextDormantSweepTime = Now + DormantSweepInterval;
+        if (!bPlayersGathered) {
+            GatherPlayerLocations();
+        }
+        constexpr int32 W = static_cast<int32>(EConversionScheduledWork::CycleComplete);
+        for (int32 i = DormantStations.Num() - 1; i >= 0; --i) {
+            FStationRecord *Rec = Stations.Find(DormantStations[i]);
+            const UConversionStationComponent *Station = Rec ? Rec->Station.Get() : nullptr;
+            if (!Station || !Rec->bDormant) {
+                DormantStations.RemoveAtSwap(i, EAllowShrinking::No);
+                continue;
+            }
+            if (bDormancyEnabled && !IsStationRelevant(Station)) {
+                continue;
+            }
+            FWheelEntry Wake;
+            Wake.Station = DormantStations[i];
+            Wake.DueTime = Now;
+            Wake.Tick = NextTick;
+            Wake.Generation = Rec->Generation[W];
+            Wake.Work = EConversionScheduledWork::CycleComplete;
+            Wake.bCatchUp = true;
+            ReadyQueue.Add(Wake);
+            Rec->bDormant = false; // still pending (IsScheduled) until the wake runs
+            DormantStations.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,157 @@
+// Mythic — Conversion Scheduler
+// Central time-ordered wheel for every conversion station's cycle completions + auto-enqueue checks
+// (replaces one ProcessTimerHandle + one AutoEnqueueTimerHandle per station).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "ConversionSchedulerSubsystem.generated.h"
+
+class UConversionStationComponent;
+
+/** The two kinds of deferred station work the scheduler owns. */
+enum class EConversionScheduledWork : uint8 {
+    CycleComplete, // the head job's current cycle ends
+    AutoEnqueue,   // an Automatic station re-checks its inputs for a recipe
+    Count
+};
+
+/**
+ * Conversion Scheduler — owns every authoritative station's pending work in one hashed timing wheel.
+ *
+ * Previously each UConversionStationComponent armed its own FTimerManager timers (one per running cycle, one per
+ * auto-enqueue poke). Player bases run hundreds of stations, so the timer heap churned with a set/clear per cycle per
+ * station. Now:
+ *
+ * - Work is bucketed by due tick (WheelSlotSeconds) into WheelSlotCount slots. Scheduling and cancelling are O(1)
+ *   (cancel bumps the station's generation; stale wheel entries are dropped when their slot is drained), and each pass
+ *   only walks the slots whose ticks elapsed since the last pass.
+ * - Released work runs in due-time order under a per-frame budget (UMythicDeveloperSettings::ConversionMaxCyclesPerFrame).
+ *   Anything over budget stays in the ready queue and runs first next frame, so a base-wide burst is smeared over frames
+ *   instead of landing in one.
+ * - A cycle that falls due while no player is within ConversionRelevanceRadius is PARKED instead of completed. The
+ *   relevance sweep (every DormantSweepInterval) queues a wake for each parked station a player has come back to; wakes
+ *   join the ready queue behind the work already released, so they share the per-frame budget. A woken station settles
+ *   analytically: the elapsed cycle count N is computed once, clamped by the inputs, fuel, catalysts and output space it
+ *   actually had, and consumed / produced as N in one step per job. A player opening a parked station wakes just that
+ *   one immediately (NotifyObserved), so the queue they see is settled.
+ *
+ * Server-side by use (stations only schedule with authority); created for every game world.
+ */
+UCLASS()
+class MYTHIC_API UConversionSchedulerSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    //~ End USubsystem Interface
+
+    /** Arm (or re-arm) Work for Station, due Delay seconds from now. Replaces any pending Work of the same kind. */
+    void Schedule(UConversionStationComponent *Station, EConversionScheduledWork Work, float Delay);
+
+    /** Drop Station's pending Work of this kind (also un-parks a dormant cycle). Safe if nothing is pending. */
+    void Cancel(UConversionStationComponent *Station, EConversionScheduledWork Work);
+
+    /** Is Work pending for Station? A parked (dormant) cycle counts as pending. */
+    bool IsScheduled(const UConversionStationComponent *Station, EConversionScheduledWork Work) const;
+
+    /** Forget Station entirely (EndPlay). */
+    void UnregisterStation(UConversionStationComponent *Station);
+
+    /** Station is being looked at (a player opened it): fast-forward its parked cycle now rather than at the next sweep. */
+    void NotifyObserved(UConversionStationComponent *Station);
+
+    /** Stations with any pending work (debug/stats) */
+    int32 GetStationCount() const { return Stations.Num(); }
+
+    /** Parked cycles awaiting an observer (debug/stats) */
+    int32 GetDormantCount() const { return DormantStations.Num(); }
+
+    /** Work items run in the most recent pass (debug/stats) */
+    int32 GetLastBatchSize() const { return LastBatchSize; }
+
+    /** Released work still waiting on budget after the most recent pass (debug/stats) */
+    int32 GetReadyBacklog() const { return ReadyQueue.Num(); }
+
+    // ─── Pure helpers (static for tests) ─────────────────
+
+    /** Wheel granularity (seconds per slot) and slot count (one revolution = 12.8s; later work waits out its rounds) */
+    static constexpr float WheelSlotSeconds = 0.05f;
+    static constexpr int32 WheelSlotCount = 256;
+
+    /** Seconds between relevance sweeps over the parked stations */
+    static constexpr float DormantSweepInterval = 1.0f;
+
+    /** Absolute wheel tick a work item due at DueTime belongs to */
+    static int64 ComputeWheelTick(double DueTime);
+
+    /**
+     * Whole cycles elapsed between a cycle starting at CycleStart (Duration long) and Now, i.e. how many completions a
+     * ticking station would have run. Bounded by RemainingCycles (<= 0 = unbounded) and MaxCycles. A zero-length or
+     * not-yet-finished cycle yields 0.
+     */
+    static int32 ComputeElapsedCycles(double CycleStart, float Duration, double Now, int32 RemainingCycles, int32 MaxCycles);
+
+private:
+    /** Core-ticker callback: drain elapsed wheel slots, run ready work under budget, sweep parked stations */
+    bool Tick(float DeltaTime);
+
+    /** Drain every wheel slot whose tick fully elapsed (tick < NowTick) into ReadyQueue, in due-time order */
+    void ReleaseElapsedSlots(int64 NowTick);
+
+    /** Is any player pawn within the relevance radius of Station? Always true when dormancy is disabled. */
+    bool IsStationRelevant(const UConversionStationComponent *Station) const;
+
+    /** Refresh PlayerLocations from the player controllers (once per pass that needs it) */
+    void GatherPlayerLocations();
+
+    /** Un-park Station and let it catch up its elapsed cycles now (outside the budget) */
+    void WakeStation(UConversionStationComponent *Station);
+
+    struct FWheelEntry {
+        TObjectKey<UConversionStationComponent> Station;
+        double DueTime = 0.0;
+        int64 Tick = 0;
+        uint32 Generation = 0;
+        EConversionScheduledWork Work = EConversionScheduledWork::CycleComplete;
+        // A queued wake of a parked cycle: catch up instead of completing (and skip the relevance check).
+        bool bCatchUp = false;
+    };
+
+    struct FStationRecord {
+        TWeakObjectPtr<UConversionStationComponent> Station;
+        uint32 Generation[static_cast<int32>(EConversionScheduledWork::Count)] = {};
+        bool bPending[static_cast<int32>(EConversionScheduledWork::Count)] = {};
+        bool bDormant = false;
+    };
+
+    /** The wheel — WheelSlotCount buckets, each holding every entry whose Tick maps to it (any round) */
+    TArray<TArray<FWheelEntry>> Slots;
+
+    /** Next tick not yet drained */
+    int64 NextTick = 0;
+
+    /** Released entries (due-time ordered per release) and queued wakes waiting on budget; drained from the front */
+    TArray<FWheelEntry> ReadyQueue;
+
+    /** Station → generations / pending flags / dormancy */
+    TMap<TObjectKey<UConversionStationComponent>, FStationRecord> Stations;
+
+    /** Stations with a parked cycle */
+    TArray<TObjectKey<UConversionStationComponent>> DormantStations;
+
+    /** Per-pass scratch (retained between passes) */
+    TArray<FWheelEntry> ReleasedScratch;
+    TArray<FVector> PlayerLocations;
+
+    double NextDormantSweepTime = 0.0;
+    int32 LastBatchSize = 0;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
@@ -2,9 +2,9 @@
 
 #include "AbilitySystemComponent.h"
 #include "ConversionRecipe.h"
+#include "ConversionSchedulerSubsystem.h"
 #include "ConversionSubsystem.h"
 #include "Mythic.h"
-#include "TimerManager.h"
 #include "Engine/GameInstance.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
@@ -131,6 +131,9 @@ void UConversionStationComponent::BeginPlay() {
     if (const UGameInstance *GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr) {
         Subsystem = GI->GetSubsystem<UConversionSubsystem>();
     }
+    if (UWorld *World = GetWorld()) {
+        Scheduler = World->GetSubsystem<UConversionSchedulerSubsystem>();
+    }
 
     // Resolve the station inventory from the owning actor's provider interface.
     if (IInventoryProviderInterface *Provider = Cast<IInventoryProviderInterface>(GetOwner())) {
@@ -181,10 +184,10 @@ void UConversionStationComponent::EndPlay(const EEndPlayReason::Type Reason) {
         Subsystem->OnRecipesReady.RemoveAll(this);
     }
 
-    if (GetWorld()) {
-        GetWorld()->GetTimerManager().ClearTimer(ProcessTimerHandle);
-        GetWorld()->GetTimerManager().ClearTimer(AutoEnqueueTimerHandle);
+    if (Scheduler.IsValid()) {
+        Scheduler->UnregisterStation(this);
     }
+    SourceInventoryCache.Reset();
 
     Super::EndPlay(Reason);
 }
@@ -230,8 +233,35 @@ void UConversionStationComponent::GetSourceInventories(AController *JobControlle
                                                        FGameplayTag &OutInputGroup, FGameplayTag &OutCatalystGroup) const {
     OutInvs.Reset();
     if (JobController) {
-        if (IInventoryProviderInterface *Prov = Cast<IInventoryProviderInterface>(JobController)) {
-            OutInvs = Prov->GetAllInventoryComponents();
+        // Resolved once per instigator; a new provider serial or a component that has since gone away invalidates it.
+        IInventoryProviderInterface *Prov = Cast<IInventoryProviderInterface>(JobController);
+        const uint32 Serial = Prov ? Prov->GetInventorySetSerial() : 0;
+        FSourceInventorySet *Cached = SourceInventoryCache.Find(JobController);
+        if (Cached && Cached->Serial == Serial) {
+            for (const TWeakObjectPtr<UMythicInventoryComponent> &Inv : Cached->Inventories) {
+                if (!Inv.IsValid()) {
+                    Cached = nullptr;
+                    break;
+                }
+                OutInvs.Add(Inv.Get());
+            }
+        }
+        else {
+            Cached = nullptr;
+        }
+        if (!Cached) {
+            OutInvs.Reset();
+            FSourceInventorySet &Entry = SourceInventoryCache.FindOrAdd(JobController);
+            Entry.Serial = Serial;
+            Entry.Inventories.Reset();
+            if (Prov) {
+                for (UMythicInventoryComponent *Inv : Prov->GetAllInventoryComponents()) {
+                    if (Inv) {
+                        OutInvs.Add(Inv);
+                        Entry.Inventories.Add(Inv);
+                    }
+                }
+            }
         }
         OutInputGroup = FGameplayTag(); // all player slots
         OutCatalystGroup = FGameplayTag();
@@ -263,37 +293,84 @@ void UConversionStationComponent::GatherInstances(const TArray<UMythicInventoryC
     }
 }
 
+int32 UConversionStationComponent::CountIngredientStacks(const FConversionIngredient &Ing,
+                                                         const TArray<UMythicInventoryComponent *> &Invs,
+                                                         const FGameplayTag &GroupFilter,
+                                                         const TArray<UMythicItemInstance *> &Insts) {
+    int32 Have = 0;
+    if (Ing.MatchMode == EConversionMatchMode::ExactItem) {
+        // Only the slots holding this definition — a 200-slot chest feeding the station costs O(matching slots), not
+        // O(slots), per ingredient. MatchesInstance still applies the level / tag requirements per instance.
+        const UItemDefinition *Def = Ing.ExactItem.Get();
+        if (!Def) {
+            return 0; // unloaded / unset — MatchesInstance would reject every instance anyway
+        }
+        for (const UMythicInventoryComponent *Inv : Invs) {
+            if (!Inv) {
+                continue;
+            }
+            const TArray<FMythicInventorySlotEntry> &AllSlots = Inv->GetAllSlots();
+            for (const int32 SlotIdx : Inv->GetSlotsHoldingItem(Def)) {
+                const FMythicInventorySlotEntry &Slot = AllSlots[SlotIdx];
+                if (GroupFilter.IsValid() && Slot.GroupTag != GroupFilter) {
+                    continue;
+                }
+                if (Ing.MatchesInstance(Slot.SlottedItemInstance)) {
+                    Have += Slot.SlottedItemInstance->GetStacks();
+                }
+            }
+        }
+        return Have;
+    }
+    // Tag queries match the effective type probe (definition type ∪ runtime tags) — no definition key to index by.
+    for (UMythicItemInstance *I : Insts) {
+        if (I && Ing.MatchesInstance(I)) {
+            Have += I->GetStacks();
+        }
+    }
+    return Have;
+}
+
+bool UConversionStationComponent::NeedsInstanceScan(const UConversionRecipe *R, bool bConsumed) {
+    for (const FConversionIngredient &Ing : R->Inputs) {
+        if (Ing.bConsumed == bConsumed && Ing.MatchMode != EConversionMatchMode::ExactItem) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool UConversionStationComponent::VerifyInputs(UConversionRecipe *R, AController *JobController, int32 Cycles, bool bCheckCatalysts) const {
-    if (!R) {
+    if (!R || CountAffordableCycles(R, JobController) < Cycles) {
         return false;
     }
+    if (bCheckCatalysts) {
+        return VerifyCatalystsPresent(R, JobController);
+    }
+    return true;
+}
+
+int32 UConversionStationComponent::CountAffordableCycles(UConversionRecipe *R, AController *JobController) const {
+    if (!R) {
+        return 0;
+    }
     TArray<UMythicInventoryComponent *> Invs;
     FGameplayTag InGroup, CatGroup;
     GetSourceInventories(JobController, Invs, InGroup, CatGroup);
 
     TArray<UMythicItemInstance *> Insts;
-    GatherInstances(Invs, InGroup, Insts);
+    if (NeedsInstanceScan(R, true)) {
+        GatherInstances(Invs, InGroup, Insts);
+    }
 
+    int32 Cycles = MAX_int32;
     for (const FConversionIngredient &Ing : R->Inputs) {
-        if (!Ing.bConsumed) {
+        if (!Ing.bConsumed || Ing.RequiredAmount <= 0) {
             continue;
         }
-        const int32 Need = Ing.RequiredAmount * Cycles;
-        int32 Have = 0;
-        for (UMythicItemInstance *I : Insts) {
-            if (I && Ing.MatchesInstance(I)) {
-                Have += I->GetStacks();
-            }
-        }
-        if (Have < Need) {
-            return false;
-        }
+        Cycles = FMath::Min(Cycles, CountIngredientStacks(Ing, Invs, InGroup, Insts) / Ing.RequiredAmount);
     }
-
-    if (bCheckCatalysts) {
-        return VerifyCatalystsPresent(R, JobController);
-    }
-    return true;
+    return Cycles;
 }
 
 bool UConversionStationComponent::VerifyCatalystsPresent(UConversionRecipe *R, AController *JobController) const {
@@ -305,18 +382,15 @@ bool UConversionStationComponent::VerifyCatalystsPresent(UConversionRecipe *R, A
     GetSourceInventories(JobController, Invs, InGroup, CatGroup);
 
     TArray<UMythicItemInstance *> Insts;
-    GatherInstances(Invs, CatGroup, Insts);
+    if (NeedsInstanceScan(R, false)) {
+        GatherInstances(Invs, CatGroup, Insts);
+    }
 
     for (const FConversionIngredient &Ing : R->Inputs) {
         if (Ing.bConsumed) {
             continue;
         }
-        int32 Have = 0;
-        for (UMythicItemInstance *I : Insts) {
-            if (I && Ing.MatchesInstance(I)) {
-                Have += I->GetStacks();
-            }
-        }
+        const int32 Have = CountIngredientStacks(Ing, Invs, CatGroup, Insts);
         if (Have < Ing.RequiredAmount) {
             return false;
         }
@@ -343,12 +417,7 @@ bool UConversionStationComponent::ConsumeInputs(UConversionRecipe *R, AControlle
             continue;
         }
         const int32 Need = Ing.RequiredAmount * Cycles;
-        int32 Have = 0;
-        for (UMythicItemInstance *I : Insts) {
-            if (I && Ing.MatchesInstance(I)) {
-                Have += I->GetStacks();
-            }
-        }
+        const int32 Have = CountIngredientStacks(Ing, Invs, InGroup, Insts);
         if (Have < Need) {
             return false;
         }
@@ -500,11 +569,12 @@ bool UConversionStationComponent::ConsumeInputs(UConversionRecipe *R, AControlle
     return true;
 }
 
-bool UConversionStationComponent::EnsureFuel(UConversionRecipe *R) {
+bool UConversionStationComponent::EnsureFuel(UConversionRecipe *R, int32 Cycles) {
     if (!R || !R->Process.bRequiresFuel) {
         return true;
     }
-    if (FuelState.BufferedBurnSeconds >= R->Process.Duration) {
+    const float Target = R->Process.Duration * FMath::Max(1, Cycles);
+    if (FuelState.BufferedBurnSeconds >= Target) {
         return true;
     }
     if (!StationInv.IsValid()) {
@@ -513,7 +583,7 @@ bool UConversionStationComponent::EnsureFuel(UConversionRecipe *R) {
 
     bool bChanged = false;
     bool bExhausted = false;
-    while (FuelState.BufferedBurnSeconds < R->Process.Duration && !bExhausted) {
+    while (FuelState.BufferedBurnSeconds < Target && !bExhausted) {
         UMythicItemInstance *FuelInst = nullptr;
         const FFuelDefinition *MatchedFuel = nullptr;
 
@@ -546,8 +616,11 @@ bool UConversionStationComponent::EnsureFuel(UConversionRecipe *R) {
             break;
         }
 
-        StationInv->ServerRemoveItem(FuelInst, 1);
-        FuelState.BufferedBurnSeconds += MatchedFuel->BurnSecondsPerUnit;
+        // Every unit this stack can put toward the target in one removal (a single unit on the live one-cycle path).
+        const int32 Deficit = FMath::CeilToInt32((Target - FuelState.BufferedBurnSeconds) / MatchedFuel->BurnSecondsPerUnit);
+        const int32 Units = FMath::Clamp(Deficit, 1, FMath::Max(1, FuelInst->GetStacks()));
+        StationInv->ServerRemoveItem(FuelInst, Units);
+        FuelState.BufferedBurnSeconds += MatchedFuel->BurnSecondsPerUnit * Units;
         FuelState.CapacityHintSeconds = FMath::Max(FuelState.CapacityHintSeconds, FuelState.BufferedBurnSeconds);
         bChanged = true;
     }
@@ -560,6 +633,133 @@ bool UConversionStationComponent::EnsureFuel(UConversionRecipe *R) {
     return FuelState.BufferedBurnSeconds >= R->Process.Duration;
 }
 
+int32 UConversionStationComponent::CountFuelCycles(UConversionRecipe *R) const {
+    if (!R || !R->Process.bRequiresFuel || R->Process.Duration <= 0.0f) {
+        return MAX_int32;
+    }
+    double Seconds = FuelState.BufferedBurnSeconds;
+    if (StationInv.IsValid()) {
+        for (const FMythicInventorySlotEntry &Slot : StationInv->GetAllSlots()) {
+            if (!Slot.SlottedItemInstance || (FuelGroupTag.IsValid() && Slot.GroupTag != FuelGroupTag)) {
+                continue;
+            }
+            const FFuelDefinition *MatchedFuel = R->Process.AcceptedFuels.FindByPredicate([&Slot](const FFuelDefinition &Fuel) {
+                return Fuel.FuelMatch.MatchesInstance(Slot.SlottedItemInstance);
+            });
+            if (!MatchedFuel) {
+                continue;
+            }
+            if (MatchedFuel->BurnSecondsPerUnit <= 0.0f) {
+                break; // EnsureFuel stops at an unusable fuel too
+            }
+            Seconds += static_cast<double>(MatchedFuel->BurnSecondsPerUnit) * Slot.SlottedItemInstance->GetStacks();
+        }
+    }
+    return static_cast<int32>(FMath::Min<double>(FMath::FloorToDouble(Seconds / R->Process.Duration), MAX_int32));
+}
+
+int32 UConversionStationComponent::CountOutputCycles(UConversionRecipe *R, int32 MaxCycles) const {
+    if (!R || R->Process.OutputRouting != EConversionOutputRouting::StationOutputSlots || !StationInv.IsValid()) {
+        return MaxCycles; // routed to the instigator / the world: no station space to run out of
+    }
+
+    // Per-definition demand at full probability (a worst case). Transforms keep their instance: one unstackable slot each,
+    // of the target definition when the product names one (else the input's, unknown here — only unwhitelisted slots).
+    TArray<FConversionOutputDemand, TInlineAllocator<4>> Demands;
+    TArray<const UItemDefinition *, TInlineAllocator<4>> DemandDefs;
+    for (const FConversionProduct &P : R->Products) {
+        if (P.Probability <= 0.0f) {
+            continue;
+        }
+        const bool bCreate = P.Mode == EConversionProductMode::Create;
+        const UItemDefinition *Def = bCreate ? P.ItemDefinition.Get() : P.TransformToDefinition.Get();
+        if (bCreate && !Def) {
+            continue; // ProduceAndRoute skips it
+        }
+        int32 Index = bCreate ? DemandDefs.IndexOfByKey(Def) : INDEX_NONE;
+        if (Index == INDEX_NONE) {
+            Index = Demands.AddDefaulted();
+            DemandDefs.Add(Def);
+            if (bCreate) {
+                Demands[Index].StackMax = FMath::Max(1, Def->StackSizeMax);
+                const TArray<FMythicInventorySlotEntry> &AllSlots = StationInv->GetAllSlots();
+                for (const int32 SlotIdx : StationInv->GetPartialStackSlots(Def)) {
+                    Demands[Index].PartialSpace += Demands[Index].StackMax - AllSlots[SlotIdx].SlottedItemInstance->GetStacks();
+                }
+            }
+        }
+        Demands[Index].UnitsPerCycle += bCreate ? P.Quantity : 1;
+    }
+    if (Demands.IsEmpty()) {
+        return MaxCycles;
+    }
+
+    int32 EmptySlots = 0;
+    for (const FMythicInventorySlotEntry &Slot : StationInv->GetAllSlots()) {
+        if (Slot.SlottedItemInstance) {
+            continue;
+        }
+        const bool bOpen = !Slot.SlotDefinition || Slot.SlotDefinition->WhitelistedItemTypes.Num() == 0;
+        bool bAny = false;
+        for (int32 d = 0; d < Demands.Num(); ++d) {
+            if (bOpen || (DemandDefs[d] && DemandDefs[d]->ItemType.MatchesAny(Slot.SlotDefinition->WhitelistedItemTypes))) {
+                ++Demands[d].EmptySlots;
+                bAny = true;
+            }
+        }
+        EmptySlots += bAny ? 1 : 0;
+    }
+    return ComputeOutputCapacityCycles(Demands, EmptySlots, MaxCycles);
+}
+
+int32 UConversionStationComponent::ClampCatchUpCycles(int32 Elapsed, int32 InputCycles, int32 FuelCycles, int32 OutputCycles,
+                                                      bool bCatalystsPresent) {
+    if (Elapsed <= 0) {
+        return 0;
+    }
+    if (!bCatalystsPresent) {
+        return 1;
+    }
+    int64 Cycles = Elapsed;
+    Cycles = FMath::Min<int64>(Cycles, 1 + static_cast<int64>(FMath::Max(0, InputCycles)));
+    Cycles = FMath::Min<int64>(Cycles, FMath::Max(1, FuelCycles));
+    Cycles = FMath::Min<int64>(Cycles, FMath::Max(1, OutputCycles));
+    return static_cast<int32>(Cycles);
+}
+
+int32 UConversionStationComponent::ComputeOutputCapacityCycles(TConstArrayView<FConversionOutputDemand> Demands, int32 EmptySlots,
+                                                               int32 MaxCycles) {
+    auto Fits = [&](int32 Cycles) {
+        int64 SlotsNeeded = 0;
+        for (const FConversionOutputDemand &D : Demands) {
+            if (D.UnitsPerCycle <= 0) {
+                continue;
+            }
+            const int64 Overflow = FMath::Max<int64>(0, static_cast<int64>(Cycles) * D.UnitsPerCycle - D.PartialSpace);
+            const int64 Needed = (Overflow + FMath::Max(1, D.StackMax) - 1) / FMath::Max(1, D.StackMax);
+            if (Needed > D.EmptySlots) {
+                return false;
+            }
+            SlotsNeeded += Needed;
+        }
+        return SlotsNeeded <= EmptySlots;
+    };
+
+    // Fits is monotone in Cycles: binary search the largest count that still fits.
+    int32 Lo = 0;
+    int32 Hi = FMath::Max(0, MaxCycles);
+    while (Lo < Hi) {
+        const int32 Mid = Lo + (Hi - Lo + 1) / 2;
+        if (Fits(Mid)) {
+            Lo = Mid;
+        }
+        else {
+            Hi = Mid - 1;
+        }
+    }
+    return Lo;
+}
+
 int32 UConversionStationComponent::ResolveProductLevel(EProductLevelMode LevelMode, int32 InputLevel, int32 InStationLevel, int32 FixedLevel) {
     switch (LevelMode) {
     case EProductLevelMode::InheritInputLevel:
@@ -625,7 +825,7 @@ void UConversionStationComponent::RouteInstance(UMythicItemInstance *Inst, EConv
     }
 }
 
-void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FConversionJobEntry &Job) {
+void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FConversionJobEntry &Job, int32 Cycles) {
     UMythicLootManagerSubsystem *Loot = GetWorld() && GetWorld()->GetGameInstance()
         ? GetWorld()->GetGameInstance()->GetSubsystem<UMythicLootManagerSubsystem>()
         : nullptr;
@@ -643,11 +843,17 @@ void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FC
     int32 TransformCursor = 0;
 
     for (const FConversionProduct &P : R->Products) {
-        if (FMath::FRand() >= P.Probability) {
-            continue;
-        }
-
         if (P.Mode == EConversionProductMode::Create) {
+            // Each cycle rolls on its own; the successes are minted together, in MaxStack chunks.
+            int32 Successes = 0;
+            for (int32 c = 0; c < Cycles; c++) {
+                if (FMath::FRand() < P.Probability) {
+                    Successes++;
+                }
+            }
+            if (Successes == 0) {
+                continue;
+            }
             UItemDefinition *Def = P.ItemDefinition.Get();
             if (!Def) {
                 UE_LOG(Myth, Warning, TEXT("ConversionStation: product item def unresolved; skipped."));
@@ -655,7 +861,7 @@ void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FC
             }
             const int32 Level = ComputeProductLevel(P, Job);
             const int32 MaxStack = Def->StackSizeMax > 0 ? Def->StackSizeMax : 1;
-            int32 Remaining = P.Quantity;
+            int32 Remaining = P.Quantity * Successes;
             while (Remaining > 0) {
                 const int32 Take = FMath::Min(Remaining, MaxStack);
                 if (UMythicItemInstance *Inst = Loot->Create(Def, Take, nullptr, Level)) {
@@ -663,8 +869,14 @@ void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FC
                 }
                 Remaining -= Take;
             }
+            continue;
         }
-        else { // Transform
+
+        // Transform: each successful cycle transforms the next held input.
+        for (int32 c = 0; c < Cycles; c++) {
+            if (FMath::FRand() >= P.Probability) {
+                continue;
+            }
             UMythicItemInstance *T = Held.IsValidIndex(TransformCursor) ? Held[TransformCursor] : nullptr;
             TransformCursor++;
             if (!IsValid(T)) {
@@ -697,7 +909,7 @@ void UConversionStationComponent::ProduceAndRoute(UConversionRecipe *R, const FC
         }
     }
 
-    // Remove exactly the held instances routed this cycle, matched by identity (not by tail position).
+    // Remove exactly the held instances routed by these cycles, matched by identity (not by tail position).
     for (int32 c = 0; c < TransformCursor; c++) {
         UMythicItemInstance *Routed = Held[c];
         for (int32 i = HeldTransforms.Num() - 1; i >= 0; i--) {
@@ -790,7 +1002,7 @@ void UConversionStationComponent::AdvanceProcessing() {
     if (!HasAuthority() || !GetWorld()) {
         return;
     }
-    if (GetWorld()->GetTimerManager().IsTimerActive(ProcessTimerHandle)) {
+    if (IsCycleScheduled()) {
         return;
     }
 
@@ -841,8 +1053,7 @@ void UConversionStationComponent::AdvanceProcessing() {
         CompleteCurrentCycleAndContinue();
     }
     else {
-        GetWorld()->GetTimerManager().SetTimer(ProcessTimerHandle, this, &UConversionStationComponent::OnCycleComplete,
-                                               FMath::Max(Head->CycleDuration, UE_KINDA_SMALL_NUMBER), false);
+        ScheduleCycleCompletion(Head->CycleDuration);
     }
 }
 
@@ -895,11 +1106,159 @@ void UConversionStationComponent::OnCycleComplete() {
     CompleteCurrentCycleAndContinue();
 }
 
+void UConversionStationComponent::ScheduleCycleCompletion(float Delay) {
+    if (Scheduler.IsValid()) {
+        Scheduler->Schedule(this, EConversionScheduledWork::CycleComplete, FMath::Max(Delay, UE_KINDA_SMALL_NUMBER));
+    }
+}
+
+bool UConversionStationComponent::IsCycleScheduled() const {
+    return Scheduler.IsValid() && Scheduler->IsScheduled(this, EConversionScheduledWork::CycleComplete);
+}
+
+void UConversionStationComponent::CatchUpDormantCycles() {
+    if (!HasAuthority() || !GetWorld()) {
+        return;
+    }
+    const double Now = ServerNow();
+
+    // One pass per job that ran out while unobserved: each next head is started as of when its predecessor ended and
+    // settled the same way. Every pass but the last removes a job, so the queue length bounds it.
+    for (int32 Pass = 0; Pass <= MaxQueueLength; ++Pass) {
+        FConversionJobEntry *Head = Jobs.EditHead();
+        if (!Head || Head->State != EConversionJobState::Processing) {
+            if (Pass == 0) {
+                AdvanceProcessing();
+            }
+            return;
+        }
+        double JobEndTime = 0.0;
+        if (!CatchUpHeadJob(Now, JobEndTime)) {
+            return;
+        }
+
+        AdvanceProcessing(); // starts (and arms) the next head as of now
+        Head = Jobs.EditHead();
+        if (!Head || Head->State != EConversionJobState::Processing || Head->CycleDuration <= 0.f) {
+            return;
+        }
+        Head->CycleStartServerTime = JobEndTime;
+        Jobs.MarkDirtyAt(0);
+        ScheduleCycleCompletion(static_cast<float>(Head->CycleStartServerTime + Head->CycleDuration - Now));
+    }
+}
+
+bool UConversionStationComponent::CatchUpHeadJob(double Now, double &OutJobEndTime) {
+    if (Scheduler.IsValid()) {
+        Scheduler->Cancel(this, EConversionScheduledWork::CycleComplete);
+    }
+    FConversionJobEntry *Head = Jobs.EditHead();
+    UConversionRecipe *R = Head && Subsystem.IsValid() ? Subsystem->GetRecipeById(Head->RecipeId) : nullptr;
+    if (!R || Head->CycleDuration <= 0.f) {
+        CompleteCurrentCycleAndContinue(); // the live path (it stalls a head whose recipe is gone)
+        return false;
+    }
+
+    const int32 Elapsed = UConversionSchedulerSubsystem::ComputeElapsedCycles(
+        Head->CycleStartServerTime, Head->CycleDuration, Now, Head->Quantity, MaxCatchUpCycles);
+    if (Elapsed <= 0) {
+        ScheduleCycleCompletion(static_cast<float>(Head->CycleStartServerTime + Head->CycleDuration - Now));
+        return false;
+    }
+
+    // N = the elapsed cycles the station could actually have run: the in-progress one is paid for; further ones need
+    // inputs (Continuous pays per cycle — Timed paid them all at enqueue), fuel, catalysts and somewhere to put output.
+    AController *C = ResolveInstigatorController(Head->JobId);
+    const bool bContinuous = R->Process.Timing == EConversionTiming::Continuous;
+    int32 Cycles = ClampCatchUpCycles(Elapsed,
+                                      bContinuous ? CountAffordableCycles(R, C) : MAX_int32,
+                                      CountFuelCycles(R),
+                                      CountOutputCycles(R, Elapsed),
+                                      VerifyCatalystsPresent(R, C));
+
+    const FConversionJobEntry FirstCycle = *Head; // stable copy for production
+    bMutatingStationInv = true;
+
+    // Fuel for all N in one draw, then inputs for cycles 2..N in one consume. Either coming up short (it was just
+    // counted, so only on a mismatch between the count and the take) settles fewer cycles rather than overdrawing.
+    if (R->Process.bRequiresFuel) {
+        EnsureFuel(R, Cycles);
+        Cycles = FMath::Clamp(FMath::FloorToInt32(FuelState.BufferedBurnSeconds / FirstCycle.CycleDuration), 1, Cycles);
+    }
+    int32 LaterLevel = FirstCycle.SnapshotInputLevel;
+    if (bContinuous && Cycles > 1 && !ConsumeInputs(R, C, Cycles - 1, FirstCycle.JobId, LaterLevel)) {
+        Cycles = 1;
+    }
+
+    if (bContinuous) {
+        ProduceAndRoute(R, FirstCycle, 1);
+        if (Cycles > 1) {
+            FConversionJobEntry LaterCycles = FirstCycle;
+            LaterCycles.SnapshotInputLevel = LaterLevel;
+            ProduceAndRoute(R, LaterCycles, Cycles - 1);
+        }
+        // Everything reserved so far is produced now (see CompleteCurrentCycleAndContinue).
+        if (FJobReservation *Res = JobReservations.Find(FirstCycle.JobId)) {
+            Res->Items.Reset();
+        }
+    }
+    else {
+        ProduceAndRoute(R, FirstCycle, Cycles);
+    }
+
+    if (R->Process.bRequiresFuel) {
+        FuelState.BufferedBurnSeconds = FMath::Max(0.f, FuelState.BufferedBurnSeconds - Cycles * FirstCycle.CycleDuration);
+        FuelState.LastSampleServerTime = ServerNow();
+        OnFuelChanged.Broadcast();
+    }
+
+    const int32 HeadIdx = Jobs.IndexOfId(FirstCycle.JobId);
+    Head = (HeadIdx == 0) ? Jobs.EditHead() : nullptr;
+    if (!Head) {
+        bMutatingStationInv = false;
+        AdvanceProcessing();
+        return false;
+    }
+
+    const double CyclesEnd = FirstCycle.CycleStartServerTime + Cycles * static_cast<double>(FirstCycle.CycleDuration);
+    const bool bUnbounded = (Head->Quantity == 0);
+    if (!bUnbounded) {
+        Head->Quantity = FMath::Max(0, Head->Quantity - Cycles);
+    }
+
+    if (!bUnbounded && Head->Quantity == 0) {
+        const FConversionJobEntry Completed = *Head;
+        Jobs.RemoveAt(0);
+        ClearJobBookkeeping(Completed.JobId);
+        bMutatingStationInv = false;
+        OnJobCompleted.Broadcast(Completed);
+        OnJobsChanged.Broadcast();
+        OutJobEndTime = CyclesEnd;
+        return true;
+    }
+
+    const bool bStarted = BeginCycle(*Head, R, /*bReConsume=*/true);
+    bMutatingStationInv = false;
+    if (!bStarted) {
+        return false; // stalled on catalysts / fuel / inputs, where the live loop would have
+    }
+    if (Cycles == Elapsed) {
+        // Only time ran out: the next cycle began when the last settled one ended. (Clamped short, the station sat
+        // idle on a missing resource instead, and the cycle starts now.)
+        Head->CycleStartServerTime = CyclesEnd;
+        Jobs.MarkDirtyAt(0);
+    }
+    ScheduleCycleCompletion(static_cast<float>(Head->CycleStartServerTime + Head->CycleDuration - Now));
+    return false;
+}
+
 void UConversionStationComponent::CompleteCurrentCycleAndContinue() {
     if (!HasAuthority() || !GetWorld()) {
         return;
     }
-    GetWorld()->GetTimerManager().ClearTimer(ProcessTimerHandle);
+    if (Scheduler.IsValid()) {
+        Scheduler->Cancel(this, EConversionScheduledWork::CycleComplete);
+    }
 
     int32 Safety = 0;
     while (true) {
@@ -962,8 +1321,7 @@ void UConversionStationComponent::CompleteCurrentCycleAndContinue() {
                 if (R->Process.Timing == EConversionTiming::Instant) {
                     continue; // produce the next cycle immediately
                 }
-                GetWorld()->GetTimerManager().SetTimer(ProcessTimerHandle, this, &UConversionStationComponent::OnCycleComplete,
-                                                       FMath::Max(Head->CycleDuration, UE_KINDA_SMALL_NUMBER), false);
+                ScheduleCycleCompletion(Head->CycleDuration);
                 return;
             }
             // BeginCycle stalled the head (missing fuel/input/catalyst).
@@ -999,10 +1357,10 @@ void UConversionStationComponent::ScheduleAutoEnqueue() {
     if (!HasAuthority() || !GetWorld()) {
         return;
     }
-    if (GetWorld()->GetTimerManager().IsTimerActive(AutoEnqueueTimerHandle)) {
+    if (!Scheduler.IsValid() || Scheduler->IsScheduled(this, EConversionScheduledWork::AutoEnqueue)) {
         return;
     }
-    GetWorld()->GetTimerManager().SetTimer(AutoEnqueueTimerHandle, this, &UConversionStationComponent::TryAutoEnqueue, 0.01f, false);
+    Scheduler->Schedule(this, EConversionScheduledWork::AutoEnqueue, 0.01f);
 }
 
 void UConversionStationComponent::TryAutoEnqueue() {
@@ -1126,6 +1484,13 @@ void UConversionStationComponent::Server_RegisterInstigator(AController *Control
     S.Pawn = RangeActor;
     // Back-date so the first craft right after opening isn't swallowed by the rate limiter.
     S.LastRequestServerTime = ServerNow() - kMinRequestInterval;
+
+    // A (re-)opening instigator may bring a different provider set; re-resolve on the next verify.
+    SourceInventoryCache.Remove(Controller);
+    // Someone is looking: settle any cycles that ran while the station was unobserved before they see the queue.
+    if (Scheduler.IsValid()) {
+        Scheduler->NotifyObserved(this);
+    }
 }
 
 void UConversionStationComponent::Server_RequestStart(AController *Controller, FGameplayTag RecipeId, int32 Quantity) {
@@ -1229,8 +1594,8 @@ void UConversionStationComponent::Server_CancelJob(AController *Controller, int3
 
     const FConversionJobEntry JobCopy = Jobs.GetItems()[Idx];
 
-    if (Idx == 0 && GetWorld() && GetWorld()->GetTimerManager().IsTimerActive(ProcessTimerHandle)) {
-        GetWorld()->GetTimerManager().ClearTimer(ProcessTimerHandle);
+    if (Idx == 0 && Scheduler.IsValid()) {
+        Scheduler->Cancel(this, EConversionScheduledWork::CycleComplete);
     }
 
     RefundJob(JobCopy);
@@ -11,7 +11,9 @@ class UMythicInventoryComponent;
 class UMythicItemInstance;
 class UItemDefinition;
 class UConversionRecipe;
+struct FConversionIngredient;
 class UConversionSubsystem;
+class UConversionSchedulerSubsystem;
 class AController;
 class UAbilitySystemComponent;
 class IInventoryProviderInterface;
@@ -88,6 +90,16 @@ struct TStructOpsTypeTraits<FConversionJobArray> : TStructOpsTypeTraitsBase2<FCo
     enum { WithNetDeltaSerializer = true };
 };
 
+/** One product definition's claim on the station's output slots, per cycle (see ComputeOutputCapacityCycles). */
+struct FConversionOutputDemand {
+    int32 UnitsPerCycle = 0;
+    int32 StackMax = 1;
+    // Free units left in existing partial stacks of the definition.
+    int32 PartialSpace = 0;
+    // Empty slots whose whitelist admits the definition.
+    int32 EmptySlots = 0;
+};
+
 /** Replicated fuel buffer state (furnace/fireplace). */
 USTRUCT()
 struct FConversionFuelState {
@@ -188,8 +200,7 @@ protected:
     float UseRangeTolerance = 50.f;
 
     // ---- Server-only runtime (NOT replicated) ----
-    FTimerHandle ProcessTimerHandle;
-    FTimerHandle AutoEnqueueTimerHandle;
+    // Cycle completions + auto-enqueue checks are armed on the world's UConversionSchedulerSubsystem (no per-station timers).
     int32 NextJobId = 1;
     float ServerUseRangeSq = 0.f;
     bool bMutatingStationInv = false;
@@ -224,6 +235,16 @@ protected:
 
     TMap<int32, FJobReservation> JobReservations;
 
+    // Instigator → its provider's inventory set, resolved once instead of per verify/consume call. Dropped when the
+    // instigator (re-)registers; re-resolved when the provider's GetInventorySetSerial moves on (a bag gained or lost)
+    // or a cached component has gone away.
+    struct FSourceInventorySet {
+        uint32 Serial = 0;
+        TArray<TWeakObjectPtr<UMythicInventoryComponent>> Inventories;
+    };
+
+    mutable TMap<TWeakObjectPtr<AController>, FSourceInventorySet> SourceInventoryCache;
+
     // Transform products release (not destroy) their input; the instances are GC-rooted here until routed.
     UPROPERTY()
     TArray<FHeldTransform> HeldTransforms;
@@ -232,6 +253,8 @@ protected:
     TWeakObjectPtr<UMythicInventoryComponent> StationInv;
     UPROPERTY(Transient)
     TWeakObjectPtr<UConversionSubsystem> Subsystem;
+    UPROPERTY(Transient)
+    TWeakObjectPtr<UConversionSchedulerSubsystem> Scheduler;
 
     UFUNCTION()
     void OnRep_Fuel();
@@ -244,6 +267,15 @@ protected:
     bool BeginCycle(FConversionJobEntry &Head, UConversionRecipe *Recipe, bool bReConsume);
     void CompleteCurrentCycleAndContinue();
     void OnCycleComplete();
+    // Arm the head's cycle completion on the scheduler Delay seconds out / is one armed (or parked)?
+    void ScheduleCycleCompletion(float Delay);
+    bool IsCycleScheduled() const;
+    // Scheduler callback when a parked cycle is observed: settle every cycle that elapsed while unobserved — N at a time
+    // per job, not one by one — then re-arm the in-progress one for its remaining time.
+    void CatchUpDormantCycles();
+    // Settle the head job's elapsed cycles in one step. True when that finished the job (OutJobEndTime = when its last
+    // cycle ended); false when the head is still running (re-armed) or stalled.
+    bool CatchUpHeadJob(double Now, double &OutJobEndTime);
     void ScheduleAutoEnqueue();
     void TryAutoEnqueue();
     UFUNCTION()
@@ -254,12 +286,21 @@ protected:
                               FGameplayTag &OutInputGroup, FGameplayTag &OutCatalystGroup) const;
     void GatherInstances(const TArray<UMythicInventoryComponent *> &Invs, const FGameplayTag &GroupFilter,
                          TArray<UMythicItemInstance *> &Out) const;
+    static bool NeedsInstanceScan(const UConversionRecipe *R, bool bConsumed);
 
     bool VerifyInputs(UConversionRecipe *R, AController *JobController, int32 Cycles, bool bCheckCatalysts) const;
+    // Whole cycles of consumed inputs the sources hold (MAX_int32 when the recipe consumes nothing).
+    int32 CountAffordableCycles(UConversionRecipe *R, AController *JobController) const;
     bool ConsumeInputs(UConversionRecipe *R, AController *JobController, int32 Cycles, int32 JobId, int32 &OutSnapshotLevel);
     bool VerifyCatalystsPresent(UConversionRecipe *R, AController *JobController) const;
-    bool EnsureFuel(UConversionRecipe *R);
-    void ProduceAndRoute(UConversionRecipe *R, const FConversionJobEntry &Job);
+    // Top the fuel buffer up to cover Cycles cycles, drawing whole stacks' worth of units per removal.
+    bool EnsureFuel(UConversionRecipe *R, int32 Cycles = 1);
+    // Cycles the buffer plus the fuel slots' stock can burn through (MAX_int32 when the recipe needs no fuel).
+    int32 CountFuelCycles(UConversionRecipe *R) const;
+    // Cycles whose products the station's output slots can take, up to MaxCycles (MaxCycles when routed elsewhere).
+    int32 CountOutputCycles(UConversionRecipe *R, int32 MaxCycles) const;
+    // Produce Cycles cycles' worth of products in one pass (creates are minted as combined stacks).
+    void ProduceAndRoute(UConversionRecipe *R, const FConversionJobEntry &Job, int32 Cycles = 1);
     void RouteInstance(UMythicItemInstance *Inst, EConversionOutputRouting Routing, const FConversionJobEntry &Job);
     void RefundJob(const FConversionJobEntry &Job);
     void MintTo(UItemDefinition *Def, int32 Qty, AController *C, int32 Level) const;
@@ -268,6 +309,8 @@ protected:
     bool IsActorInRange(const AActor *A) const;
     bool HasAuthority() const;
     double ServerNow() const;
+    // Upper bound on cycles one fast-forward settles per job; time beyond it is forfeited.
+    static constexpr int32 MaxCatchUpCycles = 1024;
     int32 ComputeProductLevel(const struct FConversionProduct &P, const FConversionJobEntry &Job) const;
 
 public:
@@ -281,6 +324,23 @@ public:
      *  InheritInputLevel→InputLevel, InheritStationLevel→StationLevel. Static + pure (no actor/world). */
     static int32 ResolveProductLevel(EProductLevelMode LevelMode, int32 InputLevel, int32 InStationLevel, int32 FixedLevel);
 
+    /** How many of Elapsed unobserved cycles a catch-up may settle. The in-progress cycle (already paid for) always
+     *  completes; the rest are limited by the further cycles' worth of consumed inputs on hand (InputCycles), the cycles
+     *  the fuel covers (FuelCycles, counting the in-progress one) and the output space (OutputCycles, likewise). Missing
+     *  catalysts stop it after the in-progress cycle. Returns 0 only when nothing elapsed. Pure (static for tests). */
+    static int32 ClampCatchUpCycles(int32 Elapsed, int32 InputCycles, int32 FuelCycles, int32 OutputCycles, bool bCatalystsPresent);
+
+    /** Largest N <= MaxCycles for which N cycles of every demand fit: each definition fills its partial stacks first,
+     *  then needs whole empty slots it is allowed into, and all definitions together draw on EmptySlots. Pure (static
+     *  for tests). */
+    static int32 ComputeOutputCapacityCycles(TConstArrayView<FConversionOutputDemand> Demands, int32 EmptySlots, int32 MaxCycles);
+
+    /** Stacks matching Ing across Invs (GroupFilter-limited). ExactItem ingredients read each inventory's per-definition
+     *  slot index (O(matching slots)); tag-query ingredients scan Insts, which the caller gathers only when one exists.
+     *  Static for tests. */
+    static int32 CountIngredientStacks(const FConversionIngredient &Ing, const TArray<UMythicInventoryComponent *> &Invs,
+                                       const FGameplayTag &GroupFilter, const TArray<UMythicItemInstance *> &Insts);
+
     UPROPERTY(BlueprintAssignable, Category="Conversion")
     FOnConversionJobsChanged OnJobsChanged;
     UPROPERTY(BlueprintAssignable, Category="Conversion")
@@ -311,4 +371,7 @@ public:
     void Server_RequestStart(AController *Controller, FGameplayTag RecipeId, int32 Quantity);
     void Server_CancelJob(AController *Controller, int32 JobId);
     void Server_SetAutoRepeat(AController *Controller, bool bRepeat);
+
+private:
+    friend class UConversionSchedulerSubsystem;
 };
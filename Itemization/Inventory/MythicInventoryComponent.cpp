@@ -18,6 +18,7 @@
 #include "AbilitySystemComponent.h"    // ...to read its owned gameplay tags
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Algo/BinarySearch.h"       // slot index: sorted per-definition slot lists
 #include "Fragments/ActionableItemFragment.h"
 #include "Mythic/Itemization/MythicTags_Inventory.h"
 
@@ -526,8 +527,10 @@ int32 UMythicInventoryComponent::AddToAnySlot(UMythicItemInstance *ItemInstance,
     // a full incoming stack skip merging entirely, so it never topped off partials and wasted slots. (isStackableWith below
     // still guards real compatibility.)
     if (StackDef && ShouldAttemptStackMerge(StackDef->StackSizeMax)) {
-        // Add to existing stack
-        for (int32 i = 0; i < Slots.Num(); ++i) {
+        // Add to existing stack — only the partial stacks of this definition (per-definition index), ascending like the
+        // old full-slot walk. Copied: topping a stack off re-indexes it (it leaves the partial list) mid-loop.
+        const TArray<int32, TInlineAllocator<16>> PartialSlots(GetPartialStackSlots(StackDef));
+        for (const int32 i : PartialSlots) {
             auto ItemInSlot = Slots.Items[i].SlottedItemInstance;
             if (bFromPlayer && !Slots.Items[i].bCanPlayerPut) {
                 continue;
@@ -781,6 +784,7 @@ void UMythicInventoryComponent::HandleSlotsAdded(const TArrayView<int32> &AddedI
 
     // Structural change: rebuild VM once, then refresh changed slots (no-cost if rebuild already covers)
     SetupLocalViewModel();
+    bSlotIndexStale = true;
 
     if (NumAdded > 0) {
         OnInventorySizeChanged.Broadcast(FinalSize, OldSize);
@@ -803,6 +807,7 @@ void UMythicInventoryComponent::HandleSlotsChanged(const TArrayView<int32> &Chan
         if (Slots.IsValidIndex(idx)) {
             Slots.Items[idx].ClientUpdateActiveState(this);
         }
+        RefreshSlotIndex(idx);
 
         OnSlotUpdated.Broadcast(idx);
         if (IsValid(ViewModel)) {
@@ -837,6 +842,7 @@ void UMythicInventoryComponent::HandleSlotsRemoved(const TArrayView<int32> &Remo
 
     // Structural change: rebuild VM
     SetupLocalViewModel();
+    bSlotIndexStale = true;
 
     if (NumRemoved > 0) {
         OnInventorySizeChanged.Broadcast(FinalSize, OldSize);
@@ -852,14 +858,9 @@ int32 UMythicInventoryComponent::GetItemCount(UItemDefinition *RequiredItem) con
         return 0; // Early return for null definition
     }
 
-    int32 count = 0;
-    for (const FMythicInventorySlotEntry &Slot : Slots.Items) {
-        if (Slot.SlottedItemInstance && Slot.SlottedItemInstance->GetItemDefinition() == RequiredItem) {
-            count += Slot.SlottedItemInstance->GetStacks();
-        }
-    }
-
-    return count;
+    EnsureSlotIndex();
+    const FItemDefIndexEntry *Entry = ItemDefIndex.Find(TObjectKey<UItemDefinition>(RequiredItem));
+    return Entry ? Entry->TotalStacks : 0;
 }
 
 void UMythicInventoryComponent::ServerRemoveItem_Implementation(UMythicItemInstance *ItemInstance, int32 Amount) {
@@ -898,8 +899,11 @@ void UMythicInventoryComponent::ServerRemoveItemByDefinition_Implementation(UIte
     checkf(ItemDef != nullptr, TEXT("RemoveItem:: Invalid ItemDef!"));
     checkf(Amount > 0, TEXT("RemoveItem:: Invalid Amount!"));
 
+    // Only the slots holding ItemDef (per-definition index), ascending like the old full walk. Copied: each destroy /
+    // stack change re-indexes its slot mid-loop.
+    const TArray<int32, TInlineAllocator<16>> HoldingSlots(GetSlotsHoldingItem(ItemDef));
     int32 RemovedSoFar = 0;
-    for (int32 i = 0; i < Slots.Items.Num(); ++i) {
+    for (const int32 i : HoldingSlots) {
         FMythicInventorySlotEntry &Slot = Slots.Items[i];
         UMythicItemInstance *item = Slot.SlottedItemInstance;
         if (!item) {
@@ -963,6 +967,7 @@ void UMythicInventoryComponent::DestroyAllSlots() {
     }
 
     Slots.Items.Empty();
+    bSlotIndexStale = true;
 }
 
 void UMythicInventoryComponent::OnUnregister() {
@@ -987,28 +992,114 @@ float UMythicInventoryComponent::ComputeSlotWeight(float UnitWeight, int32 Stack
 }
 
 float UMythicInventoryComponent::GetTotalCarriedWeight() const {
-    float Total = 0.0f;
-    for (const FMythicInventorySlotEntry &Entry : Slots.GetItems()) {
-        const UMythicItemInstance *Inst = Entry.SlottedItemInstance;
-        if (Inst && Inst->GetItemDefinition()) {
-            Total += ComputeSlotWeight(Inst->GetItemDefinition()->Weight, Inst->GetStacks());
-        }
-    }
-    return Total;
+    EnsureSlotIndex();
+    return FMath::Max(0.0f, CarriedWeight); // delta accumulation can leave a -epsilon on an emptied inventory
 }
 
 int32 UMythicInventoryComponent::GetTotalCurrency() const {
-    int32 Total = 0;
-    for (const FMythicInventorySlotEntry &Entry : Slots.GetItems()) {
-        const UMythicItemInstance *Inst = Entry.SlottedItemInstance;
-        if (Inst && Inst->GetItemDefinition() && Inst->GetItemDefinition()->ItemType.MatchesTag(ITEMIZATION_TYPE_CURRENCY)) {
-            Total += FMath::Max(0, Inst->GetStacks());
-        }
+    EnsureSlotIndex();
+    return CurrencyTotal;
+}
+
+TConstArrayView<int32> UMythicInventoryComponent::GetSlotsHoldingItem(const UItemDefinition *ItemDef) const {
+    EnsureSlotIndex();
+    const FItemDefIndexEntry *Entry = ItemDef ? ItemDefIndex.Find(TObjectKey<UItemDefinition>(ItemDef)) : nullptr;
+    return Entry ? TConstArrayView<int32>(Entry->Slots) : TConstArrayView<int32>();
+}
+
+TConstArrayView<int32> UMythicInventoryComponent::GetPartialStackSlots(const UItemDefinition *ItemDef) const {
+    EnsureSlotIndex();
+    const FItemDefIndexEntry *Entry = ItemDef ? ItemDefIndex.Find(TObjectKey<UItemDefinition>(ItemDef)) : nullptr;
+    return Entry ? TConstArrayView<int32>(Entry->PartialSlots) : TConstArrayView<int32>();
+}
+
+UMythicInventoryComponent::FSlotIndexRecord UMythicInventoryComponent::MakeSlotIndexRecord(int32 SlotIndex) const {
+    FSlotIndexRecord Record;
+    const UMythicItemInstance *Inst = Slots.Items[SlotIndex].SlottedItemInstance;
+    const UItemDefinition *Def = Inst ? Inst->GetItemDefinition() : nullptr;
+    if (!Def) {
+        return Record; // empty slot (or an unresolvable definition) contributes nothing
+    }
+    Record.ItemDef = Def;
+    Record.Stacks = Inst->GetStacks();
+    Record.Weight = ComputeSlotWeight(Def->Weight, Record.Stacks);
+    Record.bPartial = Def->StackSizeMax > 0 && Record.Stacks < Def->StackSizeMax;
+    Record.bCurrency = Def->ItemType.MatchesTag(ITEMIZATION_TYPE_CURRENCY);
+    return Record;
+}
+
+void UMythicInventoryComponent::LinkSlotIndexRecord(int32 SlotIndex, const FSlotIndexRecord &Record) const {
+    CarriedWeight += Record.Weight;
+    if (Record.bCurrency) {
+        CurrencyTotal += FMath::Max(0, Record.Stacks);
+    }
+    if (Record.ItemDef == TObjectKey<UItemDefinition>()) {
+        return;
+    }
+    FItemDefIndexEntry &Entry = ItemDefIndex.FindOrAdd(Record.ItemDef);
+    Entry.Slots.Insert(SlotIndex, Algo::LowerBound(Entry.Slots, SlotIndex));
+    if (Record.bPartial) {
+        Entry.PartialSlots.Insert(SlotIndex, Algo::LowerBound(Entry.PartialSlots, SlotIndex));
+    }
+    Entry.TotalStacks += Record.Stacks;
+}
+
+void UMythicInventoryComponent::UnlinkSlotIndexRecord(int32 SlotIndex, const FSlotIndexRecord &Record) const {
+    CarriedWeight -= Record.Weight;
+    if (Record.bCurrency) {
+        CurrencyTotal -= FMath::Max(0, Record.Stacks);
+    }
+    if (Record.ItemDef == TObjectKey<UItemDefinition>()) {
+        return;
+    }
+    FItemDefIndexEntry *Entry = ItemDefIndex.Find(Record.ItemDef);
+    if (!Entry) {
+        return;
+    }
+    Entry->Slots.RemoveSingle(SlotIndex); // stable — keeps the ascending order
+    if (Record.bPartial) {
+        Entry->PartialSlots.RemoveSingle(SlotIndex);
+    }
+    Entry->TotalStacks -= Record.Stacks;
+    if (Entry->Slots.IsEmpty()) {
+        ItemDefIndex.Remove(Record.ItemDef);
+    }
+}
+
+void UMythicInventoryComponent::EnsureSlotIndex() const {
+    // The slot-count check also catches a structural change that reached us without a callback (e.g. a host-side
+    // Items.Empty()), so a stale index can never be read.
+    if (!bSlotIndexStale && SlotRecords.Num() == Slots.Num()) {
+        return;
+    }
+    SlotRecords.SetNum(Slots.Num(), EAllowShrinking::No);
+    ItemDefIndex.Reset();
+    CarriedWeight = 0.0f;
+    CurrencyTotal = 0;
+    for (int32 i = 0; i < Slots.Num(); ++i) {
+        SlotRecords[i] = MakeSlotIndexRecord(i);
+        LinkSlotIndexRecord(i, SlotRecords[i]); // ascending i → every list is appended in order
+    }
+    bSlotIndexStale = false;
+}
+
+void UMythicInventoryComponent::RefreshSlotIndex(int32 SlotIndex) {
+    if (bSlotIndexStale || SlotRecords.Num() != Slots.Num() || !SlotRecords.IsValidIndex(SlotIndex)) {
+        bSlotIndexStale = true; // a structural change is pending — the next read rebuilds everything anyway
+        return;
+    }
+    const FSlotIndexRecord NewRecord = MakeSlotIndexRecord(SlotIndex);
+    FSlotIndexRecord &OldRecord = SlotRecords[SlotIndex];
+    if (NewRecord.ItemDef == OldRecord.ItemDef && NewRecord.Stacks == OldRecord.Stacks) {
+        return; // a tag / active-state refresh — nothing the index tracks changed
     }
-    return Total;
+    UnlinkSlotIndexRecord(SlotIndex, OldRecord);
+    LinkSlotIndexRecord(SlotIndex, NewRecord);
+    OldRecord = NewRecord;
 }
 
 void UMythicInventoryComponent::NotifyItemInstanceUpdated(int32 SlotIndex) {
+    RefreshSlotIndex(SlotIndex);
     if (IsValid(ViewModel)) {
         ViewModel->RefreshSlotFromInventory(this, SlotIndex);
     }
@@ -5,6 +5,7 @@
 #include "Components/ActorComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
 #include "InventoryProfile.h"
 #include "InventorySlotDefinition.h"
 #include "MythicInventoryComponent.generated.h"
@@ -177,7 +178,8 @@ public:
     TArray<FMythicInventorySlotEntry> &GetAllSlotsMutable() { return Slots.Items; }
 
     // Total carry weight of everything in this inventory: sum of each slotted item's UnitWeight × stack (encumbrance).
-    // Reads the replicated FastArray, so it is valid on the server and the owning client. 0 if every item is weightless.
+    // Valid on the server and the owning client. 0 if every item is weightless. O(1): a running total kept by the slot
+    // index below (a structural change — slots added/removed — rebuilds it once on the next read).
     float GetTotalCarriedWeight() const;
 
     // Pure per-slot weight contribution: UnitWeight × StackCount with both clamped non-negative (a weightless or
@@ -186,8 +188,17 @@ public:
 
     // The CURRENCY this inventory holds = summed stack quantity over Itemization.Type.Currency items (a player's wallet
     // balance, since currency is modelled as stackable currency-type items). 0 if it holds none. Server + owning client.
+    // O(1) running total, like GetTotalCarriedWeight.
     int32 GetTotalCurrency() const;
 
+    // Slots currently holding an instance of ItemDef, ascending (the order the linear scans used). O(1) lookup into the
+    // per-definition index; empty if none. The view is invalidated by the next inventory mutation — copy it before
+    // mutating while iterating.
+    TConstArrayView<int32> GetSlotsHoldingItem(const UItemDefinition *ItemDef) const;
+
+    // The subset of GetSlotsHoldingItem whose stack is below the definition's StackSizeMax (stack-merge targets).
+    TConstArrayView<int32> GetPartialStackSlots(const UItemDefinition *ItemDef) const;
+
     UMythicInventoryComponent(const FObjectInitializer &OI);
 
     virtual void BeginPlay() override;
@@ -308,8 +319,8 @@ public:
     UFUNCTION(BlueprintPure, Category = "ViewModel")
     UInventoryVM *GetViewModel() const;
 
-    // Count the number of items in the inventory that match the given item definition (aggregates all slots).
-    // BlueprintPure so HUD/vendor widgets can read a currency balance, e.g. GetItemCount(GoldDef).
+    // Count the number of items in the inventory that match the given item definition (aggregates all slots). O(1) via
+    // the per-definition index. BlueprintPure so HUD/vendor widgets can read a currency balance, e.g. GetItemCount(GoldDef).
     UFUNCTION(BlueprintPure, Category = "Inventory")
     int32 GetItemCount(UItemDefinition *RequiredItem) const;
 
@@ -365,6 +376,36 @@ protected:
     void HandleSlotsChanged(const TArrayView<int32> &ChangedIndices, int32 FinalSize);
     void HandleSlotsRemoved(const TArrayView<int32> &RemovedIndices, int32 FinalSize);
 
+    // ─── Slot index ───
+    // What each slot last contributed (definition, stacks, weight, currency) plus, per item definition, the sorted slots
+    // holding it, their summed stacks and the partial stacks among them; running weight + currency totals on top. Every
+    // per-slot notification (server mutation via NotifyItemInstanceUpdated — SetItemInSlotInternal, SetStackSize,
+    // ReleaseFromSlot — and replicated changes via HandleSlotsChanged) re-reads just that slot and applies the delta; a
+    // slot-count change marks the index stale and the next read rebuilds it. Mutable: the lazy rebuild runs from const
+    // reads. Definitions are held as TObjectKey (never dereferenced) — a slotted instance keeps its definition alive.
+    struct FSlotIndexRecord {
+        TObjectKey<UItemDefinition> ItemDef;
+        int32 Stacks = 0;
+        float Weight = 0.0f;
+        bool bPartial = false;
+        bool bCurrency = false;
+    };
+    struct FItemDefIndexEntry {
+        TArray<int32> Slots;        // ascending
+        TArray<int32> PartialSlots; // ascending
+        int32 TotalStacks = 0;
+    };
+    void RefreshSlotIndex(int32 SlotIndex);
+    FSlotIndexRecord MakeSlotIndexRecord(int32 SlotIndex) const;
+    void LinkSlotIndexRecord(int32 SlotIndex, const FSlotIndexRecord &Record) const;
+    void UnlinkSlotIndexRecord(int32 SlotIndex, const FSlotIndexRecord &Record) const;
+    void EnsureSlotIndex() const;
+    mutable TArray<FSlotIndexRecord> SlotRecords;
+    mutable TMap<TObjectKey<UItemDefinition>, FItemDefIndexEntry> ItemDefIndex;
+    mutable float CarriedWeight = 0.0f;
+    mutable int32 CurrencyTotal = 0;
+    mutable bool bSlotIndexStale = true;
+
     // friend the fast array struct to allow it to call our callbacks
     friend struct FMythicInventoryFastArray;
 };
@@ -24,6 +24,10 @@ class IInventoryProviderInterface {
     /** Returns ALL the inventory components owned by this actor */
     virtual TArray<UMythicInventoryComponent *> GetAllInventoryComponents() const = 0;
 
+    /** Changes whenever the set GetAllInventoryComponents returns changes, so callers may cache that set and re-resolve
+     *  only on a new value. Providers whose set is fixed for their lifetime keep the default. */
+    virtual uint32 GetInventorySetSerial() const { return 0; }
+
     // Returns the ASC that holds the schematics learned by this actor
     virtual UAbilitySystemComponent *GetSchematicsASC() const = 0;
 
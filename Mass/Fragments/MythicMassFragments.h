@@ -226,7 +226,7 @@ static constexpr int32 VentChannelCount = static_cast<int32>(EMythicVentChannel:
 
 // ─────────────────────────────────────────────────────────────
 // Creature Fragment — Creature-specific ecology data
-// Only on creature entities (~24B)
+// Only on creature entities (~32B)
 // ─────────────────────────────────────────────────────────────
 
 /**
@@ -256,6 +256,14 @@ struct MYTHIC_API FMythicCreatureFragment : public FMassFragment {
 
     /** Radius (in cells) within which the creature gets territorial aggression boost */
     uint8 TerritorialRadius = 2;
+
+    /** True while this creature is counted in the species occupancy grid (at OccupancyCell). Owned by the ecology
+     *  processor + UMythicCreatureOccupancyRemoveObserver — never written elsewhere. */
+    bool bInOccupancy = false;
+
+    /** Cell this creature is counted under in the species occupancy grid; lags Identity.Cell until the next ecology
+     *  tick moves it. Meaningful only while bInOccupancy. */
+    FMythicCellCoord OccupancyCell;
 };
 
 // ─────────────────────────────────────────────────────────────
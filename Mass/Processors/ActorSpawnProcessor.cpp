@@ -8,6 +8,7 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Persistence/PersistentNPCRegistry.h"
 #include "World/LivingWorld/Spawn/MythicPlacement.h"
@@ -185,8 +186,12 @@ void UMythicActorSpawnProcessor::Execute(FMassEntityManager &EntityManager, FMas
 
     // Per-Execute no-hitch budget: cap the number of navmesh/overlap validations across ALL spawn requests this tick.
     // When spent, the remaining requests re-queue (their spawn-request tag is re-added) for the next tick. Bounds the
-    // cost of a town streaming in all at once to MaxPlacementValidationsPerTick * (per-validation cost).
-    const int32 MaxValidations = FMath::Max(1, Settings->MaxPlacementValidationsPerTick);
+    // cost of a town streaming in all at once to MaxPlacementValidationsPerTick * (per-validation cost) — or to the
+    // budget governor's current grant for this lane, which that setting anchors.
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 MaxValidations = FMath::Max(1, Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::PlacementValidations,
+                                                                            Settings->MaxPlacementValidationsPerTick)
+                                                       : Settings->MaxPlacementValidationsPerTick);
     int32 ValidationsThisTick = 0;
     const double Now = World->GetTimeSeconds();
 
@@ -231,6 +236,7 @@ void UMythicActorSpawnProcessor::Execute(FMassEntityManager &EntityManager, FMas
 
     // Collect requests first. Spawning actors while iterating the entity chunks is unsafe, so gather (entity,
     // identity) pairs in the query, then spawn after the iteration completes.
+    const double PlacementStartSeconds = FPlatformTime::Seconds();
     TArray<TPair<FMassEntityHandle, FMythicIdentityFragment>> Requests;
     SpawnRequestQuery.ForEachEntityChunk(Context, [&Requests](FMassExecutionContext &ChunkContext) {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -410,6 +416,11 @@ void UMythicActorSpawnProcessor::Execute(FMassEntityManager &EntityManager, FMas
         Context.Defer().AddTag<FMythicCognitiveTag>(Entity);
     }
 
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::PlacementValidations, ValidationsThisTick,
+                            ValidationsThisTick >= MaxValidations ? ValidationsThisTick : 0, FPlatformTime::Seconds() - PlacementStartSeconds);
+    }
+
     // ─── Dehydration: despawn actors whose entity dropped below Tier 2 ───
     // Gather first (don't mutate during chunk iteration), then act.
     TArray<FMassEntityHandle> Despawns;
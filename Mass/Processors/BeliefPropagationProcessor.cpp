@@ -91,6 +91,8 @@ void UMythicBeliefPropagationProcessor::Execute(FMassEntityManager &EntityManage
     // Hop decay: each propagation reduces the event count contribution.
     // This prevents instant omniscience — information takes time to spread.
 
+    const double WorldTime = World->GetTimeSeconds();
+
     HydratedSocialQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
         if (PropagationBudget <= 0) {
             return;
@@ -126,19 +128,18 @@ void UMythicBeliefPropagationProcessor::Execute(FMassEntityManager &EntityManage
             }
 
             // ─── Propagate to each social neighbor ───
-            TArray<FMythicSocialEdge> SocialEdges;
-            SocialGraph->GetEdges(ChunkContext.GetEntity(i), World->GetTimeSeconds(), SocialEdges);
-
-            for (const FMythicSocialEdge &Edge : SocialEdges) {
+            // Zero-copy walk of the entity's edge block (the visitor only queues deferred commands — it never calls back
+            // into the graph, which holds its read lock for the walk).
+            SocialGraph->VisitEdges(ChunkContext.GetEntity(i), WorldTime, [&](const FMythicSocialEdge &Edge, float) {
                 if (PropagationBudget <= 0) {
-                    break;
+                    return false;
                 }
 
                 // Don't share info with enemies — Rival is the only antagonistic relation. (The prior
                 // static_cast<EMythicSocialRelation>(5) "Hostile" was a magic-ordinal bug: 5 is Subordinate and no
                 // Hostile relation exists, so it wrongly muted gossip down authority/mentorship chains.)
                 if (Edge.Relation == EMythicSocialRelation::Rival) {
-                    continue; // Don't share info with enemies
+                    return true; // Don't share info with enemies
                 }
 
                 --PropagationBudget;
@@ -172,7 +173,8 @@ void UMythicBeliefPropagationProcessor::Execute(FMassEntityManager &EntityManage
                 UE_LOG(LogMythLivingWorld, Verbose,
                        TEXT("BeliefPropagation: Entity propagated %d events to neighbor (relation=%d, pressure=%.1f)"),
                        PropagatedEventCount, static_cast<int32>(Edge.Relation), TotalPressure);
-            }
+                return true;
+            });
         }
     });
 }
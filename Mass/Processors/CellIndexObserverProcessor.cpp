@@ -0,0 +1,129 @@
+// Mythic Living World — Cell Index Observers Implementation
+
+#include "Mass/Processors/CellIndexObserverProcessor.h"
+#include "MassExecutionContext.h"
+#include "Mass/Fragments/MythicMassFragments.h"
+#include "Mass/Tags/MythicMassTags.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "Engine/World.h"
+
+// ─────────────────────────────────────────────────────────────
+// Add (entity created)
+// ─────────────────────────────────────────────────────────────
+
+UMythicCellIndexAddObserver::UMythicCellIndexAddObserver() {
+    ObservedType = FMythicIdentityFragment::StaticStruct();
+    Operation = EMassObservedOperation::Add;
+    ExecutionFlags = static_cast<uint8>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+    bRequiresGameThreadExecution = true; // the index is game-thread only
+
+    IdentityQuery.RegisterWithProcessor(*this);
+}
+
+void UMythicCellIndexAddObserver::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) {
+    IdentityQuery.AddRequirement<FMythicIdentityFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+EMythicCellEntityCategory UMythicCellIndexAddObserver::GetChunkCategories(const FMassExecutionContext &ChunkContext) {
+    EMythicCellEntityCategory Categories = EMythicCellEntityCategory::None;
+    if (ChunkContext.DoesArchetypeHaveTag<FMythicNPCTag>()) {
+        Categories |= EMythicCellEntityCategory::NPC;
+    }
+    if (ChunkContext.DoesArchetypeHaveTag<FMythicTravelerTag>()) {
+        Categories |= EMythicCellEntityCategory::Traveler;
+    }
+    if (ChunkContext.DoesArchetypeHaveTag<FMythicEncounterEntityTag>()) {
+        Categories |= EMythicCellEntityCategory::Encounter;
+    }
+    if (ChunkContext.DoesArchetypeHaveTag<FMythicCreatureTag>()) {
+        Categories |= EMythicCellEntityCategory::Creature;
+    }
+    return Categories;
+}
+
+void UMythicCellIndexAddObserver::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
+    UWorld *World = GetWorld();
+    UMythicCellEntityIndexSubsystem *CellIndex = World ? World->GetSubsystem<UMythicCellEntityIndexSubsystem>() : nullptr;
+    if (!CellIndex) {
+        return;
+    }
+
+    IdentityQuery.ForEachEntityChunk(Context, [CellIndex](FMassExecutionContext &ChunkContext) {
+        const EMythicCellEntityCategory Categories = GetChunkCategories(ChunkContext);
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
+        for (int32 i = 0; i < NumEntities; ++i) {
+            CellIndex->AddEntity(ChunkContext.GetEntity(i), IdentityView[i].Cell, Categories);
+        }
+    });
+}
+
+// ─────────────────────────────────────────────────────────────
+// Remove (entity destroyed)
+// ─────────────────────────────────────────────────────────────
+
+UMythicCellIndexRemoveObserver::UMythicCellIndexRemoveObserver() {
+    ObservedType = FMythicIdentityFragment::StaticStruct();
+    Operation = EMassObservedOperation::Remove;
+    ExecutionFlags = static_cast<uint8>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+    bRequiresGameThreadExecution = true;
+
+    IdentityQuery.RegisterWithProcessor(*this);
+}
+
+void UMythicCellIndexRemoveObserver::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) {
+    IdentityQuery.AddRequirement<FMythicIdentityFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+void UMythicCellIndexRemoveObserver::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
+    UWorld *World = GetWorld();
+    UMythicCellEntityIndexSubsystem *CellIndex = World ? World->GetSubsystem<UMythicCellEntityIndexSubsystem>() : nullptr;
+    if (!CellIndex) {
+        return;
+    }
+
+    // The entity → cell map inside the index locates each bucket, so the (about to be freed) fragment isn't read.
+    IdentityQuery.ForEachEntityChunk(Context, [CellIndex](FMassExecutionContext &ChunkContext) {
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        for (int32 i = 0; i < NumEntities; ++i) {
+            CellIndex->RemoveEntity(ChunkContext.GetEntity(i));
+        }
+    });
+}
+
+// ─────────────────────────────────────────────────────────────
+// Creature species occupancy (creature destroyed)
+// ─────────────────────────────────────────────────────────────
+
+UMythicCreatureOccupancyRemoveObserver::UMythicCreatureOccupancyRemoveObserver() {
+    ObservedType = FMythicCreatureFragment::StaticStruct();
+    Operation = EMassObservedOperation::Remove;
+    ExecutionFlags = static_cast<uint8>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+    bRequiresGameThreadExecution = true;
+
+    CreatureQuery.RegisterWithProcessor(*this);
+}
+
+void UMythicCreatureOccupancyRemoveObserver::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) {
+    CreatureQuery.AddRequirement<FMythicCreatureFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+void UMythicCreatureOccupancyRemoveObserver::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
+    UWorld *World = GetWorld();
+    UMythicCellEntityIndexSubsystem *CellIndex = World ? World->GetSubsystem<UMythicCellEntityIndexSubsystem>() : nullptr;
+    if (!CellIndex) {
+        return;
+    }
+
+    // Remove observers run before the fragment is released, so the recorded OccupancyCell is still readable here.
+    FMythicSpeciesOccupancyGrid &Occupancy = CellIndex->GetSpeciesOccupancy();
+    CreatureQuery.ForEachEntityChunk(Context, [&Occupancy](FMassExecutionContext &ChunkContext) {
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        const auto CreatureView = ChunkContext.GetFragmentView<FMythicCreatureFragment>();
+        for (int32 i = 0; i < NumEntities; ++i) {
+            if (CreatureView[i].bInOccupancy) {
+                Occupancy.Remove(CreatureView[i].OccupancyCell, CreatureView[i].SpeciesId);
+            }
+        }
+    });
+}
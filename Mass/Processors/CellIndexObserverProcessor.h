@@ -0,0 +1,73 @@
+// Mythic Living World — Cell Index Observers
+// MASS observers that keep UMythicCellEntityIndexSubsystem (cell index + species occupancy) in step with entity
+// creation and destruction.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassObserverProcessor.h"
+#include "MassEntityQuery.h"
+#include "World/LivingWorld/MythicCellSpatialIndex.h" // EMythicCellEntityCategory
+#include "CellIndexObserverProcessor.generated.h"
+
+class UMythicCellEntityIndexSubsystem;
+struct FMassExecutionContext;
+
+/**
+ * Inserts every entity created with FMythicIdentityFragment into the shared cell index, at its Identity.Cell and with
+ * the categories of its archetype tags. Fires when the creation context is released — creation sites hold it until the
+ * identity is written (see UMythicCellEntityIndexSubsystem).
+ */
+UCLASS()
+class MYTHIC_API UMythicCellIndexAddObserver : public UMassObserverProcessor {
+    GENERATED_BODY()
+
+public:
+    UMythicCellIndexAddObserver();
+
+    /** Categories for a chunk's archetype (tags are fixed at creation for living-world archetypes) */
+    static EMythicCellEntityCategory GetChunkCategories(const FMassExecutionContext &ChunkContext);
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+private:
+    FMassEntityQuery IdentityQuery;
+};
+
+/** Removes every destroyed FMythicIdentityFragment entity from the shared cell index. */
+UCLASS()
+class MYTHIC_API UMythicCellIndexRemoveObserver : public UMassObserverProcessor {
+    GENERATED_BODY()
+
+public:
+    UMythicCellIndexRemoveObserver();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+private:
+    FMassEntityQuery IdentityQuery;
+};
+
+/**
+ * Uncounts every destroyed creature from the species occupancy grid, at the cell the ecology processor last recorded
+ * on its FMythicCreatureFragment. Creatures are only ever counted by the ecology processor (on their first ecology tick),
+ * so there is no matching add observer.
+ */
+UCLASS()
+class MYTHIC_API UMythicCreatureOccupancyRemoveObserver : public UMassObserverProcessor {
+    GENERATED_BODY()
+
+public:
+    UMythicCreatureOccupancyRemoveObserver();
+
+protected:
+    virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
+    virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
+
+private:
+    FMassEntityQuery CreatureQuery;
+};
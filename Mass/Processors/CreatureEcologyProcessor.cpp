@@ -8,14 +8,16 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
 #include "World/LivingWorld/Creatures/CreatureAggressionTypes.h"
+#include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "Engine/DataTable.h"
 #include "Engine/World.h"
 
 UMythicCreatureEcologyProcessor::UMythicCreatureEcologyProcessor() {
     ProcessingPhase = EMassProcessingPhase::PrePhysics;
     ExecutionFlags = static_cast<uint8>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
-    bRequiresGameThreadExecution = false;
+    bRequiresGameThreadExecution = true; // shares the species occupancy grid with a game-thread observer
     bAutoRegisterWithProcessingPhases = true;
 
     // Run after population spawner
@@ -48,6 +50,7 @@ float UMythicCreatureEcologyProcessor::ComputeTerritorialAggression(float BaseAg
 
 void UMythicCreatureEcologyProcessor::BuildAggressionMatrix(const UDataTable *Table, FMythicCreatureAggressionMatrix &OutMatrix) {
     OutMatrix.Entries.Reset();
+    OutMatrix.HostileRows.Reset();
     if (!Table) {
         return; // No authored matrix => empty => no cross-species aggression (current behavior preserved).
     }
@@ -62,6 +65,26 @@ void UMythicCreatureEcologyProcessor::BuildAggressionMatrix(const UDataTable *Ta
         OutMatrix.Entries.Add(FMythicCreatureAggressionMatrix::PackKey(Row->AttackerSpeciesId, Row->TargetSpeciesId),
                               FMath::Clamp(Row->Aggression, 0.0f, 1.0f));
     }
+    if (OutMatrix.Entries.Num() == 0) {
+        return;
+    }
+
+    // Hostile rows from the final (deduplicated) entries, so a later zero row clears an earlier non-zero one.
+    OutMatrix.HostileRows.SetNum(256);
+    for (const TPair<uint16, float> &Entry : OutMatrix.Entries) {
+        if (Entry.Value > 0.0f) {
+            OutMatrix.HostileRows[Entry.Key >> 8].Set(static_cast<uint8>(Entry.Key & 0xFF));
+        }
+    }
+}
+
+float UMythicCreatureEcologyProcessor::ComputeCrossSpeciesAggression(const FMythicSpeciesMask &CellSpecies,
+                                                                     const FMythicCreatureAggressionMatrix &Matrix, uint8 Attacker) {
+    FMythicSpeciesMask Targets = CellSpecies & Matrix.GetHostileRow(Attacker);
+    Targets.Clear(Attacker); // same species — never a target
+    float MaxCross = 0.0f;
+    Targets.ForEachSpecies([&](uint8 Target) { MaxCross = FMath::Max(MaxCross, Matrix.Get(Attacker, Target)); });
+    return MaxCross;
 }
 
 void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
@@ -87,16 +110,16 @@ void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager,
         return;
     }
 
-    // Throttle
+    // Throttle (an interval of 0 runs every frame)
     TimeSinceLastTick += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastTick < Settings->CreatureEcologyIntervalSeconds) {
         return;
     }
     TimeSinceLastTick = 0.0f;
 
-    // Resolve the species×species aggression matrix ONCE (game-thread only — LoadSynchronous is not thread-safe; this
-    // processor may run off the game thread, so we defer the load to the first game-thread tick and reuse the cached
-    // flattened map thereafter). Until loaded, AggressionMatrix is empty => no cross-species aggression (safe default).
+    // Resolve the species×species aggression matrix ONCE (LoadSynchronous is game-thread only — this processor runs on
+    // the game thread, the check guards against that ever changing) and reuse the cached flattened map thereafter.
+    // Until loaded, AggressionMatrix is empty => no cross-species aggression (safe default).
     if (!bAggressionMatrixResolved && IsInGameThread()) {
         bAggressionMatrixResolved = true;
         const UDataTable *Table = Settings->CreatureAggressionMatrix.LoadSynchronous();
@@ -108,17 +131,35 @@ void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager,
     int32 ContagionBudget = Settings->MaxHerdContagionPerTick;
     const int32 ThreatIdx = static_cast<int32>(EMythicPressureChannel::Threat);
 
-    // ─── Step 0: Per-cell species presence (for the cross-species aggression lookup) ───
-    // Built only when an aggression matrix is authored — otherwise it's pure cost for no effect. Maps a cell to the set
-    // of distinct species occupying it. Bounded: one small TSet per occupied cell, cleared each tick (scratch reused).
-    TMap<FMythicCellCoord, TSet<uint8>> CellSpecies;
-    if (!AggressionMatrix.IsEmpty()) {
-        CreatureQuery.ForEachEntityChunk(Context, [&CellSpecies](FMassExecutionContext &ChunkContext) {
+    // ─── Step 0: Keep the species occupancy grid current (for the cross-species aggression lookup) ───
+    // Maintained only when an aggression matrix is authored — otherwise it's pure cost for no effect. Sized once from the
+    // territory grid; after that a creature is only touched here when its Identity.Cell differs from the cell it was
+    // counted under (despawns are uncounted by UMythicCreatureOccupancyRemoveObserver).
+    UMythicCellEntityIndexSubsystem *CellIndex = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    FMythicSpeciesOccupancyGrid *Occupancy = CellIndex ? &CellIndex->GetSpeciesOccupancy() : nullptr;
+    if (Occupancy && !Occupancy->IsInitialized()) {
+        if (const UMythicTerritoryGrid *Grid = LWS->GetTerritoryGrid()) {
+            Occupancy->Initialize(Grid->GetWidth(), Grid->GetHeight());
+        }
+    }
+    const bool bCrossSpecies = !AggressionMatrix.IsEmpty() && Occupancy && Occupancy->IsInitialized();
+    if (bCrossSpecies) {
+        TRACE_CPUPROFILER_EVENT_SCOPE(MythicCreatureEcology_SyncOccupancy);
+        CreatureQuery.ForEachEntityChunk(Context, [Occupancy](FMassExecutionContext &ChunkContext) {
             const int32 NumEntities = ChunkContext.GetNumEntities();
             const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-            const auto CreatureView = ChunkContext.GetFragmentView<FMythicCreatureFragment>();
+            auto CreatureView = ChunkContext.GetMutableFragmentView<FMythicCreatureFragment>();
             for (int32 i = 0; i < NumEntities; ++i) {
-                CellSpecies.FindOrAdd(IdentityView[i].Cell).Add(CreatureView[i].SpeciesId);
+                FMythicCreatureFragment &Creature = CreatureView[i];
+                const FMythicCellCoord &Cell = IdentityView[i].Cell;
+                if (Creature.bInOccupancy && Creature.OccupancyCell == Cell) {
+                    continue;
+                }
+                if (Creature.bInOccupancy) {
+                    Occupancy->Remove(Creature.OccupancyCell, Creature.SpeciesId);
+                }
+                Creature.bInOccupancy = Occupancy->Add(Cell, Creature.SpeciesId);
+                Creature.OccupancyCell = Cell;
             }
         });
     }
@@ -148,17 +189,9 @@ void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager,
             // Cross-species aggression: if this creature shares its cell with another species it is hostile toward
             // (per the authored matrix), raise CurrentAggression toward that value. Transient (recomputed each tick),
             // so it relaxes the moment the species separate. Skipped entirely when no matrix is authored.
-            if (!AggressionMatrix.IsEmpty()) {
-                if (const TSet<uint8> *Here = CellSpecies.Find(CurrentCell)) {
-                    float MaxCross = 0.0f;
-                    for (const uint8 OtherSpecies : *Here) {
-                        if (OtherSpecies == Creature.SpeciesId) {
-                            continue; // same species — not a target
-                        }
-                        MaxCross = FMath::Max(MaxCross, AggressionMatrix.Get(Creature.SpeciesId, OtherSpecies));
-                    }
-                    Creature.CurrentAggression = FMath::Max(Creature.CurrentAggression, MaxCross);
-                }
+            if (bCrossSpecies) {
+                const float MaxCross = ComputeCrossSpeciesAggression(Occupancy->GetMask(CurrentCell), AggressionMatrix, Creature.SpeciesId);
+                Creature.CurrentAggression = FMath::Max(Creature.CurrentAggression, MaxCross);
             }
         }
     });
@@ -170,8 +203,11 @@ void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager,
     // on distance to that source cell (PackRadiusSq) so distant pack members don't telepathically inherit a far-off
     // scare. (Previously PackRadiusSq was computed but never used and the max threat was shared pack-wide regardless of
     // distance, defeating PackPressureShareRadius — Mass chunks are archetype-grouped, not spatial, so there was no
-    // implicit spatial bound.)
-    TMap<uint16, TPair<float, FMythicCellCoord>> PackMaxThreat;
+    // implicit spatial bound.) Flat per-PackId arrays: an untouched pack reads 0 threat, which never shares.
+    if (PackThreat.IsEmpty()) {
+        PackThreat.SetNumZeroed(0x10000);
+        PackThreatCell.SetNum(0x10000);
+    }
 
     HydratedCreatureQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -186,49 +222,55 @@ void UMythicCreatureEcologyProcessor::Execute(FMassEntityManager &EntityManager,
             }
 
             const float Threat = PsychoView[i].Pressure[ThreatIdx];
-            TPair<float, FMythicCellCoord> &Entry = PackMaxThreat.FindOrAdd(PackId, TPair<float, FMythicCellCoord>(0.0f, FMythicCellCoord()));
-            if (Threat > Entry.Key) {
-                Entry.Key = Threat;
-                Entry.Value = IdentityView[i].Cell;
+            if (Threat > PackThreat[PackId]) {
+                if (PackThreat[PackId] <= 0.0f) {
+                    TouchedPacks.Add(PackId);
+                }
+                PackThreat[PackId] = Threat;
+                PackThreatCell[PackId] = IdentityView[i].Cell;
             }
         }
     });
 
     // Second pass: share max threat back to pack members + herd-flee contagion
-    HydratedCreatureQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto CreatureView = ChunkContext.GetFragmentView<FMythicCreatureFragment>();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        auto PsychoView = ChunkContext.GetMutableFragmentView<FMythicPsychodynamicFragment>();
-
-        for (int32 i = 0; i < NumEntities && ContagionBudget > 0; ++i) {
-            const uint16 PackId = CreatureView[i].PackId;
-            if (PackId == 0) {
-                continue;
-            }
+    if (!TouchedPacks.IsEmpty()) {
+        HydratedCreatureQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
+            const int32 NumEntities = ChunkContext.GetNumEntities();
+            const auto CreatureView = ChunkContext.GetFragmentView<FMythicCreatureFragment>();
+            const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
+            auto PsychoView = ChunkContext.GetMutableFragmentView<FMythicPsychodynamicFragment>();
 
-            const TPair<float, FMythicCellCoord> *PackMax = PackMaxThreat.Find(PackId);
-            if (!PackMax) {
-                continue;
-            }
+            for (int32 i = 0; i < NumEntities && ContagionBudget > 0; ++i) {
+                const uint16 PackId = CreatureView[i].PackId;
+                if (PackId == 0 || PackThreat[PackId] <= 0.0f) {
+                    continue;
+                }
 
-            // Distance-gate: only members within PackPressureShareRadius of the threat source share its pressure
-            // (the documented contract). Squared-Euclidean so we consume PackRadiusSq without a sqrt.
-            const FMythicCellCoord &Cell = IdentityView[i].Cell;
-            const int32 dX = Cell.X - PackMax->Value.X;
-            const int32 dY = Cell.Y - PackMax->Value.Y;
-            if (static_cast<float>(dX * dX + dY * dY) > PackRadiusSq) {
-                continue;
-            }
+                // Distance-gate: only members within PackPressureShareRadius of the threat source share its pressure
+                // (the documented contract). Squared-Euclidean so we consume PackRadiusSq without a sqrt.
+                const FMythicCellCoord &Cell = IdentityView[i].Cell;
+                const FMythicCellCoord &Source = PackThreatCell[PackId];
+                const int32 dX = Cell.X - Source.X;
+                const int32 dY = Cell.Y - Source.Y;
+                if (static_cast<float>(dX * dX + dY * dY) > PackRadiusSq) {
+                    continue;
+                }
 
-            FMythicPsychodynamicFragment &Psycho = PsychoView[i];
+                FMythicPsychodynamicFragment &Psycho = PsychoView[i];
 
-            // Pack pressure sharing: raise this member's threat toward pack max (dampened)
-            if (PackMax->Key > Psycho.Pressure[ThreatIdx]) {
-                const float SharedFraction = 0.5f;
-                Psycho.Pressure[ThreatIdx] = FMath::Lerp(Psycho.Pressure[ThreatIdx], PackMax->Key, SharedFraction);
-                --ContagionBudget;
+                // Pack pressure sharing: raise this member's threat toward pack max (dampened)
+                if (PackThreat[PackId] > Psycho.Pressure[ThreatIdx]) {
+                    const float SharedFraction = 0.5f;
+                    Psycho.Pressure[ThreatIdx] = FMath::Lerp(Psycho.Pressure[ThreatIdx], PackThreat[PackId], SharedFraction);
+                    --ContagionBudget;
+                }
             }
-        }
-    });
+        });
+    }
+
+    // Clear only the packs written this tick (the arrays stay zeroed between ticks without a 64K sweep).
+    for (const uint16 PackId : TouchedPacks) {
+        PackThreat[PackId] = 0.0f;
+    }
+    TouchedPacks.Reset();
 }
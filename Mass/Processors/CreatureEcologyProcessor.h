@@ -20,7 +20,13 @@
  * 3. **Herd-Flee Contagion** — When a herd creature's Threat pressure exceeds flee threshold,
  *    nearby herd members also raise their Threat (stampede behavior).
  *
- * Runs on server/standalone at configured interval, budget-capped.
+ * Species co-location comes from the persistent FMythicSpeciesOccupancyGrid (UMythicCellEntityIndexSubsystem), which
+ * this processor keeps current by moving only the creatures whose cell changed; the cross-species check is then an AND
+ * of the cell's species mask with the attacker's aggression-matrix row. Pack threat lives in flat arrays indexed by
+ * PackId. Nothing is rebuilt or hashed per creature per tick, so CreatureEcologyIntervalSeconds can be 0 (every frame).
+ *
+ * Runs on server/standalone on the game thread (the occupancy grid is shared with a game-thread observer), at the
+ * configured interval, budget-capped.
  */
 UCLASS()
 class MYTHIC_API UMythicCreatureEcologyProcessor : public UMassProcessor {
@@ -40,6 +46,11 @@ public:
      *  it is unit-testable; null table => empty matrix (no cross-species aggression, current behavior). */
     static void BuildAggressionMatrix(const class UDataTable *Table, FMythicCreatureAggressionMatrix &OutMatrix);
 
+    /** Highest aggression Attacker feels toward any OTHER species present in CellSpecies (0 if none is a target).
+     *  Only species surviving the CellSpecies & hostile-row AND are value-looked-up. Pure + static for unit testing. */
+    static float ComputeCrossSpeciesAggression(const FMythicSpeciesMask &CellSpecies, const FMythicCreatureAggressionMatrix &Matrix,
+                                               uint8 Attacker);
+
 protected:
     virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
@@ -60,4 +71,10 @@ private:
 
     /** Latches that the (one-time, sync) aggression-table load + flatten has run, so it isn't retried every tick. */
     bool bAggressionMatrixResolved = false;
+
+    /** Per-PackId highest hydrated-member Threat this tick, and the cell of the member holding it (0x10000 entries,
+     *  sized on first use). Only the TouchedPacks entries are live; they're zeroed again at the end of the tick. */
+    TArray<float> PackThreat;
+    TArray<FMythicCellCoord> PackThreatCell;
+    TArray<uint16> TouchedPacks;
 };
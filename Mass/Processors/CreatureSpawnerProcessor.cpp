@@ -8,8 +8,11 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Settlements/MythicSettlement.h"
+#include "World/LivingWorld/Settlements/SettlementRegistry.h" // FMythicSettlementSnapshot (pinned ownership test)
 #include "World/LivingWorld/Creatures/CreatureSpeciesTypes.h"
 #include "AI/NPCs/MythicNPCCharacter.h" // far-despawn tears down any embodied creature actor (IS-A NPC character)
 #include "Engine/DataTable.h"
@@ -18,8 +21,8 @@
 #include "Engine/World.h"
 
 UMythicCreatureSpawnerProcessor::UMythicCreatureSpawnerProcessor() {
-    // Server/standalone, game thread (creates entities via the command buffer + reads sim-lock-guarded settlement
-    // copies). Mirrors UMythicPopulationSpawnerProcessor's threading contract exactly.
+    // Server/standalone, game thread (creates entities via the command buffer + reads the published settlement
+    // snapshot). Mirrors UMythicPopulationSpawnerProcessor's threading contract exactly.
     ProcessingPhase = EMassProcessingPhase::PrePhysics;
     ExecutionFlags = static_cast<uint8>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
     bRequiresGameThreadExecution = true;
@@ -137,21 +140,27 @@ void UMythicCreatureSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
         return;
     }
 
-    // ─── Count existing creatures per cell ───
-    TMap<FMythicCellCoord, int32> CellCreatureCounts;
-    ExistingCreatureQuery.ForEachEntityChunk(Context, [&CellCreatureCounts](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        for (int32 i = 0; i < NumEntities; ++i) {
-            CellCreatureCounts.FindOrAdd(IdentityView[i].Cell)++;
-        }
-    });
+    // ─── Existing creatures per cell ───
+    // Read per candidate cell from the shared, incrementally maintained cell index (no full creature sweep per tick).
+    const UMythicCellEntityIndexSubsystem *CellIndexSubsystem = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (!CellIndexSubsystem) {
+        return;
+    }
+    const FMythicCellSpatialIndex &CellIndex = CellIndexSubsystem->GetIndex();
+
+    // Published settlement snapshot, acquired ONCE per Execute (pinned under the publisher's read lock, no
+    // SimulationLock). Null before the first publish = no settlements yet = every cell is a wilderness candidate.
+    const FMythicSettlementSnapshotRef SettlementSnap = LWS->AcquireSettlementSnapshot();
 
     // ─── Determine cells needing creatures ───
     const float SpawnRadius = Settings->CreatureSpawnRadius;
     const float SpawnRadiusSq = FMath::Square(SpawnRadius);
     const int32 SpawnRadiusCells = FMath::CeilToInt(SpawnRadius);
-    int32 SpawnBudget = Settings->MaxCreatureSpawnsPerTick;
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 SpawnCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::CreatureSpawns, Settings->MaxCreatureSpawnsPerTick)
+                                   : Settings->MaxCreatureSpawnsPerTick;
+    int32 SpawnBudget = SpawnCap;
+    const double SpawnStartSeconds = FPlatformTime::Seconds();
 
     // Per-creature spawn payload (mirrors PopulationSpawner's local struct discipline).
     struct FMythicCreatureSpawnData {
@@ -175,21 +184,21 @@ void UMythicCreatureSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
                     continue;
                 }
 
-                // Dedup BEFORE the SimulationLock-guarded settlement copy (overlapping co-op spawn radii reach the same
-                // cell once per nearby player). Mirrors the population spawner's dedup-before-lock pattern.
+                // Dedup BEFORE the ownership probes (overlapping co-op spawn radii reach the same cell once per nearby
+                // player). Mirrors the population spawner's dedup pattern.
                 if (ConsideredCells.Contains(Cell)) {
                     continue;
                 }
                 ConsideredCells.Add(Cell);
 
                 // ── Ownership predicates: wilderness ONLY ──
-                // Settlement cell -> population spawner owns it. Snapshot under SimulationLock (copy-out) — never hold a
-                // live Settlements pointer on the game thread (the sim thread mutates it under that lock).
-                FMythicSettlementData Settlement;
-                if (LWS->CopySettlementAtCell(Cell, Settlement)) {
+                // Settlement cell -> population spawner owns it. Read from the published snapshot — never a live
+                // Settlements pointer on the game thread (the sim thread mutates it under SimulationLock).
+                if (SettlementSnap && SettlementSnap->FindAtCell(Cell)) {
                     continue;
                 }
-                // Faction-controlled non-settlement cell -> territory-patrol spawner owns it. Lock-free committed read.
+                // Faction-controlled non-settlement cell -> territory-patrol spawner owns it. Committed read (GetCell
+                // copies under the grid's SnapshotLock).
                 const FMythicTerritoryCell TC = Grid->GetCell(Cell);
                 if (TC.DominantFaction.IsValid()) {
                     continue;
@@ -209,7 +218,7 @@ void UMythicCreatureSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
                 // ── Deficit ──
                 const int32 TargetCount = ComputeCreatureTargetDensity(
                     Settings->MaxCreaturesPerBiomeCell, Settings->CreatureSpawnDensityScale, Settings->MaxEntitiesPerCell);
-                const int32 CurrentCount = CellCreatureCounts.FindRef(Cell);
+                const int32 CurrentCount = CellIndex.GetCellCount(Cell, EMythicCellEntityCategory::Creature, EMythicCellEntityCategory::None);
                 const int32 Deficit = TargetCount - CurrentCount;
                 if (Deficit <= 0) {
                     continue;
@@ -285,6 +294,11 @@ void UMythicCreatureSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
         }
     }
 
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::CreatureSpawns, SpawnCap - SpawnBudget, SpawnBudget <= 0 ? SpawnCap : 0,
+                            FPlatformTime::Seconds() - SpawnStartSeconds);
+    }
+
     // ─── Deferred batch-create the creature entities ───
     if (SpawnDataArray.Num() > 0) {
         // Copy-capture (NOT move-capture): FMassDeferredCreateCommand stores a TFunction, which requires a COPYABLE
@@ -305,7 +319,8 @@ void UMythicCreatureSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
             FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
             TArray<FMassEntityHandle> SpawnedEntities;
-            Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
+            // Held until the fragments below are written — the cell-index observers fire on its release.
+            const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
 
             for (int32 i = 0; i < SpawnDataArray.Num(); ++i) {
                 const FMythicCreatureSpawnData &Data = SpawnDataArray[i];
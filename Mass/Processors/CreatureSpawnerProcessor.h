@@ -56,7 +56,7 @@ protected:
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
 
 private:
-    /** Query for existing creature entities (per-cell density count + far-from-player despawn). */
+    /** Query for existing creature entities (far-from-player despawn; per-cell density comes from the shared cell index). */
     FMassEntityQuery ExistingCreatureQuery;
 
     /** Timer accumulator — processor runs at configured interval, not every frame. */
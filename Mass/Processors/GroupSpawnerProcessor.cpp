@@ -10,10 +10,12 @@
 #include "Mass/Processors/PopulationSpawnerProcessor.h" // UMythicPopulationSpawnerProcessor::ResolveEconomy
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Settlements/MythicSettlement.h"
+#include "World/LivingWorld/Settlements/SettlementRegistry.h" // FMythicSettlementSnapshot (pinned settlement reads)
 #include "World/LivingWorld/Groups/GroupTypes.h"
 #include "World/LivingWorld/NPCGeneration/NPCGenerator.h"
 #include "World/LivingWorld/MythicTags_LivingWorld.h" // NPC.Role.* fallbacks
@@ -47,19 +49,10 @@ UMythicGroupSpawnerProcessor::UMythicGroupSpawnerProcessor() {
     // read already reflects this tick's ambient spawns where the radii overlap.
     ExecutionOrder.ExecuteAfter.Add(TEXT("UMythicPopulationSpawnerProcessor"));
 
-    ExistingNPCQuery.RegisterWithProcessor(*this);
     ExistingGroupQuery.RegisterWithProcessor(*this);
 }
 
 void UMythicGroupSpawnerProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) {
-    // SAME SHAPE as UMythicPopulationSpawnerProcessor::ExistingNPCQuery so the per-cell density count is consistent with
-    // the ambient population (shared MaxEntitiesPerCell cap). Group members carry FMythicNPCTag, so they self-count here
-    // on subsequent ticks; encounter-owned entities are excluded (the EncounterDirector owns those).
-    ExistingNPCQuery.AddRequirement<FMythicIdentityFragment>(EMassFragmentAccess::ReadOnly);
-    ExistingNPCQuery.AddRequirement<FMythicSignificanceFragment>(EMassFragmentAccess::ReadOnly);
-    ExistingNPCQuery.AddTagRequirement<FMythicNPCTag>(EMassFragmentPresence::All);
-    ExistingNPCQuery.AddTagRequirement<FMythicEncounterEntityTag>(EMassFragmentPresence::None);
-
     // Distinct-active-group count (MaxActiveGroups cap) — only entities that carry the group fragment.
     ExistingGroupQuery.AddRequirement<FMythicGroupFragment>(EMassFragmentAccess::ReadOnly);
     ExistingGroupQuery.AddTagRequirement<FMythicGroupMemberTag>(EMassFragmentPresence::All);
@@ -140,15 +133,16 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
         return;
     }
 
-    // ─── Step 2: Count existing per-cell NPC density + distinct active groups ───
-    TMap<FMythicCellCoord, int32> CellEntityCounts;
-    ExistingNPCQuery.ForEachEntityChunk(Context, [&CellEntityCounts](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        for (int32 i = 0; i < NumEntities; ++i) {
-            CellEntityCounts.FindOrAdd(IdentityView[i].Cell)++;
-        }
-    });
+    // ─── Step 2: Per-cell NPC density + distinct active groups ───
+    // Density is read per candidate cell from the shared cell index (every NPC except encounter-owned entities — the
+    // shared MaxEntitiesPerCell cap; group members carry FMythicNPCTag, so they self-count once their creates flush).
+    // PendingCellSpawns overlays this tick's not-yet-flushed group members on top of the index count.
+    const UMythicCellEntityIndexSubsystem *CellIndexSubsystem = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (!CellIndexSubsystem) {
+        return;
+    }
+    const FMythicCellSpatialIndex &CellIndex = CellIndexSubsystem->GetIndex();
+    TMap<FMythicCellCoord, int32> PendingCellSpawns;
 
     TSet<uint32> ActiveGroupIds;
     ExistingGroupQuery.ForEachEntityChunk(Context, [&ActiveGroupIds](FMassExecutionContext &ChunkContext) {
@@ -162,6 +156,15 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
     });
     int32 ActiveGroupCount = ActiveGroupIds.Num();
 
+    // Published settlement + faction snapshots, acquired ONCE per Execute (each pinned under the publisher's read lock,
+    // no SimulationLock).
+    // No settlement snapshot yet = no settlement cells = nothing for this spawner to do.
+    const FMythicSettlementSnapshotRef SettlementSnap = LWS->AcquireSettlementSnapshot();
+    const FMythicFactionSnapshotRef FactionSnap = FactionDB->AcquireSnapshot();
+    if (!SettlementSnap || !FactionSnap) {
+        return;
+    }
+
     // ─── Step 3: Per settlement cell — chance-gated weighted template draw ───
     const float SpawnRadiusSq = FMath::Square(Settings->GroupSpawnRadius);
     const int32 SpawnRadiusCells = FMath::CeilToInt(Settings->GroupSpawnRadius);
@@ -210,28 +213,30 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
                     continue;
                 }
 
-                // Dedup across overlapping player radii BEFORE the SimulationLock-guarded settlement copy (same
-                // contention-avoidance reason as the population/patrol spawners).
+                // Dedup across overlapping player radii BEFORE the settlement lookup (same reason as the
+                // population/patrol spawners).
                 if (ConsideredCells.Contains(CandidateCell)) {
                     continue;
                 }
                 ConsideredCells.Add(CandidateCell);
 
-                // Groups spawn in SETTLEMENT cells only (opposite of the patrol spawner). Snapshot under SimulationLock.
-                FMythicSettlementData Settlement;
-                if (!LWS->CopySettlementAtCell(CandidateCell, Settlement) || !Settlement.GoverningFaction.IsValid()) {
+                // Groups spawn in SETTLEMENT cells only (opposite of the patrol spawner). Read from the published snapshot.
+                const FMythicSettlementSnapshotEntry *SettlementEntry = SettlementSnap->FindAtCell(CandidateCell);
+                if (!SettlementEntry || !SettlementEntry->GoverningFaction.IsValid()) {
                     continue;
                 }
+                const FMythicSettlementSnapshotEntry &Settlement = *SettlementEntry;
                 // Hostile camps host enemies, not social groups — skip them (their occupants are the population spawner's
                 // bandit branch).
                 if (Settlement.bIsHostileCamp) {
                     continue;
                 }
 
-                FMythicFactionData FactionData;
-                if (!FactionDB->GetFaction(Settlement.GoverningFaction, FactionData)) {
+                const FMythicFactionData *FactionEntry = FactionSnap->GetFaction(Settlement.GoverningFaction);
+                if (!FactionEntry) {
                     continue;
                 }
+                const FMythicFactionData &FactionData = *FactionEntry;
                 if (!FactionData.bAlive || FactionData.Status != EMythicFactionStatus::Active) {
                     continue;
                 }
@@ -259,7 +264,9 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
                 const FMythicGroupTemplate &Template = TemplatesArr[TemplateIndex];
 
                 // ─── Roll member counts (clamped to MaxGroupMembers + per-cell + per-tick headroom) ───
-                const int32 CurrentCount = CellEntityCounts.FindRef(CandidateCell);
+                const int32 *PendingSpawns = PendingCellSpawns.Find(CandidateCell);
+                const int32 CurrentCount = CellIndex.GetCellCount(CandidateCell, EMythicCellEntityCategory::NPC, EMythicCellEntityCategory::Encounter)
+                    + (PendingSpawns ? *PendingSpawns : 0);
                 const int32 CellHeadroom = FMath::Max(0, PerCellCap - CurrentCount);
                 int32 RemainingGroupSlots = FMath::Min(MaxGroupMembers, FMath::Min(CellHeadroom, MemberBudget));
                 if (RemainingGroupSlots <= 0) {
@@ -379,7 +386,7 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
                 GroupSpans.Add(Span);
 
                 // Charge budgets + per-cell bookkeeping so a second group in the same cell this tick can't overflow it.
-                CellEntityCounts.FindOrAdd(CandidateCell) += SpawnedThisGroup;
+                PendingCellSpawns.FindOrAdd(CandidateCell) += SpawnedThisGroup;
                 MemberBudget -= SpawnedThisGroup;
                 --GroupBudget;
                 ++ActiveGroupCount;
@@ -408,7 +415,8 @@ void UMythicGroupSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FM
             FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
             TArray<FMassEntityHandle> Spawned;
-            Manager.BatchCreateEntities(Archetype, SpawnData.Num(), Spawned);
+            // Held until the fragments below are written — the cell-index observers fire on its release.
+            const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, SpawnData.Num(), Spawned);
             for (int32 i = 0; i < SpawnData.Num(); ++i) {
                 const FMythicGroupMemberSpawnData &D = SpawnData[i];
                 const FMassEntityHandle E = Spawned[i];
@@ -79,10 +79,6 @@ protected:
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
 
 private:
-    /** Existing-ambient-NPC count query — SAME SHAPE as the population spawner's so the per-cell density count is
-     *  consistent with the shared MaxEntitiesPerCell cap (group members carry FMythicNPCTag, so they self-count on
-     *  subsequent ticks). Read-only. */
-    FMassEntityQuery ExistingNPCQuery;
 
     /** Existing-group-member query (entities carrying FMythicGroupFragment) — used to count distinct active GroupIds for
      *  the MaxActiveGroups cap. Read-only. */
@@ -10,6 +10,8 @@
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "AI/Party/PartySubsystem.h" // companion far-despawn exemption
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Settlements/SettlementRegistry.h"
@@ -39,13 +41,15 @@ namespace {
         return EMythicSpawnPointPurpose::Civilian;
     }
 
-    // Deterministically pick a generated spawn point in Cell matching Desired (else an Any-purpose point, else null).
-    // Among the matching points, index = NameHash % count, so the choice is stable for a given NPC identity (no RNG,
-    // no wall-clock) and spreads NPCs of the same purpose across the available anchors. Returns nullptr when the cell
-    // has no generated points of a usable purpose → caller uses the cell-center placement path (coexistence).
-    const FMythicSpawnPoint *PickPointForCell(const FMythicSettlementData &Settlement, const FMythicCellCoord &Cell,
+    // Deterministically pick a generated spawn point from CellPoints (one cell's slice of the settlement snapshot)
+    // matching Desired (else an Any-purpose point, else null). Among the matching points, index = NameHash % count, so
+    // the choice is stable for a given NPC identity (no RNG, no wall-clock) and spreads NPCs of the same purpose across
+    // the available anchors. The snapshot keeps each cell's points in the settlement's original order, so picks match
+    // the old full-list scan. Returns nullptr when the cell has no generated points of a usable purpose → caller uses
+    // the cell-center placement path (coexistence).
+    const FMythicSpawnPoint *PickPointForCell(TConstArrayView<FMythicSpawnPoint> CellPoints,
                                               EMythicSpawnPointPurpose Desired, uint32 NameHash) {
-        if (Settlement.SpawnPoints.Num() == 0) {
+        if (CellPoints.Num() == 0) {
             return nullptr;
         }
 
@@ -54,8 +58,8 @@ namespace {
         for (int32 Pass = 0; Pass < 2; ++Pass) {
             const EMythicSpawnPointPurpose Want = (Pass == 0) ? Desired : EMythicSpawnPointPurpose::Any;
             int32 MatchCount = 0;
-            for (const FMythicSpawnPoint &P : Settlement.SpawnPoints) {
-                if (P.Cell == Cell && P.Purpose == Want) {
+            for (const FMythicSpawnPoint &P : CellPoints) {
+                if (P.Purpose == Want) {
                     ++MatchCount;
                 }
             }
@@ -64,8 +68,8 @@ namespace {
             }
             const int32 Target = static_cast<int32>(NameHash % static_cast<uint32>(MatchCount));
             int32 Seen = 0;
-            for (const FMythicSpawnPoint &P : Settlement.SpawnPoints) {
-                if (P.Cell == Cell && P.Purpose == Want) {
+            for (const FMythicSpawnPoint &P : CellPoints) {
+                if (P.Purpose == Want) {
                     if (Seen == Target) {
                         return &P;
                     }
@@ -203,6 +207,16 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
     const FGameplayTag HostileRoleTag =
         Settings->BanditRoleTag.IsValid() ? Settings->BanditRoleTag : TAG_NPC_ROLE_BANDIT;
 
+    // Acquire the published settlement + faction snapshots ONCE per Execute (never per cell). Each is pinned under the
+    // publisher's read lock, held only for the pointer copy; neither takes SimulationLock, so a long sim tick can no
+    // longer stall this loop, and both stay immutable for the whole Execute (at most one sim commit stale — the next
+    // refill wave sees the newer state).
+    const FMythicSettlementSnapshotRef SettlementSnap = Registry->AcquireSnapshot();
+    const FMythicFactionSnapshotRef FactionSnap = FactionDB->AcquireSnapshot();
+    if (!SettlementSnap || !FactionSnap) {
+        return;
+    }
+
     // ─── Step 1: Gather player positions ───────────────
 
     TArray<FMythicCellCoord> PlayerCells;
@@ -221,23 +235,27 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
 
     UE_LOG(LogMythLivingWorld, Verbose, TEXT("PopulationSpawner: %d player(s) detected."), PlayerCells.Num());
 
-    // ─── Step 2: Count existing entities per cell ──────
-
-    TMap<FMythicCellCoord, int32> CellEntityCounts;
-    ExistingNPCQuery.ForEachEntityChunk(Context, [&CellEntityCounts](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
+    // ─── Step 2: Per-cell census source ───────────────
 
-        for (int32 i = 0; i < NumEntities; ++i) {
-            CellEntityCounts.FindOrAdd(IdentityView[i].Cell)++;
-        }
-    });
+    // Existing per-cell counts come from the shared, incrementally maintained cell index, read only for the candidate
+    // cells below — no per-tick walk of every NPC into a count map. The counted set matches ExistingNPCQuery: NPCs,
+    // minus travelers (a passing caravan mustn't crowd out the settlement) and encounter-owned entities.
+    const UMythicCellEntityIndexSubsystem *CellIndexSubsystem = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (!CellIndexSubsystem) {
+        return;
+    }
+    const FMythicCellSpatialIndex &CellIndex = CellIndexSubsystem->GetIndex();
+    constexpr EMythicCellEntityCategory CensusExcluded = EMythicCellEntityCategory::Traveler | EMythicCellEntityCategory::Encounter;
 
     // ─── Step 3: Determine cells needing spawns ────────
 
     const float SpawnRadiusSq = FMath::Square(Settings->PopulationSpawnRadius);
     const int32 SpawnRadiusCells = FMath::CeilToInt(Settings->PopulationSpawnRadius);
-    int32 SpawnBudget = Settings->MaxSpawnsPerTick;
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 SpawnCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::Spawns, Settings->MaxSpawnsPerTick)
+                                   : Settings->MaxSpawnsPerTick;
+    int32 SpawnBudget = SpawnCap;
+    const double SpawnStartSeconds = FPlatformTime::Seconds();
 
     struct FMythicNPCPopulationSpawnData {
         FMythicIdentityFragment Identity;
@@ -247,7 +265,7 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
     TArray<FMythicNPCPopulationSpawnData> SpawnDataArray;
     SpawnDataArray.Reserve(SpawnBudget);
 
-    // Cells already CONSIDERED this tick — dedup across overlapping player spawn radii (see the lock note below).
+    // Cells already CONSIDERED this tick — dedup across overlapping player spawn radii (see the note below).
     TSet<FMythicCellCoord> ConsideredCells;
     for (const FMythicCellCoord &PlayerCell : PlayerCells) {
         for (int32 DY = -SpawnRadiusCells; DY <= SpawnRadiusCells && SpawnBudget > 0; ++DY) {
@@ -262,29 +280,30 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
                     continue;
                 }
 
-                // Dedup BEFORE the (SimulationLock-guarded) settlement copy below. When players cluster — common in
-                // co-op — their spawn radii overlap heavily, so the same cell is reached once per nearby player.
-                // Considering each cell only once per tick eliminates redundant CopySettlementAtCell lock acquisitions
-                // that contend with the sim thread's conquest writes. The set holds every cell CONSIDERED this tick
-                // (settlement or not), so even non-settlement cells aren't re-copied per overlapping player.
+                // Dedup BEFORE the settlement lookup below. When players cluster — common in co-op — their spawn radii
+                // overlap heavily, so the same cell is reached once per nearby player; without the set an overlapping
+                // cell would be refilled once per player in the same wave (its count in the cell index isn't bumped
+                // until this tick's deferred creates flush). The set holds every cell CONSIDERED this tick, settlement or not.
                 if (ConsideredCells.Contains(CandidateCell)) {
                     continue;
                 }
                 ConsideredCells.Add(CandidateCell);
 
-                // Only populate cells that belong to a settlement. Snapshot it under SimulationLock (copy-out) — NEVER
-                // hold a live Settlements-map pointer on this game thread: the sim thread writes GoverningFaction during
-                // a conquest TransferSettlement under that lock, so an unlocked read here tears (NPCs stamped to the
-                // wrong faction) or dangles across a RegisterSettlement rehash.
-                FMythicSettlementData Settlement;
-                if (!LWS->CopySettlementAtCell(CandidateCell, Settlement) || !Settlement.GoverningFaction.IsValid()) {
+                // Only populate cells that belong to a settlement. Read through the published snapshot — NEVER a live
+                // Settlements-map pointer on this game thread: the sim thread writes GoverningFaction during a conquest
+                // TransferSettlement, so an unlocked live read tears (NPCs stamped to the wrong faction) or dangles
+                // across a RegisterSettlement rehash. The snapshot entry is immutable and pinned by SettlementSnap.
+                const FMythicSettlementSnapshotEntry *SettlementEntry = SettlementSnap->FindAtCell(CandidateCell);
+                if (!SettlementEntry || !SettlementEntry->GoverningFaction.IsValid()) {
                     continue;
                 }
+                const FMythicSettlementSnapshotEntry &Settlement = *SettlementEntry;
 
-                FMythicFactionData FactionData;
-                if (!FactionDB->GetFaction(Settlement.GoverningFaction, FactionData)) {
+                const FMythicFactionData *FactionEntry = FactionSnap->GetFaction(Settlement.GoverningFaction);
+                if (!FactionEntry) {
                     continue;
                 }
+                const FMythicFactionData &FactionData = *FactionEntry;
 
                 // Capacity = ControlledCellCount × PopulationPerCell (same formula as WorldSimThread)
                 const int32 FactionCapacity = FactionData.ControlledCellCount * Settings->PopulationPerCell;
@@ -296,7 +315,7 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
                     FactionCapacity
                     );
 
-                const int32 CurrentCount = CellEntityCounts.FindRef(CandidateCell);
+                const int32 CurrentCount = CellIndex.GetCellCount(CandidateCell, EMythicCellEntityCategory::NPC, CensusExcluded);
                 const int32 Deficit = TargetCount - CurrentCount;
 
                 if (Deficit <= 0) {
@@ -365,7 +384,7 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
                     // the ActorSpawnProcessor skips the project+scatter pipeline (it re-tests occupancy only). No matching
                     // point → leave bHasSpawnOverride false → the existing cell-center placement path is used verbatim.
                     if (const FMythicSpawnPoint *Point = PickPointForCell(
-                            Settlement, CandidateCell, PurposeForRole(SpawnData.Identity.RoleTag),
+                            SettlementSnap->GetSpawnPointsInCell(CandidateCell), PurposeForRole(SpawnData.Identity.RoleTag),
                             SpawnData.Identity.NameHash)) {
                         SpawnData.Identity.SpawnOverridePos = Point->WorldLocation;
                         SpawnData.Identity.bHasSpawnOverride = true;
@@ -401,6 +420,11 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
         }
     }
 
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::Spawns, SpawnCap - SpawnBudget, SpawnBudget <= 0 ? SpawnCap : 0,
+                            FPlatformTime::Seconds() - SpawnStartSeconds);
+    }
+
     if (SpawnDataArray.Num() > 0) {
         Context.Defer().PushCommand<FMassDeferredCreateCommand>([SpawnDataArray](FMassEntityManager &Manager) {
             TRACE_CPUPROFILER_EVENT_SCOPE(MythicPopulationSpawner_DeferredSpawn);
@@ -414,7 +438,8 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
             FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
             TArray<FMassEntityHandle> SpawnedEntities;
-            Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
+            // Held until the fragments below are written — the cell-index observers fire on its release.
+            const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
 
             for (int32 i = 0; i < SpawnDataArray.Num(); ++i) {
                 const FMythicNPCPopulationSpawnData &Data = SpawnDataArray[i];
@@ -463,7 +488,7 @@ void UMythicPopulationSpawnerProcessor::Execute(FMassEntityManager &EntityManage
                 }
                 // Tear down any embodied cognitive actor FIRST. A Tier2-promoted NPC that drifts into the despawn band
                 // before the significance pass demotes it still has an AMythicNPCCharacter in EmbodiedActors; a bare
-                // DestroyEntity would orphan that actor (dangling CognitiveBrain SourceEntity + live think timer) and
+                // DestroyEntity would orphan that actor (dangling CognitiveBrain SourceEntity + live scheduler registration) and
                 // leak the EmbodiedActors[Entity] key — the same hole the EncounterDirector cleanup fixed on its path.
                 // Safe to call directly: this processor is bRequiresGameThreadExecution (ctor), so we are on the game
                 // thread; LWS is captured from Execute.
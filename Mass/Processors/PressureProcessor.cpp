@@ -6,6 +6,7 @@
 #include "MassEntitySubsystem.h"
 #include "MassExecutionContext.h"
 #include "MassCommandBuffer.h"
+#include "MassEntityView.h"
 #include "Mass/Fragments/MythicMassFragments.h"
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/Events/ActionEventSubsystem.h"
@@ -13,6 +14,8 @@
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "Engine/World.h"
 
 UMythicPressureProcessor::UMythicPressureProcessor() {
@@ -43,6 +46,26 @@ bool UMythicPressureProcessor::ComputeDespairState(float TotalPressure, float De
     return TotalPressure >= DespairThreshold * RecoveryFraction; // stay despaired until well below the trigger
 }
 
+void UMythicPressureProcessor::BuildWitnessRuns(TConstArrayView<FMythicWitnessResult> Results, TArray<int32> &OutOrder,
+                                                TArray<int32> &OutRunStarts) {
+    OutOrder.Reset(Results.Num());
+    OutRunStarts.Reset();
+    for (int32 i = 0; i < Results.Num(); ++i) {
+        OutOrder.Add(i);
+    }
+    OutOrder.StableSort([&Results](int32 A, int32 B) {
+        const FMassEntityHandle &EA = Results[A].WitnessEntity;
+        const FMassEntityHandle &EB = Results[B].WitnessEntity;
+        return EA.Index != EB.Index ? EA.Index < EB.Index : EA.SerialNumber < EB.SerialNumber;
+    });
+    for (int32 i = 0; i < OutOrder.Num(); ++i) {
+        if (i == 0 || Results[OutOrder[i]].WitnessEntity != Results[OutOrder[i - 1]].WitnessEntity) {
+            OutRunStarts.Add(i);
+        }
+    }
+    OutRunStarts.Add(OutOrder.Num());
+}
+
 void UMythicPressureProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicPressure_Execute);
 
@@ -87,7 +110,11 @@ void UMythicPressureProcessor::Execute(FMassEntityManager &EntityManager, FMassE
     const float GuardAssistRadius = Settings->GuardAssistRadius;
     const float EmotionalContagionRadius = Settings->EmotionalContagionRadius;
     const int32 MobFormationThreshold = Settings->MobFormationThreshold;
-    int32 PressureBudget = Settings->MaxPressureEvalsPerFrame;
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 PressureCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::PressureEvals, Settings->MaxPressureEvalsPerFrame)
+                                      : Settings->MaxPressureEvalsPerFrame;
+    int32 PressureBudget = PressureCap;
+    const double PassStartSeconds = FPlatformTime::Seconds();
     const double CurrentWorldTime = World->GetTimeSeconds();
 
     const int32 ThreatIdx = static_cast<int32>(EMythicPressureChannel::Threat);
@@ -102,260 +129,312 @@ void UMythicPressureProcessor::Execute(FMassEntityManager &EntityManager, FMassE
     const int32 FightVent = static_cast<int32>(EMythicVentChannel::Fight);
     const int32 FleeVent = static_cast<int32>(EMythicVentChannel::Flee);
 
-    // ─── Phase 1: Build entity → witness results map ───
-    TMap<FMassEntityHandle, TArray<const FMythicWitnessResult *>> EntityWitnessMap;
-    EntityWitnessMap.Reserve(WitnessResults.Num());
-
+    // ─── Phase 1: Group this frame's witness results into one run per witness ───
     const int32 MaxToProcess = FMath::Min(WitnessResults.Num(), PressureBudget);
-    for (int32 i = 0; i < MaxToProcess; ++i) {
-        EntityWitnessMap.FindOrAdd(WitnessResults[i].WitnessEntity).Add(&WitnessResults[i]);
-    }
+    BuildWitnessRuns(MakeArrayView(WitnessResults.GetData(), MaxToProcess), WitnessOrder, WitnessRunStarts);
 
     // ─── Phase 2: Track venting for secondary effects (guard assist, contagion, mobs) ───
-    // Deferred secondary pressure effects — applied next frame to avoid O(n²) within same frame
-    struct FDeferredPressureBoost {
-        FMythicCellCoord Cell;
-        FMythicFactionId Faction;
-        int32 PressureChannel;
-        float Amount;
-        int32 Radius; // cell radius — from the designer-tunable GuardAssist/EmotionalContagion settings, not a hardcoded 2
-    };
-    TArray<FDeferredPressureBoost> DeferredBoosts;
-    DeferredBoosts.Reserve(16);
-
-    // Track Fight targets for mob dynamics
-    TMap<int32, int32> FightTargetCounts; // target entity index → count of fighters
-
-    // ─── Phase 3: Process entities with pending witness results ───
-    HydratedEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
-        if (PressureBudget <= 0) {
-            return;
+    // Deferred secondary pressure effects — applied after the main pass to avoid O(n²) within the same pass
+    DeferredBoosts.Reset();
+    FightVents.Reset();
+
+    // ─── Phase 3: Process each witness by handle ───
+    // Only entities that actually have results are touched (fragments fetched from the EntityManager, as the witness
+    // processor does); a witness that de-hydrated since it was queued is skipped, as the hydrated sweep used to skip it.
+    for (int32 Run = 0; Run + 1 < WitnessRunStarts.Num() && PressureBudget > 0; ++Run) {
+        const int32 RunBegin = WitnessRunStarts[Run];
+        const int32 RunEnd = WitnessRunStarts[Run + 1];
+        const FMassEntityHandle Entity = WitnessResults[WitnessOrder[RunBegin]].WitnessEntity;
+        if (!EntityManager.IsEntityActive(Entity)) {
+            continue;
+        }
+        const FMassEntityView EntityView(EntityManager, Entity);
+        if (!EntityView.HasTag<FMythicHydratedTag>()) {
+            continue;
+        }
+        const FMythicIdentityFragment *IdentityPtr = EntityView.GetFragmentDataPtr<FMythicIdentityFragment>();
+        FMythicPsychodynamicFragment *PsychoPtr = EntityView.GetFragmentDataPtr<FMythicPsychodynamicFragment>();
+        const FMythicPersonalityFragment *PersonalityPtr = EntityView.GetFragmentDataPtr<FMythicPersonalityFragment>();
+        FMythicSignificanceFragment *SignificancePtr = EntityView.GetFragmentDataPtr<FMythicSignificanceFragment>();
+        if (!IdentityPtr || !PsychoPtr || !PersonalityPtr || !SignificancePtr) {
+            continue;
         }
 
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        auto PsychoView = ChunkContext.GetMutableFragmentView<FMythicPsychodynamicFragment>();
-        const auto PersonalityView = ChunkContext.GetFragmentView<FMythicPersonalityFragment>();
-        auto SignificanceView = ChunkContext.GetMutableFragmentView<FMythicSignificanceFragment>();
-
-        for (int32 i = 0; i < NumEntities && PressureBudget > 0; ++i) {
-            const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-            const TArray<const FMythicWitnessResult *> *Results = EntityWitnessMap.Find(Entity);
-            if (!Results) {
-                continue; // This entity has no pending witness results
-            }
+        const FMythicIdentityFragment &Identity = *IdentityPtr;
+        FMythicPsychodynamicFragment &Psycho = *PsychoPtr;
+        const FMythicPersonalityFragment &Personality = *PersonalityPtr;
+        FMythicSignificanceFragment &Significance = *SignificancePtr;
 
-            const FMythicIdentityFragment &Identity = IdentityView[i];
-            FMythicPsychodynamicFragment &Psycho = PsychoView[i];
-            const FMythicPersonalityFragment &Personality = PersonalityView[i];
-            FMythicSignificanceFragment &Significance = SignificanceView[i];
-
-            // ─── Lazy Decay ───
-            // O(1): exponential decay since last event, computed only when touched
-            const double Elapsed = CurrentWorldTime - Psycho.LastEventTime;
-            if (Elapsed > 0.0 && Psycho.LastEventTime > 0.0) {
-                const float DecayMultiplier = FMath::Exp(-DecayRate * static_cast<float>(Elapsed));
-                for (int32 c = 0; c < PressureChannelCount; ++c) {
-                    Psycho.Pressure[c] *= DecayMultiplier;
-                }
+        // ─── Lazy Decay ───
+        // O(1): exponential decay since last event, computed only when touched
+        const double Elapsed = CurrentWorldTime - Psycho.LastEventTime;
+        if (Elapsed > 0.0 && Psycho.LastEventTime > 0.0) {
+            const float DecayMultiplier = FMath::Exp(-DecayRate * static_cast<float>(Elapsed));
+            for (int32 c = 0; c < PressureChannelCount; ++c) {
+                Psycho.Pressure[c] *= DecayMultiplier;
             }
+        }
 
-            // ─── Accumulate Pressure ───
-            for (const FMythicWitnessResult *Result : *Results) {
-                --PressureBudget;
-
-                // Severity-based magnitude scaling
-                float SeverityMagnitude = 0.0f;
-                switch (Result->Severity) {
-                case EMythicMoralSeverity::Disapprove:
-                    SeverityMagnitude = 0.3f * Result->EventSignificance;
-                    break;
-                case EMythicMoralSeverity::Condemn:
-                    SeverityMagnitude = 0.7f * Result->EventSignificance;
-                    break;
-                case EMythicMoralSeverity::Hostile:
-                    SeverityMagnitude = 1.0f * Result->EventSignificance;
-                    break;
-                default:
-                    continue; // Ignore — should never reach here
-                }
-
-                // Map category flags → pressure channels
-                const bool bIsCombat = (Result->EventCategoryFlags & EMythicEventCategory::Combat) != 0;
-                const bool bIsCrime = (Result->EventCategoryFlags & EMythicEventCategory::Crime) != 0;
-                const bool bIsDeath = (Result->EventCategoryFlags & EMythicEventCategory::Death) != 0;
-                const bool bIsMagic = (Result->EventCategoryFlags & EMythicEventCategory::Magic) != 0;
-                const bool bIsEnvironment = (Result->EventCategoryFlags & EMythicEventCategory::Environment) != 0;
-
-                if (bIsCombat) {
-                    Psycho.Pressure[ThreatIdx] += SeverityMagnitude;
-                    Psycho.Pressure[WrathIdx] += SeverityMagnitude * 0.5f;
-                }
-                if (bIsCrime) {
-                    Psycho.Pressure[InjusticeIdx] += SeverityMagnitude;
-                }
-                if (bIsDeath) {
-                    Psycho.Pressure[GriefIdx] += SeverityMagnitude * 0.8f;
-                }
-                // Magic/ability spectacle → extra Threat for non-magic NPCs
-                if (bIsMagic) {
-                    Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.6f;
-                }
-                // Environmental danger → pure Threat
-                if (bIsEnvironment) {
-                    Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.7f;
-                }
-                // Default: if no specific category, apply to Threat at half magnitude
-                if (!bIsCombat && !bIsCrime && !bIsDeath && !bIsMagic && !bIsEnvironment) {
-                    Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.5f;
-                }
+        // ─── Accumulate Pressure ───
+        for (int32 r = RunBegin; r < RunEnd; ++r) {
+            const FMythicWitnessResult *Result = &WitnessResults[WitnessOrder[r]];
+            --PressureBudget;
+
+            // Severity-based magnitude scaling
+            float SeverityMagnitude = 0.0f;
+            switch (Result->Severity) {
+            case EMythicMoralSeverity::Disapprove:
+                SeverityMagnitude = 0.3f * Result->EventSignificance;
+                break;
+            case EMythicMoralSeverity::Condemn:
+                SeverityMagnitude = 0.7f * Result->EventSignificance;
+                break;
+            case EMythicMoralSeverity::Hostile:
+                SeverityMagnitude = 1.0f * Result->EventSignificance;
+                break;
+            default:
+                continue; // Ignore — should never reach here
             }
 
-            Psycho.LastEventTime = CurrentWorldTime;
+            // Map category flags → pressure channels
+            const bool bIsCombat = (Result->EventCategoryFlags & EMythicEventCategory::Combat) != 0;
+            const bool bIsCrime = (Result->EventCategoryFlags & EMythicEventCategory::Crime) != 0;
+            const bool bIsDeath = (Result->EventCategoryFlags & EMythicEventCategory::Death) != 0;
+            const bool bIsMagic = (Result->EventCategoryFlags & EMythicEventCategory::Magic) != 0;
+            const bool bIsEnvironment = (Result->EventCategoryFlags & EMythicEventCategory::Environment) != 0;
 
-            // ─── Despair Detection (REQ-BEH-009) ───
-            // Total unvented pressure across all channels exceeds threshold → despair
-            float TotalPressure = 0.0f;
-            for (int32 c = 0; c < PressureChannelCount; ++c) {
-                TotalPressure += Psycho.Pressure[c];
+            if (bIsCombat) {
+                Psycho.Pressure[ThreatIdx] += SeverityMagnitude;
+                Psycho.Pressure[WrathIdx] += SeverityMagnitude * 0.5f;
             }
-            // Despair is RECOVERABLE (was previously set-once-never-reset → permanent). Recompute each pressure tick; it
-            // lifts once pressure falls back through the hysteresis band. NOTE: only updates when the entity has witness
-            // results this tick (the processor is event-driven), so decay-only recovery lags until the entity is next
-            // processed — acceptable, and far better than never recovering. (bDespaired's consumer — faction-collapse
-            // spirals per the fragment doc — is still unbuilt/design-gated; this makes the state correct for it.)
-            const bool bNowDespaired = ComputeDespairState(TotalPressure, DespairThreshold, Psycho.bDespaired);
-            if (bNowDespaired != Psycho.bDespaired) {
-                Psycho.bDespaired = bNowDespaired;
-                UE_LOG(LogMythLivingWorld, Log, TEXT("Despair: Entity in cell %s %s (total=%.2f, threshold=%.2f)"),
-                       *Identity.Cell.ToString(),
-                       bNowDespaired ? TEXT("reached despair") : TEXT("recovered from despair"),
-                       TotalPressure, DespairThreshold);
+            if (bIsCrime) {
+                Psycho.Pressure[InjusticeIdx] += SeverityMagnitude;
             }
-
-            // ─── Vent Check ───
-            // Find the pressure channel with the highest value
-            float MaxPressure = 0.0f;
-            int32 MaxPressureChannel = -1;
-            for (int32 c = 0; c < PressureChannelCount; ++c) {
-                if (Psycho.Pressure[c] > MaxPressure) {
-                    MaxPressure = Psycho.Pressure[c];
-                    MaxPressureChannel = c;
-                }
+            if (bIsDeath) {
+                Psycho.Pressure[GriefIdx] += SeverityMagnitude * 0.8f;
+            }
+            // Magic/ability spectacle → extra Threat for non-magic NPCs
+            if (bIsMagic) {
+                Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.6f;
             }
+            // Environmental danger → pure Threat
+            if (bIsEnvironment) {
+                Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.7f;
+            }
+            // Default: if no specific category, apply to Threat at half magnitude
+            if (!bIsCombat && !bIsCrime && !bIsDeath && !bIsMagic && !bIsEnvironment) {
+                Psycho.Pressure[ThreatIdx] += SeverityMagnitude * 0.5f;
+            }
+        }
 
-            if (MaxPressure >= VentThreshold && MaxPressureChannel >= 0) {
-                // Route through personality — pick the vent channel with highest weight
-                // Guards (role tag) have elevated Enforce weight from personality generation
-                float BestVentWeight = -1.0f;
-                int32 BestVentChannel = 0;
-                for (int32 v = 0; v < VentChannelCount; ++v) {
-                    if (Personality.VentWeights[v] > BestVentWeight) {
-                        BestVentWeight = Personality.VentWeights[v];
-                        BestVentChannel = v;
-                    }
-                }
+        Psycho.LastEventTime = CurrentWorldTime;
 
-                // ─── Guard Assist Propagation (REQ-BEH-002) ───
-                // When a guard vents via Enforce, nearby same-faction guards get assist boost
-                if (BestVentChannel == EnforceVent) {
-                    FDeferredPressureBoost Boost;
-                    Boost.Cell = Identity.Cell;
-                    Boost.Faction = Identity.Faction;
-                    Boost.PressureChannel = InjusticeIdx;
-                    Boost.Amount = MaxPressure * 0.3f; // 30% of enforcer's pressure
-                    Boost.Radius = FMath::RoundToInt(GuardAssistRadius); // REQ-BEH-002 designer-tunable radius (was hardcoded 2)
-                    DeferredBoosts.Add(Boost);
-                }
+        // ─── Despair Detection (REQ-BEH-009) ───
+        // Total unvented pressure across all channels exceeds threshold → despair
+        float TotalPressure = 0.0f;
+        for (int32 c = 0; c < PressureChannelCount; ++c) {
+            TotalPressure += Psycho.Pressure[c];
+        }
+        // Despair is RECOVERABLE (was previously set-once-never-reset → permanent). Recompute each pressure tick; it
+        // lifts once pressure falls back through the hysteresis band. NOTE: only updates when the entity has witness
+        // results this tick (the processor is event-driven), so decay-only recovery lags until the entity is next
+        // processed — acceptable, and far better than never recovering. (bDespaired's consumer — faction-collapse
+        // spirals per the fragment doc — is still unbuilt/design-gated; this makes the state correct for it.)
+        const bool bNowDespaired = ComputeDespairState(TotalPressure, DespairThreshold, Psycho.bDespaired);
+        if (bNowDespaired != Psycho.bDespaired) {
+            Psycho.bDespaired = bNowDespaired;
+            UE_LOG(LogMythLivingWorld, Log, TEXT("Despair: Entity in cell %s %s (total=%.2f, threshold=%.2f)"),
+                   *Identity.Cell.ToString(),
+                   bNowDespaired ? TEXT("reached despair") : TEXT("recovered from despair"),
+                   TotalPressure, DespairThreshold);
+        }
 
-                // ─── Emotional Contagion (REQ-BEH-003) ───
-                // Flee venting spreads Threat to nearby entities (budget-capped, 1 hop)
-                if (BestVentChannel == FleeVent) {
-                    FDeferredPressureBoost Boost;
-                    Boost.Cell = Identity.Cell;
-                    Boost.Faction = FMythicFactionId(); // Any faction — contagion crosses faction lines
-                    Boost.PressureChannel = ThreatIdx;
-                    Boost.Amount = MaxPressure * 0.2f; // 20% contagion transfer
-                    Boost.Radius = FMath::RoundToInt(EmotionalContagionRadius); // REQ-BEH-003 designer-tunable radius (was hardcoded 2)
-                    DeferredBoosts.Add(Boost);
-                }
+        // ─── Vent Check ───
+        // Find the pressure channel with the highest value
+        float MaxPressure = 0.0f;
+        int32 MaxPressureChannel = -1;
+        for (int32 c = 0; c < PressureChannelCount; ++c) {
+            if (Psycho.Pressure[c] > MaxPressure) {
+                MaxPressure = Psycho.Pressure[c];
+                MaxPressureChannel = c;
+            }
+        }
 
-                // ─── Mob Dynamics (REQ-BEH-005) ───
-                // Track Fight target for mob formation
-                if (BestVentChannel == FightVent && Psycho.FightTargetEntity != INDEX_NONE) {
-                    FightTargetCounts.FindOrAdd(Psycho.FightTargetEntity)++;
+        if (MaxPressure >= VentThreshold && MaxPressureChannel >= 0) {
+            // Route through personality — pick the vent channel with highest weight
+            // Guards (role tag) have elevated Enforce weight from personality generation
+            float BestVentWeight = -1.0f;
+            int32 BestVentChannel = 0;
+            for (int32 v = 0; v < VentChannelCount; ++v) {
+                if (Personality.VentWeights[v] > BestVentWeight) {
+                    BestVentWeight = Personality.VentWeights[v];
+                    BestVentChannel = v;
                 }
+            }
+
+            // ─── Guard Assist Propagation (REQ-BEH-002) ───
+            // When a guard vents via Enforce, nearby same-faction guards get assist boost
+            if (BestVentChannel == EnforceVent) {
+                FDeferredPressureBoost Boost;
+                Boost.Cell = Identity.Cell;
+                Boost.Faction = Identity.Faction;
+                Boost.PressureChannel = InjusticeIdx;
+                Boost.Amount = MaxPressure * 0.3f; // 30% of enforcer's pressure
+                Boost.Radius = FMath::RoundToInt(GuardAssistRadius); // REQ-BEH-002 designer-tunable radius (was hardcoded 2)
+                DeferredBoosts.Add(Boost);
+            }
 
-                // Reduce pressure after venting (release half the peak pressure)
-                Psycho.Pressure[MaxPressureChannel] *= 0.5f;
+            // ─── Emotional Contagion (REQ-BEH-003) ───
+            // Flee venting spreads Threat to nearby entities (budget-capped, 1 hop)
+            if (BestVentChannel == FleeVent) {
+                FDeferredPressureBoost Boost;
+                Boost.Cell = Identity.Cell;
+                Boost.Faction = FMythicFactionId(); // Any faction — contagion crosses faction lines
+                Boost.PressureChannel = ThreatIdx;
+                Boost.Amount = MaxPressure * 0.2f; // 20% contagion transfer
+                Boost.Radius = FMath::RoundToInt(EmotionalContagionRadius); // REQ-BEH-003 designer-tunable radius (was hardcoded 2)
+                DeferredBoosts.Add(Boost);
+            }
 
-                UE_LOG(LogMythLivingWorld, Verbose, TEXT("Pressure vent: Entity vented via channel %d (pressure=%.2f, threshold=%.2f)"),
-                       BestVentChannel, MaxPressure, VentThreshold);
+            // ─── Mob Dynamics (REQ-BEH-005) ───
+            // Track Fight target for mob formation
+            if (BestVentChannel == FightVent && Psycho.FightTargetEntity != INDEX_NONE) {
+                FightVents.Add(FFightVent{Psycho.FightTargetEntity, &Psycho});
             }
 
-            // Dirty significance — pressure change affects significance score
-            Significance.bDirty = true;
+            // Reduce pressure after venting (release half the peak pressure)
+            Psycho.Pressure[MaxPressureChannel] *= 0.5f;
+
+            UE_LOG(LogMythLivingWorld, Verbose, TEXT("Pressure vent: Entity vented via channel %d (pressure=%.2f, threshold=%.2f)"),
+                   BestVentChannel, MaxPressure, VentThreshold);
         }
-    });
 
-    // ─── Phase 4: Apply mob bonuses ───
-    // When enough entities share the same Fight target, grant mob bonus
-    if (FightTargetCounts.Num() > 0) {
-        HydratedEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
-            const int32 NumEntities = ChunkContext.GetNumEntities();
-            auto PsychoView = ChunkContext.GetMutableFragmentView<FMythicPsychodynamicFragment>();
-
-            for (int32 i = 0; i < NumEntities; ++i) {
-                FMythicPsychodynamicFragment &Psycho = PsychoView[i];
-                if (Psycho.FightTargetEntity == INDEX_NONE) {
-                    continue;
-                }
+        // Dirty significance — pressure change affects significance score
+        Significance.bDirty = true;
+    }
 
-                const int32 *Count = FightTargetCounts.Find(Psycho.FightTargetEntity);
-                if (Count && *Count >= MobFormationThreshold) {
+    // ─── Phase 4: Apply mob bonuses ───
+    // When enough entities vent Fight at the same target this pass, every hydrated entity holding that target gets the
+    // mob bonus — idle allies included, not just this pass's venters. Sorting by target turns the per-target crowd count
+    // into run lengths; the holders come from the shared fight-target index instead of a sweep of the hydrated set.
+    // A target with no recorded holders (no FightTargetEntity writer calls SetFightTarget yet) falls back to the run's
+    // own venters. No structural change happens inside Execute, so the venter fragment pointers are still valid.
+    const UMythicCellEntityIndexSubsystem *CellIndex = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (FightVents.Num() >= MobFormationThreshold && FightVents.Num() > 0) {
+        FightVents.Sort([](const FFightVent &A, const FFightVent &B) { return A.TargetEntity < B.TargetEntity; });
+        for (int32 RunBegin = 0; RunBegin < FightVents.Num();) {
+            const int32 Target = FightVents[RunBegin].TargetEntity;
+            int32 RunEnd = RunBegin + 1;
+            while (RunEnd < FightVents.Num() && FightVents[RunEnd].TargetEntity == Target) {
+                ++RunEnd;
+            }
+            const int32 VentBegin = RunBegin;
+            RunBegin = RunEnd;
+            if (RunEnd - VentBegin < MobFormationThreshold) {
+                continue;
+            }
+            const TConstArrayView<FMassEntityHandle> Holders =
+                CellIndex ? CellIndex->GetFightTargetHolders(Target) : TConstArrayView<FMassEntityHandle>();
+            if (Holders.Num() == 0) {
+                for (int32 f = VentBegin; f < RunEnd; ++f) {
                     // Mob formed: boost Fight pressure, reduce Threat (safety in numbers)
+                    FMythicPsychodynamicFragment &Psycho = *FightVents[f].Psycho;
                     Psycho.Pressure[WrathIdx] += 0.3f;
                     Psycho.Pressure[ThreatIdx] *= 0.7f; // 30% Threat reduction from mob
                 }
+                continue;
             }
-        });
+            for (const FMassEntityHandle Holder : Holders) {
+                if (!EntityManager.IsEntityActive(Holder)) {
+                    continue;
+                }
+                const FMassEntityView HolderView(EntityManager, Holder);
+                if (!HolderView.HasTag<FMythicHydratedTag>()) {
+                    continue;
+                }
+                FMythicPsychodynamicFragment *Psycho = HolderView.GetFragmentDataPtr<FMythicPsychodynamicFragment>();
+                if (!Psycho || Psycho->FightTargetEntity != Target) {
+                    continue; // retargeted without updating the index — skip rather than trust a stale entry
+                }
+                // Mob formed: boost Fight pressure, reduce Threat (safety in numbers)
+                Psycho->Pressure[WrathIdx] += 0.3f;
+                Psycho->Pressure[ThreatIdx] *= 0.7f; // 30% Threat reduction from mob
+            }
+        }
     }
 
-    // ─── Phase 5: Store deferred boosts for next frame processing ───
-    // Guard assist and emotional contagion are applied via the ActionEventSubsystem's
-    // deferred pressure boost queue. This prevents O(n²) per-frame cascades.
-    // The boosts are processed in the NEXT frame's pressure pass.
-    // (For now, we process inline with a secondary chunk pass — budget-capped)
-    if (DeferredBoosts.Num() > 0) {
+    // ─── Phase 5: Apply deferred boosts ───
+    // Guard assist and emotional contagion: boosts with the same origin cell / faction / channel / radius are merged
+    // into one (amounts summed), then each reaches its receivers through the shared cell→entity index — a broad-phase
+    // box query, narrowed by the same Manhattan radius and faction check as before. Budget-capped.
+    if (DeferredBoosts.Num() > 0 && CellIndex) {
+        DeferredBoosts.Sort([](const FDeferredPressureBoost &A, const FDeferredPressureBoost &B) {
+            if (A.Cell.X != B.Cell.X) { return A.Cell.X < B.Cell.X; }
+            if (A.Cell.Y != B.Cell.Y) { return A.Cell.Y < B.Cell.Y; }
+            if (A.Faction.Index != B.Faction.Index) { return A.Faction.Index < B.Faction.Index; }
+            if (A.PressureChannel != B.PressureChannel) { return A.PressureChannel < B.PressureChannel; }
+            return A.Radius < B.Radius;
+        });
+        int32 Merged = 0;
+        for (int32 b = 1; b < DeferredBoosts.Num(); ++b) {
+            FDeferredPressureBoost &Into = DeferredBoosts[Merged];
+            const FDeferredPressureBoost &Boost = DeferredBoosts[b];
+            if (Boost.Cell == Into.Cell && Boost.Faction.Index == Into.Faction.Index &&
+                Boost.PressureChannel == Into.PressureChannel && Boost.Radius == Into.Radius) {
+                Into.Amount += Boost.Amount;
+            }
+            else {
+                DeferredBoosts[++Merged] = Boost;
+            }
+        }
+        DeferredBoosts.SetNum(Merged + 1, EAllowShrinking::No);
+
         int32 DeferredBudget = 16; // Max deferred pressure applications per frame
-        HydratedEntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
+        for (const FDeferredPressureBoost &Boost : DeferredBoosts) {
             if (DeferredBudget <= 0) {
-                return;
+                break;
             }
-            const int32 NumEntities = ChunkContext.GetNumEntities();
-            const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-            auto PsychoView = ChunkContext.GetMutableFragmentView<FMythicPsychodynamicFragment>();
-
-            for (int32 i = 0; i < NumEntities && DeferredBudget > 0; ++i) {
-                const FMythicIdentityFragment &Identity = IdentityView[i];
-                for (const FDeferredPressureBoost &Boost : DeferredBoosts) {
-                    // Check cell radius
-                    const int32 Dist = FMath::Abs(Identity.Cell.X - Boost.Cell.X)
-                        + FMath::Abs(Identity.Cell.Y - Boost.Cell.Y);
-                    if (Dist > Boost.Radius) { // designer-tunable per-boost radius (GuardAssist/EmotionalContagion settings)
-                        continue;
-                    }
-                    // Faction check (if specified — contagion is faction-agnostic)
-                    if (Boost.Faction.IsValid() && Identity.Faction.Index != Boost.Faction.Index) {
-                        continue;
-                    }
-                    PsychoView[i].Pressure[Boost.PressureChannel] += Boost.Amount;
-                    --DeferredBudget;
+            BoostCandidates.Reset();
+            CellIndex->GetIndex().QueryRange(Boost.Cell, Boost.Radius, BoostCandidates);
+
+            for (const FMassEntityHandle Candidate : BoostCandidates) {
+                if (DeferredBudget <= 0) {
+                    break;
+                }
+                if (!EntityManager.IsEntityActive(Candidate)) {
+                    continue;
+                }
+                const FMassEntityView CandidateView(EntityManager, Candidate);
+                if (!CandidateView.HasTag<FMythicHydratedTag>()) {
+                    continue;
                 }
+                const FMythicIdentityFragment *Identity = CandidateView.GetFragmentDataPtr<FMythicIdentityFragment>();
+                FMythicPsychodynamicFragment *Psycho = CandidateView.GetFragmentDataPtr<FMythicPsychodynamicFragment>();
+                if (!Identity || !Psycho) {
+                    continue;
+                }
+                // Check cell radius
+                const int32 Dist = FMath::Abs(Identity->Cell.X - Boost.Cell.X)
+                    + FMath::Abs(Identity->Cell.Y - Boost.Cell.Y);
+                if (Dist > Boost.Radius) { // designer-tunable per-boost radius (GuardAssist/EmotionalContagion settings)
+                    continue;
+                }
+                // Faction check (if specified — contagion is faction-agnostic)
+                if (Boost.Faction.IsValid() && Identity->Faction.Index != Boost.Faction.Index) {
+                    continue;
+                }
+                Psycho->Pressure[Boost.PressureChannel] += Boost.Amount;
+                --DeferredBudget;
             }
-        });
+        }
+    }
+
+    // Results past the cap stay queued for the next frame; that carried-over tail is the lane's backlog.
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::PressureEvals, PressureCap - PressureBudget, WitnessResults.Num() - MaxToProcess,
+                            FPlatformTime::Seconds() - PassStartSeconds);
     }
 
-    // Flush consumed witness results
-    ActionSub->FlushProcessedWitnessResults();
+    // Flush consumed witness results (the processed prefix only)
+    ActionSub->FlushProcessedWitnessResults(MaxToProcess);
 }
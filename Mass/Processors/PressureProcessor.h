@@ -6,17 +6,20 @@
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
 #include "MassEntityQuery.h"
+#include "World/LivingWorld/LivingWorldTypes.h"
 #include "PressureProcessor.generated.h"
 
 class UMythicActionEventSubsystem;
+struct FMythicPsychodynamicFragment;
+struct FMythicWitnessResult;
 
 /**
  * MASS processor that accumulates emotional pressure on hydrated entities
  * and triggers venting behavior when thresholds are crossed.
  *
  * Flow (event-driven — only runs when there are witness results):
- * 1. Consumes FMythicWitnessResult queue from the WitnessPerceptionProcessor
- * 2. For each result (budget-capped by MaxPressureEvalsPerFrame):
+ * 1. Consumes FMythicWitnessResult queue from the WitnessPerceptionProcessor, sorted into one run per witness
+ * 2. For each witness run (budget-capped by MaxPressureEvalsPerFrame results), fragments fetched by handle:
  *    a. Lazy decay — exponential decay from LastEventTime to now, O(1)
  *    b. Accumulate pressure into channels based on severity + category
  *    c. Check if any channel exceeds VentThreshold
@@ -27,7 +30,11 @@ class UMythicActionEventSubsystem;
  * Zero cost when no witness results are pending.
  *
  * Budget: MaxPressureEvalsPerFrame per frame.
- * Cost: O(W × C) where W = witness results, C = pressure channels (6).
+ * Cost: O(W log W + W × C) where W = witness results, C = pressure channels (6) — never a sweep of the hydrated set.
+ * Mob crowding counts Fight venters per target from a sorted run and reaches every hydrated holder of a crowded target
+ * through the shared fight-target holder index — or, while that target has no recorded holders, the run's own venters;
+ * guard-assist / contagion boosts are merged per (cell, faction, channel, radius) and reach their receivers through the
+ * shared cell→entity index.
  */
 UCLASS()
 class MYTHIC_API UMythicPressureProcessor : public UMassProcessor {
@@ -44,14 +51,43 @@ public:
      */
     static bool ComputeDespairState(float TotalPressure, float DespairThreshold, bool bWasDespaired);
 
+    /**
+     * Group witness results by witness: OutOrder receives the result indices sorted by witness handle (stable, so each
+     * witness keeps its results in queue order) and OutRunStarts the offset into OutOrder where each witness's run
+     * begins, plus a trailing OutOrder.Num() sentinel — run r is [OutRunStarts[r], OutRunStarts[r + 1]). Pure + static.
+     */
+    static void BuildWitnessRuns(TConstArrayView<FMythicWitnessResult> Results, TArray<int32> &OutOrder, TArray<int32> &OutRunStarts);
+
 protected:
     virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
 
 private:
-    /** Query for hydrated entities (have psychodynamic + personality fragments) */
+    /** Secondary pressure from a vent (guard assist / emotional contagion), applied to entities near Cell */
+    struct FDeferredPressureBoost {
+        FMythicCellCoord Cell;
+        FMythicFactionId Faction;
+        int32 PressureChannel = 0;
+        float Amount = 0.0f;
+        int32 Radius = 0; // cell radius — from the designer-tunable GuardAssist/EmotionalContagion settings
+    };
+
+    /** A Fight vent this frame, for mob crowding (counted per target after a sort) */
+    struct FFightVent {
+        int32 TargetEntity = INDEX_NONE;
+        FMythicPsychodynamicFragment *Psycho = nullptr;
+    };
+
+    /** Declares the hydrated fragment access to the MASS scheduler; witnesses are reached by handle, not by sweeping it */
     FMassEntityQuery HydratedEntityQuery;
 
+    /** Per-frame scratch (retained between frames) */
+    TArray<int32> WitnessOrder;
+    TArray<int32> WitnessRunStarts;
+    TArray<FDeferredPressureBoost> DeferredBoosts;
+    TArray<FFightVent> FightVents;
+    TArray<FMassEntityHandle> BoostCandidates;
+
     /** Cached subsystem pointer */
     TWeakObjectPtr<UMythicActionEventSubsystem> CachedActionSubsystem;
 };
@@ -8,6 +8,7 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h"
@@ -42,6 +43,15 @@ namespace {
         }
         return UMythicSignificanceProcessor::IsInCloseView(Actor->GetActorLocation(), PlayerViews, MinSpawnDistance);
     }
+
+    // One entity the promotion/demotion pass may transition. Sig/Identity point into chunk memory, which stays put for
+    // the whole Execute — every structural change this processor makes goes through the deferred command buffer.
+    struct FSignificanceEntry {
+        FMassEntityHandle Entity;
+        FMythicSignificanceFragment *Sig = nullptr;
+        const FMythicIdentityFragment *Identity = nullptr;
+        bool bCreature = false;
+    };
 }
 
 UMythicSignificanceProcessor::UMythicSignificanceProcessor() {
@@ -111,8 +121,14 @@ void UMythicSignificanceProcessor::Execute(FMassEntityManager &EntityManager, FM
     // Proximity-driven embodiment: populate the world near players regardless of narrative score (see the floor below).
     const bool bProxEmbodiment = Settings->bProximityForcesEmbodiment;
     const int32 EmbodimentRadiusCells = Settings->EmbodimentRadiusCells;
-    int32 RescoreBudget = Settings->MaxRescoresPerFrame;
-    int32 PromotionBudget = Settings->MaxPromotionsPerFrame;
+    // Rescore / promotion caps come from the budget governor (anchored on the static settings) when it is running.
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 RescoreCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::Rescores, Settings->MaxRescoresPerFrame)
+                                     : Settings->MaxRescoresPerFrame;
+    const int32 PromotionCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::Promotions, Settings->MaxPromotionsPerFrame)
+                                       : Settings->MaxPromotionsPerFrame;
+    int32 RescoreBudget = RescoreCap;
+    int32 PromotionBudget = PromotionCap;
     // Demotions get their OWN per-frame budget so a tick saturated by promotions can never starve demotions
     // (which is what FREES cognitive slots) — see the embodiment-arc review. Tier1->Tier0 and Tier2->Tier1
     // draw this counter; the two promotion branches draw PromotionBudget.
@@ -214,6 +230,7 @@ void UMythicSignificanceProcessor::Execute(FMassEntityManager &EntityManager, FM
     const bool bDespawnGateActive = bViewGate && PlayerViews.Num() > 0;
 
     // ─── Pass 1: Rescore dirty entities ───
+    const double RescoreStartSeconds = FPlatformTime::Seconds();
     AllSignificanceQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
         if (RescoreBudget <= 0) {
             return;
@@ -302,304 +319,400 @@ void UMythicSignificanceProcessor::Execute(FMassEntityManager &EntityManager, FM
         }
     });
 
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::Rescores, RescoreCap - RescoreBudget, RescoreBudget <= 0 ? RescoreCap : 0,
+                            FPlatformTime::Seconds() - RescoreStartSeconds);
+    }
+
     // ─── Pass 2: Promotion / Demotion ───
-    // First, count existing actors per tier to enforce the two hard caps. ONE O(entities) read-walk tallies BOTH:
+    // Transitions are applied by RANK, not in archetype/chunk order. Previously the first qualifying entities the chunk
+    // walk reached took every free slot and the per-frame budget, so a barely-qualifying ambient in an early archetype
+    // could hold a cognitive slot while a far more significant NPC in a later chunk waited indefinitely. Now:
+    //   (a) ONE O(entities) read-walk does the perma-dead cleanup, tallies the hard caps, and classifies every entity
+    //       as a threshold demotion, a promotion candidate, or a current holder a stronger candidate could displace;
+    //   (b) threshold demotions run weakest-first — they FREE slots before anything is promoted;
+    //   (c) the top-K candidates (SelectTopK) are promoted strongest-first into the freed + spare slots, and a candidate
+    //       that meets a full cap displaces the weakest holder of that pool if it outscores it by the hysteresis margin.
+    //
+    // The caps tallied in (a):
     //   - CognitiveActorCount = Tier1+ (hydrated)  → bounded by MaxCognitiveActors at the Tier0->Tier1 site.
     //   - EmbodiedActorCount  = Tier2  (embodied)  → bounded by MaxEmbodiedActors at BOTH Tier2-promotion sites.
-    // Fused into the existing pre-pass (no second walk) per the no-hitch budget contract.
     // Counts are split humanoid vs CREATURE so wildlife gets its OWN budget (MaxCreatureActors) and can't starve the
     // humanoid cognitive cap — a creature-dense wilderness was filling MaxCognitiveActors and blocking travelers/NPCs
     // from ever promoting. CognitiveActorCount/EmbodiedActorCount now count NON-creature (humanoid) entities only;
     // CreatureActiveCount counts hydrated (Tier1+) creatures (one budget covering creature hydrate + embody).
+    const double PassStartSeconds = FPlatformTime::Seconds();
+    FMythicSignificanceStats &Stats = LWS->GetMutableSignificanceStats();
+
     int32 CognitiveActorCount = 0;
     int32 EmbodiedActorCount = 0;
     int32 CreatureActiveCount = 0;
-    AllSignificanceQuery.ForEachEntityChunk(Context, [&CognitiveActorCount, &EmbodiedActorCount, &CreatureActiveCount](FMassExecutionContext &ChunkContext) {
-        const bool bCreatureChunk = ChunkContext.DoesArchetypeHaveTag<FMythicCreatureTag>();
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto SignificanceView = ChunkContext.GetFragmentView<FMythicSignificanceFragment>();
-        for (int32 i = 0; i < NumEntities; ++i) {
-            if (SignificanceView[i].Tier >= EMythicSignificanceTier::Tier1_Reactive) {
-                if (bCreatureChunk) { ++CreatureActiveCount; } else { ++CognitiveActorCount; }
-            }
-            if (!bCreatureChunk && SignificanceView[i].Tier >= EMythicSignificanceTier::Tier2_Cognitive) {
-                ++EmbodiedActorCount;
-            }
-        }
-    });
+    int32 TierPopulation[4] = {}; // telemetry: tiers as (a) found them
 
     const int32 MaxCognitiveActors = Settings->MaxCognitiveActors;
     const int32 MaxEmbodiedActors = Settings->MaxEmbodiedActors;
     const int32 MaxCreatureActors = Settings->MaxCreatureActors;
+    const float Tier2Threshold = Settings->Tier2PromotionThreshold;
 
-    AllSignificanceQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
-        if (PromotionBudget <= 0 && DemotionBudget <= 0) {
-            return;
-        }
+    UMythicPersistentNPCRegistry *NPCRegistry = LWS->GetPersistentNPCRegistry();
+
+    // Candidates are kept structure-of-arrays: the scores are one contiguous float column, so ranking every qualifying
+    // ambient streams 4 bytes per candidate instead of chasing fragment pointers.
+    TArray<float> CandidateScores;
+    TArray<FSignificanceEntry> Candidates;
+    TArray<FSignificanceEntry> Demotions;
 
+    // Displaceable holders per pool: hydrated-but-bodyless humanoids / creatures (displace → Tier0) and embodied
+    // humanoids (displace → Tier1). Party companions never enter the embodied list — same exemption as the demotion.
+    // A Tier1 entity that is itself a Tier2 candidate is not a holder (it would be displaced, then re-promoted).
+    TArray<FSignificanceEntry> HumanoidHolders;
+    TArray<FSignificanceEntry> CreatureHolders;
+    TArray<FSignificanceEntry> EmbodiedHolders;
+
+    // ─── (a) Classify ───
+    AllSignificanceQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext &ChunkContext) {
+        // Whole chunks are homogeneous by archetype, so the creature test is computed ONCE per chunk.
+        const bool bChunkIsCreature = ChunkContext.DoesArchetypeHaveTag<FMythicCreatureTag>();
         const int32 NumEntities = ChunkContext.GetNumEntities();
+        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
         auto SignificanceView = ChunkContext.GetMutableFragmentView<FMythicSignificanceFragment>();
 
-        // ─── Creature-hydration gate (embodiment-service-LOCK-v1 §5a) ───
-        // Whole chunks are homogeneous by archetype, so this is computed ONCE per chunk. Humanoid BDI hydration
-        // (Psychodynamic / Personality / Social fragments + GeneratePersonality + leader-candidate reporting) is
-        // skipped for creature entities below — a wolf must NOT get a faction personality. The SHARED parts of
-        // promotion (FMythicHydratedTag, the tier decision, FMythicActorSpawnRequestTag) still apply so the creature
-        // hydrates + routes through the ActorSpawnProcessor's creature query exactly as before.
-        const bool bChunkIsCreature = ChunkContext.DoesArchetypeHaveTag<FMythicCreatureTag>();
+        for (int32 i = 0; i < NumEntities; ++i) {
+            FMythicSignificanceFragment &Sig = SignificanceView[i];
+            const FSignificanceEntry Entry{ChunkContext.GetEntity(i), &Sig, &IdentityView[i], bChunkIsCreature};
+            ++TierPopulation[FMath::Clamp(static_cast<int32>(Sig.Tier), 0, 3)];
 
-        // ─── spawn view-gate (embodiment-service-LOCK-v1 §5b) ───
-        // Would embodying this entity pop an actor INTO a player's close view? Tested at the candidate spawn position
-        // (the entity's cell center — the actor doesn't exist yet). Honors the stream-in grace bypass: during grace
-        // bSpawnGateActive is false, so a gated candidate embodies immediately (bulk pre-population). A gated candidate
-        // is NOT promoted to Tier2 this tick — it stays Tier1 (hydrated, bodyless) and is rescored every tick, so it
-        // embodies the instant the player looks away or moves past ViewGateMinSpawnDistance (no permanent deferral).
-        auto WouldPopInView = [&](const FMythicIdentityFragment &Id) -> bool {
-            if (!bSpawnGateActive || !Grid) {
-                return false;
+            if (Sig.Tier == EMythicSignificanceTier::Tier0_Ambient) {
+                if (QualifiesForPromotion(Sig.Score, PromotionThreshold, Hysteresis)) {
+                    CandidateScores.Add(Sig.Score);
+                    Candidates.Add(Entry);
+                }
+                continue;
             }
-            const FVector CandidatePos = Grid->CellToWorld(Id.Cell);
-            return IsInCloseView(CandidatePos, PlayerViews, ViewGateMinDist);
-        };
-
-        for (int32 i = 0; i < NumEntities && (PromotionBudget > 0 || DemotionBudget > 0); ++i) {
-            FMythicSignificanceFragment &Sig = SignificanceView[i];
 
             // ─── Perma-dead cleanup (combat death of an embodied NPC) — evaluated FIRST ───
             // AMythicNPCCharacter::HandleNPCDeath marks a combat-killed NPC perma-dead, but its entity is still
             // hydrated (Tier1+) and, if Tier2, still embodied. Fully dehydrate it back to ambient Tier0 here so it
-            // FREES its cognitive slot. (Dropping only to Tier1 could get STUCK near a player: the Tier1->Tier2
-            // IsPermaDead guard `continue`s before the Tier1->Tier0 demotion is ever reached.) The IsPermaDead
-            // guards on both promotion branches then permanently block re-embodiment as a zombie.
-            if (Sig.Tier >= EMythicSignificanceTier::Tier1_Reactive) {
-                const FMythicIdentityFragment &DeadId = ChunkContext.GetFragmentView<FMythicIdentityFragment>()[i];
-                UMythicPersistentNPCRegistry *DeadReg = LWS->GetPersistentNPCRegistry();
-                if (DeadReg && DeadReg->IsPermaDead(DeadId.NameHash)) {
-                    const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-                    // Only Tier2 entities carry FMythicCognitiveTag / an embodied actor — request the despawn so the
-                    // existing ActorSpawnProcessor consumer removes the tag + destroys the actor. Combat death is
-                    // terminal: this is NOT gated by the no-vanish-in-front view-guard (a perma-dead embodied NPC is
-                    // being torn down regardless — the actor's own death/corpse path owns the visible removal).
-                    if (Sig.Tier == EMythicSignificanceTier::Tier2_Cognitive) {
-                        Context.Defer().AddTag<FMythicActorDespawnRequestTag>(Entity);
-                        // Drops out of the embodied (Tier2) set — humanoids only count against MaxEmbodiedActors.
-                        if (!bChunkIsCreature) {
-                            --EmbodiedActorCount;
-                        }
-                    }
-                    // Remove the hydration fragments + drop to Tier0, mirroring the Tier1->Tier0 demotion (single
-                    // source of truth for de-hydration), and free the cognitive/creature slot. Creatures carry ONLY the
-                    // HydratedTag (the BDI fragments were skipped on their promotion), so only strip those for humanoids.
-                    Context.Defer().RemoveTag<FMythicHydratedTag>(Entity);
-                    if (!bChunkIsCreature) {
-                        Context.Defer().RemoveFragment<FMythicPsychodynamicFragment>(Entity);
-                        Context.Defer().RemoveFragment<FMythicPersonalityFragment>(Entity);
-                        Context.Defer().RemoveFragment<FMythicSocialFragment>(Entity);
-                    }
-                    Sig.Tier = EMythicSignificanceTier::Tier0_Ambient;
-                    Sig.Score = 0.0f;
-                    Sig.RelevantEventCount = 0;
-                    if (bChunkIsCreature) { --CreatureActiveCount; } else { --CognitiveActorCount; }
-                    continue;
+            // FREES its cognitive slot (it is simply never tallied). Dropping only to Tier1 could get STUCK near a
+            // player; the IsPermaDead guard on the promotion path then permanently blocks re-embodiment as a zombie.
+            if (NPCRegistry && NPCRegistry->IsPermaDead(IdentityView[i].NameHash)) {
+                // Only Tier2 entities carry FMythicCognitiveTag / an embodied actor — request the despawn so the
+                // existing ActorSpawnProcessor consumer removes the tag + destroys the actor. Combat death is
+                // terminal: this is NOT gated by the no-vanish-in-front view-guard (a perma-dead embodied NPC is
+                // being torn down regardless — the actor's own death/corpse path owns the visible removal).
+                if (Sig.Tier == EMythicSignificanceTier::Tier2_Cognitive) {
+                    Context.Defer().AddTag<FMythicActorDespawnRequestTag>(Entry.Entity);
                 }
+                // Remove the hydration fragments + drop to Tier0, mirroring the Tier1->Tier0 demotion. Creatures carry
+                // ONLY the HydratedTag (the BDI fragments were skipped on their promotion), so only strip those for
+                // humanoids.
+                Context.Defer().RemoveTag<FMythicHydratedTag>(Entry.Entity);
+                if (!bChunkIsCreature) {
+                    Context.Defer().RemoveFragment<FMythicPsychodynamicFragment>(Entry.Entity);
+                    Context.Defer().RemoveFragment<FMythicPersonalityFragment>(Entry.Entity);
+                    Context.Defer().RemoveFragment<FMythicSocialFragment>(Entry.Entity);
+                }
+                Sig.Tier = EMythicSignificanceTier::Tier0_Ambient;
+                Sig.Score = 0.0f;
+                Sig.RelevantEventCount = 0;
+                ++Stats.Demotions;
+                continue;
             }
 
-            // ─── Tier 0 → Tier 1 Promotion ───
-            if (PromotionBudget > 0
-                && Sig.Tier == EMythicSignificanceTier::Tier0_Ambient
-                && QualifiesForPromotion(Sig.Score, PromotionThreshold, Hysteresis)) {
-
-                // Enforce the hard cap — creatures against their OWN budget (MaxCreatureActors) so wildlife never
-                // starves the humanoid cognitive cap (the bug: a creature-dense wild filled MaxCognitiveActors and a
-                // crossing merchant could never get a slot to promote).
-                if (bChunkIsCreature ? (CreatureActiveCount >= MaxCreatureActors)
-                                     : (CognitiveActorCount >= MaxCognitiveActors)) {
-                    continue;
-                }
+            if (bChunkIsCreature) { ++CreatureActiveCount; } else { ++CognitiveActorCount; }
+            if (!bChunkIsCreature && Sig.Tier == EMythicSignificanceTier::Tier2_Cognitive) {
+                ++EmbodiedActorCount;
+            }
 
-                // Promote: add hydration fragments via deferred commands
-                const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-                const FMythicIdentityFragment &Identity = ChunkContext.GetFragmentView<FMythicIdentityFragment>()[i];
-
-                // Check PersistentNPCRegistry — dead NPCs cannot be promoted. This MUST run BEFORE drawing the promotion
-                // budget + cognitive count below: a perma-dead Tier0 NPC selected for promotion would otherwise leak a
-                // per-frame promotion slot (--PromotionBudget) + inflate CognitiveActorCount before the `continue` bails,
-                // starving real promotions that frame.
-                UMythicPersistentNPCRegistry *Registry = LWS->GetPersistentNPCRegistry();
-                if (Registry && Registry->IsPermaDead(Identity.NameHash)) {
-                    Sig.Score = 0.0f; // Suppress score
-                    continue; // Skip promotion, this NPC is dead forever
+            if (QualifiesForDemotion(Sig.Score, DemotionThreshold, Hysteresis)) {
+                Demotions.Add(Entry);
+            }
+            else if (Sig.Tier == EMythicSignificanceTier::Tier1_Reactive) {
+                if (QualifiesForPromotion(Sig.Score, Tier2Threshold, 0.0f)) {
+                    CandidateScores.Add(Sig.Score);
+                    Candidates.Add(Entry);
                 }
+                else {
+                    (bChunkIsCreature ? CreatureHolders : HumanoidHolders).Add(Entry);
+                }
+            }
+            else if (!bChunkIsCreature && !(PartySubsystem && PartySubsystem->IsCompanionEntity(Entry.Entity))) {
+                EmbodiedHolders.Add(Entry);
+            }
+        }
+    });
+
+    // Faction reads for hydration (ideology-biased personality) come from one snapshot acquired per Execute and indexed
+    // in place, instead of copying a whole FMythicFactionData out of the database per promotion.
+    UMythicFactionDatabase *FactionDB = LWS->GetFactionDatabase();
+    const FMythicFactionSnapshotRef FactionSnapshot = FactionDB ? FactionDB->AcquireSnapshot() : FMythicFactionSnapshotRef();
+
+    // ─── spawn view-gate (embodiment-service-LOCK-v1 §5b) ───
+    // Would embodying this entity pop an actor INTO a player's close view? Tested at the candidate spawn position
+    // (the entity's cell center — the actor doesn't exist yet). Honors the stream-in grace bypass: during grace
+    // bSpawnGateActive is false, so a gated candidate embodies immediately (bulk pre-population). A gated candidate
+    // is NOT promoted to Tier2 this tick — it stays Tier1 (hydrated, bodyless) and is rescored every tick, so it
+    // embodies the instant the player looks away or moves past ViewGateMinSpawnDistance (no permanent deferral).
+    auto WouldPopInView = [&](const FMythicIdentityFragment &Id) -> bool {
+        if (!bSpawnGateActive || !Grid) {
+            return false;
+        }
+        const FVector CandidatePos = Grid->CellToWorld(Id.Cell);
+        return IsInCloseView(CandidatePos, PlayerViews, ViewGateMinDist);
+    };
+
+    // Tier1 → Tier0: remove the hydration fragments. Creatures carry ONLY the HydratedTag (BDI fragments were skipped on
+    // their promotion), so only strip those for humanoids. Draws DemotionBudget.
+    auto Dehydrate = [&](const FSignificanceEntry &Entry) {
+        --DemotionBudget;
+        ++Stats.Demotions;
+        if (Entry.bCreature) { --CreatureActiveCount; } else { --CognitiveActorCount; }
+
+        Context.Defer().RemoveTag<FMythicHydratedTag>(Entry.Entity);
+        if (!Entry.bCreature) {
+            Context.Defer().RemoveFragment<FMythicPsychodynamicFragment>(Entry.Entity);
+            Context.Defer().RemoveFragment<FMythicPersonalityFragment>(Entry.Entity);
+            Context.Defer().RemoveFragment<FMythicSocialFragment>(Entry.Entity);
+        }
+
+        Entry.Sig->Tier = EMythicSignificanceTier::Tier0_Ambient;
+        Entry.Sig->RelevantEventCount = 0;
+
+        UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Demoted entity to Tier0_Ambient (score=%.2f, cognitive=%d/%d)"),
+               Entry.Sig->Score, CognitiveActorCount, MaxCognitiveActors);
+    };
+
+    // Tier2 → Tier1 (dehydrate: despawn the embodied actor). Drops to Tier1_Reactive (stays hydrated + still counted in
+    // CognitiveActorCount, which counts Tier1+) and requests that the MASS->actor bridge despawn its actor; the freed
+    // ACTOR is handled by the bridge's despawn consumer. Draws DemotionBudget.
+    auto Disembody = [&](const FSignificanceEntry &Entry) {
+        --DemotionBudget;
+        ++Stats.Demotions;
+        if (!Entry.bCreature) { --EmbodiedActorCount; } // only humanoids count against MaxEmbodiedActors
+        Context.Defer().AddTag<FMythicActorDespawnRequestTag>(Entry.Entity);
+        Entry.Sig->Tier = EMythicSignificanceTier::Tier1_Reactive;
+
+        UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Demoted entity Tier2->Tier1, despawn requested (score=%.2f, cognitive=%d/%d)"),
+               Entry.Sig->Score, CognitiveActorCount, MaxCognitiveActors);
+    };
+
+    // no-vanish-in-front (embodiment-service-LOCK-v1 §5b): never despawn an embodied actor inside a player's close view —
+    // it keeps its body and is re-evaluated next tick. Grace is NOT applied to despawn (bDespawnGateActive ignores it).
+    // The actor's REAL location is the gate target (see IsEmbodiedActorInCloseView).
+    auto IsDespawnGated = [&](const FSignificanceEntry &Entry) -> bool {
+        return IsEmbodiedActorInCloseView(LWS, Entry.Entity, bDespawnGateActive, PlayerViews, ViewGateMinDist);
+    };
+
+    // ─── (b) Threshold demotions, weakest first ───
+    const auto ByScoreAscending = [](const FSignificanceEntry &A, const FSignificanceEntry &B) {
+        return A.Sig->Score < B.Sig->Score;
+    };
+    Demotions.Sort(ByScoreAscending);
+    for (const FSignificanceEntry &Entry : Demotions) {
+        if (DemotionBudget <= 0) {
+            break;
+        }
+        if (Entry.Sig->Tier == EMythicSignificanceTier::Tier1_Reactive) {
+            Dehydrate(Entry);
+        }
+        // Party companions are EXEMPT — they stay embodied while following the player (see resolve above).
+        else if (!(PartySubsystem && PartySubsystem->IsCompanionEntity(Entry.Entity)) && !IsDespawnGated(Entry)) {
+            Disembody(Entry);
+        }
+    }
 
-                --PromotionBudget;
-                if (bChunkIsCreature) { ++CreatureActiveCount; } else { ++CognitiveActorCount; }
+    // ─── Hot-set displacement ───
+    // Each holder pool is sorted weakest-first and consumed from the front, so a displacement is O(1) and every holder is
+    // displaced at most once per tick. A displacement draws DemotionBudget; the promotion it enables draws PromotionBudget.
+    HumanoidHolders.Sort(ByScoreAscending);
+    CreatureHolders.Sort(ByScoreAscending);
+    EmbodiedHolders.Sort(ByScoreAscending);
+    int32 NextHumanoidHolder = 0;
+    int32 NextCreatureHolder = 0;
+    int32 NextEmbodiedHolder = 0;
+
+    // Free one hydration slot in a full pool by dehydrating its weakest bodyless holder.
+    auto TryDisplaceHydrated = [&](float CandidateScore, bool bCreature) -> bool {
+        TArray<FSignificanceEntry> &Holders = bCreature ? CreatureHolders : HumanoidHolders;
+        int32 &Next = bCreature ? NextCreatureHolder : NextHumanoidHolder;
+        if (DemotionBudget <= 0 || !Holders.IsValidIndex(Next)
+            || !ShouldDisplaceHolder(CandidateScore, Holders[Next].Sig->Score, Hysteresis)) {
+            return false;
+        }
+        Dehydrate(Holders[Next++]);
+        ++Stats.Swaps;
+        return true;
+    };
+
+    // Free one embodied slot by disembodying the weakest embodied humanoid — skipping any the despawn view-gate protects.
+    auto TryDisplaceEmbodied = [&](float CandidateScore) -> bool {
+        while (DemotionBudget > 0 && EmbodiedHolders.IsValidIndex(NextEmbodiedHolder)) {
+            const FSignificanceEntry &Holder = EmbodiedHolders[NextEmbodiedHolder];
+            if (!ShouldDisplaceHolder(CandidateScore, Holder.Sig->Score, Hysteresis)) {
+                return false;
+            }
+            ++NextEmbodiedHolder;
+            if (IsDespawnGated(Holder)) {
+                continue;
+            }
+            Disembody(Holder);
+            ++Stats.Swaps;
+            return true;
+        }
+        return false;
+    };
+
+    // Embodied-cap gate shared by both Tier2-promotion sites: creatures are bounded by CreatureActiveCount instead.
+    auto HasEmbodiedSlot = [&](const FSignificanceEntry &Entry) -> bool {
+        return Entry.bCreature || EmbodiedActorCount < MaxEmbodiedActors || TryDisplaceEmbodied(Entry.Sig->Score);
+    };
+
+    // ─── (c) Rank and promote, strongest first ───
+    TArray<int32> Ranked;
+    SelectTopK(CandidateScores, PromotionBudget * CandidateRankSlack, Ranked);
+
+    int32 ResolvedCandidates = 0;
+    for (const int32 CandidateIndex : Ranked) {
+        if (PromotionBudget <= 0) {
+            break;
+        }
 
+        const FSignificanceEntry &Entry = Candidates[CandidateIndex];
+        FMythicSignificanceFragment &Sig = *Entry.Sig;
+        const FMythicIdentityFragment &Identity = *Entry.Identity;
+        const FMassEntityHandle Entity = Entry.Entity;
+        const bool bChunkIsCreature = Entry.bCreature;
+
+        // Check PersistentNPCRegistry — dead NPCs cannot be promoted. This MUST run BEFORE drawing the promotion budget
+        // or a slot: a perma-dead Tier0 NPC would otherwise leak a per-frame promotion (and possibly displace a live
+        // holder) before bailing. (Hydrated perma-dead entities were already cleaned up in (a).)
+        if (NPCRegistry && NPCRegistry->IsPermaDead(Identity.NameHash)) {
+            Sig.Score = 0.0f; // Suppress score
+            ++ResolvedCandidates;
+            continue; // Skip promotion, this NPC is dead forever
+        }
 
-                // SHARED hydration marker — both humanoids AND creatures become Tier1+ entities (the creature gate
-                // below skips only the HUMANOID BDI work, not the hydrated-tag / tier decision / spawn-request).
-                Context.Defer().AddTag<FMythicHydratedTag>(Entity);
+        // ─── Tier 0 → Tier 1 Promotion ───
+        if (Sig.Tier == EMythicSignificanceTier::Tier0_Ambient) {
+            // Enforce the hard cap — creatures against their OWN budget (MaxCreatureActors) so wildlife never starves
+            // the humanoid cognitive cap. A full pool admits the candidate only by displacing a weaker holder.
+            const bool bPoolFull = bChunkIsCreature ? (CreatureActiveCount >= MaxCreatureActors)
+                                                    : (CognitiveActorCount >= MaxCognitiveActors);
+            if (bPoolFull && !TryDisplaceHydrated(Sig.Score, bChunkIsCreature)) {
+                continue;
+            }
 
-                // ─── Humanoid-only BDI hydration (embodiment-service-LOCK-v1 §5a) ───
-                // Creatures (FMythicCreatureTag chunks) do NOT get a psyche, a faction-biased personality, a social
-                // graph, or leader-candidacy — those are human concepts. Skipping the AddFragment calls also keeps the
-                // creature archetype clean (no Psychodynamic/Personality/Social columns), which the gameplay debugger
-                // surfaces. A wolf still hydrates (Tier1) + can embody (Tier2) via the shared paths above/below.
-                if (!bChunkIsCreature) {
-                    Context.Defer().AddFragment<FMythicPsychodynamicFragment>(Entity);
-                    Context.Defer().AddFragment<FMythicPersonalityFragment>(Entity);
-                    Context.Defer().AddFragment<FMythicSocialFragment>(Entity);
-
-                    // ─── Generate personality from faction ideology ───
-                    // Full NPC generation pipeline: NameHash + faction ideology → personality
-                    UMythicFactionDatabase *FactionDB = LWS->GetFactionDatabase();
-                    if (FactionDB && Identity.Faction.IsValid()) {
-                        FMythicFactionData FData;
-                        if (FactionDB->GetFaction(Identity.Faction, FData)) {
-                            // Generate personality biased by faction ideology
-                            FMythicPersonalityFragment GenPersonality = FMythicNPCGenerator::GeneratePersonality(
-                                Identity.NameHash, FData.Ideology, Identity.RoleTag);
-
-                            // Apply via deferred command (fragment data is set after archetype change)
-                            Context.Defer().PushCommand<FMassDeferredChangeCompositionCommand>(
-                                [Entity, GenPersonality](FMassEntityManager &Manager) {
-                                    if (Manager.IsEntityValid(Entity)) {
-                                        FMythicPersonalityFragment *Personality = Manager.GetFragmentDataPtr<FMythicPersonalityFragment>(Entity);
-                                        if (Personality) {
-                                            *Personality = GenPersonality;
-                                        }
+            --PromotionBudget;
+            ++Stats.Promotions;
+            ++ResolvedCandidates;
+            if (bChunkIsCreature) { ++CreatureActiveCount; } else { ++CognitiveActorCount; }
+
+            // SHARED hydration marker — both humanoids AND creatures become Tier1+ entities (the creature gate
+            // below skips only the HUMANOID BDI work, not the hydrated-tag / tier decision / spawn-request).
+            Context.Defer().AddTag<FMythicHydratedTag>(Entity);
+
+            // ─── Humanoid-only BDI hydration (embodiment-service-LOCK-v1 §5a) ───
+            // Creatures (FMythicCreatureTag chunks) do NOT get a psyche, a faction-biased personality, a social
+            // graph, or leader-candidacy — those are human concepts. Skipping the AddFragment calls also keeps the
+            // creature archetype clean (no Psychodynamic/Personality/Social columns), which the gameplay debugger
+            // surfaces. A wolf still hydrates (Tier1) + can embody (Tier2) via the shared paths above/below.
+            if (!bChunkIsCreature) {
+                Context.Defer().AddFragment<FMythicPsychodynamicFragment>(Entity);
+                Context.Defer().AddFragment<FMythicPersonalityFragment>(Entity);
+                Context.Defer().AddFragment<FMythicSocialFragment>(Entity);
+
+                // ─── Generate personality from faction ideology ───
+                // Full NPC generation pipeline: NameHash + faction ideology → personality
+                if (FactionSnapshot && Identity.Faction.IsValid()) {
+                    if (const FMythicFactionMoralProfile *FProfile = FactionSnapshot->GetMoralProfile(Identity.Faction)) {
+                        // Generate personality biased by faction ideology
+                        FMythicPersonalityFragment GenPersonality = FMythicNPCGenerator::GeneratePersonality(
+                            Identity.NameHash, FProfile->Ideology, Identity.RoleTag);
+
+                        // Apply via deferred command (fragment data is set after archetype change)
+                        Context.Defer().PushCommand<FMassDeferredChangeCompositionCommand>(
+                            [Entity, GenPersonality](FMassEntityManager &Manager) {
+                                if (Manager.IsEntityValid(Entity)) {
+                                    FMythicPersonalityFragment *Personality = Manager.GetFragmentDataPtr<FMythicPersonalityFragment>(Entity);
+                                    if (Personality) {
+                                        *Personality = GenPersonality;
                                     }
-                                });
-                        }
-                    }
-
-                    // ─── Leadership succession reporting ───
-                    // Report this entity as a potential leader candidate for its faction.
-                    // ReportLeaderCandidate only accepts if the score exceeds the current leader's.
-                    if (FactionDB && Identity.Faction.IsValid()) {
-                        // Route through the subsystem's SimulationLock-guarded wrapper — a direct FactionDB call here
-                        // (game thread) would race the sim thread's leader writes (succession + AnnihilateFaction).
-                        LWS->ReportLeaderCandidate(
-                            Identity.Faction,
-                            Entity.Index,
-                            Sig.Score);
+                                }
+                            });
                     }
                 }
 
-                // ─── Promotion to Tier 2 (Actor Spawn) ─── (no hysteresis margin on the spawn threshold)
-                // GATED: (1) under the MaxEmbodiedActors ceiling AND (2) embodying would not pop an actor into a
-                // player's close view (unless inside the stream-in grace window). A refused/gated candidate stays
-                // Tier1 (hydrated, bodyless) and is rescored every tick, so it embodies the moment a slot frees / the
-                // player looks away — no permanent deferral. Short-circuit ORDER matters: the && evaluates the cheap
-                // QualifiesForPromotion first, then the O(players) view test, so a far/quiet entity costs ~nothing.
-                if (QualifiesForPromotion(Sig.Score, Settings->Tier2PromotionThreshold, 0.0f)
-                    && (bChunkIsCreature || EmbodiedActorCount < MaxEmbodiedActors)
-                    && !WouldPopInView(Identity)) {
-                    Sig.Tier = EMythicSignificanceTier::Tier2_Cognitive;
-                    if (!bChunkIsCreature) { ++EmbodiedActorCount; } // creatures are bounded by CreatureActiveCount instead
-
-                    // Trigger actual actor spawn here or in PopulationSpawnerProcessor
-                    Context.Defer().AddTag<FMythicActorSpawnRequestTag>(Entity);
-
-                    UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity DIRECT to Tier2_Cognitive (score=%.2f, NameHash=%u, embodied=%d/%d)"),
-                           Sig.Score, Identity.NameHash, EmbodiedActorCount, MaxEmbodiedActors);
-                }
-                else {
-                    Sig.Tier = EMythicSignificanceTier::Tier1_Reactive;
-
-                    UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity to Tier1_Reactive (score=%.2f, cognitive=%d/%d)"),
-                           Sig.Score, CognitiveActorCount, MaxCognitiveActors);
+                // ─── Leadership succession reporting ───
+                // Report this entity as a potential leader candidate for its faction.
+                // ReportLeaderCandidate only accepts if the score exceeds the current leader's.
+                if (FactionDB && Identity.Faction.IsValid()) {
+                    // Route through the subsystem's SimulationLock-guarded wrapper — a direct FactionDB call here
+                    // (game thread) would race the sim thread's leader writes (succession + AnnihilateFaction).
+                    LWS->ReportLeaderCandidate(
+                        Identity.Faction,
+                        Entity.Index,
+                        Sig.Score);
                 }
             }
-            // ─── Tier 1 → Tier 2 Promotion ───
-            // GATED in the CONDITION (embodiment-service-LOCK-v1 §5b/§5d): under the MaxEmbodiedActors ceiling AND not
-            // popping into a player's close view. A gated entity FAILS this `else if` and falls through — but it cannot
-            // hit the Tier1->Tier0 demotion below (its score is >= the Tier2 threshold, so QualifiesForDemotion is
-            // false), so it simply STAYS Tier1 (hydrated, bodyless) and is rescored every tick. It embodies the moment
-            // an embodied slot frees OR the player looks away / moves past ViewGateMinSpawnDistance — no permanent
-            // deferral, no leaked PromotionBudget (the && short-circuits BEFORE --PromotionBudget below). Cheap test
-            // first (Qualifies), then ceiling, then the O(players) view test last (so a quiet/far Tier1 entity costs
-            // ~nothing). The per-i Identity fetch in the condition is a trivial view-index; it's re-fetched in the body.
-            else if (PromotionBudget > 0
-                && Sig.Tier == EMythicSignificanceTier::Tier1_Reactive
-                && QualifiesForPromotion(Sig.Score, Settings->Tier2PromotionThreshold, 0.0f)
-                && (bChunkIsCreature || EmbodiedActorCount < MaxEmbodiedActors)
-                && !WouldPopInView(ChunkContext.GetFragmentView<FMythicIdentityFragment>()[i])) {
-
-                const FMythicIdentityFragment &Identity = ChunkContext.GetFragmentView<FMythicIdentityFragment>()[i];
-
-                // Check PersistentNPCRegistry — dead NPCs cannot be promoted
-                UMythicPersistentNPCRegistry *Registry = LWS->GetPersistentNPCRegistry();
-                if (Registry && Registry->IsPermaDead(Identity.NameHash)) {
-                    Sig.Score = 0.0f; // Suppress score
-                    continue; // Skip promotion, this NPC is dead forever
-                }
 
-                // Draw the per-frame promotion budget — every sibling tier-transition branch does. Without this the
-                // Tier1->Tier2 path bypassed MaxPromotionsPerFrame and burst-spawned every qualifying entity's cognitive
-                // actor in ONE frame (while DemotionBudget kept the outer loop alive), causing a hitch.
-                --PromotionBudget;
+            // ─── Promotion to Tier 2 (Actor Spawn) ─── (no hysteresis margin on the spawn threshold)
+            // GATED: (1) embodying would not pop an actor into a player's close view (unless inside the stream-in grace
+            // window) AND (2) under the MaxEmbodiedActors ceiling, or a weaker embodied holder can be displaced. A
+            // refused/gated candidate stays Tier1 (hydrated, bodyless) and is rescored every tick, so it embodies the
+            // moment a slot frees / the player looks away — no permanent deferral. The view test runs BEFORE the slot
+            // test so a gated candidate never displaces a holder for nothing.
+            if (QualifiesForPromotion(Sig.Score, Tier2Threshold, 0.0f)
+                && !WouldPopInView(Identity)
+                && HasEmbodiedSlot(Entry)) {
                 Sig.Tier = EMythicSignificanceTier::Tier2_Cognitive;
-                if (!bChunkIsCreature) { ++EmbodiedActorCount; } // humanoids count against MaxEmbodiedActors; creatures use CreatureActiveCount
+                if (!bChunkIsCreature) { ++EmbodiedActorCount; } // creatures are bounded by CreatureActiveCount instead
 
-                const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
+                // Trigger actual actor spawn here or in PopulationSpawnerProcessor
                 Context.Defer().AddTag<FMythicActorSpawnRequestTag>(Entity);
 
-                UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity to Tier2_Cognitive (score=%.2f, NameHash=%u, embodied=%d/%d)"),
+                UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity DIRECT to Tier2_Cognitive (score=%.2f, NameHash=%u, embodied=%d/%d)"),
                        Sig.Score, Identity.NameHash, EmbodiedActorCount, MaxEmbodiedActors);
             }
-            // ─── Tier 1 → Tier 0 Demotion ───
-            else if (DemotionBudget > 0
-                && Sig.Tier == EMythicSignificanceTier::Tier1_Reactive
-                && QualifiesForDemotion(Sig.Score, DemotionThreshold, Hysteresis)) {
-                --DemotionBudget;
-                if (bChunkIsCreature) { --CreatureActiveCount; } else { --CognitiveActorCount; }
-
-                // Demote: remove hydration fragments. Creatures carry ONLY the HydratedTag (BDI fragments were skipped
-                // on their promotion), so only strip those for humanoids.
-                const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-                Context.Defer().RemoveTag<FMythicHydratedTag>(Entity);
-                if (!bChunkIsCreature) {
-                    Context.Defer().RemoveFragment<FMythicPsychodynamicFragment>(Entity);
-                    Context.Defer().RemoveFragment<FMythicPersonalityFragment>(Entity);
-                    Context.Defer().RemoveFragment<FMythicSocialFragment>(Entity);
-                }
-
-                Sig.Tier = EMythicSignificanceTier::Tier0_Ambient;
-                Sig.RelevantEventCount = 0;
-
-                UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Demoted entity to Tier0_Ambient (score=%.2f, cognitive=%d/%d)"),
-                       Sig.Score, CognitiveActorCount, MaxCognitiveActors);
-            }
-            // ─── Tier 2 → Tier 1 Demotion (dehydrate: despawn the embodied actor) ───
-            // no-vanish-in-front (embodiment-service-LOCK-v1 §5b): do NOT request a despawn while the embodied
-            // actor is in a player's close view — keep it Tier2 (still embodied) and re-evaluate next tick; it
-            // despawns the instant the player looks away or moves past ViewGateMinSpawnDistance. Grace is NOT applied
-            // to despawn (bDespawnGateActive ignores it) — grace exists only to BULK-EMBODY on arrival, never to keep
-            // a de-significant actor alive longer. The actor's REAL location is the gate target (more accurate than the
-            // entity cell for a moving NPC, and it matches the actor-side guard in ActorSpawnProcessor); if the actor is
-            // already gone (no reverse link) there's nothing visible to protect, so the gate is skipped. This is the
-            // FINAL clause of the if/else chain, so a gated entity falls through and simply stays Tier2 this tick.
-            else if (DemotionBudget > 0
-                && Sig.Tier == EMythicSignificanceTier::Tier2_Cognitive
-                && QualifiesForDemotion(Sig.Score, DemotionThreshold, Hysteresis)
-                // EXEMPT party companions — they stay embodied while following the player (see resolve above).
-                && !(PartySubsystem && PartySubsystem->IsCompanionEntity(ChunkContext.GetEntity(i)))
-                && !IsEmbodiedActorInCloseView(LWS, ChunkContext.GetEntity(i), bDespawnGateActive, PlayerViews, ViewGateMinDist)) {
-                // Drop to Tier1_Reactive (stays hydrated + still counted in CognitiveActorCount, which counts
-                // Tier1+) and request that the MASS->actor bridge despawn its actor. Do NOT decrement
-                // CognitiveActorCount here - the entity remains Tier1+, so only the Tier1->Tier0 step leaves
-                // that set. The freed ACTOR is handled by the bridge's despawn consumer.
-                --DemotionBudget;
-                if (!bChunkIsCreature) { --EmbodiedActorCount; } // only humanoids count against MaxEmbodiedActors (creature stays in CreatureActiveCount)
-                const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-                Context.Defer().AddTag<FMythicActorDespawnRequestTag>(Entity);
+            else {
                 Sig.Tier = EMythicSignificanceTier::Tier1_Reactive;
 
-                UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Demoted entity Tier2->Tier1, despawn requested (score=%.2f, cognitive=%d/%d)"),
+                UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity to Tier1_Reactive (score=%.2f, cognitive=%d/%d)"),
                        Sig.Score, CognitiveActorCount, MaxCognitiveActors);
             }
         }
-    });
+        // ─── Tier 1 → Tier 2 Promotion ───
+        // GATED (embodiment-service-LOCK-v1 §5b/§5d): not popping into a player's close view AND under the
+        // MaxEmbodiedActors ceiling (or displacing a weaker embodied holder). A gated entity simply STAYS Tier1
+        // (hydrated, bodyless) and is rescored every tick — it embodies the moment an embodied slot frees OR the player
+        // looks away / moves past ViewGateMinSpawnDistance. No leaked PromotionBudget: the gates run BEFORE the draw.
+        else {
+            if (WouldPopInView(Identity) || !HasEmbodiedSlot(Entry)) {
+                continue;
+            }
+
+            --PromotionBudget;
+            ++Stats.Promotions;
+            ++ResolvedCandidates;
+            Sig.Tier = EMythicSignificanceTier::Tier2_Cognitive;
+            if (!bChunkIsCreature) { ++EmbodiedActorCount; } // humanoids count against MaxEmbodiedActors; creatures use CreatureActiveCount
+
+            Context.Defer().AddTag<FMythicActorSpawnRequestTag>(Entity);
+
+            UE_LOG(LogMythLivingWorld, Log, TEXT("Significance: Promoted entity to Tier2_Cognitive (score=%.2f, NameHash=%u, embodied=%d/%d)"),
+                   Sig.Score, Identity.NameHash, EmbodiedActorCount, MaxEmbodiedActors);
+        }
+    }
+
+    const double PassMs = (FPlatformTime::Seconds() - PassStartSeconds) * 1000.0;
+    Stats.LastCandidates = Candidates.Num();
+    Stats.LastBacklog = Candidates.Num() - ResolvedCandidates;
+    Stats.LastPassMs = PassMs;
+    Stats.PeakPassMs = FMath::Max(Stats.PeakPassMs, PassMs);
+    ++Stats.Passes;
+    FMemory::Memcpy(Stats.TierPopulation, TierPopulation, sizeof(TierPopulation));
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::Promotions, PromotionCap - PromotionBudget, Stats.LastBacklog, PassMs / 1000.0);
+    }
 }
 
 float UMythicSignificanceProcessor::ComputeProximityScore(const FMythicCellCoord &EntityCell, TConstArrayView<FMythicCellCoord> PlayerCells, float SpawnRadius) {
@@ -660,3 +773,35 @@ bool UMythicSignificanceProcessor::ShouldRescore(bool bDirty, EMythicSignificanc
     // re-evaluated so its proximity stays current and it demotes once players move away (no stale-score slot leak).
     return bDirty || Tier != EMythicSignificanceTier::Tier0_Ambient;
 }
+
+void UMythicSignificanceProcessor::SelectTopK(TConstArrayView<float> Scores, int32 K, TArray<int32> &OutIndices) {
+    OutIndices.Reset();
+    if (K <= 0 || Scores.Num() == 0) {
+        return;
+    }
+
+    // "A is weaker than B": lower score, or an equal score at a higher index. Used as the heap predicate, the heap top is
+    // the weakest index kept so far — each new index either beats it (pop + push) or is discarded, O(log K) per index.
+    const auto Weaker = [Scores](int32 A, int32 B) {
+        return Scores[A] < Scores[B] || (Scores[A] == Scores[B] && A > B);
+    };
+
+    OutIndices.Reserve(FMath::Min(K, Scores.Num()));
+    for (int32 Index = 0; Index < Scores.Num(); ++Index) {
+        if (OutIndices.Num() < K) {
+            OutIndices.HeapPush(Index, Weaker);
+        }
+        else if (Weaker(OutIndices.HeapTop(), Index)) {
+            OutIndices.HeapPopDiscard(Weaker, EAllowShrinking::No);
+            OutIndices.HeapPush(Index, Weaker);
+        }
+    }
+
+    // Strongest first.
+    OutIndices.Sort([&Weaker](int32 A, int32 B) { return Weaker(B, A); });
+}
+
+bool UMythicSignificanceProcessor::ShouldDisplaceHolder(float CandidateScore, float HolderScore, float Hysteresis) {
+    // Strictly more than the margin: at exactly HolderScore + Hysteresis the holder keeps its slot (no tie churn).
+    return CandidateScore > HolderScore + Hysteresis;
+}
@@ -37,12 +37,13 @@ struct FMythicPlayerView {
  *    Budget: MaxRescoresPerFrame per tick.
  *
  * 2. **Promotion/demotion pass** — scored entities checked against tier thresholds:
- *    - Score > PromotionThreshold → promote (add hydration fragments)
- *    - Score < DemotionThreshold → demote (remove hydration fragments)
+ *    - Score < DemotionThreshold → demote (remove hydration fragments), weakest first
+ *    - Score > PromotionThreshold → candidate; the strongest candidates are promoted first (top-K, not chunk order)
+ *    - A candidate facing a full cap displaces the weakest current holder if it outscores it by the hysteresis margin
  *    - Hysteresis prevents oscillation at threshold boundaries.
- *    Budget: MaxPromotionsPerFrame per tick.
+ *    Budget: MaxPromotionsPerFrame per tick (promotions and demotions/swaps each).
  *
- * Cost: O(D + P) where D = dirty entities rescored, P = promotions/demotions.
+ * Cost: O(D + N log K) where D = dirty entities rescored, N = qualifying candidates, K = candidates ranked per tick.
  * Amortized across timer interval — not per-frame.
  */
 UCLASS()
@@ -79,6 +80,19 @@ public:
      *  agree. MinSpawnDistance is in cm (compared squared internally). Empty PlayerViews → false (nothing to gate). */
     static bool IsInCloseView(const FVector &WorldPos, TConstArrayView<FMythicPlayerView> PlayerViews, float MinSpawnDistance);
 
+    /** Top-K selection: fill OutIndices with the indices of the K highest Scores, strongest first (equal scores → lower
+     *  index first, so the pick is deterministic). Bounded min-heap of size K — O(N log K), so ranking every qualifying
+     *  ambient candidate costs little more than the walk that gathered them. K <= 0 or empty Scores → empty. Pure + static. */
+    static void SelectTopK(TConstArrayView<float> Scores, int32 K, TArray<int32> &OutIndices);
+
+    /** Hot-set swap gate: a candidate facing a full cap displaces a current holder only if it outscores it by MORE than
+     *  the hysteresis margin, so two near-equal entities never trade a slot back and forth each tick. Pure + static. */
+    static bool ShouldDisplaceHolder(float CandidateScore, float HolderScore, float Hysteresis);
+
+    /** Candidates ranked per tick, as a multiple of MaxPromotionsPerFrame — headroom so a few per-candidate refusals
+     *  (view-gated, perma-dead, a full pool with nothing weaker to swap out) don't strand the tick's promotion budget. */
+    static constexpr int32 CandidateRankSlack = 4;
+
 protected:
     virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
@@ -9,11 +9,14 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Territory/MythicBiome.h"      // EMythicBiome (frontier-density modifier)
 #include "World/LivingWorld/Settlements/MythicSettlement.h"
+#include "World/LivingWorld/Settlements/SettlementRegistry.h" // FMythicSettlementSnapshot (pinned ownership test)
 #include "World/LivingWorld/NPCGeneration/NPCGenerator.h"
 #include "World/LivingWorld/MythicTags_LivingWorld.h"     // TAG_NPC_ROLE_SOLDIER / TAG_NPC_ROLE_TRAVELER fallbacks
 #include "World/LivingWorld/Persistence/PersistentNPCRegistry.h"
@@ -35,18 +38,11 @@ UMythicTerritoryPatrolSpawnerProcessor::UMythicTerritoryPatrolSpawnerProcessor()
     // Run AFTER the ambient population spawner so settlement cells are populated first and, where spawn radii overlap,
     // the per-cell density count we read already reflects this tick's ambient spawns.
     ExecutionOrder.ExecuteAfter.Add(TEXT("UMythicPopulationSpawnerProcessor"));
-
-    ExistingNPCQuery.RegisterWithProcessor(*this);
 }
 
 void UMythicTerritoryPatrolSpawnerProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) {
-    // SAME SHAPE as UMythicPopulationSpawnerProcessor::ExistingNPCQuery so the per-cell density count is consistent with
-    // the ambient population (shared MaxEntitiesPerCell cap). Soldiers/travelers we spawn carry FMythicNPCTag, so they
-    // are counted here on subsequent ticks; encounter-owned entities are excluded (the EncounterDirector owns those).
-    ExistingNPCQuery.AddRequirement<FMythicIdentityFragment>(EMassFragmentAccess::ReadOnly);
-    ExistingNPCQuery.AddRequirement<FMythicSignificanceFragment>(EMassFragmentAccess::ReadOnly);
-    ExistingNPCQuery.AddTagRequirement<FMythicNPCTag>(EMassFragmentPresence::All);
-    ExistingNPCQuery.AddTagRequirement<FMythicEncounterEntityTag>(EMassFragmentPresence::None);
+    // No entity query: per-cell density is read from the shared cell index (UMythicCellEntityIndexSubsystem), and every
+    // spawn goes through a deferred create command.
 }
 
 void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) {
@@ -102,21 +98,34 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
         return;
     }
 
-    // ─── Step 2: Count existing ambient NPCs per cell (shared per-cell cap) ───
-    TMap<FMythicCellCoord, int32> CellEntityCounts;
-    ExistingNPCQuery.ForEachEntityChunk(Context, [&CellEntityCounts](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        for (int32 i = 0; i < NumEntities; ++i) {
-            CellEntityCounts.FindOrAdd(IdentityView[i].Cell)++;
-        }
-    });
+    // ─── Step 2: Existing NPCs per cell (shared per-cell cap) ───
+    // Read per candidate cell from the shared cell index: every NPC except encounter-owned entities (the EncounterDirector
+    // owns those). Soldiers/travelers we spawn carry FMythicNPCTag, so they count toward the shared MaxEntitiesPerCell
+    // cap once their deferred creates flush.
+    const UMythicCellEntityIndexSubsystem *CellIndexSubsystem = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (!CellIndexSubsystem) {
+        return;
+    }
+    const FMythicCellSpatialIndex &CellIndex = CellIndexSubsystem->GetIndex();
+
+    // Published settlement + faction snapshots, acquired ONCE per Execute — each pinned under the publisher's read
+    // lock, no SimulationLock or FactionDB lock inside the per-cell loop. A null settlement snapshot (none registered
+    // yet) = no settlement cells.
+    const FMythicSettlementSnapshotRef SettlementSnap = LWS->AcquireSettlementSnapshot();
+    const FMythicFactionSnapshotRef FactionSnap = FactionDB->AcquireSnapshot();
+    if (!FactionSnap) {
+        return;
+    }
 
     // ─── Step 3: Determine faction-controlled cells needing soldiers/travelers ───
     const float SpawnRadius = Settings->TerritoryPatrolSpawnRadius;
     const float SpawnRadiusSq = FMath::Square(SpawnRadius);
     const int32 SpawnRadiusCells = FMath::CeilToInt(SpawnRadius);
-    int32 SpawnBudget = Settings->MaxPatrolSpawnsPerTick;
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 SpawnCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::PatrolSpawns, Settings->MaxPatrolSpawnsPerTick)
+                                   : Settings->MaxPatrolSpawnsPerTick;
+    int32 SpawnBudget = SpawnCap;
+    const double SpawnStartSeconds = FPlatformTime::Seconds();
 
     // Soldier and traveler spawn-data are gathered separately because they create DIFFERENT archetypes (kind tag), so we
     // build one deferred-create command per kind after the cell pass.
@@ -145,14 +154,15 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                     continue;
                 }
 
-                // Dedup across overlapping player radii BEFORE the (SimulationLock-guarded) settlement copy below — same
-                // contention-avoidance reason as the population spawner. Holds every cell considered this tick.
+                // Dedup across overlapping player radii BEFORE the per-cell probes below — same reason as the population
+                // spawner. Holds every cell considered this tick.
                 if (ConsideredCells.Contains(CandidateCell)) {
                     continue;
                 }
                 ConsideredCells.Add(CandidateCell);
 
-                // Territory cell is read lock-free from the committed game-thread snapshot (GetCell copies by value).
+                // Territory cell is copied by value from the committed ReadBuffer (GetCell holds the grid's
+                // SnapshotLock for the copy only).
                 const FMythicTerritoryCell TC = Grid->GetCell(CandidateCell);
 
                 // TRUE wilderness (no dominant faction) belongs to the creature spawner; player-owned property is its
@@ -161,20 +171,20 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                     continue;
                 }
 
-                // Settlement cells are owned by the ambient population spawner — never double-populate them. Snapshot
-                // under SimulationLock (copy-out); the bare presence of a settlement (regardless of governing faction)
+                // Settlement cells are owned by the ambient population spawner — never double-populate them. Read from
+                // the published settlement snapshot; the bare presence of a settlement (regardless of governing faction)
                 // hands the cell to that system.
-                FMythicSettlementData SettlementScratch;
-                if (LWS->CopySettlementAtCell(CandidateCell, SettlementScratch)) {
+                if (SettlementSnap && SettlementSnap->FindAtCell(CandidateCell)) {
                     continue;
                 }
 
                 // Dead / non-Active factions field no soldiers (a conquered or annihilated faction's banner is gone even
                 // if its influence hasn't fully bled away yet).
-                FMythicFactionData FactionData;
-                if (!FactionDB->GetFaction(TC.DominantFaction, FactionData)) {
+                const FMythicFactionData *FactionEntry = FactionSnap->GetFaction(TC.DominantFaction);
+                if (!FactionEntry) {
                     continue;
                 }
+                const FMythicFactionData &FactionData = *FactionEntry;
                 if (!FactionData.bAlive || FactionData.Status != EMythicFactionStatus::Active) {
                     continue;
                 }
@@ -198,11 +208,10 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                 // ─── Contested-border (border-war) garrison boost ───
                 // A cell that touches a cell held by a faction this one is AT WAR with (EMythicFactionRelation::Hostile) is
                 // a frontline — it gets a deterministic soldier-count boost so wars VISIBLY thicken the garrison along the
-                // front. 4-neighbor probe (matches the influence-propagation adjacency): GetCell is a lock-free value-copy
-                // (OOB => default cell with an invalid DominantFaction), GetRelationship takes the FactionDB SnapshotLock —
-                // the SAME lock kind already taken by GetFaction above, so no new lock is introduced. No RNG: identical
-                // snapshot => identical result. Cost is bounded (<=4 GetCell + <=4 GetRelationship) and only paid once per
-                // deduped considered cell.
+                // front. 4-neighbor probe (matches the influence-propagation adjacency): GetCell is a value-copy under
+                // the grid's SnapshotLock (OOB => default cell with an invalid DominantFaction), GetRelationship reads
+                // the same pinned faction snapshot as GetFaction above. No RNG: identical snapshot => identical result.
+                // Cost is bounded (<=4 GetCell + <=4 GetRelationship) and only paid once per deduped considered cell.
                 bool bContestedBorder = false;
                 {
                     static const FMythicCellCoord NeighborOffsets[4] = {
@@ -221,7 +230,7 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
 
                         // Hostile == at war (FactionDatabase: Allied for self, Neutral for invalid/OOB, Hostile is the
                         // top-of-scale at-war stance). A single hostile neighbor makes this a frontline cell.
-                        if (FactionDB->GetRelationship(TC.DominantFaction, NeighborTC.DominantFaction) ==
+                        if (FactionSnap->GetRelationship(TC.DominantFaction, NeighborTC.DominantFaction) ==
                             EMythicFactionRelation::Hostile) {
                             bContestedBorder = true;
                             break;
@@ -233,7 +242,7 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                     SoldierTarget, bContestedBorder, Settings->ContestedBorderSoldierMultiplier,
                     Settings->MaxSoldiersPerControlledCell, Settings->MaxEntitiesPerCell);
 
-                const int32 CurrentCount = CellEntityCounts.FindRef(CandidateCell);
+                const int32 CurrentCount = CellIndex.GetCellCount(CandidateCell, EMythicCellEntityCategory::NPC, EMythicCellEntityCategory::Encounter);
                 const int32 SoldierDeficit = SoldierTarget - CurrentCount;
                 const int32 SoldiersToSpawn = (SoldierDeficit > 0) ? FMath::Min(SoldierDeficit, SpawnBudget) : 0;
 
@@ -313,6 +322,11 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
         }
     }
 
+    if (Budgets) {
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::PatrolSpawns, SpawnCap - SpawnBudget, SpawnBudget <= 0 ? SpawnCap : 0,
+                            FPlatformTime::Seconds() - SpawnStartSeconds);
+    }
+
     // ─── Step 4: Deferred batch-create (one command per kind/archetype) ───
     if (SoldierSpawnData.Num() > 0) {
         // Copy-capture (matches UMythicPopulationSpawnerProcessor's proven deferred-create idiom). The array is bounded
@@ -332,7 +346,8 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                 FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
                 TArray<FMassEntityHandle> Spawned;
-                Manager.BatchCreateEntities(Archetype, SoldierSpawnData.Num(), Spawned);
+                // Held until the fragments below are written — the cell-index observers fire on its release.
+                const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, SoldierSpawnData.Num(), Spawned);
                 for (int32 i = 0; i < SoldierSpawnData.Num(); ++i) {
                     const FMythicTerritorySpawnData &D = SoldierSpawnData[i];
                     const FMassEntityHandle E = Spawned[i];
@@ -358,7 +373,8 @@ void UMythicTerritoryPatrolSpawnerProcessor::Execute(FMassEntityManager &EntityM
                 FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
                 TArray<FMassEntityHandle> Spawned;
-                Manager.BatchCreateEntities(Archetype, TravelerSpawnData.Num(), Spawned);
+                // Held until the fragments below are written — the cell-index observers fire on its release.
+                const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, TravelerSpawnData.Num(), Spawned);
                 for (int32 i = 0; i < TravelerSpawnData.Num(); ++i) {
                     const FMythicTerritorySpawnData &D = TravelerSpawnData[i];
                     const FMassEntityHandle E = Spawned[i];
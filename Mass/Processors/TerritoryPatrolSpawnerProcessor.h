@@ -93,14 +93,6 @@ protected:
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
 
 private:
-    /**
-     * Existing-ambient-NPC count query. SAME SHAPE as UMythicPopulationSpawnerProcessor::ExistingNPCQuery
-     * (Identity + Significance + FMythicNPCTag All + FMythicEncounterEntityTag None) so the per-cell density count this
-     * processor honors is consistent with the ambient population's — soldiers/travelers it spawns also carry NPCTag,
-     * so they self-count toward the shared MaxEntitiesPerCell cap on subsequent ticks. Read-only.
-     */
-    FMassEntityQuery ExistingNPCQuery;
-
     /** Timer accumulator — processor runs at TerritoryPatrolSpawnIntervalSeconds, not every frame. */
     float TimeSinceLastTick = 0.0f;
 };
@@ -9,6 +9,7 @@
 #include "Mass/Tags/MythicMassTags.h"
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "AI/NPCs/MythicNPCCharacter.h" // despawn tears down any embodied traveler actor before freeing its entity
@@ -72,6 +73,7 @@ void UMythicTravelerRouteProcessor::Execute(FMassEntityManager &EntityManager, F
     if (!Grid) {
         return;
     }
+    UMythicCellEntityIndexSubsystem *CellIndex = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
 
     // Throttle: advance ONE cell per (cell size / travel speed) — a believable walking pace that scales with cell size
     // and roughly matches the embodied AIController's movement, so a traveler crossing into a player's embodiment band
@@ -134,6 +136,9 @@ void UMythicTravelerRouteProcessor::Execute(FMassEntityManager &EntityManager, F
             const bool bEmbodied = (LWS->FindEmbodiedActor(Entity) != nullptr);
             if (!bEmbodied) {
                 Identity.Cell = NextCell;
+                if (CellIndex) {
+                    CellIndex->MoveEntity(Entity, NextCell);
+                }
                 // Dirty the significance score so the proximity rescore re-evaluates this entity's new cell (mirrors
                 // the AIController::RefreshLiveCell dirty — cheap, only on a cell change, which is every step here).
                 // Via the chunk view (structurally safe mid-iteration), not a manager fragment lookup.
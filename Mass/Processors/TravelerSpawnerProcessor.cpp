@@ -319,7 +319,8 @@ void UMythicTravelerSpawnerProcessor::Execute(FMassEntityManager &EntityManager,
             FMassArchetypeHandle Archetype = Manager.CreateArchetype(MakeArrayView(Composition));
 
             TArray<FMassEntityHandle> SpawnedEntities;
-            Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
+            // Held until the fragments below are written — the cell-index observers fire on its release.
+            const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = Manager.BatchCreateEntities(Archetype, SpawnDataArray.Num(), SpawnedEntities);
 
             for (int32 i = 0; i < SpawnDataArray.Num(); ++i) {
                 const FMythicTravelerSpawnData &Data = SpawnDataArray[i];
@@ -13,6 +13,8 @@
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Morality/MoralSignature.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
 #include "World/EnvironmentController/MythicEnvironmentSubsystem.h" // GetDayTime for REQ-BEH-007 night perception
 #include "World/EnvironmentController/MythicEnvironmentController.h" // GetCurrentWeather → UWeatherType::bImpairsPerception
 #include "Engine/World.h"
@@ -79,6 +81,13 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
         return;
     }
 
+    // One acquire for the whole Execute, pinned under the publisher's read lock: every per-witness moral lookup below
+    // indexes this immutable snapshot directly instead of copying a profile out of the database per candidate.
+    const FMythicFactionSnapshotRef FactionSnapshot = FactionDB->AcquireSnapshot();
+    if (!FactionSnapshot) {
+        return;
+    }
+
     // REQ-BEH-007: NPC perception (hearing range) degrades at NIGHT and in designer-flagged bad WEATHER. Drive the
     // ActionEventSubsystem's perception multiplier from the real time-of-day + active weather (the env subsystem owns
     // the clock; the controller owns the weather). Night and weather STACK multiplicatively, so a storm at night is the
@@ -108,22 +117,21 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
     const float PerceptionMul = ActionSub->GetPerceptionMultiplier();
     const int32 BaseHearingRadius = Settings->WitnessHearingRadius;
     const int32 EffectiveHearingRadius = FMath::Max(1, FMath::RoundToInt32(BaseHearingRadius * PerceptionMul));
-    int32 WitnessBudget = Settings->MaxWitnessEvalsPerFrame;
+    UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>();
+    const int32 WitnessCap = Budgets ? Budgets->GetBudget(EMythicLivingWorldBudgetLane::WitnessEvals, Settings->MaxWitnessEvalsPerFrame)
+                                     : Settings->MaxWitnessEvalsPerFrame;
+    int32 WitnessBudget = WitnessCap;
     TArray<FMythicWitnessResult> &WitnessResults = ActionSub->GetPendingWitnessResults();
     FMythicCrimeReportQueue &CrimeQueue = ActionSub->GetCrimeReportQueue();
 
-    // Build the broad-phase cell→entity index ONCE this tick (single O(N) pass over the SAME entity set
-    // AllEntitiesQuery scanned before), so the per-event witness lookup below queries only the hearing-radius
-    // neighborhood instead of re-scanning ALL entities for every event — the O(events × N) → O(N + events × box) fix.
-    // Reset retains allocations (no per-tick churn). Indexing the same set means witnesses are unchanged vs the old scan.
-    SpatialIndex.Reset();
-    AllEntitiesQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext &ChunkContext) {
-        const int32 NumEntities = ChunkContext.GetNumEntities();
-        const auto IdentityView = ChunkContext.GetFragmentView<FMythicIdentityFragment>();
-        for (int32 i = 0; i < NumEntities; ++i) {
-            SpatialIndex.Insert(IdentityView[i].Cell, ChunkContext.GetEntity(i));
-        }
-    });
+    // Broad-phase cell→entity index shared by every living-world processor and maintained incrementally (create/destroy
+    // observers + the Identity.Cell movers), so the per-event witness lookup below queries only the hearing-radius
+    // neighborhood — no per-tick O(N) rebuild, no full-entity scan per event.
+    const UMythicCellEntityIndexSubsystem *CellIndex = World->GetSubsystem<UMythicCellEntityIndexSubsystem>();
+    if (!CellIndex) {
+        return;
+    }
+    const FMythicCellSpatialIndex &SpatialIndex = CellIndex->GetIndex();
 
     // Process each pending event ATOMICALLY: once an event is STARTED it is scanned to completion this frame, so its
     // witness results + crime records are emitted exactly once. The budget caps how many EVENTS begin per frame, NOT
@@ -138,6 +146,7 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
     // MaxWitnessEvalsPerFrame a SOFT per-event-granular cap — a single high-witness event may overshoot it in one frame
     // (bounded by witnesses near ONE event, not all entities). A hard within-event cap needs a stable resume cursor,
     // which the cell-ordered spatial index (see BACKLOG: O(E×N) witness scan) provides — tracked as the follow-on.
+    const double ScanStartSeconds = FPlatformTime::Seconds();
     for (FMythicPendingActionEvent &PendingEvent : PendingEvents) {
         if (PendingEvent.bFullyProcessed) {
             continue; // already emitted on an earlier frame; awaiting FlushProcessedEvents
@@ -163,6 +172,17 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
         // EntityManager (entities don't despawn mid-Execute; the null guard is defensive).
         WitnessCandidates.Reset();
         SpatialIndex.QueryRange(EventCell, EffectiveHearingRadius, WitnessCandidates);
+        if (WitnessCandidates.Num() == 0) {
+            PendingEvent.bFullyProcessed = true;
+            continue; // nobody within earshot — skip the severity table entirely
+        }
+
+        // Severity depends only on (event, witness faction), so evaluate it ONCE per faction for this event and classify
+        // every witness by its faction index. A massacre in a crowded plaza costs F dot products + W table reads instead
+        // of W dot products (the per-witness category injection + evaluation it replaces).
+        FMythicMoralAction EvaluatedVector = Event.MoralVector;
+        ApplyCategoryAxes(Event.ActionCategory, EvaluatedVector);
+        BuildSeverityTable(EvaluatedVector, *FactionSnapshot, SeverityTable);
 
         for (const FMassEntityHandle WitnessEntity : WitnessCandidates) {
                 const FMythicIdentityFragment *IdPtr = EntityManager.GetFragmentDataPtr<FMythicIdentityFragment>(WitnessEntity);
@@ -189,53 +209,17 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
                 }
 
                 // Reject entities that can contribute no witness/crime output BEFORE spending budget — a
-                // faction-less entity (e.g. an unaffiliated creature) or one whose faction isn't in the DB produces
-                // nothing downstream, so charging it budget only starves real witnesses (e.g. a crowd near a kill).
-                if (!Identity.Faction.IsValid()) {
-                    continue;
-                }
-                FMythicFactionMoralProfile FactionProfile;
-                if (!FactionDB->GetFactionMoralProfile(Identity.Faction, FactionProfile)) {
+                // faction-less entity (e.g. an unaffiliated creature) or one whose faction isn't committed in the
+                // snapshot (outside the table) produces nothing downstream, so charging it budget only starves real
+                // witnesses (e.g. a crowd near a kill).
+                if (!Identity.Faction.IsValid() || !SeverityTable.IsValidIndex(Identity.Faction.Index)) {
                     continue;
                 }
 
                 --WitnessBudget;
                 ++PendingEvent.WitnessesProcessed;
 
-                // Moral evaluation — dot product of action vs witness's faction ideology
-                FMythicMoralAction EvaluatedVector = Event.MoralVector;
-
-                // Category-specific moral axis mapping (REQ-BEH-010)
-                // Inject additional moral dimensions based on the action type
-                switch (Event.ActionCategory) {
-                case EMythicActionCategory::Magic_Damage:
-                    // Destructive magic is viewed through both Violence and Arcane lenses
-                    EvaluatedVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.5f;
-                    break;
-                case EMythicActionCategory::Magic_Healing:
-                    // Healing magic is Mercy + Arcane
-                    EvaluatedVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.3f;
-                    EvaluatedVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Mercy)] += 0.5f;
-                    break;
-                case EMythicActionCategory::Magic_Forbidden:
-                    // Forbidden magic DESECRATES — negative Sanctity (the absence of sanctity, exactly as a kill is
-                    // negative Mercy) — and transgresses anti-magic ideology (positive Arcane). Severity = -dot, so a
-                    // sanctity-protecting faction (Ideology.Sanctity = +1) only condemns a NEGATIVE-Sanctity action.
-                    // The prior += 1.0f inverted the sign, so protector factions never condemned necromancy.
-                    EvaluatedVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Sanctity)] -= 1.0f;
-                    EvaluatedVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.8f;
-                    break;
-                default:
-                    break;
-                }
-
-                const EMythicMoralSeverity Severity = FMythicMoralSignature::EvaluateActionSeverity(
-                    EvaluatedVector,
-                    FactionProfile.Ideology,
-                    FactionProfile.DisapproveThreshold,
-                    FactionProfile.CondemnThreshold,
-                    FactionProfile.HostileThreshold
-                    );
+                const EMythicMoralSeverity Severity = SeverityTable[Identity.Faction.Index];
 
                 if (Severity == EMythicMoralSeverity::Ignore) {
                     continue; // No reaction needed
@@ -287,6 +271,59 @@ void UMythicWitnessPerceptionProcessor::Execute(FMassEntityManager &EntityManage
         PendingEvent.bFullyProcessed = true;
     }
 
+    // Report to the budget governor. Unstarted events can't be costed in witnesses until they're scanned, so while any
+    // wait the lane asks for as much again as it just spent.
+    if (Budgets) {
+        int32 EventsWaiting = 0;
+        for (const FMythicPendingActionEvent &PendingEvent : PendingEvents) {
+            EventsWaiting += PendingEvent.bFullyProcessed ? 0 : 1;
+        }
+        const int32 Evaluated = WitnessCap - WitnessBudget;
+        Budgets->ReportWork(EMythicLivingWorldBudgetLane::WitnessEvals, Evaluated, EventsWaiting > 0 ? FMath::Max(Evaluated, 1) : 0,
+                            FPlatformTime::Seconds() - ScanStartSeconds);
+    }
+
     // Flush fully processed events
     ActionSub->FlushProcessedEvents();
 }
+
+void UMythicWitnessPerceptionProcessor::ApplyCategoryAxes(EMythicActionCategory Category, FMythicMoralAction &InOutVector) {
+    switch (Category) {
+    case EMythicActionCategory::Magic_Damage:
+        // Destructive magic is viewed through both Violence and Arcane lenses
+        InOutVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.5f;
+        break;
+    case EMythicActionCategory::Magic_Healing:
+        // Healing magic is Mercy + Arcane
+        InOutVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.3f;
+        InOutVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Mercy)] += 0.5f;
+        break;
+    case EMythicActionCategory::Magic_Forbidden:
+        // Forbidden magic DESECRATES — negative Sanctity (the absence of sanctity, exactly as a kill is negative Mercy)
+        // — and transgresses anti-magic ideology (positive Arcane). Severity = -dot, so a sanctity-protecting faction
+        // (Ideology.Sanctity = +1) only condemns a NEGATIVE-Sanctity action. The prior += 1.0f inverted the sign, so
+        // protector factions never condemned necromancy.
+        InOutVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Sanctity)] -= 1.0f;
+        InOutVector.AxisValues[static_cast<int32>(EMythicMoralAxis::Arcane)] += 0.8f;
+        break;
+    default:
+        break;
+    }
+}
+
+void UMythicWitnessPerceptionProcessor::BuildSeverityTable(const FMythicMoralAction &Evaluated, const FMythicFactionSnapshot &Snapshot,
+                                                           TArray<EMythicMoralSeverity> &OutTable) {
+    // One contiguous pass over the snapshot's precomputed moral profiles (44 bytes each, dense by faction index).
+    // SetNumUninitialized keeps the scratch allocation across events; every committed slot is written below.
+    const int32 NumFactions = Snapshot.RegisteredCount;
+    OutTable.SetNumUninitialized(NumFactions, EAllowShrinking::No);
+    for (int32 FactionIndex = 0; FactionIndex < NumFactions; ++FactionIndex) {
+        const FMythicFactionMoralProfile &Profile = Snapshot.MoralProfiles[FactionIndex];
+        OutTable[FactionIndex] = FMythicMoralSignature::EvaluateActionSeverity(
+            Evaluated,
+            Profile.Ideology,
+            Profile.DisapproveThreshold,
+            Profile.CondemnThreshold,
+            Profile.HostileThreshold);
+    }
+}
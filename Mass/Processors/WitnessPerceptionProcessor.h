@@ -6,10 +6,12 @@
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
 #include "MassEntityQuery.h"
-#include "World/LivingWorld/MythicCellSpatialIndex.h" // broad-phase cell→entity witness lookup
+#include "World/LivingWorld/LivingWorldTypes.h" // EMythicActionCategory, EMythicMoralSeverity (by value in the statics)
 #include "WitnessPerceptionProcessor.generated.h"
 
 class UMythicActionEventSubsystem;
+class FMythicFactionSnapshot;
+struct FMythicMoralAction;
 
 /**
  * MASS processor that evaluates witnesses to gameplay action events.
@@ -17,14 +19,15 @@ class UMythicActionEventSubsystem;
  * Flow (event-driven — NOT per-tick polling):
  * 1. Checks ActionEventSubsystem for pending events (queued by SubmitAction)
  * 2. For each pending event (budget-capped by MaxWitnessEvalsPerFrame):
- *    a. Cell-based spatial lookup — O(1) entities in event cell + adjacent cells
+ *    a. Cell-based spatial lookup — shared UMythicCellEntityIndexSubsystem, entities in the hearing-radius box
  *    b. Hearing range filter — cell distance ≤ configurable radius
- *    c. Moral evaluation — dot product of action moral vector vs witness faction ideology
+ *    c. Moral evaluation — ONE severity per faction per event (BuildSeverityTable: dot product of the action moral
+ *       vector vs each faction's ideology), so each witness is classified by a table lookup on its faction index
  *    d. Output: FMythicWitnessResult per non-Ignore witness → queued for PressureProcessor
  * 3. Tier 0 entities witnessing Condemn+ events are marked for hydration
  *
  * Budget: MaxWitnessEvalsPerFrame witnesses per frame, overflow defers to next frame.
- * Cost: O(E × W_cell) where E = events, W_cell = entities in event cell neighborhood.
+ * Cost: O(E × (F + W_cell)) where E = events, F = registered factions, W_cell = entities in event cell neighborhood.
  */
 UCLASS()
 class MYTHIC_API UMythicWitnessPerceptionProcessor : public UMassProcessor {
@@ -33,21 +36,32 @@ class MYTHIC_API UMythicWitnessPerceptionProcessor : public UMassProcessor {
 public:
     UMythicWitnessPerceptionProcessor();
 
+    /** Category-specific moral axis mapping (REQ-BEH-010): inject the extra moral dimensions an action category carries
+     *  (destructive magic is also Arcane, forbidden magic desecrates Sanctity, ...) into the event's moral vector before
+     *  it is evaluated. Pure + static. */
+    static void ApplyCategoryAxes(EMythicActionCategory Category, FMythicMoralAction &InOutVector);
+
+    /** Per-event severity table: OutTable[FactionIndex] = EvaluateActionSeverity(Evaluated, that faction's ideology and
+     *  thresholds) for every faction committed in Snapshot ([0, RegisteredCount)). Witnesses of one faction all share
+     *  one result, so the dot product runs once per faction instead of once per witness. Pure + static. */
+    static void BuildSeverityTable(const FMythicMoralAction &Evaluated, const FMythicFactionSnapshot &Snapshot,
+                                   TArray<EMythicMoralSeverity> &OutTable);
+
 protected:
     virtual void ConfigureQueries(const TSharedRef<FMassEntityManager> &EntityManager) override;
     virtual void Execute(FMassEntityManager &EntityManager, FMassExecutionContext &Context) override;
 
 private:
-    /** Query for all entities with identity (potential witnesses) */
+    /** Query for all entities with identity (potential witnesses). Never iterated — candidates come from the shared cell
+     *  index — but it declares the Identity/Significance access this processor performs through the entity manager. */
     FMassEntityQuery AllEntitiesQuery;
 
     /** Cached subsystem pointer — resolved on first Execute */
     TWeakObjectPtr<UMythicActionEventSubsystem> CachedActionSubsystem;
 
-    /** Broad-phase cell→entity index, REBUILT each Execute (single O(N) pass) so per-event witness lookup queries only
-     *  the hearing-radius neighborhood instead of re-scanning ALL entities. Reused member to avoid per-tick allocation. */
-    FMythicCellSpatialIndex SpatialIndex;
-
     /** Scratch buffer for per-event QueryRange results (reused — Reset, not freed — to avoid per-tick allocation). */
     TArray<FMassEntityHandle> WitnessCandidates;
+
+    /** Scratch per-event severity table indexed by faction index (see BuildSeverityTable). Reused across events. */
+    TArray<EMythicMoralSeverity> SeverityTable;
 };
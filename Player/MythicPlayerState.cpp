@@ -160,6 +160,15 @@ TArray<UMythicInventoryComponent *> AMythicPlayerState::GetAllInventoryComponent
     return TArray<UMythicInventoryComponent *>();
 }
 
+uint32 AMythicPlayerState::GetInventorySetSerial() const {
+    if (APlayerController *PC = GetPlayerController()) {
+        if (IInventoryProviderInterface *InvProvider = Cast<IInventoryProviderInterface>(PC)) {
+            return InvProvider->GetInventorySetSerial();
+        }
+    }
+    return 0;
+}
+
 UAbilitySystemComponent *AMythicPlayerState::GetSchematicsASC() const {
     if (APlayerController *PC = GetPlayerController()) {
         if (IInventoryProviderInterface *InvProvider = Cast<IInventoryProviderInterface>(PC)) {
@@ -100,6 +100,7 @@ public:
 
     // IInventoryProviderInterface - delegates to PlayerController
     virtual TArray<UMythicInventoryComponent *> GetAllInventoryComponents() const override;
+    virtual uint32 GetInventorySetSerial() const override;
     virtual UAbilitySystemComponent *GetSchematicsASC() const override;
     virtual UMythicInventoryComponent *GetInventoryForItemType(const FGameplayTag &ItemType) const override;
 };
@@ -19,8 +19,8 @@
 
 // Called on clients before resources are removed on the server - cosmetic only
 // To get here:
-// 1. The server has a timer that checks for batch respawn (ProcessBatchRespawn)
-// 2. Inside ProcessBatchRespawn, if any resources are due to respawn, they are removed from the DestroyedResources array
+// 1. The server queues every destroyed resource in a min-heap keyed by respawn time and checks its top each tick
+// 2. Inside ProcessDueRespawns, the resources that are due are removed from the DestroyedResources array in one batch
 // 3. This triggers PreReplicatedRemove on clients, which calls HandleResourceRespawn
 void FTrackedDestructibleDataArray::PreReplicatedRemove(const TArrayView<int32> &RemovedIndices, int32 FinalSize) {
     UE_LOG(Myth, Log, TEXT("FTrackedDestructibleData::PreReplicatedRemove: Removed %d items"), RemovedIndices.Num());
@@ -79,32 +79,58 @@ void FTrackedDestructibleDataArray::PostReplicatedChange(const TArrayView<int32>
 }
 
 
-void UMythicResourceManagerComponent::ProcessBatchRespawn() {
-    UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ProcessBatchRespawn: Checking for resources to respawn"));
-    if (!GetOwner()->HasAuthority()) {
-        UE_LOG(Myth, Error, TEXT("UMythicResourceManagerComponent::ProcessBatchRespawn called on non-authority"));
-        return;
-    }
+void UMythicResourceManagerComponent::ProcessDueRespawns(double CurrentTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicResources_ProcessDueRespawns);
 
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    auto indicesToRemove = TArray<int32>();
-    auto DestroyedItems = *DestroyedResources.GetItems();
-    for (int32 i = 0; i < DestroyedItems.Num(); i++) {
-        auto &item = DestroyedItems[i];
-        if (ShouldRespawnDestructible(item.HitsTillDestruction, item.RespawnTime, CurrentTime)) {
-            indicesToRemove.Add(i);
+    // Pop due entries soonest-first until the frame budget is spent. Entries whose node is no longer destroyed, or was
+    // destroyed again with a later RespawnTime (a fresh entry is queued then), are stale and simply dropped.
+    TArray<int32, TInlineAllocator<32>> IndicesToRemove;
+    const int32 Budget = FMath::Max(1, MaxRespawnsPerFrame);
+    while (RespawnQueue.Num() > 0 && RespawnQueue.HeapTop().RespawnTime <= CurrentTime && IndicesToRemove.Num() < Budget) {
+        FRespawnQueueEntry Entry;
+        RespawnQueue.HeapPop(Entry, EAllowShrinking::No);
+
+        const int32 Index = DestroyedResources.FindIndex(Entry.Key);
+        if (Index == INDEX_NONE) {
+            continue;
         }
+        const FTrackedDestructibleData &Item = (*DestroyedResources.GetItems())[Index];
+        if (Item.RespawnTime != Entry.RespawnTime ||
+            !ShouldRespawnDestructible(Item.HitsTillDestruction, Item.RespawnTime, CurrentTime)) {
+            continue;
+        }
+        IndicesToRemove.Add(Index);
     }
 
-    UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ProcessBatchRespawn: Found %d resources to respawn"), indicesToRemove.Num());
+    if (IndicesToRemove.Num() > 0) {
+        UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ProcessDueRespawns: Respawning %d resources (%d still queued)"),
+               IndicesToRemove.Num(), RespawnQueue.Num());
+        DestroyedResources.RemoveItems(IndicesToRemove);
+    }
+}
 
-    if (indicesToRemove.Num() <= 0) {
-        return;
+void UMythicResourceManagerComponent::ScheduleRespawn(const FTrackedDestructibleData &DestroyedResource) {
+    FRespawnQueueEntry Entry;
+    Entry.RespawnTime = DestroyedResource.RespawnTime;
+    Entry.Key = FResourceNodeKey(DestroyedResource);
+    RespawnQueue.HeapPush(Entry);
+
+    if (!IsComponentTickEnabled()) {
+        SetComponentTickEnabled(true);
     }
+}
 
-    DestroyedResources.RemoveItems(indicesToRemove);
+void UMythicResourceManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) {
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ProcessBatchRespawn: Removed %d resources from destroyed list"), indicesToRemove.Num());
+    if (RespawnQueue.Num() == 0) {
+        // Nothing pending - sleep until the next node is destroyed (ScheduleRespawn wakes us)
+        SetComponentTickEnabled(false);
+        return;
+    }
+    if (const UWorld *World = GetWorld()) {
+        ProcessDueRespawns(World->GetTimeSeconds());
+    }
 }
 
 void UMythicResourceManagerComponent::OnRep_DestroyedResources() {
@@ -133,6 +159,8 @@ UMythicResourceManagerComponent::UMythicResourceManagerComponent() {
     // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
     // off to improve performance if you don't need them.
     PrimaryComponentTick.bCanEverTick = true;
+    // Only ticks on the server while respawns are queued (see ScheduleRespawn / TickComponent)
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 
     SetIsReplicatedByDefault(true);
 }
@@ -174,14 +202,12 @@ void UMythicResourceManagerComponent::AddOrUpdateResource(FTransform Transform,
     }
 
     // Try to find existing resource
-    FTrackedDestructibleData *ExistingResource = TrackedResources.FindByPredicate([&](const FTrackedDestructibleData &TrackedResource) {
-        return TrackedResource.ResourceISM == ResourceISM && TrackedResource.InstanceId == ResourceISM->InstanceIndexToId(index).Id;
-        // return TrackedResource.ResourceISMCClass == ISMClass && TrackedResource.Transform.GetLocation().Equals(Transform.GetLocation(), 1.0f);
-    });
+    const FResourceNodeKey Key(ResourceISM, ResourceISM ? ResourceISM->InstanceIndexToId(index).Id : INDEX_NONE);
+    const int32 *ExistingIndex = TrackedResourceIndices.Find(Key);
 
     int32 HitsRemaining;
-    if (ExistingResource) {
-        HitsRemaining = ApplyDamageToResource(*ExistingResource, ScaledDamage, PlayerController);
+    if (ExistingIndex) {
+        HitsRemaining = ApplyDamageToResource(TrackedResources[*ExistingIndex], ScaledDamage, PlayerController);
     }
     else {
         HitsRemaining = AddNewResource(Transform, ScaledDamage, PlayerController, ResourceISM, index);
@@ -224,12 +250,11 @@ void UMythicResourceManagerComponent::LoadDestroyedResource(UMythicResourceISM *
     NewDestructible.HitsTillDestruction = 0; // It's destroyed
 
     // Check if already in list?
-    bool bExists = DestroyedResources.GetItems()->ContainsByPredicate([&](const FTrackedDestructibleData &Existing) {
-        return Existing.ResourceISM == ResourceISM && Existing.InstanceId == InstanceId;
-    });
+    const bool bExists = DestroyedResources.FindIndex(FResourceNodeKey(ResourceISM, InstanceId)) != INDEX_NONE;
 
     if (!bExists) {
         DestroyedResources.AddItem(NewDestructible);
+        ScheduleRespawn(NewDestructible);
 
         // Also ensure it is visually destroyed immediately on Server
         ResourceISM->DestroyResource(InstanceId);
@@ -239,8 +264,8 @@ void UMythicResourceManagerComponent::LoadDestroyedResource(UMythicResourceISM *
 int32 UMythicResourceManagerComponent::ApplyDamageToResource(FTrackedDestructibleData &Resource, int32 DamageAmount, APlayerController *PlayerController) {
     int32 PreviousHits = Resource.HitsTillDestruction;
     Resource.HitsTillDestruction = FMath::Max(0, Resource.HitsTillDestruction - DamageAmount);
-    // Capture BEFORE the RemoveAll below — destroying the resource dangles the `Resource` reference (it lives in the
-    // array RemoveAll mutates), so reading HitsTillDestruction afterward would be a use-after-free.
+    // Capture BEFORE the swap-remove below — destroying the resource dangles the `Resource` reference (it lives in the
+    // array the removal mutates), so reading HitsTillDestruction afterward would be a use-after-free.
     const int32 HitsRemaining = Resource.HitsTillDestruction;
 
     UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ApplyDamageToResource: Applied %d damage, HitsTillDestruction: %d -> %d"),
@@ -250,18 +275,15 @@ int32 UMythicResourceManagerComponent::ApplyDamageToResource(FTrackedDestructibl
     if (Resource.HitsTillDestruction <= 0 && PreviousHits > 0) {
         UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::ApplyDamageToResource: Resource destroyed!"));
 
-        // Remove from tracked resources
-        auto NumRemoved = TrackedResources.RemoveAll([&](const FTrackedDestructibleData &TrackedResource) {
-            return TrackedResource == Resource;
-        });
-
-        if (NumRemoved <= 0) {
+        // Copy out, then remove from tracked resources (the removal moves another entry into Resource's slot)
+        const FTrackedDestructibleData DestroyedResource = Resource;
+        if (!RemoveTrackedResource(FResourceNodeKey(DestroyedResource))) {
             UE_LOG(Myth, Error, TEXT("UMythicResourceManagerComponent::ApplyDamageToResource: Could not remove resource from tracked resources"));
             return HitsRemaining;
         }
 
         // Create destroyed resource with respawn time
-        AddToDestroyedResources(Resource, PlayerController);
+        AddToDestroyedResources(DestroyedResource, PlayerController);
     }
     return HitsRemaining;
 }
@@ -296,10 +318,7 @@ int32 UMythicResourceManagerComponent::AddNewResource(FTransform Transform, int3
            MaxHealth, DamageAmount, NewResource.HitsTillDestruction);
 
     // Check if already destroyed
-    auto AlreadyDestroyed = DestroyedResources.GetItems()->FindByPredicate([&NewResource](const FTrackedDestructibleData &DestroyedResource) {
-        return DestroyedResource == NewResource;
-    });
-    if (AlreadyDestroyed) {
+    if (DestroyedResources.FindIndex(FResourceNodeKey(NewResource)) != INDEX_NONE) {
         UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::AddNewResource: Resource already destroyed, ignoring"));
         return -1; // nothing to surface — it was already gone
     }
@@ -309,7 +328,7 @@ int32 UMythicResourceManagerComponent::AddNewResource(FTransform Transform, int3
         AddToDestroyedResources(NewResource, PlayerController);
     }
     else {
-        TrackedResources.Add(NewResource);
+        TrackedResourceIndices.Add(FResourceNodeKey(NewResource), TrackedResources.Add(NewResource));
         UE_LOG(Myth, Log, TEXT("UMythicResourceManagerComponent::AddNewResource: Added to tracked resources"));
     }
     return NewResource.HitsTillDestruction; // 0 → "Depleted!" (one-shot), >0 → "N left" (first swing)
@@ -322,6 +341,7 @@ void UMythicResourceManagerComponent::AddToDestroyedResources(FTrackedDestructib
 
     // Add to destroyed resources
     DestroyedResources.AddItem(DestroyedResource);
+    ScheduleRespawn(DestroyedResource);
 
     UE_LOG(Myth, Log,
            TEXT("UMythicResourceManagerComponent::AddToDestroyedResources: Resource %d added to destroyed resources, will respawn in %.1f seconds"),
@@ -343,6 +363,19 @@ void UMythicResourceManagerComponent::AddToDestroyedResources(FTrackedDestructib
     }
 }
 
+bool UMythicResourceManagerComponent::RemoveTrackedResource(const FResourceNodeKey &Key) {
+    int32 Index = INDEX_NONE;
+    if (!TrackedResourceIndices.RemoveAndCopyValue(Key, Index)) {
+        return false;
+    }
+    const int32 Last = TrackedResources.Num() - 1;
+    if (Index != Last) {
+        TrackedResourceIndices.Add(FResourceNodeKey(TrackedResources[Last]), Index); // the last entry moves into Index
+    }
+    TrackedResources.RemoveAtSwap(Index, EAllowShrinking::No);
+    return true;
+}
+
 // Called when the game starts
 void UMythicResourceManagerComponent::BeginPlay() {
     Super::BeginPlay();
@@ -350,18 +383,7 @@ void UMythicResourceManagerComponent::BeginPlay() {
     // Set owner of DestroyedResources for replication callbacks
     DestroyedResources.OwnerComponent = this;
 
-    // Only server runs the batch respawn system
-    if (GetOwner()->HasAuthority()) {
-        GetWorld()->GetTimerManager().SetTimer(
-            BatchRespawnTimerHandle,
-            this,
-            &UMythicResourceManagerComponent::ProcessBatchRespawn,
-            BatchRespawnInterval,
-            true // Repeat every 10 minutes
-            );
-
-        UE_LOG(Myth, Log, TEXT("Batch respawn system started - checking every %.1f seconds"), BatchRespawnInterval);
-    }
+    // Only the server runs the respawn queue; the component starts ticking once the first node is queued
 }
 
 void UMythicResourceManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const {
@@ -419,10 +441,10 @@ void UMythicResourceManagerComponent::HandleResourceDestruction(const TArray<FTr
 void UMythicResourceManagerComponent::HandleResourceRespawn(const TArray<FTrackedDestructibleData> &RespawnedResources) {
     UE_LOG(Myth, Log, TEXT("HandleResourceRespawn: Syncing respawn of %d resources"), RespawnedResources.Num());
 
-    auto length = RespawnedResources.Num();
-    for (int i = 0; i < length; i++) {
-        auto Resource = RespawnedResources[i];
+    // All ISM Components that need to be dirtied once after processing
+    TSet<UMythicResourceISM *> ISMsToDirty;
 
+    for (const FTrackedDestructibleData &Resource : RespawnedResources) {
         auto ResourceComponent = Resource.ResourceISM;
         if (!ResourceComponent) {
             UE_LOG(Myth, Error, TEXT("HandleResourceRespawn: ResourceISMC is null or not loaded"));
@@ -432,9 +454,16 @@ void UMythicResourceManagerComponent::HandleResourceRespawn(const TArray<FTracke
         UE_LOG(Myth, Log, TEXT("HandleResourceRespawn: Syncing resource on ISM %s, InstanceId %d"), *ResourceComponent->GetName(),
                Resource.InstanceId);
 
-        // Restore / Unhide resource
-        bool ShouldUpdateRender = i == length - 1; // Only update on the last one to save performance
-        ResourceComponent->RestoreResource(Resource.InstanceId, Resource.Transform, ShouldUpdateRender);
+        // Restore / Unhide resource; render state is dirtied once per ISM below (a batch can span several ISMs)
+        ResourceComponent->RestoreResource(Resource.InstanceId, Resource.Transform, false);
+        ISMsToDirty.Add(ResourceComponent);
+    }
+
+    // Dirty render state once per ISM after processing all instances
+    for (UMythicResourceISM *ISM : ISMsToDirty) {
+        if (ISM) {
+            ISM->MarkRenderStateDirty();
+        }
     }
 }
 
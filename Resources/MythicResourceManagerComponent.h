@@ -7,6 +7,7 @@
 #include "MythicGatheringConfig.h"
 #include "Components/ActorComponent.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
 #include "MythicResourceManagerComponent.generated.h"
 
 USTRUCT(BlueprintType, Blueprintable)
@@ -38,6 +39,22 @@ struct FTrackedDestructibleData : public FFastArraySerializerItem {
     }
 };
 
+/** Identity of one harvestable node — (ResourceISM, InstanceId). Hash key for the tracked / destroyed lookups. */
+struct FResourceNodeKey {
+    TObjectKey<UMythicResourceISM> ISM;
+    int32 InstanceId = INDEX_NONE;
+
+    FResourceNodeKey() = default;
+    FResourceNodeKey(const UMythicResourceISM *InISM, int32 InInstanceId) : ISM(InISM), InstanceId(InInstanceId) {}
+    explicit FResourceNodeKey(const FTrackedDestructibleData &Data) : ISM(Data.ResourceISM), InstanceId(Data.InstanceId) {}
+
+    bool operator==(const FResourceNodeKey &Other) const { return ISM == Other.ISM && InstanceId == Other.InstanceId; }
+
+    friend uint32 GetTypeHash(const FResourceNodeKey &Key) {
+        return HashCombine(GetTypeHash(Key.ISM), ::GetTypeHash(Key.InstanceId));
+    }
+};
+
 USTRUCT(BlueprintType)
 struct FTrackedDestructibleDataArray : public FFastArraySerializer {
     GENERATED_BODY()
@@ -68,14 +85,22 @@ public:
         return &this->Items;
     }
 
+    // Index of the item for Key, or INDEX_NONE. Server-side: the lookup is maintained by AddItem / RemoveItems only, so
+    // on clients (items arrive through replication) it is always empty.
+    int32 FindIndex(const FResourceNodeKey &Key) const {
+        const int32 *Index = IndexByKey.Find(Key);
+        return Index ? *Index : INDEX_NONE;
+    }
+
     // Add an item and mark the array dirty and call PreReplicatedAdd manually (because server doesn't call it automatically)
     void AddItem(const FTrackedDestructibleData &NewItem) {
-        Items.Add(NewItem);
+        const int32 Index = Items.Add(NewItem);
+        IndexByKey.Add(FResourceNodeKey(NewItem), Index);
         MarkItemDirty(Items.Last());
 
         // Manually call PostReplicatedAdd on server as it won't be called automatically
         TArray<int32> AddedIndices;
-        AddedIndices.Add(Items.Num() - 1);
+        AddedIndices.Add(Index);
         PostReplicatedAdd(AddedIndices, Items.Num());
     }
 
@@ -83,20 +108,32 @@ public:
     void RemoveItems(const TArrayView<int32> &RemovedIndices) {
         PreReplicatedRemove(RemovedIndices, Items.Num() - RemovedIndices.Num());
 
-        // Remove in DESCENDING index order: RemoveAt(i) shifts every later element down by one, so removing ascending
-        // indices in-order deletes the WRONG elements once 2+ indices are given (the batch-respawn case — multiple nodes
-        // due at the same time). Sorting a local copy descending makes each removal independent. (PreReplicatedRemove
-        // above already received the original index set against the still-intact array.)
-        TArray<int32> SortedIndices(RemovedIndices.GetData(), RemovedIndices.Num());
+        // Remove in DESCENDING index order with swap-removal: the element swapped into Index always comes from past every
+        // index still to be removed, so each removal stays independent and no later element shifts. Order carries no
+        // meaning for a fast array (items replicate by ReplicationID). (PreReplicatedRemove above already received the
+        // original index set against the still-intact array.)
+        TArray<int32, TInlineAllocator<32>> SortedIndices(RemovedIndices.GetData(), RemovedIndices.Num());
         SortedIndices.Sort([](int32 A, int32 B) { return A > B; });
+        int32 Previous = INDEX_NONE;
         for (int32 Index : SortedIndices) {
-            if (Items.IsValidIndex(Index)) {
-                Items.RemoveAt(Index);
+            if (Index == Previous || !Items.IsValidIndex(Index)) {
+                continue;
+            }
+            Previous = Index;
+            IndexByKey.Remove(FResourceNodeKey(Items[Index]));
+            const int32 Last = Items.Num() - 1;
+            if (Index != Last) {
+                IndexByKey.Add(FResourceNodeKey(Items[Last]), Index); // the last item moves into Index
             }
+            Items.RemoveAtSwap(Index, EAllowShrinking::No);
         }
 
         MarkArrayDirty();
     }
+
+private:
+    // (ResourceISM, InstanceId) → index into Items (not replicated; see FindIndex)
+    TMap<FResourceNodeKey, int32> IndexByKey;
 };
 
 template <>
@@ -114,22 +151,33 @@ class MYTHIC_API UMythicResourceManagerComponent : public UActorComponent {
     UPROPERTY()
     TArray<FTrackedDestructibleData> TrackedResources = TArray<FTrackedDestructibleData>();
 
+    // (ResourceISM, InstanceId) → index into TrackedResources (kept in step with every add / swap-remove)
+    TMap<FResourceNodeKey, int32> TrackedResourceIndices;
+
     // Fast Array Serializer - Destroyed Resources
     UPROPERTY(ReplicatedUsing=OnRep_DestroyedResources)
     FTrackedDestructibleDataArray DestroyedResources = FTrackedDestructibleDataArray();
 
     ///////////// RESPAWNING SYSTEM /////////////
-    // Single timer handle for the 10-minute check
-    UPROPERTY()
-    FTimerHandle BatchRespawnTimerHandle;
+    // One pending respawn: the node and the RespawnTime it was queued with (a mismatch with the live entry = stale)
+    struct FRespawnQueueEntry {
+        double RespawnTime = 0.0;
+        FResourceNodeKey Key;
+
+        bool operator<(const FRespawnQueueEntry &Other) const { return RespawnTime < Other.RespawnTime; }
+    };
+
+    // Min-heap of pending respawns keyed by RespawnTime (server only) — the soonest respawn is always the top
+    TArray<FRespawnQueueEntry> RespawnQueue;
 
     // proficiency-based gathering bonuses (damage scaling + double yield chance)
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gathering", meta = (AllowPrivateAccess = "true"))
     FGatheringProficiencyConfig GatheringConfig;
 
     // Settings
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Respawn", meta = (AllowPrivateAccess = "true"))
-    float BatchRespawnInterval = 600.0f; // 10 minutes
+    // Respawns released per frame; any more that are due wait for the next frame (soonest first)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Respawn", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+    int32 MaxRespawnsPerFrame = 32;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Respawn", meta = (AllowPrivateAccess = "true"))
     float PlayerCheckRadius = 5000.0f; // 50 meters
@@ -137,9 +185,11 @@ class MYTHIC_API UMythicResourceManagerComponent : public UActorComponent {
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Respawn", meta = (AllowPrivateAccess = "true"))
     float DefaultRespawnDelay = 300.0f; // 5 minutes
 protected:
-    // The main respawn function - called every 10 minutes
-    UFUNCTION()
-    void ProcessBatchRespawn();
+    // Respawn every due node (up to MaxRespawnsPerFrame) in one batch removal - called from TickComponent
+    void ProcessDueRespawns(double CurrentTime);
+
+    // Queue a destroyed node for respawn at its RespawnTime and make sure the component is ticking to release it
+    void ScheduleRespawn(const FTrackedDestructibleData &DestroyedResource);
     ///////////// END RESPAWNING SYSTEM /////////////
 
     // OnRep_DestroyedResources
@@ -168,6 +218,9 @@ private:
                          Index);
     void AddToDestroyedResources(FTrackedDestructibleData DestroyedResource, APlayerController *PlayerController);
 
+    // Swap-remove the tracked entry for Key (keeps TrackedResourceIndices in step). False if it was not tracked.
+    bool RemoveTrackedResource(const FResourceNodeKey &Key);
+
     // resolve the gatherer's proficiency level for the given resource type tag (0 if no match)
     int32 GetGathererProficiencyLevel(APlayerController *PlayerController, const FGameplayTag &ResourceType) const;
 
@@ -176,12 +229,14 @@ protected:
     virtual void BeginPlay() override;
 
 public:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
     // Lifetime replication
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const override;
 
     TArray<FTrackedDestructibleData> GetTrackedDestructibles() const;
 
-    /** Respawn-eligibility gate (used by ProcessBatchRespawn): a destroyed node returns once its delay has elapsed.
+    /** Respawn-eligibility gate (used by ProcessDueRespawns): a destroyed node returns once its delay has elapsed.
      *  Requires HitsTillDestruction <= 0 (actually destroyed), RespawnTime > 0 (a real respawn time was assigned —
      *  guards a default-constructed/uninitialized entry from respawning at world-time 0), and CurrentTime >= RespawnTime.
      *  Pure + static so the respawn loop's core decision is unit-testable without a live world/timer. */
@@ -189,6 +244,12 @@ public:
 
     const TArray<FTrackedDestructibleData> &GetDestroyedItems() const { return *DestroyedResources.GetItems(); }
 
+    /** Soonest queued respawn time, or 0 when nothing is queued (server only; debug/stats) */
+    double GetNextRespawnTime() const { return RespawnQueue.Num() > 0 ? RespawnQueue.HeapTop().RespawnTime : 0.0; }
+
+    /** Respawns queued, including ones already due but held back by MaxRespawnsPerFrame (server only; debug/stats) */
+    int32 GetQueuedRespawnCount() const { return RespawnQueue.Num(); }
+
     // Used for handling destruction of resources after they are added to the destroyed resources array
     static void HandleResourceDestruction(const TArray<FTrackedDestructibleData> &DestroyedResources);
     static void HandleResourceRespawn(const TArray<FTrackedDestructibleData> &RespawnedResources);
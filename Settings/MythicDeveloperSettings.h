@@ -148,4 +148,16 @@ public:
     /** Threat accrued per point of damage dealt to an NPC (the damage→threat multiplier). */
     UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Combat", meta = (ClampMin = "0.0"))
     float ThreatPerDamage = 1.0f;
+
+    /** Conversion-station work (cycle completions + auto-enqueue checks) the conversion scheduler runs per frame. Work
+     *  over budget waits for the next frame in due order, so a base full of stations finishing together is smeared over
+     *  a few frames rather than spiking one. */
+    UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Conversion", meta = (ClampMin = "1"))
+    int32 ConversionMaxCyclesPerFrame = 64;
+
+    /** A station cycle that finishes with no player pawn within this radius (cm) is parked rather than completed, then
+     *  fast-forwarded through every elapsed cycle in one call when a player returns or opens it. <=0 = always complete
+     *  on time (no parking). */
+    UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Conversion", meta = (ClampMin = "0.0"))
+    float ConversionRelevanceRadius = 10000.0f;
 };
@@ -0,0 +1,255 @@
+// Mythic — Inventory slot index unit tests
+// Drives the per-definition slot index (GetSlotsHoldingItem / GetPartialStackSlots / GetItemCount) and the running
+// weight / currency totals through every slot mutation, checking each step against a brute-force scan of the slots,
+// plus the station's CountIngredientStacks built on that index.
+// Run via: Session Frontend → Automation → Mythic.Itemization.Inventory / Mythic.Itemization.Conversion
+
+#include "Misc/AutomationTest.h"
+#include "Itemization/Inventory/MythicInventoryComponent.h"
+#include "Itemization/Inventory/MythicItemInstance.h"
+#include "Itemization/Inventory/ItemDefinition.h"
+#include "Itemization/Storage/MythicStorageContainer.h"
+#include "Itemization/Conversion/ConversionStationComponent.h"
+#include "Itemization/Conversion/ConversionRecipe.h"
+#include "Itemization/MythicTags_Inventory.h"
+#include "Itemization/MythicTags_Conversion.h"
+
+namespace SlotIndexTestHelpers {
+    // A headless, authority-side inventory: a storage container (registered sub-object list, so item instances can be
+    // owned by it) with Num slots — the first NumInput in the station-input group, the rest in the fuel group.
+    static UMythicInventoryComponent *MakeInventory(int32 Num, int32 NumInput) {
+        AMythicStorageContainer *Owner = NewObject<AMythicStorageContainer>();
+        UMythicInventoryComponent *Inv = Owner->GetContainerInventory();
+        TArray<FMythicInventorySlotEntry> &Slots = Inv->GetAllSlotsMutable();
+        Slots.SetNum(Num);
+        for (int32 i = 0; i < Num; ++i) {
+            Slots[i] = FMythicInventorySlotEntry();
+            Slots[i].GroupTag = i < NumInput ? INVENTORY_GROUP_STATION_INPUT : INVENTORY_GROUP_STATION_FUEL;
+        }
+        return Inv;
+    }
+
+    static UItemDefinition *MakeDef(FGameplayTag Type, int32 StackSizeMax, float Weight) {
+        UItemDefinition *Def = NewObject<UItemDefinition>();
+        Def->ItemType = Type;
+        Def->StackSizeMax = StackSizeMax;
+        Def->Weight = Weight;
+        return Def;
+    }
+
+    static UMythicItemInstance *MakeItem(UMythicInventoryComponent *Inv, UItemDefinition *Def, int32 Qty, int32 Level = 1) {
+        UMythicItemInstance *Item = NewObject<UMythicItemInstance>(Inv->GetOwner());
+        Item->SetOwner(Inv->GetOwner());
+        Item->Initialize(Def, Qty, Level);
+        return Item;
+    }
+
+    // Compare the index (and the O(1) totals) with a fresh walk over every slot.
+    static void CheckAgainstScan(FAutomationTestBase &Test, const TCHAR *Step, UMythicInventoryComponent *Inv,
+                                 const TArray<UItemDefinition *> &Defs) {
+        const TArray<FMythicInventorySlotEntry> &Slots = Inv->GetAllSlots();
+        float Weight = 0.0f;
+        int32 Currency = 0;
+        for (const FMythicInventorySlotEntry &Slot : Slots) {
+            const UMythicItemInstance *Inst = Slot.SlottedItemInstance;
+            const UItemDefinition *Def = Inst ? Inst->GetItemDefinition() : nullptr;
+            if (!Def) {
+                continue;
+            }
+            Weight += UMythicInventoryComponent::ComputeSlotWeight(Def->Weight, Inst->GetStacks());
+            if (Def->ItemType.MatchesTag(ITEMIZATION_TYPE_CURRENCY)) {
+                Currency += Inst->GetStacks();
+            }
+        }
+        Test.TestEqual(FString::Printf(TEXT("%s: carried weight matches a scan"), Step), Inv->GetTotalCarriedWeight(), Weight, 1e-3f);
+        Test.TestEqual(FString::Printf(TEXT("%s: currency total matches a scan"), Step), Inv->GetTotalCurrency(), Currency);
+
+        for (UItemDefinition *Def : Defs) {
+            TArray<int32> Holding;
+            TArray<int32> Partial;
+            int32 Total = 0;
+            for (int32 i = 0; i < Slots.Num(); ++i) {
+                const UMythicItemInstance *Inst = Slots[i].SlottedItemInstance;
+                if (!Inst || Inst->GetItemDefinition() != Def) {
+                    continue;
+                }
+                Holding.Add(i);
+                if (Def->StackSizeMax > 0 && Inst->GetStacks() < Def->StackSizeMax) {
+                    Partial.Add(i);
+                }
+                Total += Inst->GetStacks();
+            }
+            const TArray<int32> IndexHolding(Inv->GetSlotsHoldingItem(Def));
+            const TArray<int32> IndexPartial(Inv->GetPartialStackSlots(Def));
+            Test.TestTrue(FString::Printf(TEXT("%s: %s slots (ascending) match a scan"), Step, *Def->GetName()), IndexHolding == Holding);
+            Test.TestTrue(FString::Printf(TEXT("%s: %s partial slots match a scan"), Step, *Def->GetName()), IndexPartial == Partial);
+            Test.TestEqual(FString::Printf(TEXT("%s: %s count matches a scan"), Step, *Def->GetName()), Inv->GetItemCount(Def), Total);
+        }
+    }
+
+    // CountIngredientStacks' contract, spelled out as a walk over every slot of every inventory.
+    static int32 ScanIngredientStacks(const FConversionIngredient &Ing, const TArray<UMythicInventoryComponent *> &Invs,
+                                      const FGameplayTag &GroupFilter) {
+        int32 Have = 0;
+        for (const UMythicInventoryComponent *Inv : Invs) {
+            if (!Inv) {
+                continue;
+            }
+            for (const FMythicInventorySlotEntry &Slot : Inv->GetAllSlots()) {
+                if (GroupFilter.IsValid() && Slot.GroupTag != GroupFilter) {
+                    continue;
+                }
+                if (Ing.MatchesInstance(Slot.SlottedItemInstance)) {
+                    Have += Slot.SlottedItemInstance->GetStacks();
+                }
+            }
+        }
+        return Have;
+    }
+}
+
+// ─── Slot index vs. brute-force scan through every mutation ──────
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicInventorySlotIndexTest,
+    "Mythic.Itemization.Inventory.SlotIndex",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicInventorySlotIndexTest::RunTest(const FString &Parameters) {
+    using namespace SlotIndexTestHelpers;
+    // Slots 0-5 input group, 6-7 fuel group.
+    UMythicInventoryComponent *Inv = MakeInventory(8, 6);
+    UItemDefinition *Ore = MakeDef(FGameplayTag(), 10, 2.0f);
+    UItemDefinition *Gold = MakeDef(ITEMIZATION_TYPE_CURRENCY, 100, 0.01f);
+    UItemDefinition *Sword = MakeDef(ITEMIZATION_TYPE_EQUIPMENT_WEAPON_SWORD, 1, 5.0f);
+    const TArray<UItemDefinition *> Defs = {Ore, Gold, Sword};
+
+    CheckAgainstScan(*this, TEXT("Empty"), Inv, Defs);
+
+    // Add: fresh stacks land in the first empty slots.
+    Inv->AddToAnySlot(MakeItem(Inv, Ore, 4));
+    Inv->AddToAnySlot(MakeItem(Inv, Gold, 30));
+    Inv->AddToAnySlot(MakeItem(Inv, Sword, 1));
+    CheckAgainstScan(*this, TEXT("Add"), Inv, Defs);
+
+    // Merge: 8 ore tops slot 0 off (4 -> 10, leaves the partial list) and the 2 left over open a new stack.
+    Inv->AddToAnySlot(MakeItem(Inv, Ore, 8));
+    TestEqual(TEXT("Merge: topped-off stack"), Inv->GetAllSlots()[0].SlottedItemInstance->GetStacks(), 10);
+    TestTrue(TEXT("Merge: full stack is no longer partial"), !Inv->GetPartialStackSlots(Ore).Contains(0));
+    CheckAgainstScan(*this, TEXT("Merge"), Inv, Defs);
+
+    // Split (the server path's slot writes: a new stack into an empty slot, then the source shrinks).
+    Inv->SetItemInSlot(4, MakeItem(Inv, Ore, 4));
+    Inv->GetAllSlots()[0].SlottedItemInstance->SetStackSize(6);
+    CheckAgainstScan(*this, TEXT("Split"), Inv, Defs);
+
+    // Remove: release the sword, and empty an ore stack through SetStackSize(0).
+    UMythicItemInstance *Released = Inv->ReleaseFromSlot(2);
+    TestTrue(TEXT("Remove: released the sword"), Released && Released->GetItemDefinition() == Sword);
+    Inv->GetAllSlots()[3].SlottedItemInstance->SetStackSize(0);
+    CheckAgainstScan(*this, TEXT("Remove"), Inv, Defs);
+
+    // Swap: occupied <-> occupied, then occupied -> empty.
+    Inv->ServerSwapSlots_Implementation(0, 1);
+    CheckAgainstScan(*this, TEXT("Swap occupied"), Inv, Defs);
+    Inv->ServerSwapSlots_Implementation(4, 5);
+    CheckAgainstScan(*this, TEXT("Swap into empty"), Inv, Defs);
+
+    // Sort: heaviest first within the input group; the fuel slot is untouched.
+    Inv->SetItemInSlot(2, Released);
+    Inv->SetItemInSlot(6, MakeItem(Inv, Gold, 5));
+    Inv->ServerSortGroup_Implementation(INVENTORY_GROUP_STATION_INPUT, ESortMode::ByWeight);
+    TestEqual(TEXT("Sort: the sword leads the group"), Inv->GetSlotsHoldingItem(Sword)[0], 0);
+    CheckAgainstScan(*this, TEXT("Sort"), Inv, Defs);
+
+    // Structural change with no callback: the slot-count check rebuilds on the next read, and incremental updates
+    // resume on the rebuilt index.
+    Inv->GetAllSlotsMutable().AddDefaulted(2);
+    CheckAgainstScan(*this, TEXT("Grow"), Inv, Defs);
+    Inv->SetItemInSlot(8, MakeItem(Inv, Ore, 7));
+    Inv->SetItemInSlot(9, MakeItem(Inv, Gold, 100));
+    CheckAgainstScan(*this, TEXT("Add after grow"), Inv, Defs);
+    Inv->GetAllSlotsMutable().RemoveAt(8, 2);
+    CheckAgainstScan(*this, TEXT("Shrink"), Inv, Defs);
+    Inv->AddToAnySlot(MakeItem(Inv, Gold, 20));
+    CheckAgainstScan(*this, TEXT("Merge after shrink"), Inv, Defs);
+
+    return true;
+}
+
+// ─── CountIngredientStacks vs. brute-force scan ──────────────────
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FConversionCountIngredientStacksTest,
+    "Mythic.Itemization.Conversion.CountIngredientStacks",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FConversionCountIngredientStacksTest::RunTest(const FString &Parameters) {
+    using namespace SlotIndexTestHelpers;
+    UItemDefinition *Ore = MakeDef(FGameplayTag(), 10, 2.0f);
+    UItemDefinition *Gold = MakeDef(ITEMIZATION_TYPE_CURRENCY, 100, 0.01f);
+
+    // Station inventory: level-1 ore in the input group and in the fuel group, gold in the input group.
+    UMythicInventoryComponent *Station = MakeInventory(6, 4);
+    Station->SetItemInSlot(0, MakeItem(Station, Ore, 10, 1));
+    Station->SetItemInSlot(1, MakeItem(Station, Gold, 40, 1));
+    Station->SetItemInSlot(3, MakeItem(Station, Ore, 3, 1));
+    Station->SetItemInSlot(5, MakeItem(Station, Ore, 6, 1));
+    // Linked chest: level-3 ore and more gold.
+    UMythicInventoryComponent *Chest = MakeInventory(4, 4);
+    Chest->SetItemInSlot(1, MakeItem(Chest, Ore, 5, 3));
+    Chest->SetItemInSlot(2, MakeItem(Chest, Gold, 15, 1));
+    const TArray<UMythicInventoryComponent *> Invs = {Station, nullptr, Chest};
+
+    TArray<UMythicItemInstance *> Insts;
+    for (const UMythicInventoryComponent *Inv : Invs) {
+        if (!Inv) {
+            continue;
+        }
+        for (const FMythicInventorySlotEntry &Slot : Inv->GetAllSlots()) {
+            if (Slot.SlottedItemInstance) {
+                Insts.Add(Slot.SlottedItemInstance);
+            }
+        }
+    }
+
+    FConversionIngredient Exact;
+    Exact.MatchMode = EConversionMatchMode::ExactItem;
+    Exact.ExactItem = Ore;
+    TestEqual(TEXT("ExactItem, all groups"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, FGameplayTag(), Insts),
+              ScanIngredientStacks(Exact, Invs, FGameplayTag()));
+    TestEqual(TEXT("ExactItem, all groups = 24"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, FGameplayTag(), Insts), 24);
+    TestEqual(TEXT("ExactItem, input group only"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, INVENTORY_GROUP_STATION_INPUT, Insts),
+              ScanIngredientStacks(Exact, Invs, INVENTORY_GROUP_STATION_INPUT));
+    TestEqual(TEXT("ExactItem, fuel group only"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, INVENTORY_GROUP_STATION_FUEL, Insts), 6);
+
+    Exact.MinItemLevel = 2;
+    TestEqual(TEXT("ExactItem, MinItemLevel filters per instance"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, FGameplayTag(), Insts),
+              ScanIngredientStacks(Exact, Invs, FGameplayTag()));
+    Exact.MinItemLevel = 0;
+
+    // The index path must follow slot changes made after the first count.
+    Station->GetAllSlots()[0].SlottedItemInstance->SetStackSize(2);
+    Station->ServerSwapSlots_Implementation(3, 5);
+    TestEqual(TEXT("ExactItem, after a shrink and a cross-group swap"),
+              UConversionStationComponent::CountIngredientStacks(Exact, Invs, INVENTORY_GROUP_STATION_INPUT, Insts),
+              ScanIngredientStacks(Exact, Invs, INVENTORY_GROUP_STATION_INPUT));
+
+    FConversionIngredient Unset;
+    TestEqual(TEXT("ExactItem with no definition counts nothing"),
+              UConversionStationComponent::CountIngredientStacks(Unset, Invs, FGameplayTag(), Insts), 0);
+
+    FConversionIngredient Query;
+    Query.MatchMode = EConversionMatchMode::TypeQuery;
+    Query.TypeQuery = FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer(ITEMIZATION_TYPE_CURRENCY));
+    TestEqual(TEXT("TypeQuery counts the gathered instances"),
+              UConversionStationComponent::CountIngredientStacks(Query, Invs, FGameplayTag(), Insts),
+              ScanIngredientStacks(Query, Invs, FGameplayTag()));
+    TestEqual(TEXT("TypeQuery gold = 55"),
+              UConversionStationComponent::CountIngredientStacks(Query, Invs, FGameplayTag(), Insts), 55);
+
+    return true;
+}
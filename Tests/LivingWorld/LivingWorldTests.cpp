@@ -4,6 +4,7 @@
 // Run via: Session Frontend → Automation → Mythic.LivingWorld
 
 #include "Misc/AutomationTest.h"
+#include "Async/Async.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "World/LivingWorld/CausalFabric/CausalFabric.h"
@@ -18,21 +19,30 @@
 #include "World/LivingWorld/Simulation/SchemeEngine.h"
 #include "World/LivingWorld/Simulation/SchemeTypes.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
+#include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
 #include "World/LivingWorld/MythicCellSpatialIndex.h"
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
+#include "World/LivingWorld/MythicLivingWorldStats.h"
+#include "World/LivingWorld/MythicSnapshotPublisher.h"
 #include "World/LivingWorld/Persistence/PersistentNPCRegistry.h"
 #include "AI/Party/PartySubsystem.h"
 #include "AI/NPCs/MythicAIController.h"
 #include "Interaction/MythicInteractionComponent.h"
 #include "AI/Cognition/CognitiveTypes.h"
 #include "AI/Cognition/CognitiveBrainComponent.h"
+#include "AI/Cognition/CognitionScheduler.h"
 #include "Itemization/Inventory/MythicItemInstance.h"
 #include "Objectives/ObjectiveDefinition.h"
 #include "Objectives/ObjectiveTracker.h" // UObjectiveTracker::ComputeObjectiveProgress
 #include "Mass/Processors/PressureProcessor.h"
+#include "World/LivingWorld/Events/ActionEventTypes.h" // FMythicWitnessResult (BuildWitnessRuns)
 #include "Mass/Processors/SignificanceProcessor.h"
+#include "Mass/Processors/WitnessPerceptionProcessor.h"
 #include "Mass/Processors/ScheduleTransitionProcessor.h"
 #include "Mass/Processors/CreatureEcologyProcessor.h"
+#include "World/LivingWorld/Creatures/CreatureSpeciesOccupancy.h"
 #include "Mass/Processors/PopulationSpawnerProcessor.h"
 #include "Mass/Processors/TerritoryPatrolSpawnerProcessor.h" // UMythicTerritoryPatrolSpawnerProcessor::ApplyContestedBorderBoost
 #include "World/LivingWorld/Roles/ArchetypeTypes.h" // UMythicArchetypeCatalog + weighted archetype draw
@@ -45,6 +55,7 @@
 #include "GAS/AttributeSets/Shared/MythicAttributeSet_Offense.h"
 #include "GAS/AttributeSets/Shared/MythicAttributeSet_Utility.h"
 #include "Itemization/Conversion/ConversionStationComponent.h"
+#include "Itemization/Conversion/ConversionSchedulerSubsystem.h"
 #include "Player/Proficiency/ProficiencyDefinition.h"
 #include "Rewards/LootReward.h"
 #include "World/LivingWorld/Dialogue/DialogueSelector.h"
@@ -58,6 +69,7 @@
 #include "Subsystem/SaveSystem/Character/SavedInventory.h"
 #include "Resources/MythicResourceManagerComponent.h"
 #include "GAS/AttributeSets/Shared/MythicLifeComponent.h"
+#include "GAS/AttributeSets/Shared/MythicLifeRegenSubsystem.h"
 #include "Player/MythicCharacter.h"
 #include "Player/MythicPlayerState.h" // ResolveCanonicalPlayerKey
 #include "Player/MythicPlayerRegistrySubsystem.h" // ResolveRegisteredKey
@@ -256,6 +268,272 @@ bool FLivingWorldCausalFabricQueryByCellTest::RunTest(const FString &Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldCausalFabricIncrementalCommitTest,
+    "Mythic.LivingWorld.Phase1.CausalFabric.IncrementalCommit",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldCausalFabricIncrementalCommitTest::RunTest(const FString &Parameters) {
+    constexpr int32 Capacity = 8;
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(Capacity);
+
+    auto Append = [Fabric](int32 CellX, double Time) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = Time;
+        Event.Cell = FMythicCellCoord(CellX, 0);
+        return Fabric->AppendEvent(Event);
+    };
+
+    // Initialize publishes both (empty) views, so even the first commit copies only what was appended; an idle commit
+    // publishes nothing and keeps the epoch.
+    Append(0, 1.0);
+    Append(1, 2.0);
+    Fabric->CommitWrites();
+    TestEqual(TEXT("first commit copies only the appended slots"), Fabric->GetLastCommitSlotCount(), 2);
+    const uint64 EpochAfterFirst = Fabric->GetCommitEpoch();
+    Fabric->CommitWrites();
+    TestTrue(TEXT("idle commit leaves the epoch alone"), Fabric->GetCommitEpoch() == EpochAfterFirst);
+
+    // The two views alternate: each commit catches up the one published before last, so it copies this commit's
+    // events plus the previous commit's.
+    TArray<uint32> Ids;
+    for (int32 i = 0; i < 3; ++i) {
+        Ids.Add(Append(i % 2, 10.0 + i));
+    }
+    Fabric->CommitWrites();
+    TestEqual(TEXT("second view catches up on both commits"), Fabric->GetLastCommitSlotCount(), 5);
+
+    // A delta that straddles the ring wrap: 4 more events → slots 5..7 then 0, evicting event 1 (cell 0). The view
+    // published first is 7 events behind.
+    for (int32 i = 3; i < 7; ++i) {
+        Ids.Add(Append(i % 2, 10.0 + i));
+    }
+    Fabric->CommitWrites();
+    TestEqual(TEXT("delta commit copies only the slots the view is missing"), Fabric->GetLastCommitSlotCount(), 7);
+    TestTrue(TEXT("delta commit advances the epoch"), Fabric->GetCommitEpoch() > EpochAfterFirst);
+    TestNull(TEXT("evicted event is gone"), Fabric->GetEvent(1));
+    for (const uint32 Id : Ids) {
+        TestNotNull(*FString::Printf(TEXT("event %u visible after delta commit"), Id), Fabric->GetEvent(Id));
+    }
+
+    // Cell chains survive the eviction: cell 0 holds the 4 new even-index events (its old event was evicted),
+    // cell 1 holds its original event plus the 3 new odd-index ones — newest first.
+    TArray<FMythicWorldEvent> Results;
+    Fabric->QueryEventsByCell(FMythicCellCoord(0, 0), 0.0, 100.0, 64, Results);
+    TestEqual(TEXT("cell 0 after wrap"), Results.Num(), 4);
+    if (Results.Num() == 4) {
+        TestEqual(TEXT("cell 0 newest-first"), static_cast<int32>(Results[0].EventId), static_cast<int32>(Ids[6]));
+    }
+    Fabric->QueryEventsByCell(FMythicCellCoord(1, 0), 0.0, 100.0, 64, Results);
+    TestEqual(TEXT("cell 1 after wrap"), Results.Num(), 4);
+
+    // More than a full lap between commits: only the newest Capacity events survive, all in cell 5.
+    uint32 LastId = 0;
+    for (int32 i = 0; i < Capacity * 2 + 3; ++i) {
+        LastId = Append(5, 100.0 + i);
+    }
+    Fabric->CommitWrites();
+    TestEqual(TEXT("multi-lap commit recopies the whole ring"), Fabric->GetLastCommitSlotCount(), Capacity);
+    Fabric->QueryEventsByCell(FMythicCellCoord(0, 0), 0.0, 1000.0, 64, Results);
+    TestEqual(TEXT("fully evicted cell has no events"), Results.Num(), 0);
+    Fabric->QueryEventsByCell(FMythicCellCoord(5, 0), 0.0, 1000.0, 64, Results);
+    TestEqual(TEXT("surviving cell has exactly Capacity events"), Results.Num(), Capacity);
+    const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(Capacity);
+    TestEqual(TEXT("recent window is full"), Recent.Num(), Capacity);
+    if (Recent.Num() == Capacity) {
+        TestEqual(TEXT("recent window ends at the newest event"), static_cast<int32>(Recent.Last().EventId), static_cast<int32>(LastId));
+        TestEqual(TEXT("recent window starts Capacity-1 before it"), static_cast<int32>(Recent[0].EventId),
+                  static_cast<int32>(LastId) - Capacity + 1);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldCausalFabricPostingListTest,
+    "Mythic.LivingWorld.Phase1.CausalFabric.PostingLists",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldCausalFabricPostingListTest::RunTest(const FString &Parameters) {
+    // Time index: MaxTimeSoFar stays binary-searchable even when producers append out of WorldTime order.
+    {
+        FMythicFabricPostingList List;
+        const double Times[] = {5.0, 3.0, 8.0, 6.0, 12.0};
+        uint32 NextId = 1;
+        for (const double Time : Times) {
+            List.Push(NextId++, Time);
+        }
+        TestEqual(TEXT("everything admitted below the oldest time"), List.FirstAtOrAfter(0.0), 0);
+        TestEqual(TEXT("entries with running max < 7 are skipped"), List.FirstAtOrAfter(7.0), 2);
+        TestEqual(TEXT("nothing admitted past the newest max"), List.FirstAtOrAfter(20.0), List.Num());
+        List.PopThrough(2);
+        TestEqual(TEXT("eviction pops from the front"), List.Num(), 3);
+        TestEqual(TEXT("oldest live entry after pop"), static_cast<int32>(List[0].EventId), 3);
+    }
+
+    constexpr int32 Capacity = 8;
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(Capacity);
+    const FMythicFactionId FactionA = LivingWorldTestHelpers::MakeFactionId(1);
+    const FMythicFactionId FactionB = LivingWorldTestHelpers::MakeFactionId(2);
+
+    auto Append = [Fabric](const FMythicFactionId &Faction, uint16 Flags, double Time) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = Time;
+        Event.PrimaryFaction = Faction;
+        Event.CategoryFlags = Flags;
+        return Fabric->AppendEvent(Event);
+    };
+
+    // 12 events across two commits: the first 4 are evicted by the second batch, so the posting lists must follow.
+    for (int32 i = 0; i < 6; ++i) {
+        Append(i % 2 == 0 ? FactionA : FactionB, EMythicEventCategory::Combat, 1.0 + i);
+    }
+    Fabric->CommitWrites();
+    for (int32 i = 6; i < 12; ++i) {
+        const uint16 Flags = i % 3 == 0 ? (EMythicEventCategory::Combat | EMythicEventCategory::Crime) : EMythicEventCategory::Crime;
+        Append(i % 2 == 0 ? FactionA : FactionB, Flags, 1.0 + i);
+    }
+    Fabric->CommitWrites();
+
+    // Live ring: ids 5..12 (times 5..12). Faction A owns the even indices → ids 5,7,9,11.
+    TArray<FMythicWorldEvent> Results;
+    Fabric->QueryEventsByFaction(FactionA, Results, 64);
+    TestEqual(TEXT("faction A live events"), Results.Num(), 4);
+    if (Results.Num() == 4) {
+        TestEqual(TEXT("faction query is newest-first"), static_cast<int32>(Results[0].EventId), 11);
+    }
+    Fabric->QueryEventsByFaction(FactionA, Results, 64, 8.0, 10.0);
+    TestEqual(TEXT("faction A within [8,10]"), Results.Num(), 1);
+
+    Fabric->QueryEventsByCategory(EMythicEventCategory::Combat, 0.0, 100.0, 64, Results);
+    TestEqual(TEXT("combat: ids 5,6 survive + combined ids 7,10"), Results.Num(), 4);
+
+    // Combined mask: every live event exactly once (ids 7 and 10 carry both bits), merged newest-first.
+    Fabric->QueryEventsByCategory(EMythicEventCategory::Combat | EMythicEventCategory::Crime, 0.0, 100.0, 64, Results);
+    TestEqual(TEXT("combined mask dedupes multi-category events"), Results.Num(), Capacity);
+    bool bDescending = true;
+    for (int32 i = 1; i < Results.Num(); ++i) {
+        bDescending &= Results[i - 1].EventId > Results[i].EventId;
+    }
+    TestTrue(TEXT("merged result is newest-first"), bDescending);
+
+    Fabric->QueryEventsByCategory(EMythicEventCategory::Combat | EMythicEventCategory::Crime, 10.5, 100.0, 64, Results);
+    TestEqual(TEXT("time window applied to the merge"), Results.Num(), 2);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldCausalFabricVisitorTest,
+    "Mythic.LivingWorld.Phase1.CausalFabric.VisitorQueries",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldCausalFabricVisitorTest::RunTest(const FString &Parameters) {
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(32);
+    const FMythicFactionId FactionA = LivingWorldTestHelpers::MakeFactionId(3);
+
+    for (int32 i = 0; i < 10; ++i) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = 1.0 + i;
+        Event.Cell = FMythicCellCoord(2, 2);
+        Event.PrimaryFaction = FactionA;
+        Event.CategoryFlags = EMythicEventCategory::Combat;
+        Event.Significance = 0.1f * i;
+        Fabric->AppendEvent(Event);
+    }
+    Fabric->CommitWrites();
+
+    // Early exit: the visitor stops after 3 and the walk is newest-first.
+    TArray<uint32> Seen;
+    const int32 Visited = Fabric->VisitRecentEvents(100, [&Seen](const FMythicWorldEvent &Event) {
+        Seen.Add(Event.EventId);
+        return Seen.Num() < 3;
+    });
+    TestEqual(TEXT("visitor stopped early"), Visited, 3);
+    if (Seen.Num() == 3) {
+        TestEqual(TEXT("recent visitor is newest-first"), static_cast<int32>(Seen[0]), 10);
+    }
+
+    // Each visitor agrees with its copy-out wrapper (which is built on it).
+    TArray<FMythicWorldEvent> Copied;
+    float SumSignificance = 0.0f;
+    Fabric->QueryEventsByCell(FMythicCellCoord(2, 2), 3.0, 8.0, 64, Copied);
+    const int32 CellVisited = Fabric->VisitEventsByCell(FMythicCellCoord(2, 2), 3.0, 8.0, [&SumSignificance](const FMythicWorldEvent &Event) {
+        SumSignificance += Event.Significance;
+        return true;
+    });
+    TestEqual(TEXT("cell visitor count matches the copy"), CellVisited, Copied.Num());
+    TestNearlyEqual(TEXT("cell visitor sees events 3..8"), SumSignificance, 0.2f + 0.3f + 0.4f + 0.5f + 0.6f + 0.7f, 0.001f);
+
+    Fabric->QueryEventsByFaction(FactionA, Copied, 4);
+    TestEqual(TEXT("copy wrapper honours MaxResults"), Copied.Num(), 4);
+    TestEqual(TEXT("faction visitor sees all"),
+              Fabric->VisitEventsByFaction(FactionA, 0.0, 100.0, [](const FMythicWorldEvent &) { return true; }), 10);
+    TestEqual(TEXT("category visitor honours the window"),
+              Fabric->VisitEventsByCategory(EMythicEventCategory::Combat, 9.5, 100.0, [](const FMythicWorldEvent &) { return true; }), 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldCausalFabricPinnedViewTest,
+    "Mythic.LivingWorld.Phase1.CausalFabric.PinnedView",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldCausalFabricPinnedViewTest::RunTest(const FString &Parameters) {
+    // A query pins the published view; commits neither wait for it nor change what it sees. Committing from inside a
+    // visitor shows both on one thread (under the old reader/writer lock this self-deadlocked).
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(16);
+
+    auto Append = [Fabric](double Time) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = Time;
+        Event.CategoryFlags = EMythicEventCategory::Trade;
+        return Fabric->AppendEvent(Event);
+    };
+    for (int32 i = 0; i < 4; ++i) {
+        Append(1.0 + i);
+    }
+    Fabric->CommitWrites();
+
+    TArray<uint32> Seen;
+    Fabric->VisitRecentEvents(16, [&](const FMythicWorldEvent &Event) {
+        if (Seen.IsEmpty()) {
+            // The first commit reuses the retired view. The second would have to reuse ours — retired now, still
+            // pinned — so it is deferred instead.
+            Append(10.0);
+            Fabric->CommitWrites();
+            TestNotNull(TEXT("commit inside a visitor publishes"), Fabric->GetEvent(5));
+            Append(11.0);
+            Fabric->CommitWrites();
+            TestEqual(TEXT("commit onto the pinned view is deferred"),
+                      static_cast<int32>(Fabric->GetDeferredCommitCount()), 1);
+            TestNull(TEXT("deferred event not yet published"), Fabric->GetEvent(6));
+        }
+        Seen.Add(Event.EventId);
+        return true;
+    });
+    TestEqual(TEXT("pinned view unchanged by the commits under it"), Seen.Num(), 4);
+    if (Seen.Num() == 4) {
+        TestEqual(TEXT("pinned walk is newest-first from its own head"), static_cast<int32>(Seen[0]), 4);
+    }
+
+    // Released: the next commit catches that view up on both events.
+    Fabric->CommitWrites();
+    TestEqual(TEXT("no further deferral once released"), static_cast<int32>(Fabric->GetDeferredCommitCount()), 1);
+    TestEqual(TEXT("catch-up covers the deferred tick"), Fabric->GetLastCommitSlotCount(), 2);
+    TestNotNull(TEXT("deferred event published"), Fabric->GetEvent(6));
+    const int32 TradeVisited =
+        Fabric->VisitEventsByCategory(EMythicEventCategory::Trade, 0.0, 100.0, [](const FMythicWorldEvent &) { return true; });
+    TestEqual(TEXT("posting lists follow the catch-up"), TradeVisited, 6);
+
+    return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FLivingWorldCausalFabricQueryByCategoryTest,
     "Mythic.LivingWorld.Phase1.CausalFabric.QueryByCategory",
@@ -392,6 +670,59 @@ bool FLivingWorldSpatialIndexQueryTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSpatialIndexIncrementalTest,
+    "Mythic.LivingWorld.SpatialIndex.Incremental",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSpatialIndexIncrementalTest::RunTest(const FString &Parameters) {
+    using ECat = EMythicCellEntityCategory;
+    FMythicCellSpatialIndex Index;
+    const FMythicCellCoord A(2, 2);
+    const FMythicCellCoord B(3, 2);
+
+    const FMassEntityHandle Npc(1, 1);
+    const FMassEntityHandle Traveler(2, 1);
+    const FMassEntityHandle Guard(3, 1);
+    const FMassEntityHandle Wolf(4, 1);
+    Index.Insert(A, Npc, ECat::NPC);
+    Index.Insert(A, Traveler, ECat::NPC | ECat::Traveler);
+    Index.Insert(A, Guard, ECat::NPC | ECat::Encounter);
+    Index.Insert(A, Wolf, ECat::Creature);
+
+    // Category counts — the ambient census (NPC without Traveler/Encounter) vs the shared cap (NPC without Encounter).
+    TestEqual(TEXT("All in A"), Index.GetCellCount(A), 4);
+    TestEqual(TEXT("Ambient census"), Index.GetCellCount(A, ECat::NPC, ECat::Traveler | ECat::Encounter), 1);
+    TestEqual(TEXT("NPC minus encounter"), Index.GetCellCount(A, ECat::NPC, ECat::Encounter), 2);
+    TestEqual(TEXT("Creatures"), Index.GetCellCount(A, ECat::Creature, ECat::None), 1);
+
+    // Move keeps the categories and re-buckets; a same-cell move is a no-op that still succeeds.
+    TestTrue(TEXT("Move indexed"), Index.Move(Traveler, B));
+    TestTrue(TEXT("Same-cell move"), Index.Move(Traveler, B));
+    TestEqual(TEXT("A lost the traveler"), Index.GetCellCount(A), 3);
+    TestEqual(TEXT("B traveler keeps its tags"), Index.GetCellCount(B, ECat::Traveler, ECat::None), 1);
+    const FMythicCellCoord *Found = Index.FindCell(Traveler);
+    TestTrue(TEXT("FindCell after move"), Found && *Found == B);
+
+    // A mover never adds an entity the create observer has not indexed.
+    const FMassEntityHandle Unknown(9, 1);
+    TestFalse(TEXT("Move of unindexed entity"), Index.Move(Unknown, B));
+    TestNull(TEXT("Unindexed entity has no cell"), Index.FindCell(Unknown));
+
+    // Re-inserting moves instead of duplicating.
+    Index.Insert(B, Npc, ECat::NPC);
+    TestEqual(TEXT("Re-insert does not duplicate"), Index.Num(), 4);
+    TestEqual(TEXT("Re-insert left A"), Index.GetCellCount(A, ECat::NPC, ECat::None), 1);
+
+    // Remove drops the entity once; a second remove reports absence.
+    TestTrue(TEXT("Remove indexed"), Index.Remove(Wolf));
+    TestFalse(TEXT("Remove twice"), Index.Remove(Wolf));
+    TestEqual(TEXT("Creature count after remove"), Index.GetCellCount(A, ECat::Creature, ECat::None), 0);
+    TestEqual(TEXT("Num after remove"), Index.Num(), 3);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // PersistentNPCRegistry — perma-death set + save/load round-trip (incl. the v2 monotonic spawn serial, R18-M7)
 // ═══════════════════════════════════════════════════════════════
@@ -692,6 +1023,70 @@ bool FLivingWorldSettlementRegistrySerializeGuardTest::RunTest(const FString &Pa
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Settlement published snapshot — UMythicSettlementRegistry::CommitSnapshot / FMythicSettlementSnapshot
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSettlementSnapshotTest,
+    "Mythic.LivingWorld.Phase3.SettlementRegistry.PublishedSnapshot",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSettlementSnapshotTest::RunTest(const FString &Parameters) {
+    // Publish lifecycle: nothing before the first commit; the first commit publishes (even empty); a clean commit
+    // republishes nothing, so readers and the replication epoch check see the same generation.
+    {
+        auto *Reg = NewObject<UMythicSettlementRegistry>();
+        TestFalse(TEXT("no snapshot before the first commit"), Reg->AcquireSnapshot().IsValid());
+
+        Reg->CommitSnapshot();
+        const FMythicSettlementSnapshotRef First = Reg->AcquireSnapshot();
+        TestTrue(TEXT("first commit publishes"), First.IsValid());
+        if (First.IsValid()) {
+            TestEqual(TEXT("first epoch is 1"), First->Epoch, static_cast<uint64>(1));
+            TestEqual(TEXT("empty registry → no settlements"), First->Settlements.Num(), 0);
+            TestNull(TEXT("empty registry → no settlement cells"), First->FindAtCell(FMythicCellCoord(0, 0)));
+        }
+
+        Reg->CommitSnapshot();
+        Reg->CommitSnapshot();
+        TestTrue(TEXT("clean commits keep the published generation"), Reg->AcquireSnapshot() == First);
+    }
+
+    // Lookups on a hand-built snapshot (registration needs a placed settlement actor).
+    {
+        FMythicSettlementSnapshot Snap;
+        Snap.Settlements.SetNum(3);
+        Snap.Settlements[0].SettlementId = 2;
+        Snap.Settlements[1].SettlementId = 5;
+        Snap.Settlements[2].SettlementId = 9;
+
+        TestTrue(TEXT("FindById hits the middle entry"), Snap.FindById(5) == &Snap.Settlements[1]);
+        TestTrue(TEXT("FindById hits the last entry"), Snap.FindById(9) == &Snap.Settlements[2]);
+        TestNull(TEXT("FindById misses a gap id"), Snap.FindById(4));
+        TestNull(TEXT("FindById misses past the end"), Snap.FindById(10));
+
+        const FMythicCellCoord CellA(3, 4);
+        const FMythicCellCoord CellB(3, 5);
+        Snap.SpawnPoints.SetNum(3);
+        Snap.SpawnPoints[0].Cell = CellA;
+        Snap.SpawnPoints[1].Cell = CellA;
+        Snap.SpawnPoints[2].Cell = CellB;
+        Snap.Cells.Add(CellA, {1, 0, 2});
+        Snap.Cells.Add(CellB, {1, 2, 1});
+
+        TestTrue(TEXT("FindAtCell resolves the owning settlement"), Snap.FindAtCell(CellA) == &Snap.Settlements[1]);
+        TestNull(TEXT("FindAtCell misses a non-settlement cell"), Snap.FindAtCell(FMythicCellCoord(0, 0)));
+
+        const TConstArrayView<FMythicSpawnPoint> PointsA = Snap.GetSpawnPointsInCell(CellA);
+        TestEqual(TEXT("cell A slice has its two points"), PointsA.Num(), 2);
+        TestTrue(TEXT("cell A slice starts at its first point"), PointsA.GetData() == &Snap.SpawnPoints[0]);
+        TestEqual(TEXT("cell B slice has one point"), Snap.GetSpawnPointsInCell(CellB).Num(), 1);
+        TestEqual(TEXT("non-settlement cell → empty slice"), Snap.GetSpawnPointsInCell(FMythicCellCoord(0, 0)).Num(), 0);
+    }
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Belief propagation hop cap — UMythicPartySubsystem::ShouldShareBelief
 // (pure predicate; the gossip loop's single eligibility gate)
@@ -890,6 +1285,36 @@ bool FLivingWorldBeliefDecayTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Cognition scheduler cadence — UMythicCognitionScheduler::QuantizeThinkInterval / ComputeNextDueTime
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldCognitionSchedulerCadenceTest,
+    "Mythic.LivingWorld.Cognition.SchedulerCadence",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldCognitionSchedulerCadenceTest::RunTest(const FString &Parameters) {
+    using Sched = UMythicCognitionScheduler;
+
+    // Quantization: nearest quantum, never below one quantum (a zero interval must not spin every pass).
+    TestEqual(TEXT("0.6s rounds to 0.5s"), Sched::QuantizeThinkInterval(0.6f), 0.5f);
+    TestEqual(TEXT("0.9s rounds to 1.0s"), Sched::QuantizeThinkInterval(0.9f), 1.0f);
+    TestEqual(TEXT("exact quantum is kept"), Sched::QuantizeThinkInterval(1.75f), 1.75f);
+    TestEqual(TEXT("tiny interval clamps to one quantum"), Sched::QuantizeThinkInterval(0.01f), Sched::ThinkIntervalQuantum);
+
+    // On time: phase is kept (a looping timer's cadence), not re-based on the dispatch time.
+    TestEqual(TEXT("on-time think keeps its phase"), Sched::ComputeNextDueTime(10.0, 10.03, 1.0f), 11.0);
+
+    // A whole interval behind (a long hitch): re-phase from now instead of bursting through missed periods.
+    TestEqual(TEXT("late think re-phases from now"), Sched::ComputeNextDueTime(10.0, 13.5, 1.0f), 14.5);
+
+    // The next due time is always strictly in the future, so a pass never re-dispatches the same brain.
+    TestTrue(TEXT("next due is after now"), Sched::ComputeNextDueTime(10.0, 11.0, 1.0f) > 11.0);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Moral trajectory arc — FMythicMoralSignature::TrajectoryAngle / ComputeMoralTrajectoryAngle
 // (was declared + serialized but NEVER computed — always 0)
@@ -1240,6 +1665,60 @@ bool FMythicMoralSignatureCoreTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Witness severity table — UMythicWitnessPerceptionProcessor::BuildSeverityTable / ApplyCategoryAxes
+// One severity per committed faction per event; every witness of a faction is classified by the same entry.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicWitnessSeverityTableTest,
+    "Mythic.LivingWorld.Witness.SeverityTable",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicWitnessSeverityTableTest::RunTest(const FString &Parameters) {
+    using W = UMythicWitnessPerceptionProcessor;
+
+    // Three committed factions (pacifist, warlike, sanctity-protecting) plus an uncommitted tail slot.
+    FMythicFactionSnapshot Snapshot;
+    Snapshot.RegisteredCount = 3;
+    Snapshot.MaxFactions = 4;
+    Snapshot.MoralProfiles.SetNum(4);
+    Snapshot.MoralProfiles[0].Ideology.GetAxisMutable(EMythicMoralAxis::Violence) = -1.0f;
+    Snapshot.MoralProfiles[1].Ideology.GetAxisMutable(EMythicMoralAxis::Violence) = 1.0f;
+    Snapshot.MoralProfiles[2].Ideology.GetAxisMutable(EMythicMoralAxis::Sanctity) = 1.0f;
+
+    const FMythicMoralAction Kill = FMythicMoralSignature::MakeKillActionMoralVector();
+    TArray<EMythicMoralSeverity> Table;
+    W::BuildSeverityTable(Kill, Snapshot, Table);
+    TestEqual(TEXT("table covers committed factions only"), Table.Num(), 3);
+    if (Table.Num() == 3) {
+        // Each entry matches the per-witness evaluation it replaces.
+        for (int32 i = 0; i < 3; ++i) {
+            const FMythicFactionMoralProfile &P = Snapshot.MoralProfiles[i];
+            const EMythicMoralSeverity Expected = FMythicMoralSignature::EvaluateActionSeverity(
+                Kill, P.Ideology, P.DisapproveThreshold, P.CondemnThreshold, P.HostileThreshold);
+            TestEqual(*FString::Printf(TEXT("faction %d matches direct evaluation"), i),
+                      static_cast<int32>(Table[i]), static_cast<int32>(Expected));
+        }
+        TestEqual(TEXT("kill vs pacifist → Hostile"), static_cast<int32>(Table[0]), static_cast<int32>(EMythicMoralSeverity::Hostile));
+        TestEqual(TEXT("kill vs warlike → Ignore"), static_cast<int32>(Table[1]), static_cast<int32>(EMythicMoralSeverity::Ignore));
+    }
+
+    // Category injection: forbidden magic desecrates (negative Sanctity), so the sanctity faction now objects.
+    FMythicMoralAction Forbidden;
+    W::ApplyCategoryAxes(EMythicActionCategory::Magic_Forbidden, Forbidden);
+    TestTrue(TEXT("forbidden magic → negative Sanctity"), Forbidden.AxisValues[static_cast<int32>(EMythicMoralAxis::Sanctity)] < 0.0f);
+    W::BuildSeverityTable(Forbidden, Snapshot, Table);
+    TestTrue(TEXT("sanctity faction condemns forbidden magic"), Table.Num() == 3 && Table[2] >= EMythicMoralSeverity::Condemn);
+
+    // Rebuilding over fewer factions shrinks the table (no stale tail entries classify a witness).
+    Snapshot.RegisteredCount = 1;
+    W::BuildSeverityTable(Kill, Snapshot, Table);
+    TestEqual(TEXT("rebuilt table tracks RegisteredCount"), Table.Num(), 1);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Population spawn density — UMythicPopulationSpawnerProcessor::ComputeTargetDensity
 // min(settlement, system) cap × clamp(pop/capacity) fill-ratio, ceil; 0 with no capacity. Governs world NPC density.
@@ -1300,6 +1779,191 @@ bool FMythicTerritorialAggressionTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Creature species occupancy — FMythicSpeciesOccupancyGrid + ComputeCrossSpeciesAggression
+// A species bit stays set until its last creature leaves the cell; off-grid cells are untracked; cross-species
+// aggression only considers OTHER species present in the cell that the attacker's matrix row marks hostile.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicSpeciesOccupancyTest,
+    "Mythic.LivingWorld.Creatures.SpeciesOccupancy",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicSpeciesOccupancyTest::RunTest(const FString &Parameters) {
+    FMythicSpeciesOccupancyGrid Grid;
+    Grid.Initialize(8, 4);
+    const FMythicCellCoord A(2, 1);
+    const FMythicCellCoord B(7, 3);
+
+    // Two wolves (species 3) and a deer (species 200 — high word) in A.
+    TestTrue(TEXT("add wolf"), Grid.Add(A, 3));
+    Grid.Add(A, 3);
+    Grid.Add(A, 200);
+    TestEqual(TEXT("two wolves counted"), Grid.GetCount(A, 3), 2);
+    TestTrue(TEXT("wolf bit set"), Grid.GetMask(A).Contains(3));
+    TestTrue(TEXT("deer bit set"), Grid.GetMask(A).Contains(200));
+    TestTrue(TEXT("other cell empty"), Grid.GetMask(B).IsEmpty());
+
+    // One wolf leaves: bit stays. The other leaves: bit clears, deer untouched.
+    Grid.Remove(A, 3);
+    TestTrue(TEXT("one wolf left → bit still set"), Grid.GetMask(A).Contains(3));
+    Grid.Remove(A, 3);
+    TestFalse(TEXT("no wolves → bit cleared"), Grid.GetMask(A).Contains(3));
+    TestTrue(TEXT("deer unaffected"), Grid.GetMask(A).Contains(200));
+    Grid.Remove(A, 3); // untracked pair → no-op
+    TestEqual(TEXT("no negative count"), Grid.GetCount(A, 3), 0);
+
+    // Off-grid cells are not tracked.
+    TestFalse(TEXT("x past width"), Grid.Add(FMythicCellCoord(8, 0), 1));
+    TestFalse(TEXT("negative y"), Grid.Add(FMythicCellCoord(0, -1), 1));
+    TestTrue(TEXT("off-grid mask reads empty"), Grid.GetMask(FMythicCellCoord(-5, 9)).IsEmpty());
+
+    // Matrix: wolf (3) → deer (200) 0.9, wolf → bear (64) 0.4, wolf → wolf 1.0 (same species is never a target).
+    FMythicCreatureAggressionMatrix Matrix;
+    Matrix.Entries.Add(FMythicCreatureAggressionMatrix::PackKey(3, 200), 0.9f);
+    Matrix.Entries.Add(FMythicCreatureAggressionMatrix::PackKey(3, 64), 0.4f);
+    Matrix.Entries.Add(FMythicCreatureAggressionMatrix::PackKey(3, 3), 1.0f);
+    Matrix.HostileRows.SetNum(256);
+    Matrix.HostileRows[3].Set(200);
+    Matrix.HostileRows[3].Set(64);
+    Matrix.HostileRows[3].Set(3);
+
+    using E = UMythicCreatureEcologyProcessor;
+    FMythicSpeciesMask Cell;
+    Cell.Set(3);
+    TestEqual(TEXT("alone with own species → 0"), E::ComputeCrossSpeciesAggression(Cell, Matrix, 3), 0.0f);
+    Cell.Set(64);
+    TestEqual(TEXT("bear present → 0.4"), E::ComputeCrossSpeciesAggression(Cell, Matrix, 3), 0.4f);
+    Cell.Set(200);
+    TestEqual(TEXT("deer + bear → max 0.9"), E::ComputeCrossSpeciesAggression(Cell, Matrix, 3), 0.9f);
+    TestEqual(TEXT("deer has no hostile row → 0"), E::ComputeCrossSpeciesAggression(Cell, Matrix, 200), 0.0f);
+    TestEqual(TEXT("unbuilt matrix → 0"), E::ComputeCrossSpeciesAggression(Cell, FMythicCreatureAggressionMatrix(), 3), 0.0f);
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Living-world budget governor — UMythicLivingWorldBudgetSubsystem pure helpers
+// Floors always granted; the rest goes to backlogged lanes by priority, capped by ceiling and the ms that remain.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicLivingWorldBudgetGovernorTest,
+    "Mythic.LivingWorld.BudgetGovernor",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicLivingWorldBudgetGovernorTest::RunTest(const FString &Parameters) {
+    using G = UMythicLivingWorldBudgetSubsystem;
+
+    // Frame headroom scales the budget, clamped to [0.25x, 2x]; unknown frame time / no target leaves it alone.
+    TestEqual(TEXT("half-target frame → 2x"), G::ComputeEffectiveBudgetMs(2.0f, 16.0f, 8.0f), 4.0f);
+    TestEqual(TEXT("double-target frame → 0.5x"), G::ComputeEffectiveBudgetMs(2.0f, 16.0f, 32.0f), 1.0f);
+    TestEqual(TEXT("spike clamps at 0.25x"), G::ComputeEffectiveBudgetMs(2.0f, 16.0f, 200.0f), 0.5f);
+    TestEqual(TEXT("idle clamps at 2x"), G::ComputeEffectiveBudgetMs(2.0f, 16.0f, 0.5f), 4.0f);
+    TestEqual(TEXT("no target → unscaled"), G::ComputeEffectiveBudgetMs(2.0f, 0.0f, 8.0f), 2.0f);
+    TestEqual(TEXT("no frame time → unscaled"), G::ComputeEffectiveBudgetMs(2.0f, 16.0f, 0.0f), 2.0f);
+
+    // Static caps anchor the floor/ceiling; the floor never drops below 1.
+    int32 Floor = 0, Ceiling = 0;
+    G::ComputeLaneLimits(20, 0.25f, 4.0f, Floor, Ceiling);
+    TestEqual(TEXT("floor = cap/4"), Floor, 5);
+    TestEqual(TEXT("ceiling = cap*4"), Ceiling, 80);
+    G::ComputeLaneLimits(2, 0.25f, 4.0f, Floor, Ceiling);
+    TestEqual(TEXT("floor at least 1"), Floor, 1);
+    TestEqual(TEXT("small ceiling"), Ceiling, 8);
+
+    // Witness-like (priority 3), spawner-like (priority 1, big backlog) and an idle lane (demand 0).
+    TArray<FMythicBudgetLaneInput> Lanes;
+    Lanes.Add({/*Cost*/ 0.25f, /*Demand*/ 20, /*Floor*/ 4, /*Ceiling*/ 40, /*Priority*/ 3});
+    Lanes.Add({0.125f, 100, 4, 16, 1});
+    Lanes.Add({0.5f, 0, 2, 8, 2});
+    TArray<int32> Out;
+    Out.SetNumZeroed(Lanes.Num());
+
+    // Tight: floors cost 1.5 ms (the idle lane's floor is free), the high-priority lane takes the remaining 2.5 ms.
+    TestEqual(TEXT("tight: projected = whole budget"), G::DistributeBudgets(Lanes, 4.0f, Out), 4.0f);
+    TestEqual(TEXT("tight: priority lane 4 + 10"), Out[0], 14);
+    TestEqual(TEXT("tight: low priority held at floor"), Out[1], 4);
+    TestEqual(TEXT("tight: idle lane keeps its floor"), Out[2], 2);
+
+    // Roomy: every backlogged lane is served to min(demand, ceiling).
+    TestEqual(TEXT("roomy: projected cost"), G::DistributeBudgets(Lanes, 100.0f, Out), 7.0f);
+    TestEqual(TEXT("roomy: demand-bound"), Out[0], 20);
+    TestEqual(TEXT("roomy: ceiling-bound"), Out[1], 16);
+    TestEqual(TEXT("roomy: idle lane still at floor"), Out[2], 2);
+
+    // Spike: no ms at all → floors only (they are guarantees, not purchases).
+    G::DistributeBudgets(Lanes, 0.0f, Out);
+    TestEqual(TEXT("zero budget: floor"), Out[0], 4);
+    TestEqual(TEXT("zero budget: floor"), Out[1], 4);
+
+    // An unmeasured lane (cost 0) is treated as free until its first report.
+    TArray<FMythicBudgetLaneInput> Fresh;
+    Fresh.Add({0.0f, 10, 2, 6, 1});
+    TArray<int32> FreshOut;
+    FreshOut.SetNumZeroed(1);
+    G::DistributeBudgets(Fresh, 0.0f, FreshOut);
+    TestEqual(TEXT("unmeasured lane → min(demand, ceiling)"), FreshOut[0], 6);
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Living-world perf histogram — FMythicPerfHistogram
+// Log2 buckets from Base; percentiles read back as bucket upper bounds, capped at the largest sample.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicLivingWorldPerfHistogramTest,
+    "Mythic.LivingWorld.PerfHistogram",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicLivingWorldPerfHistogramTest::RunTest(const FString &Parameters) {
+    FMythicPerfHistogram H(1.0);
+    TestEqual(TEXT("empty: no samples"), H.GetCount(), static_cast<int64>(0));
+    TestEqual(TEXT("empty: percentile 0"), H.GetPercentile(0.99), 0.0);
+
+    // Buckets: [0,1) [1,2) [2,4) [4,8) ... [64,128) ... open-ended last
+    TestEqual(TEXT("below base → bucket 0"), H.GetBucketIndex(0.5), 0);
+    TestEqual(TEXT("base → bucket 1"), H.GetBucketIndex(1.0), 1);
+    TestEqual(TEXT("3 → [2,4)"), H.GetBucketIndex(3.0), 2);
+    TestEqual(TEXT("100 → [64,128)"), H.GetBucketIndex(100.0), 7);
+    TestEqual(TEXT("huge → open-ended last bucket"), H.GetBucketIndex(1.0e9), FMythicPerfHistogram::NumBuckets - 1);
+
+    H.Add(0.5);
+    H.Add(1.5);
+    H.Add(3.0);
+    H.Add(3.0);
+    H.Add(100.0);
+    TestEqual(TEXT("count"), H.GetCount(), static_cast<int64>(5));
+    TestEqual(TEXT("mean"), H.GetMean(), 21.6);
+    TestEqual(TEXT("max"), H.GetMax(), 100.0);
+    TestEqual(TEXT("bucket [2,4) holds both 3s"), H.GetBucketCount(2), static_cast<int64>(2));
+
+    // Percentiles are conservative: the upper bound of the bucket holding that rank, never above the max.
+    TestEqual(TEXT("p20 → upper bound of [0,1)"), H.GetPercentile(0.2), 1.0);
+    TestEqual(TEXT("p50 → upper bound of [2,4)"), H.GetPercentile(0.5), 4.0);
+    TestEqual(TEXT("p99 → capped at the max, not 128"), H.GetPercentile(0.99), 100.0);
+
+    // Negative samples clamp to 0; Reset clears everything but keeps the base.
+    H.Add(-3.0);
+    TestEqual(TEXT("negative lands in bucket 0"), H.GetBucketCount(0), static_cast<int64>(2));
+    H.Reset();
+    TestEqual(TEXT("reset: no samples"), H.GetCount(), static_cast<int64>(0));
+    TestEqual(TEXT("reset: base kept"), H.GetBucketIndex(1.0), 1);
+
+    // A sub-ms base resolves frame-scale timings.
+    FMythicPerfHistogram Ms(1.0 / 16.0);
+    Ms.Add(0.05);
+    Ms.Add(0.3);
+    TestEqual(TEXT("0.05ms → [0, 1/16)"), Ms.GetBucketIndex(0.05), 0);
+    TestEqual(TEXT("0.3ms → [1/4, 1/2)"), Ms.GetBucketIndex(0.3), 3);
+    TestEqual(TEXT("median of two → first bucket's bound"), Ms.GetPercentile(0.5), 1.0 / 16.0);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Interaction focus priority — UMythicInteractionComponent::SelectFocusedInteractable
 // In-range → best forward-alignment (highest Dot); else closest out-of-range; in-range always wins.
@@ -1513,6 +2177,44 @@ bool FMythicRegenStepTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Batched regen — UMythicLifeRegenSubsystem::ComputeRegenTargets + ComputeNextDueTime
+// Packed lanes step exactly like the per-actor ComputeRegenTarget; only risen lanes are counted as writes.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicRegenBatchTest,
+    "Mythic.GAS.Regen.Batch",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicRegenBatchTest::RunTest(const FString &Parameters) {
+    using R = UMythicLifeRegenSubsystem;
+    // Two owners × (Health, Shield, Stamina): partial, full, zero-rate | clamped, dead-gated (rate 0), from-zero.
+    const float Cur[] = {50.0f, 100.0f, 20.0f, 95.0f, 0.0f, 0.0f};
+    const float Max[] = {100.0f, 100.0f, 100.0f, 100.0f, 100.0f, 50.0f};
+    const float Rate[] = {10.0f, 10.0f, 0.0f, 20.0f, 0.0f, 8.0f};
+    const float Delta[] = {0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f};
+    float Out[6];
+    const int32 Raised = R::ComputeRegenTargets(Cur, Max, Rate, Delta, Out);
+
+    TestEqual(TEXT("three lanes rose"), Raised, 3);
+    for (int32 i = 0; i < 6; ++i) {
+        TestEqual(FString::Printf(TEXT("lane %d matches the per-actor step"), i), Out[i],
+                  UMythicLifeComponent::ComputeRegenTarget(Cur[i], Max[i], Rate[i], Delta[i]));
+    }
+    TestEqual(TEXT("partial lane"), Out[0], 55.0f);
+    TestEqual(TEXT("full lane unchanged"), Out[1], 100.0f);
+    TestEqual(TEXT("clamped lane"), Out[3], 100.0f);
+    TestEqual(TEXT("zero-rate lane unchanged"), Out[4], 0.0f);
+    TestEqual(TEXT("recharge from zero"), Out[5], 4.0f);
+
+    // Cadence: keeps the looping-timer phase; re-phases after a hitch instead of bursting.
+    TestEqual(TEXT("on time keeps phase"), R::ComputeNextDueTime(10.0, 10.1, 0.5f), 10.5);
+    TestEqual(TEXT("hitch re-phases from now"), R::ComputeNextDueTime(10.0, 12.0, 0.5f), 12.5);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Stagger trigger — UMythicLifeComponent::IsHeavyHit + IsStaggerImmune
 // Heavy-hit threshold scales with MaxHealth; immunity window prevents stun-lock but never suppresses the FIRST hit.
@@ -1604,6 +2306,42 @@ bool FMythicResourceRespawnGateTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Destroyed-resource index — FTrackedDestructibleDataArray::FindIndex across AddItem / RemoveItems
+// Batch swap-removal must keep every surviving (ISM, InstanceId) key pointing at its item.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicResourceDestroyedIndexTest,
+    "Mythic.Resources.DestroyedIndex",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicResourceDestroyedIndexTest::RunTest(const FString &Parameters) {
+    // No ISM: the replication callbacks only log and skip, so the array can be driven standalone.
+    FTrackedDestructibleDataArray Destroyed;
+    for (int32 Id = 0; Id < 6; ++Id) {
+        FTrackedDestructibleData Item;
+        Item.InstanceId = Id;
+        Item.HitsTillDestruction = 0;
+        Item.RespawnTime = 100.0 + Id;
+        Destroyed.AddItem(Item);
+    }
+    TestEqual(TEXT("added items are indexed"), Destroyed.FindIndex(FResourceNodeKey(nullptr, 4)), 4);
+
+    // Duplicate and out-of-range indices are ignored; the rest swap-remove without disturbing each other.
+    TArray<int32> Remove = {1, 4, 1, 9};
+    Destroyed.RemoveItems(Remove);
+    const TArray<FTrackedDestructibleData> &Items = *Destroyed.GetItems();
+    TestEqual(TEXT("two items removed"), Items.Num(), 4);
+    TestEqual(TEXT("removed key is gone (1)"), Destroyed.FindIndex(FResourceNodeKey(nullptr, 1)), INDEX_NONE);
+    TestEqual(TEXT("removed key is gone (4)"), Destroyed.FindIndex(FResourceNodeKey(nullptr, 4)), INDEX_NONE);
+    for (int32 Id : {0, 2, 3, 5}) {
+        const int32 Index = Destroyed.FindIndex(FResourceNodeKey(nullptr, Id));
+        TestTrue(FString::Printf(TEXT("survivor %d indexed at its item"), Id), Items.IsValidIndex(Index) && Items[Index].InstanceId == Id);
+    }
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Significance LOD tier hysteresis — QualifiesForPromotion / QualifiesForDemotion
 // The promote (>= Thr+H) / demote (<= Thr-H) gates form the dead-band that prevents tier oscillation.
@@ -1641,6 +2379,58 @@ bool FMythicSignificanceHysteresisTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Significance ranked promotion — SelectTopK / ShouldDisplaceHolder
+// The strongest candidates win regardless of walk order; a full cap swaps only past the hysteresis margin.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicSignificanceTopKTest,
+    "Mythic.LivingWorld.Significance.TopKPromotion",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicSignificanceTopKTest::RunTest(const FString &Parameters) {
+    using S = UMythicSignificanceProcessor;
+    TArray<int32> Out;
+
+    // The strongest scores sit LATE in walk order — chunk-order promotion would have taken 0 and 1 first.
+    const TArray<float> Scores = {0.81f, 0.82f, 0.95f, 0.70f, 0.99f, 0.90f};
+    S::SelectTopK(Scores, 3, Out);
+    TestEqual(TEXT("K=3 picks three"), Out.Num(), 3);
+    if (Out.Num() == 3) {
+        TestEqual(TEXT("strongest first"), Out[0], 4);
+        TestEqual(TEXT("second"), Out[1], 2);
+        TestEqual(TEXT("third"), Out[2], 5);
+    }
+
+    // K beyond the candidate count returns every candidate, fully ranked.
+    S::SelectTopK(Scores, 32, Out);
+    TestEqual(TEXT("K > N returns N"), Out.Num(), Scores.Num());
+    bool bDescending = true;
+    for (int32 i = 1; i < Out.Num(); ++i) {
+        bDescending &= Scores[Out[i - 1]] >= Scores[Out[i]];
+    }
+    TestTrue(TEXT("fully ranked strongest-first"), bDescending);
+
+    // Equal scores break toward the lower index, so the pick is deterministic.
+    const TArray<float> Ties = {0.5f, 0.9f, 0.9f, 0.9f};
+    S::SelectTopK(Ties, 2, Out);
+    TestTrue(TEXT("ties → lower index first"), Out.Num() == 2 && Out[0] == 1 && Out[1] == 2);
+
+    S::SelectTopK(Scores, 0, Out);
+    TestEqual(TEXT("K=0 → empty"), Out.Num(), 0);
+    S::SelectTopK(TArray<float>(), 4, Out);
+    TestEqual(TEXT("no candidates → empty"), Out.Num(), 0);
+
+    // Swap gate (H=0.1): a candidate must beat the weakest holder by MORE than the margin.
+    TestTrue(TEXT("swap: 0.95 vs 0.80"), S::ShouldDisplaceHolder(0.95f, 0.80f, 0.1f));
+    TestFalse(TEXT("swap: exact margin holds"), S::ShouldDisplaceHolder(0.90f, 0.80f, 0.1f));
+    TestFalse(TEXT("swap: near-equal holds"), S::ShouldDisplaceHolder(0.85f, 0.80f, 0.1f));
+    TestFalse(TEXT("swap: weaker never displaces"), S::ShouldDisplaceHolder(0.70f, 0.80f, 0.0f));
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Save/load inventory slot-restore mapping — FSerializedInventoryData::ComputeSlotRestoreMapping
 // Index-stable match → definition fallback → no double-map → unmatched = INDEX_NONE (layout-change migration).
@@ -2688,6 +3478,89 @@ bool FMythicConversionProductLevelTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Conversion scheduler — UConversionSchedulerSubsystem wheel ticks + parked-cycle fast-forward count
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicConversionSchedulerTest,
+    "Mythic.Itemization.Conversion.Scheduler",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicConversionSchedulerTest::RunTest(const FString &Parameters) {
+    using S = UConversionSchedulerSubsystem;
+
+    // Wheel ticks are floor(due / slot width); work due inside one slot shares its tick.
+    TestEqual(TEXT("t=0 → tick 0"), S::ComputeWheelTick(0.0), int64(0));
+    TestEqual(TEXT("just under one slot → tick 0"), S::ComputeWheelTick(S::WheelSlotSeconds * 0.5), int64(0));
+    TestEqual(TEXT("10 slots in → tick 10"), S::ComputeWheelTick(S::WheelSlotSeconds * 10.5), int64(10));
+    TestTrue(TEXT("ticks are monotonic in due time"), S::ComputeWheelTick(3.0) <= S::ComputeWheelTick(3.01));
+
+    // Args: (CycleStart, Duration, Now, RemainingCycles, MaxCycles)
+    TestEqual(TEXT("cycle not finished → 0"), S::ComputeElapsedCycles(100.0, 10.0f, 109.0, 0, 1024), 0);
+    TestEqual(TEXT("exactly one cycle → 1"), S::ComputeElapsedCycles(100.0, 10.0f, 110.0, 0, 1024), 1);
+    TestEqual(TEXT("unbounded job, 95s away at 10s/cycle → 9"), S::ComputeElapsedCycles(100.0, 10.0f, 195.0, 0, 1024), 9);
+    TestEqual(TEXT("bounded job stops at its remaining cycles"), S::ComputeElapsedCycles(100.0, 10.0f, 195.0, 3, 1024), 3);
+    TestEqual(TEXT("capped by MaxCycles"), S::ComputeElapsedCycles(0.0, 1.0f, 100000.0, 0, 1024), 1024);
+    TestEqual(TEXT("zero-length cycle → 0 (Instant never parks)"), S::ComputeElapsedCycles(100.0, 0.0f, 200.0, 0, 1024), 0);
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Conversion catch-up — UConversionStationComponent::ClampCatchUpCycles / ComputeOutputCapacityCycles
+// (a woken station settles N cycles at once; N must stop where inputs, fuel, catalysts or output space ran out)
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicConversionCatchUpTest,
+    "Mythic.Itemization.Conversion.CatchUp",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicConversionCatchUpTest::RunTest(const FString &Parameters) {
+    using S = UConversionStationComponent;
+
+    // Args: (Elapsed, InputCycles beyond the paid one, FuelCycles, OutputCycles, bCatalystsPresent)
+    TestEqual(TEXT("nothing elapsed → 0"), S::ClampCatchUpCycles(0, 100, 100, 100, true), 0);
+    TestEqual(TEXT("plenty of everything → all elapsed"), S::ClampCatchUpCycles(50, MAX_int32, MAX_int32, 1000, true), 50);
+    TestEqual(TEXT("inputs for 4 more → 5 (the in-progress one is paid)"), S::ClampCatchUpCycles(50, 4, MAX_int32, 1000, true), 5);
+    TestEqual(TEXT("no inputs left → just the in-progress cycle"), S::ClampCatchUpCycles(50, 0, MAX_int32, 1000, true), 1);
+    TestEqual(TEXT("fuel for 7 → 7"), S::ClampCatchUpCycles(50, MAX_int32, 7, 1000, true), 7);
+    TestEqual(TEXT("output room for 3 → 3"), S::ClampCatchUpCycles(50, MAX_int32, MAX_int32, 3, true), 3);
+    TestEqual(TEXT("full output still completes the in-progress cycle"), S::ClampCatchUpCycles(50, MAX_int32, MAX_int32, 0, true), 1);
+    TestEqual(TEXT("catalyst gone → only the in-progress cycle"), S::ClampCatchUpCycles(50, MAX_int32, MAX_int32, 1000, false), 1);
+    TestEqual(TEXT("tightest limit wins"), S::ClampCatchUpCycles(50, 9, 6, 8, true), 6);
+
+    // One product: 3 units/cycle, stacks of 10, 4 free in a partial stack, 2 empty slots → 24 units → 8 cycles.
+    {
+        FConversionOutputDemand D;
+        D.UnitsPerCycle = 3;
+        D.StackMax = 10;
+        D.PartialSpace = 4;
+        D.EmptySlots = 2;
+        TestEqual(TEXT("partial space then whole slots"), S::ComputeOutputCapacityCycles({D}, 2, 1000), 8);
+        TestEqual(TEXT("bounded by MaxCycles"), S::ComputeOutputCapacityCycles({D}, 2, 5), 5);
+        D.EmptySlots = 0;
+        TestEqual(TEXT("whitelist admits no empty slot → partial space only"), S::ComputeOutputCapacityCycles({D}, 2, 1000), 1);
+    }
+    // Two products share the empty slots: 1 unstackable unit each per cycle, 6 empty slots → 3 cycles.
+    {
+        FConversionOutputDemand A;
+        A.UnitsPerCycle = 1;
+        A.EmptySlots = 6;
+        FConversionOutputDemand B = A;
+        TestEqual(TEXT("demands draw on one shared pool"), S::ComputeOutputCapacityCycles({A, B}, 6, 1000), 3);
+    }
+    // A product with no room at all → 0 (the clamp above still lets the in-progress cycle complete and spill).
+    {
+        FConversionOutputDemand D;
+        D.UnitsPerCycle = 1;
+        TestEqual(TEXT("no room → 0"), S::ComputeOutputCapacityCycles({D}, 0, 1000), 0);
+    }
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Settlement center cell — AMythicSettlement::ComputeCenterCell
 // (the Socialize gather-point — was never assigned → always (0,0) → NPCs socialized at the grid origin corner)
@@ -3388,6 +4261,90 @@ bool FLivingWorldDespairStateTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════
+// Witness grouping — UMythicPressureProcessor::BuildWitnessRuns
+// One run per witness, results kept in queue order inside each run.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldPressureWitnessRunsTest,
+    "Mythic.LivingWorld.Pressure.WitnessRuns",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldPressureWitnessRunsTest::RunTest(const FString &Parameters) {
+    auto MakeResult = [](int32 Index, float Significance) {
+        FMythicWitnessResult R;
+        R.WitnessEntity.Index = Index;
+        R.WitnessEntity.SerialNumber = 1;
+        R.EventSignificance = Significance;
+        return R;
+    };
+    // Witness 7 twice (queue order 1.0 then 3.0), witness 2 once.
+    const TArray<FMythicWitnessResult> Results = {MakeResult(7, 1.0f), MakeResult(2, 2.0f), MakeResult(7, 3.0f)};
+
+    TArray<int32> Order;
+    TArray<int32> RunStarts;
+    UMythicPressureProcessor::BuildWitnessRuns(Results, Order, RunStarts);
+
+    TestEqual(TEXT("every result ordered"), Order.Num(), 3);
+    TestEqual(TEXT("two runs + sentinel"), RunStarts.Num(), 3);
+    TestEqual(TEXT("sentinel closes the last run"), RunStarts.Last(), 3);
+    TestEqual(TEXT("first run is witness 2"), Results[Order[RunStarts[0]]].WitnessEntity.Index, 2);
+    TestEqual(TEXT("witness 2 has one result"), RunStarts[1] - RunStarts[0], 1);
+    TestEqual(TEXT("witness 7 has two results"), RunStarts[2] - RunStarts[1], 2);
+    TestEqual(TEXT("witness 7 keeps queue order (first)"), Results[Order[1]].EventSignificance, 1.0f);
+    TestEqual(TEXT("witness 7 keeps queue order (second)"), Results[Order[2]].EventSignificance, 3.0f);
+
+    // Empty input → just the sentinel.
+    UMythicPressureProcessor::BuildWitnessRuns(TConstArrayView<FMythicWitnessResult>(), Order, RunStarts);
+    TestEqual(TEXT("empty → no order"), Order.Num(), 0);
+    TestEqual(TEXT("empty → sentinel only"), RunStarts.Num(), 1);
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Fight-target holders — UMythicCellEntityIndexSubsystem::SetFightTarget
+// Mob bonuses reach every holder of a crowded target, so retarget / clear / destroy must keep the lists exact.
+// ═══════════════════════════════════════════════════════════════
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldFightTargetHoldersTest,
+    "Mythic.LivingWorld.Pressure.FightTargetHolders",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldFightTargetHoldersTest::RunTest(const FString &Parameters) {
+    auto *CellIndex = NewObject<UMythicCellEntityIndexSubsystem>();
+    auto MakeHandle = [](int32 Index) {
+        FMassEntityHandle Handle;
+        Handle.Index = Index;
+        Handle.SerialNumber = 1;
+        return Handle;
+    };
+    const FMassEntityHandle A = MakeHandle(1), B = MakeHandle(2), C = MakeHandle(3);
+
+    CellIndex->SetFightTarget(A, 50);
+    CellIndex->SetFightTarget(B, 50);
+    CellIndex->SetFightTarget(C, 60);
+    CellIndex->SetFightTarget(A, 50); // same target again — no duplicate
+    TestEqual(TEXT("two holders of 50"), CellIndex->GetFightTargetHolders(50).Num(), 2);
+    TestEqual(TEXT("one holder of 60"), CellIndex->GetFightTargetHolders(60).Num(), 1);
+    TestEqual(TEXT("unknown target → none"), CellIndex->GetFightTargetHolders(70).Num(), 0);
+
+    CellIndex->SetFightTarget(B, 60); // retarget
+    TestEqual(TEXT("retarget leaves 50"), CellIndex->GetFightTargetHolders(50).Num(), 1);
+    TestEqual(TEXT("retarget joins 60"), CellIndex->GetFightTargetHolders(60).Num(), 2);
+
+    CellIndex->SetFightTarget(A, INDEX_NONE); // clear
+    TestEqual(TEXT("cleared holder gone"), CellIndex->GetFightTargetHolders(50).Num(), 0);
+
+    CellIndex->RemoveEntity(C); // destroyed
+    const TConstArrayView<FMassEntityHandle> Remaining = CellIndex->GetFightTargetHolders(60);
+    TestTrue(TEXT("destroyed holder dropped, retargeted one kept"), Remaining.Num() == 1 && Remaining[0] == B);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 // Diplomacy score→relation hysteresis mapping + shift significance — FMythicWorldSimThread
 // ═══════════════════════════════════════════════════════════════
@@ -3587,6 +4544,145 @@ bool FLivingWorldTerritoryGridPropagateTest::RunTest(const FString &Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldTerritoryGridParallelPropagateTest,
+    "Mythic.LivingWorld.Phase1.TerritoryGrid.ParallelPropagateBitIdentical",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldTerritoryGridParallelPropagateTest::RunTest(const FString &Parameters) {
+    // 150×110 = 16500 cells: several bands, the last one partial, and a width that is not a multiple of 32 (band
+    // boundaries fall mid-row). Blocky territories exercise the single-faction fast path; noise exercises borders.
+    constexpr int32 W = 150;
+    constexpr int32 H = 110;
+    auto MakeGrid = [W, H](int32 ParallelMinCells) {
+        UMythicTerritoryGridSettings *Settings = LivingWorldTestHelpers::CreateGridSettings(W, H);
+        Settings->ParallelPropagationMinCells = ParallelMinCells;
+        auto *Grid = NewObject<UMythicTerritoryGrid>();
+        Grid->Initialize(Settings);
+        FRandomStream Rng(4242);
+        for (int32 Y = 0; Y < H; ++Y) {
+            for (int32 X = 0; X < W; ++X) {
+                const int32 Block = (X / 25 + Y / 20) % 4; // 3 = unclaimed
+                const bool bNoise = Rng.FRand() < 0.15f;
+                const int32 FactionIdx = bNoise ? Rng.RandRange(0, 3) : Block;
+                if (FactionIdx < 3) {
+                    Grid->SetCellInfluence(FMythicCellCoord(X, Y), LivingWorldTestHelpers::MakeFactionId(FactionIdx), Rng.FRandRange(0.05f, 1.0f));
+                }
+            }
+        }
+        Grid->CommitWrites();
+        return Grid;
+    };
+
+    UMythicTerritoryGrid *Serial = MakeGrid(MAX_int32);
+    UMythicTerritoryGrid *Parallel = MakeGrid(0);
+
+    // One tick checked cell-by-cell against the general reference evaluation (covers the interior fast path).
+    {
+        TArray<FMythicTerritoryCell> Before;
+        Before.SetNum(W * H);
+        for (int32 i = 0; i < W * H; ++i) {
+            Before[i] = Serial->GetCell(FMythicCellCoord(i % W, i / W));
+        }
+        Serial->PropagateInfluence();
+        Serial->CommitWrites();
+        int32 Mismatches = 0;
+        for (int32 Y = 0; Y < H; ++Y) {
+            for (int32 X = 0; X < W; ++X) {
+                FMythicFactionId RefFaction;
+                float RefInfluence = 0.0f;
+                UMythicTerritoryGrid::EvaluateCellReference(Before.GetData(), W, H, X, Y, 0.1f, 0.1f, RefFaction, RefInfluence);
+                const FMythicTerritoryCell After = Serial->GetCell(FMythicCellCoord(X, Y));
+                Mismatches += (After.DominantFaction != RefFaction || After.Influence != RefInfluence) ? 1 : 0;
+            }
+        }
+        TestEqual(TEXT("banded propagation matches the reference evaluation bit-for-bit"), Mismatches, 0);
+        Parallel->PropagateInfluence();
+        Parallel->CommitWrites();
+    }
+
+    for (int32 Tick = 0; Tick < 8; ++Tick) {
+        Serial->PropagateInfluence();
+        Serial->CommitWrites();
+        Parallel->PropagateInfluence();
+        Parallel->CommitWrites();
+    }
+
+    int32 Diffs = 0;
+    for (int32 Y = 0; Y < H; ++Y) {
+        for (int32 X = 0; X < W; ++X) {
+            const FMythicTerritoryCell A = Serial->GetCell(FMythicCellCoord(X, Y));
+            const FMythicTerritoryCell B = Parallel->GetCell(FMythicCellCoord(X, Y));
+            Diffs += (A.DominantFaction != B.DominantFaction || A.Influence != B.Influence) ? 1 : 0;
+        }
+    }
+    TestEqual(TEXT("parallel and single-threaded propagation are bit-identical after 9 ticks"), Diffs, 0);
+
+    TArray<FMythicCellCoord> Changed;
+    Parallel->GetChangedCells(Changed);
+    TestTrue(TEXT("parallel apply still reports dirty cells"), Changed.Num() > 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldTerritoryGridFrontierPropagateTest,
+    "Mythic.LivingWorld.Phase1.TerritoryGrid.FrontierPropagateMatchesFullSweep",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldTerritoryGridFrontierPropagateTest::RunTest(const FString &Parameters) {
+    constexpr int32 N = 96;
+    auto MakeGrid = [](bool bIncremental) {
+        UMythicTerritoryGridSettings *Settings = LivingWorldTestHelpers::CreateGridSettings(N, N);
+        Settings->bIncrementalPropagation = bIncremental;
+        auto *Grid = NewObject<UMythicTerritoryGrid>();
+        Grid->Initialize(Settings);
+        // Two faction seeds on an empty map: they grow, saturate and meet in a contested border.
+        Grid->SetCellInfluence(FMythicCellCoord(20, 48), LivingWorldTestHelpers::MakeFactionId(0), 1.0f);
+        Grid->SetCellInfluence(FMythicCellCoord(75, 48), LivingWorldTestHelpers::MakeFactionId(1), 1.0f);
+        return Grid;
+    };
+    UMythicTerritoryGrid *Full = MakeGrid(false);
+    UMythicTerritoryGrid *Frontier = MakeGrid(true);
+
+    auto CountDiffs = [&]() {
+        int32 Diffs = 0;
+        for (int32 Y = 0; Y < N; ++Y) {
+            for (int32 X = 0; X < N; ++X) {
+                const FMythicTerritoryCell A = Full->GetCell(FMythicCellCoord(X, Y));
+                const FMythicTerritoryCell B = Frontier->GetCell(FMythicCellCoord(X, Y));
+                Diffs += (A.DominantFaction != B.DominantFaction || A.Influence != B.Influence) ? 1 : 0;
+            }
+        }
+        return Diffs;
+    };
+
+    int32 Mismatches = 0;
+    for (int32 Tick = 0; Tick < 160; ++Tick) {
+        if (Tick == 100) {
+            // A mid-run external write (a settlement claim deep inside settled territory) must re-seed the frontier.
+            Full->SetCellInfluence(FMythicCellCoord(10, 10), LivingWorldTestHelpers::MakeFactionId(1), 1.0f);
+            Frontier->SetCellInfluence(FMythicCellCoord(10, 10), LivingWorldTestHelpers::MakeFactionId(1), 1.0f);
+        }
+        Full->PropagateInfluence();
+        Full->CommitWrites();
+        Frontier->PropagateInfluence();
+        Frontier->CommitWrites();
+        Mismatches += CountDiffs() > 0 ? 1 : 0;
+        TestEqual(TEXT("full sweep always evaluates every cell"), Full->GetLastPropagationCellCount(), N * N);
+    }
+    TestEqual(TEXT("frontier propagation matches the full sweep on every tick"), Mismatches, 0);
+
+    // After the map settles the frontier collapses to (at most) the contested border.
+    for (int32 Tick = 0; Tick < 200; ++Tick) {
+        Frontier->PropagateInfluence();
+    }
+    TestTrue(*FString::Printf(TEXT("settled map evaluates a small frontier (%d of %d cells)"), Frontier->GetLastPropagationCellCount(), N * N),
+             Frontier->GetLastPropagationCellCount() < N * N / 10);
+
+    return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FLivingWorldTerritoryGridWorldToCellTest,
     "Mythic.LivingWorld.Phase1.TerritoryGrid.WorldToCell",
@@ -3848,6 +4944,245 @@ bool FLivingWorldFactionDBRelationshipsTest::RunTest(const FString &Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldFactionDBSnapshotTest,
+    "Mythic.LivingWorld.Phase1.FactionDatabase.PublishedSnapshot",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldFactionDBSnapshotTest::RunTest(const FString &Parameters) {
+    auto *DB = NewObject<UMythicFactionDatabase>();
+    DB->Initialize(LivingWorldTestHelpers::CreateFactionSettings(20, 3));
+
+    const FMythicFactionId A = LivingWorldTestHelpers::MakeFactionId(0);
+    const FMythicFactionId B = LivingWorldTestHelpers::MakeFactionId(1);
+
+    FMythicFactionSnapshotRef Held = DB->AcquireSnapshot();
+    TestTrue(TEXT("Snapshot published by Initialize"), Held.IsValid());
+    if (!Held) {
+        return false;
+    }
+    TestEqual(TEXT("Snapshot registered count"), Held->RegisteredCount, 3);
+    TestTrue(TEXT("Snapshot epoch matches database"), Held->Epoch == DB->GetSnapshotEpoch());
+    const FMythicFactionSnapshot *HeldPtr = Held.GetReference();
+
+    // Mutate + commit many times; the held snapshot must stay frozen and must never be recycled underneath us.
+    for (int32 Commit = 1; Commit <= 12; ++Commit) {
+        DB->GetFactionMutable(A)->Population = 100 + Commit;
+        DB->GetFactionMutable(A)->Ideology.Violence = 0.05f * Commit;
+        DB->SetRelationship(A, B, (Commit % 2) ? EMythicFactionRelation::Hostile : EMythicFactionRelation::Friendly);
+        DB->CommitWrites();
+
+        const FMythicFactionSnapshotRef Current = DB->AcquireSnapshot();
+        TestTrue(*FString::Printf(TEXT("Commit %d publishes a different snapshot than the held one"), Commit),
+                 Current.GetReference() != HeldPtr);
+        TestEqual(*FString::Printf(TEXT("Commit %d current population"), Commit), Current->GetFaction(A)->Population,
+                  100 + Commit);
+        TestEqual(*FString::Printf(TEXT("Commit %d moral profile mirrors ideology"), Commit),
+                  Current->GetMoralProfile(A)->Ideology.Violence, Current->GetFaction(A)->Ideology.Violence);
+        TestEqual(*FString::Printf(TEXT("Commit %d snapshot relationship matches accessor"), Commit),
+                  Current->GetRelationship(A, B), DB->GetRelationship(A, B));
+        TestEqual(*FString::Printf(TEXT("Commit %d held population frozen"), Commit), Held->GetFaction(A)->Population, 100);
+        TestEqual(*FString::Printf(TEXT("Commit %d held relationship frozen"), Commit), Held->GetRelationship(A, B),
+                  EMythicFactionRelation::Neutral);
+    }
+
+    // A faction registered but not yet committed is invisible to readers (no default-constructed "alive" slot).
+    FMythicFactionData NewFaction;
+    NewFaction.Population = 7;
+    const FMythicFactionId NewId = DB->RegisterFaction(NewFaction);
+    FMythicFactionData Out;
+    TestFalse(TEXT("Uncommitted faction not readable"), DB->GetFaction(NewId, Out));
+    TestEqual(TEXT("Uncommitted faction not counted"), DB->GetActiveFactionCount(), 3);
+    DB->CommitWrites();
+    TestTrue(TEXT("Committed faction readable"), DB->GetFaction(NewId, Out));
+    TestEqual(TEXT("Committed faction population"), Out.Population, 7);
+
+    // Once released, retired generations are recycled: steady-state commits stop allocating new snapshots.
+    Held.SafeRelease();
+    TSet<const FMythicFactionSnapshot *> Seen;
+    for (int32 Commit = 0; Commit < 32; ++Commit) {
+        DB->CommitWrites();
+        Seen.Add(DB->AcquireSnapshot().GetReference());
+    }
+    TestTrue(*FString::Printf(TEXT("Snapshot storage recycled (%d distinct over 32 commits)"), Seen.Num()), Seen.Num() <= 8);
+
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Snapshot publisher — TMythicSnapshotPublisher under concurrent readers + commits
+// A reader must never see a recycled (torn) generation, whether it holds the snapshot briefly or across commits.
+// ═══════════════════════════════════════════════════════════════
+
+namespace SnapshotPublisherTest {
+    struct FStressSnapshot : public FThreadSafeRefCountedObject {
+        uint64 Epoch = 0;
+        TArray<uint64> Values; // every entry == Epoch once published
+    };
+
+    /** Read until Done; count any snapshot whose contents disagree with its epoch (a recycled-while-read generation) */
+    template <typename AcquireFn, typename CheckFn>
+    TFuture<int32> SpawnReader(std::atomic<bool> &Done, AcquireFn Acquire, CheckFn IsConsistent) {
+        return Async(EAsyncExecution::Thread, [&Done, Acquire, IsConsistent]() {
+            int32 Torn = 0;
+            uint32 Reads = 0;
+            while (!Done.load(std::memory_order_acquire)) {
+                const auto Snapshot = Acquire();
+                if (!Snapshot) {
+                    continue;
+                }
+                Torn += IsConsistent(*Snapshot) ? 0 : 1;
+                // Every 64th read holds its snapshot across later commits, then re-checks it: still intact.
+                if ((++Reads & 63) == 0) {
+                    FPlatformProcess::Sleep(0.0005f);
+                    Torn += IsConsistent(*Snapshot) ? 0 : 1;
+                }
+            }
+            return Torn;
+        });
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSnapshotPublisherStressTest,
+    "Mythic.LivingWorld.SnapshotPublisher",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSnapshotPublisherStressTest::RunTest(const FString &Parameters) {
+    using namespace SnapshotPublisherTest;
+    constexpr int32 NumReaders = 4;
+
+    // Bare publisher with a small pool, so storage is recycled as aggressively as the scheme allows.
+    {
+        TMythicSnapshotPublisher<FStressSnapshot, 2> Publisher;
+        std::atomic<bool> Done{false};
+        const auto Acquire = [&Publisher]() { return Publisher.Acquire(); };
+        const auto IsConsistent = [](const FStressSnapshot &Snap) {
+            for (const uint64 Value : Snap.Values) {
+                if (Value != Snap.Epoch) {
+                    return false;
+                }
+            }
+            return Snap.Values.Num() == 64;
+        };
+        TArray<TFuture<int32>> Readers;
+        for (int32 r = 0; r < NumReaders; ++r) {
+            Readers.Add(SpawnReader(Done, Acquire, IsConsistent));
+        }
+
+        TSet<const FStressSnapshot *> Storage;
+        for (uint64 Epoch = 1; Epoch <= 20000; ++Epoch) {
+            TRefCountPtr<FStressSnapshot> Next = Publisher.BeginWrite();
+            Storage.Add(Next.GetReference());
+            Next->Values.SetNumUninitialized(64);
+            for (uint64 &Value : Next->Values) {
+                Value = Epoch;
+            }
+            Next->Epoch = Epoch; // written last: a recycled snapshot read mid-rewrite disagrees with its values
+            Publisher.Publish(MoveTemp(Next));
+        }
+        Done.store(true, std::memory_order_release);
+
+        int32 Torn = 0;
+        for (TFuture<int32> &Reader : Readers) {
+            Torn += Reader.Get();
+        }
+        TestEqual(TEXT("publisher: no reader saw a recycled generation"), Torn, 0);
+        TestTrue(*FString::Printf(TEXT("publisher: storage recycled (%d distinct over 20000 commits)"), Storage.Num()),
+                 Storage.Num() < 20000);
+        TestEqual(TEXT("publisher: last generation published"), Publisher.Acquire()->Epoch, static_cast<uint64>(20000));
+
+        Publisher.Reset();
+        TestFalse(TEXT("publisher: reset unpublishes"), Publisher.Acquire().IsValid());
+    }
+
+    // Faction database end to end: population and moral profile are both written per commit and must agree with it.
+    {
+        auto *DB = NewObject<UMythicFactionDatabase>();
+        DB->Initialize(LivingWorldTestHelpers::CreateFactionSettings(20, 3));
+        const FMythicFactionId A = LivingWorldTestHelpers::MakeFactionId(0);
+        const uint64 BaseEpoch = DB->GetSnapshotEpoch();
+
+        std::atomic<bool> Done{false};
+        const auto Acquire = [DB]() { return DB->AcquireSnapshot(); };
+        const auto IsConsistent = [A, BaseEpoch](const FMythicFactionSnapshot &Snap) {
+            if (Snap.Epoch <= BaseEpoch) {
+                return true; // the Initialize generation
+            }
+            const int32 Commit = static_cast<int32>(Snap.Epoch - BaseEpoch);
+            return Snap.GetFaction(A)->Population == Commit &&
+                   Snap.GetMoralProfile(A)->Ideology.Violence == Snap.GetFaction(A)->Ideology.Violence &&
+                   Snap.GetFaction(A)->Ideology.Violence == static_cast<float>(Commit % 100) * 0.01f;
+        };
+        TArray<TFuture<int32>> Readers;
+        for (int32 r = 0; r < NumReaders; ++r) {
+            Readers.Add(SpawnReader(Done, Acquire, IsConsistent));
+        }
+
+        for (int32 Commit = 1; Commit <= 5000; ++Commit) {
+            FMythicFactionData *Faction = DB->GetFactionMutable(A);
+            Faction->Population = Commit;
+            Faction->Ideology.Violence = static_cast<float>(Commit % 100) * 0.01f;
+            DB->CommitWrites();
+        }
+        Done.store(true, std::memory_order_release);
+
+        int32 Torn = 0;
+        for (TFuture<int32> &Reader : Readers) {
+            Torn += Reader.Get();
+        }
+        TestEqual(TEXT("faction database: no reader saw a recycled generation"), Torn, 0);
+        TestEqual(TEXT("faction database: last commit published"), DB->AcquireSnapshot()->GetFaction(A)->Population, 5000);
+    }
+
+    // Causal fabric end to end: visitors walk a pinned view while the sim thread keeps committing. Every walk must see
+    // one contiguous id range with untorn payloads (PerpEntityId is derived from the id).
+    {
+        auto *Fabric = NewObject<UMythicCausalFabric>();
+        Fabric->Initialize(256);
+
+        std::atomic<bool> Done{false};
+        TArray<TFuture<int32>> Readers;
+        for (int32 r = 0; r < NumReaders; ++r) {
+            Readers.Add(Async(EAsyncExecution::Thread, [Fabric, &Done]() {
+                int32 Torn = 0;
+                while (!Done.load(std::memory_order_acquire)) {
+                    uint32 Expected = 0;
+                    Fabric->VisitRecentEvents(256, [&Torn, &Expected](const FMythicWorldEvent &Event) {
+                        const bool bGap = Expected != 0 && Event.EventId != Expected;
+                        Torn += bGap || Event.PerpEntityId != Event.EventId * 3 ? 1 : 0;
+                        Expected = Event.EventId - 1;
+                        return true;
+                    });
+                }
+                return Torn;
+            }));
+        }
+
+        for (int32 Commit = 0; Commit < 5000; ++Commit) {
+            for (int32 i = 0; i <= Commit % 7; ++i) {
+                FMythicWorldEvent Event;
+                Event.WorldTime = 1.0;
+                Event.PerpEntityId = Fabric->GetTotalEventCount() * 3; // the id AppendEvent is about to assign
+                Fabric->AppendEvent(Event);
+            }
+            Fabric->CommitWrites();
+        }
+        Done.store(true, std::memory_order_release);
+
+        int32 Torn = 0;
+        for (TFuture<int32> &Reader : Readers) {
+            Torn += Reader.Get();
+        }
+        TestEqual(TEXT("causal fabric: no walk saw a torn or recycled view"), Torn, 0);
+
+        // A reader that outlived a commit interval may have deferred the final publish; nothing pins a view now.
+        Fabric->CommitWrites();
+        TestNotNull(TEXT("causal fabric: last event published"), Fabric->GetEvent(Fabric->GetTotalEventCount() - 1));
+    }
+    return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FLivingWorldFactionDBSerializeBehaviorFlagsTest,
     "Mythic.LivingWorld.Phase1.FactionDatabase.SerializeBehaviorFlags",
@@ -4060,6 +5395,42 @@ bool FLivingWorldSettlementFactionQueryTest::RunTest(const FString &Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldEmbodimentDemandPredictionTest,
+    "Mythic.LivingWorld.Phase3.EmbodimentPool.PredictDemand",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldEmbodimentDemandPredictionTest::RunTest(const FString &Parameters) {
+    // A 3x3 town (density 10) centred on (10,0); everything else is wilderness.
+    const auto DensityAt = [](const FMythicCellCoord &Cell) -> int32 {
+        return (FMath::Abs(Cell.X - 10) <= 1 && FMath::Abs(Cell.Y) <= 1) ? 10 : INDEX_NONE;
+    };
+
+    // Standing still at the origin, radius 1: 9 wilderness cells, no town in reach.
+    FMythicEmbodimentDemand Idle = UMythicLivingWorldSubsystem::PredictEmbodimentDemand(
+        DensityAt, FMythicCellCoord(0, 0), FVector2D::ZeroVector, 8.0f, 1, 2);
+    TestEqual(TEXT("Idle: no humanoid demand"), Idle.Humanoid, 0);
+    TestEqual(TEXT("Idle: 9 wild cells x 2"), Idle.Creature, 18);
+
+    // Walking +X at 1 cell/s for 10s sweeps x in [-1, 11] x y in [-1, 1] = 39 distinct cells, 9 of them town.
+    FMythicEmbodimentDemand Toward = UMythicLivingWorldSubsystem::PredictEmbodimentDemand(
+        DensityAt, FMythicCellCoord(0, 0), FVector2D(1.0f, 0.0f), 10.0f, 1, 2);
+    TestEqual(TEXT("Toward town: all 9 town cells counted once"), Toward.Humanoid, 90);
+    TestEqual(TEXT("Toward town: 30 distinct wild cells"), Toward.Creature, 60);
+
+    // Walking away never reaches the town.
+    FMythicEmbodimentDemand Away = UMythicLivingWorldSubsystem::PredictEmbodimentDemand(
+        DensityAt, FMythicCellCoord(0, 0), FVector2D(-1.0f, 0.0f), 10.0f, 1, 2);
+    TestEqual(TEXT("Away from town: no humanoid demand"), Away.Humanoid, 0);
+
+    // Fast diagonal travel must not skip cells between samples: every cell on the diagonal is swept at radius 0.
+    FMythicEmbodimentDemand Diagonal = UMythicLivingWorldSubsystem::PredictEmbodimentDemand(
+        [](const FMythicCellCoord &) { return INDEX_NONE; }, FMythicCellCoord(0, 0), FVector2D(3.0f, 3.0f), 2.0f, 0, 1);
+    TestEqual(TEXT("Diagonal 6-cell run sweeps 7 cells"), Diagonal.Creature, 7);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 //  WORLD SIM THREAD TESTS (via friend declaration)
 // ═══════════════════════════════════════════════════════════════
@@ -4227,6 +5598,265 @@ bool FLivingWorldSimDiplomacyTest::RunTest(const FString &Parameters) {
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSimPhaseGraphDeterminismTest,
+    "Mythic.LivingWorld.Phase2.WorldSimThread.PhaseGraphDeterminism",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSimPhaseGraphDeterminismTest::RunTest(const FString &Parameters) {
+    using W = FMythicWorldSimThread;
+    using namespace EMythicSimResource;
+
+    // ── Conflict rule: read/read commutes; any write against a read or write orders the pair ──
+    TestFalse(TEXT("read/read commutes"), W::DoSimPhasesConflict(FactionEconomy, 0, FactionEconomy, 0));
+    TestTrue(TEXT("write/read orders"), W::DoSimPhasesConflict(0, FactionEconomy, FactionEconomy, 0));
+    TestTrue(TEXT("read/write orders"), W::DoSimPhasesConflict(FactionEconomy, 0, 0, FactionEconomy));
+    TestTrue(TEXT("write/write orders"), W::DoSimPhasesConflict(0, TerritoryWrite, 0, TerritoryWrite));
+    TestFalse(TEXT("disjoint writes commute"), W::DoSimPhasesConflict(0, TerritoryWrite, FactionIdeology, FactionEconomy));
+
+    // ── Phase streams: a (seed, tick, phase) triple always replays; a different tick or phase draws a different one ──
+    TestEqual(TEXT("same seed/tick/phase replays"), W::MakeSimPhaseRandom(7, 3, 1).GetInitialSeed(),
+              W::MakeSimPhaseRandom(7, 3, 1).GetInitialSeed());
+    TestNotEqual(TEXT("next tick reseeds"), W::MakeSimPhaseRandom(7, 3, 1).GetInitialSeed(),
+                 W::MakeSimPhaseRandom(7, 4, 1).GetInitialSeed());
+    TestNotEqual(TEXT("phases draw apart"), W::MakeSimPhaseRandom(7, 3, 1).GetInitialSeed(),
+                 W::MakeSimPhaseRandom(7, 3, 2).GetInitialSeed());
+
+    // ── Two identical worlds: one ticked back to back, one through the parallel phase graph ──
+    struct FWorld {
+        UMythicCausalFabric *Fabric = nullptr;
+        UMythicFactionDatabase *DB = nullptr;
+        UMythicTerritoryGrid *Grid = nullptr;
+        UMythicLivingWorldSettings *Settings = nullptr;
+        UMythicSchemeEngine *Schemes = nullptr;
+    };
+    // Both worlds roll dice: faction 0 holds a disconnected outpost (geographic schism → mutated splinter ideology)
+    // and two hostile pairs generate, progress and discover schemes every tick.
+    auto MakeWorld = [](bool bParallel) {
+        FWorld World;
+        World.Fabric = NewObject<UMythicCausalFabric>();
+        World.Fabric->Initialize(256);
+        World.DB = NewObject<UMythicFactionDatabase>();
+        World.DB->Initialize(LivingWorldTestHelpers::CreateFactionSettings(20, 4));
+        World.DB->SetRelationship(LivingWorldTestHelpers::MakeFactionId(0), LivingWorldTestHelpers::MakeFactionId(1),
+                                  EMythicFactionRelation::Hostile);
+        World.DB->SetRelationship(LivingWorldTestHelpers::MakeFactionId(2), LivingWorldTestHelpers::MakeFactionId(3),
+                                  EMythicFactionRelation::Hostile);
+        World.Grid = NewObject<UMythicTerritoryGrid>();
+        World.Grid->Initialize(LivingWorldTestHelpers::CreateGridSettings());
+        for (int32 f = 0; f < 4; ++f) {
+            World.Grid->SetCellInfluence(FMythicCellCoord(2 + f * 3, 2 + f * 3), LivingWorldTestHelpers::MakeFactionId(f), 1.0f);
+        }
+        World.Grid->SetCellInfluence(FMythicCellCoord(13, 2), LivingWorldTestHelpers::MakeFactionId(0), 1.0f);
+        World.Settings = LivingWorldTestHelpers::CreateLivingWorldSettings();
+        World.Settings->bParallelSimPhases = bParallel;
+        World.Settings->MinSchismSize = 2;
+        World.Settings->MinSchismPopulation = 10;
+        World.Settings->SchismIdeologyMutation = 0.3f;
+        World.Settings->SchemeGenerationTickInterval = 1;
+        World.Settings->SchemeBaseProbability = 0.5f;
+        World.Schemes = NewObject<UMythicSchemeEngine>();
+        World.Schemes->Initialize(World.DB, World.Fabric, World.Grid, World.Settings);
+        return World;
+    };
+
+    FWorld Serial = MakeWorld(false);
+    FWorld Parallel = MakeWorld(true);
+
+    FCriticalSection SerialLock;
+    FCriticalSection ParallelLock;
+    W SerialSim;
+    W ParallelSim;
+    SerialSim.Setup(Serial.Fabric, Serial.DB, Serial.Grid, nullptr, Serial.Settings, 1.0f, &SerialLock, Serial.Schemes);
+    ParallelSim.Setup(Parallel.Fabric, Parallel.DB, Parallel.Grid, nullptr, Parallel.Settings, 1.0f, &ParallelLock,
+                      Parallel.Schemes);
+
+    // The grid-only propagation waits on nothing; its census must wait on it (and on nothing that commutes with it).
+    const int32 PropagationIdx = SerialSim.SimPhases.IndexOfByPredicate([](const W::FSimPhase &P) {
+        return FCString::Strcmp(P.Name, TEXT("TerritoryPropagation")) == 0;
+    });
+    const int32 CensusIdx = SerialSim.SimPhases.IndexOfByPredicate([](const W::FSimPhase &P) {
+        return FCString::Strcmp(P.Name, TEXT("TerritoryCensus")) == 0;
+    });
+    if (TestTrue(TEXT("phase table has the territory phases"), PropagationIdx != INDEX_NONE && CensusIdx != INDEX_NONE)) {
+        TestEqual(TEXT("propagation is independent of the economy chain"), SerialSim.SimPhasePrerequisites[PropagationIdx].Num(), 0);
+        TestTrue(TEXT("census waits on propagation"), SerialSim.SimPhasePrerequisites[CensusIdx].Contains(PropagationIdx));
+    }
+
+    for (int32 Tick = 0; Tick < 5; ++Tick) {
+        SerialSim.SimTick();
+        ParallelSim.SimTick();
+    }
+
+    TestEqual(TEXT("same faction count"), Serial.DB->GetRegisteredCount(), Parallel.DB->GetRegisteredCount());
+    for (int32 i = 0; i < Serial.DB->GetRegisteredCount(); ++i) {
+        FMythicFactionData A;
+        FMythicFactionData B;
+        Serial.DB->GetFaction(LivingWorldTestHelpers::MakeFactionId(i), A);
+        Parallel.DB->GetFaction(LivingWorldTestHelpers::MakeFactionId(i), B);
+        TestEqual(*FString::Printf(TEXT("faction %d population"), i), A.Population, B.Population);
+        TestEqual(*FString::Printf(TEXT("faction %d cells"), i), A.ControlledCellCount, B.ControlledCellCount);
+        TestEqual(*FString::Printf(TEXT("faction %d food"), i), A.Reserves.Food, B.Reserves.Food);
+        for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
+            const EMythicMoralAxis AxisEnum = static_cast<EMythicMoralAxis>(Axis);
+            TestEqual(*FString::Printf(TEXT("faction %d ideology axis %d"), i, Axis),
+                      A.Ideology.GetAxis(AxisEnum), B.Ideology.GetAxis(AxisEnum));
+        }
+        for (int32 j = 0; j < Serial.DB->GetRegisteredCount(); ++j) {
+            TestEqual(*FString::Printf(TEXT("relation %d-%d"), i, j),
+                      Serial.DB->GetRelationship(LivingWorldTestHelpers::MakeFactionId(i), LivingWorldTestHelpers::MakeFactionId(j)),
+                      Parallel.DB->GetRelationship(LivingWorldTestHelpers::MakeFactionId(i), LivingWorldTestHelpers::MakeFactionId(j)));
+        }
+    }
+    TestEqual(TEXT("same number of fabric events"), (int32)Serial.Fabric->GetTotalEventCount(), (int32)Parallel.Fabric->GetTotalEventCount());
+
+    // FactionEvolution and Schemes outcomes: same seed → same splinters and the same schemes, roll for roll.
+    TestTrue(TEXT("the outpost split off a splinter faction"), Serial.DB->GetRegisteredCount() > 4);
+    const TArray<FMythicScheme> SerialSchemes = Serial.Schemes->GetActiveSchemes();
+    const TArray<FMythicScheme> ParallelSchemes = Parallel.Schemes->GetActiveSchemes();
+    TestTrue(TEXT("schemes were generated"), SerialSchemes.Num() > 0);
+    if (TestEqual(TEXT("same active scheme count"), SerialSchemes.Num(), ParallelSchemes.Num())) {
+        for (int32 i = 0; i < SerialSchemes.Num(); ++i) {
+            const FMythicScheme &A = SerialSchemes[i];
+            const FMythicScheme &B = ParallelSchemes[i];
+            TestEqual(*FString::Printf(TEXT("scheme %d id"), i), A.SchemeId, B.SchemeId);
+            TestTrue(*FString::Printf(TEXT("scheme %d type"), i), A.Type == B.Type);
+            TestTrue(*FString::Printf(TEXT("scheme %d factions"), i),
+                     A.OriginFaction == B.OriginFaction && A.TargetFaction == B.TargetFaction);
+            TestTrue(*FString::Printf(TEXT("scheme %d state"), i), A.State == B.State);
+            TestEqual(*FString::Printf(TEXT("scheme %d progress"), i), A.Progress, B.Progress);
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSimEventDigestTest,
+    "Mythic.LivingWorld.Phase2.WorldSimThread.EventDigest",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSimEventDigestTest::RunTest(const FString &Parameters) {
+    using W = FMythicWorldSimThread;
+
+    TestEqual(TEXT("combat hurts by full significance"), W::DiplomacyEventContribution(EMythicEventCategory::Combat, 0.8f), -0.8f);
+    TestEqual(TEXT("trade helps by half significance"), W::DiplomacyEventContribution(EMythicEventCategory::Trade, 0.8f), 0.4f);
+
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(64);
+    auto *DB = NewObject<UMythicFactionDatabase>();
+    DB->Initialize(LivingWorldTestHelpers::CreateFactionSettings(20, 3));
+    auto *Grid = NewObject<UMythicTerritoryGrid>();
+    Grid->Initialize(LivingWorldTestHelpers::CreateGridSettings());
+    auto *Settings = LivingWorldTestHelpers::CreateLivingWorldSettings();
+    Settings->DiplomacyEventScanCap = 2;
+    Settings->DriftMinSignificance = 0.0f;
+
+    // Three combat events 0→1 (only the newest two fit the per-pair cap), one trade event 2→0.
+    const double Now = FPlatformTime::Seconds();
+    auto Append = [&](uint8 P, uint8 S, uint16 Category, float Significance) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = Now - 1.0;
+        Event.PrimaryFaction = LivingWorldTestHelpers::MakeFactionId(P);
+        Event.SecondaryFaction = LivingWorldTestHelpers::MakeFactionId(S);
+        Event.CategoryFlags = Category;
+        Event.Significance = Significance;
+        Event.MoralVector.AxisValues[0] = 1.0f;
+        Fabric->AppendEvent(Event);
+    };
+    Append(0, 1, EMythicEventCategory::Combat, 0.5f);
+    Append(1, 0, EMythicEventCategory::Combat, 0.5f);
+    Append(0, 1, EMythicEventCategory::Combat, 0.5f);
+    Append(2, 0, EMythicEventCategory::Trade, 1.0f);
+    Fabric->CommitWrites();
+
+    W SimThread;
+    FCriticalSection SimLock;
+    SimThread.Setup(Fabric, DB, Grid, nullptr, Settings, 1.0f, &SimLock);
+    SimThread.TickEventDigest();
+
+    const int32 MaxF = DB->GetMaxFactions();
+    TestEqual(TEXT("pair 0-1 capped at two events"), SimThread.EventDigest.PairCount[0 * MaxF + 1], 2);
+    TestEqual(TEXT("pair 0-1 score sums the two newest"), SimThread.EventDigest.PairScore[0 * MaxF + 1], -1.0f);
+    TestEqual(TEXT("pair 0-2 is symmetric (stored low-high)"), SimThread.EventDigest.PairScore[0 * MaxF + 2], 0.5f);
+    TestEqual(TEXT("pair 1-2 untouched"), SimThread.EventDigest.PairCount[1 * MaxF + 2], 0);
+
+    TestEqual(TEXT("faction 0 primary events tallied for culture"), SimThread.EventDigest.CultureTotal[0], 2);
+    TestEqual(TEXT("faction 0 culture is all combat"), SimThread.EventDigest.CultureCombat[0], 2);
+    TestEqual(TEXT("faction 0 involved in every event (ideology)"), SimThread.EventDigest.IdeologyCount[0],
+              FMath::Min(4, Settings->IdeologyEventScanCap));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSimEventDigestScanCapTest,
+    "Mythic.LivingWorld.Phase2.WorldSimThread.EventDigestScanCap",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSimEventDigestScanCapTest::RunTest(const FString &Parameters) {
+    using W = FMythicWorldSimThread;
+
+    auto *Fabric = NewObject<UMythicCausalFabric>();
+    Fabric->Initialize(256);
+    auto *DB = NewObject<UMythicFactionDatabase>();
+    DB->Initialize(LivingWorldTestHelpers::CreateFactionSettings(20, 3));
+    auto *Grid = NewObject<UMythicTerritoryGrid>();
+    Grid->Initialize(LivingWorldTestHelpers::CreateGridSettings());
+    auto *Settings = LivingWorldTestHelpers::CreateLivingWorldSettings();
+    Settings->SimEventDigestScanCap = 64;
+    Settings->DriftMinSignificance = 0.0f;
+
+    // Oldest first: 20 combat events of faction 0, then 36 combat + 64 trade events of faction 1. The digest's scan
+    // sees only faction 1's newest 64 (all trade).
+    const double Now = FPlatformTime::Seconds();
+    auto Append = [&](uint8 P, uint16 Category) {
+        FMythicWorldEvent Event;
+        Event.WorldTime = Now - 1.0;
+        Event.PrimaryFaction = LivingWorldTestHelpers::MakeFactionId(P);
+        Event.CategoryFlags = Category;
+        Event.Significance = 1.0f;
+        Fabric->AppendEvent(Event);
+    };
+    for (int32 i = 0; i < 20; ++i) {
+        Append(0, EMythicEventCategory::Combat);
+    }
+    for (int32 i = 0; i < 36; ++i) {
+        Append(1, EMythicEventCategory::Combat);
+    }
+    for (int32 i = 0; i < 64; ++i) {
+        Append(1, EMythicEventCategory::Trade);
+    }
+    Fabric->CommitWrites();
+
+    W SimThread;
+    FCriticalSection SimLock;
+    SimThread.Setup(Fabric, DB, Grid, nullptr, Settings, 1.0f, &SimLock);
+    SimThread.TickEventDigest();
+
+    // The windowed consumers stop at the scan cap: faction 0's events are older than the newest 64.
+    TestEqual(TEXT("ideology misses events past the scan cap"), SimThread.EventDigest.IdeologyCount[0], 0);
+    TestEqual(TEXT("divergence misses events past the scan cap"), SimThread.EventDigest.DivergenceCount[0], 0);
+    TestEqual(TEXT("divergence sees the scanned faction"), SimThread.EventDigest.DivergenceCount[1],
+              FMath::Min(64, Settings->IdeologyEventScanCap));
+
+    // The culture window does not: every faction keeps its own newest 64 primary events.
+    TestEqual(TEXT("culture reaches past the scan cap"), SimThread.EventDigest.CultureTotal[0], 20);
+    TestEqual(TEXT("culture past the cap is tallied by category"), SimThread.EventDigest.CultureCombat[0], 20);
+    TestEqual(TEXT("culture window capped at 64 events"), SimThread.EventDigest.CultureTotal[1], 64);
+    TestEqual(TEXT("culture window keeps the newest events"), SimThread.EventDigest.CultureTrade[1], 64);
+    TestEqual(TEXT("culture window drops older events"), SimThread.EventDigest.CultureCombat[1], 0);
+
+    // Raising the cap to the ring lets the windowed consumers see faction 0 again; culture is unchanged.
+    Settings->SimEventDigestScanCap = 256;
+    SimThread.TickEventDigest();
+    TestEqual(TEXT("full-ring scan reaches faction 0"), SimThread.EventDigest.DivergenceCount[0],
+              FMath::Min(20, Settings->IdeologyEventScanCap));
+    TestEqual(TEXT("culture independent of the scan cap"), SimThread.EventDigest.CultureTotal[0], 20);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 //  SOCIAL GRAPH TESTS
 // ═══════════════════════════════════════════════════════════════
@@ -4595,6 +6225,65 @@ bool FLivingWorldSocialGraphPruneSelectiveTest::RunTest(const FString &Parameter
     return true;
 }
 
+// ─── Slot storage / zero-copy visitor ────────────────────────
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FLivingWorldSocialGraphVisitEdgesTest,
+    "Mythic.LivingWorld.SocialGraph.VisitEdgesAndSlotReuse",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLivingWorldSocialGraphVisitEdgesTest::RunTest(const FString &Parameters) {
+    auto *Graph = NewObject<UMythicSocialGraph>();
+    Graph->Initialize(4, 0.05f, 0.01f);
+
+    auto MakeHandle = [](int32 Index) {
+        FMassEntityHandle H;
+        H.Index = Index;
+        H.SerialNumber = 1;
+        return H;
+    };
+    const FMassEntityHandle A = MakeHandle(1);
+    const FMassEntityHandle B = MakeHandle(2);
+    FMythicFactionId Faction = LivingWorldTestHelpers::MakeFactionId(0);
+
+    for (int32 t = 0; t < 3; ++t) {
+        Graph->AddOrStrengthenEdge(A, MakeHandle(10 + t), EMythicSocialRelation::Friend, 1.0f, 0.0, Faction);
+    }
+    Graph->AddOrStrengthenEdge(B, A, EMythicSocialRelation::Rival, 0.5f, 0.0, Faction);
+
+    // Visitor sees every outgoing edge with the decayed strength (rate 0.01 × 100s → e^-1).
+    int32 Seen = 0;
+    const int32 Visited = Graph->VisitEdges(A, 100.0, [&](const FMythicSocialEdge &Edge, float Strength) {
+        TestEqual(TEXT("visitor strength is decayed"), Strength, 0.367879f, 0.001f);
+        ++Seen;
+        return true;
+    });
+    TestEqual(TEXT("visits all of A's edges"), Visited, 3);
+    TestEqual(TEXT("visitor called once per edge"), Seen, 3);
+
+    // Returning false stops the walk.
+    const int32 Stopped = Graph->VisitEdges(A, 100.0, [](const FMythicSocialEdge &, float) { return false; });
+    TestEqual(TEXT("early stop visits one edge"), Stopped, 1);
+    TestEqual(TEXT("unknown source visits nothing"), Graph->VisitEdges(MakeHandle(99), 100.0, [](const FMythicSocialEdge &, float) { return true; }), 0);
+
+    // Emptying A frees its slot; a new source reuses it without disturbing B's block.
+    TArray<FMassEntityHandle> Severed;
+    Graph->RemoveAllEdges(A, Severed);
+    TestEqual(TEXT("A's removal takes its 3 edges and B's edge to A"), Graph->GetTotalEdgeCount(), 0);
+    TestEqual(TEXT("no entity holds a slot"), Graph->GetEntityCount(), 0);
+
+    const FMassEntityHandle C = MakeHandle(3);
+    Graph->AddOrStrengthenEdge(C, B, EMythicSocialRelation::Family, 0.9f, 100.0, Faction);
+    Graph->AddOrStrengthenEdge(B, C, EMythicSocialRelation::Family, 0.9f, 100.0, Faction);
+    FMythicSocialEdge Edge;
+    TestTrue(TEXT("C→B lives in a reused slot"), Graph->HasEdge(C, B, 100.0, Edge));
+    TestTrue(TEXT("B→C lives in a reused slot"), Graph->HasEdge(B, C, 100.0, Edge));
+    TestEqual(TEXT("two edges, two slots"), Graph->GetTotalEdgeCount(), 2);
+    TestEqual(TEXT("two sources"), Graph->GetEntityCount(), 2);
+
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════
 //  SCHEME ENGINE TESTS
 // ═══════════════════════════════════════════════════════════════
@@ -4681,11 +6370,12 @@ bool FLivingWorldSchemeEngineGenerateTest::RunTest(const FString &Parameters) {
     Engine->Initialize(FactionDB, Fabric, Grid, SchemeTestHelpers::CreateSchemeTestLivingWorldSettings());
 
     // Tick with SimDeltaTime = 0 to isolate GENERATION: TickSchemes generates AND then progresses in the same call,
-    // and ProgressScheme's detection roll (FRand() < DetectionRisk * SimDeltaTime) could otherwise flip a freshly
-    // generated scheme to Discovered on its own birth tick (~1%), making the IsActive() assertion below flaky.
+    // and ProgressScheme's detection roll (Random.FRand() < DetectionRisk * SimDeltaTime) could otherwise flip a
+    // freshly generated scheme to Discovered on its own birth tick (~1%), making the IsActive() assertion below flaky.
     // Generation is SimDeltaTime-independent (gate uses SchemeBaseProbability, not dt), so dt=0 generates normally
     // while the detection roll (× 0) can never fire — deterministic generation, no incidental same-tick discovery.
-    Engine->TickSchemes(0.0f, 0);
+    FRandomStream Rng(1);
+    Engine->TickSchemes(0.0f, 0, Rng);
 
     TestTrue(TEXT("Should have generated at least 1 scheme"), Engine->GetActiveSchemeCount() > 0);
 
@@ -4723,14 +6413,15 @@ bool FLivingWorldSchemeEngineProgressTest::RunTest(const FString &Parameters) {
 
     Engine->Initialize(FactionDB, Fabric, Grid, SchemeTestHelpers::CreateSchemeTestLivingWorldSettings());
 
-    Engine->TickSchemes(1.0f, 0);
+    FRandomStream Rng(1);
+    Engine->TickSchemes(1.0f, 0, Rng);
     TArray<FMythicScheme> Before = Engine->GetActiveSchemes();
     TestTrue(TEXT("Should have generated schemes"), Before.Num() > 0);
 
     float InitialProgress = Before.Num() > 0 ? Before[0].Progress : 0.0f;
     uint32 TrackId = Before.Num() > 0 ? Before[0].SchemeId : 0;
 
-    Engine->TickSchemes(10.0f, 1);
+    Engine->TickSchemes(10.0f, 1, Rng);
     TArray<FMythicScheme> After = Engine->GetActiveSchemes();
 
     for (const FMythicScheme &S : After) {
@@ -4766,11 +6457,12 @@ bool FLivingWorldSchemeEngineCompletionTest::RunTest(const FString &Parameters)
 
     Engine->Initialize(FactionDB, Fabric, Grid, SchemeTestHelpers::CreateSchemeTestLivingWorldSettings());
 
-    Engine->TickSchemes(1.0f, 0);
+    FRandomStream Rng(1);
+    Engine->TickSchemes(1.0f, 0, Rng);
 
     // Tick many times with large delta to force completion
     for (int32 i = 1; i < 200; ++i) {
-        Engine->TickSchemes(10.0f, static_cast<uint32>(i));
+        Engine->TickSchemes(10.0f, static_cast<uint32>(i), Rng);
     }
 
     Fabric->CommitWrites();
@@ -4801,7 +6493,8 @@ bool FLivingWorldSchemeEngineByFactionTest::RunTest(const FString &Parameters) {
     Grid->Initialize(LivingWorldTestHelpers::CreateGridSettings());
 
     Engine->Initialize(FactionDB, Fabric, Grid, SchemeTestHelpers::CreateSchemeTestLivingWorldSettings());
-    Engine->TickSchemes(1.0f, 0);
+    FRandomStream Rng(1);
+    Engine->TickSchemes(1.0f, 0, Rng);
 
     TArray<FMythicScheme> Faction0 = Engine->GetSchemesByFaction(LivingWorldTestHelpers::MakeFactionId(0));
     for (const FMythicScheme &S : Faction0) {
@@ -4839,8 +6532,9 @@ bool FLivingWorldSchemeEngineMaxPerFactionTest::RunTest(const FString &Parameter
     Settings->MaxSchemesPerFaction = 3;
     Engine->Initialize(FactionDB, Fabric, Grid, Settings);
 
+    FRandomStream Rng(1);
     for (uint32 i = 0; i < 50; ++i) {
-        Engine->TickSchemes(0.001f, i);
+        Engine->TickSchemes(0.001f, i, Rng);
     }
 
     TArray<FMythicScheme> Faction0 = Engine->GetSchemesByFaction(LivingWorldTestHelpers::MakeFactionId(0));
@@ -4892,7 +6586,8 @@ bool FLivingWorldSchemeEngineSkipsDeadTargetTest::RunTest(const FString &Paramet
 
     Engine->Initialize(FactionDB, Fabric, Grid, SchemeTestHelpers::CreateSchemeTestLivingWorldSettings());
 
-    Engine->TickSchemes(1.0f, 0);
+    FRandomStream Rng(1);
+    Engine->TickSchemes(1.0f, 0, Rng);
 
     // No scheme may target the annihilated faction.
     const TArray<FMythicScheme> Schemes = Engine->GetActiveSchemes();
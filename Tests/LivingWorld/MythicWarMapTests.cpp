@@ -7,6 +7,8 @@
 //   - WorldToNormalized (corners -> 0/1, center -> 0.5, Y-flip, OOB clamps, degenerate -> 0)
 //   - CellToNormalized (centers + Y-flip)
 //   - ResolveFactionColorForId (idx<Num override-aware; idx>=Num deterministic; matches DeterministicColorForId)
+//   - CellDirtyRect (cell ±1, clipped at grid edges; OOB -> empty)
+//   - AddDirtyRect (neighbors coalesce, distant rects stay separate, MaxRects cap merges cheapest)
 // Pure helpers only — zero engine/render/replication state.
 // Run via: Session Frontend -> Automation -> Mythic.LivingWorld.WarMap
 
@@ -305,3 +307,55 @@ bool FMythicWarMapResolveColorTest::RunTest(const FString& Parameters) {
               MythicWarMap::ResolveFactionColorForId(7, Empty));
     return true;
 }
+
+// ─────────────────────────────────────────────────────────────
+// CellDirtyRect + AddDirtyRect (incremental texture upload regions)
+// ─────────────────────────────────────────────────────────────
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMythicWarMapDirtyRectTest,
+    "Mythic.LivingWorld.WarMap.DirtyRects",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FMythicWarMapDirtyRectTest::RunTest(const FString& Parameters) {
+    // Interior cell: itself + 4-neighbors' bounding box (Max exclusive).
+    TestEqual(TEXT("interior cell -> 3x3"), MythicWarMap::CellDirtyRect(5, 5, 16, 16), FIntRect(4, 4, 7, 7));
+    // Corner cell clips to the grid.
+    TestEqual(TEXT("corner cell clipped"), MythicWarMap::CellDirtyRect(0, 0, 16, 16), FIntRect(0, 0, 2, 2));
+    TestEqual(TEXT("far corner clipped"), MythicWarMap::CellDirtyRect(15, 15, 16, 16), FIntRect(14, 14, 16, 16));
+    // Out-of-bounds / degenerate -> empty.
+    TestEqual(TEXT("OOB cell -> empty"), MythicWarMap::CellDirtyRect(16, 0, 16, 16).Area(), 0);
+    TestEqual(TEXT("degenerate grid -> empty"), MythicWarMap::CellDirtyRect(0, 0, 0, 0).Area(), 0);
+
+    // Adjacent cells coalesce into one rect covering both.
+    TArray<FIntRect> Rects;
+    MythicWarMap::AddDirtyRect(Rects, MythicWarMap::CellDirtyRect(5, 5, 64, 64), 8);
+    MythicWarMap::AddDirtyRect(Rects, MythicWarMap::CellDirtyRect(6, 5, 64, 64), 8);
+    TestEqual(TEXT("neighbors -> one rect"), Rects.Num(), 1);
+    TestEqual(TEXT("merged rect is the union"), Rects[0], FIntRect(4, 4, 8, 7));
+
+    // A distant change stays a separate (small) rect instead of bloating the first into a huge box.
+    MythicWarMap::AddDirtyRect(Rects, MythicWarMap::CellDirtyRect(50, 50, 64, 64), 8);
+    TestEqual(TEXT("distant cell -> second rect"), Rects.Num(), 2);
+
+    // Re-dirtying an already-covered cell adds nothing.
+    MythicWarMap::AddDirtyRect(Rects, MythicWarMap::CellDirtyRect(5, 5, 64, 64), 8);
+    TestEqual(TEXT("covered cell -> no new rect"), Rects.Num(), 2);
+
+    // Empty rects are ignored.
+    MythicWarMap::AddDirtyRect(Rects, FIntRect(), 8);
+    TestEqual(TEXT("empty rect ignored"), Rects.Num(), 2);
+
+    // At the cap, a new distant rect is folded into an existing one (count never exceeds MaxRects).
+    TArray<FIntRect> Capped;
+    MythicWarMap::AddDirtyRect(Capped, FIntRect(0, 0, 2, 2), 2);
+    MythicWarMap::AddDirtyRect(Capped, FIntRect(60, 60, 62, 62), 2);
+    MythicWarMap::AddDirtyRect(Capped, FIntRect(0, 60, 2, 62), 2);
+    TestEqual(TEXT("cap respected"), Capped.Num(), 2);
+    bool bCovered = false;
+    for (const FIntRect& R : Capped) {
+        bCovered |= R.Contains(FIntPoint(0, 60)) && R.Contains(FIntPoint(1, 61));
+    }
+    TestTrue(TEXT("capped rect still covers the new region"), bCovered);
+    return true;
+}
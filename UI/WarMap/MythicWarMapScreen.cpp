@@ -99,9 +99,14 @@ void UMythicWarMapScreen::NativeOnActivated() {
             BoundSubsystem = Sub;
             bBound = true;
         }
-        // Trigger a rebuild; RefreshNow broadcasts OnWarMapChanged -> HandleWarMapChanged -> PumpToBlueprint, so the WBP
-        // receives the texture + data exactly once even on first open.
-        Sub->RefreshNow();
+        // First open builds the map (RefreshNow broadcasts OnWarMapChanged -> HandleWarMapChanged -> PumpToBlueprint);
+        // afterwards the subsystem keeps it current incrementally, so a re-open just pumps. Either way the WBP receives
+        // the texture + data exactly once.
+        if (Sub->HasBuiltMap()) {
+            PumpToBlueprint();
+        } else {
+            Sub->RefreshNow();
+        }
     } else {
         // Subsystem not reachable yet (early activation). The WBP can call RefreshFromSubsystem later, and once a proxy
         // change arrives the next activation will bind. Nothing to pump now.
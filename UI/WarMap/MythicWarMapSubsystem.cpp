@@ -1,5 +1,6 @@
 // Mythic Living World — War-Map Texture Subsystem (implementation)
-// Client-only. Reads replicated proxies + client-loaded settings; builds a per-cell BGRA8 texture event-driven.
+// Client-only. Reads replicated proxies + client-loaded settings; builds a per-cell BGRA8 texture event-driven, then
+// keeps it current with budgeted dirty-rect region uploads.
 
 #include "MythicWarMapSubsystem.h"
 
@@ -10,6 +11,7 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "TextureResource.h"
+#include "RenderUtils.h" // FUpdateTextureRegion2D
 
 #include "World/LivingWorld/LivingWorldSubsystem.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
@@ -23,19 +25,29 @@
 void UMythicWarMapSubsystem::Initialize(FSubsystemCollectionBase& Collection) {
     Super::Initialize(Collection);
     // Grid + texture are resolved lazily on first use (the living-world subsystem / replicator may not exist yet at
-    // local-player-subsystem init). Bind to the proxy-change delegate the first time we can reach the subsystem.
+    // local-player-subsystem init). Bind to the proxy-change delegates the first time we can reach the subsystem.
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMythicWarMapSubsystem::Tick), 0.0f);
 }
 
 void UMythicWarMapSubsystem::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
     if (bBoundToProxies) {
         if (UMythicLivingWorldSubsystem* LWS = GetLivingWorld()) {
             LWS->OnLivingWorldProxiesChanged.RemoveAll(this);
+            LWS->OnTerritoryProxyCellChanged.Remove(TerritoryCellChangedHandle);
         }
+        TerritoryCellChangedHandle.Reset();
         bBoundToProxies = false;
     }
     WarMapTexture = nullptr;
     PixelBuffer.Empty();
     DominantByCell.Empty();
+    CellCountByFaction.Empty();
+    DirtyRects.Empty();
     CachedInitialFactions.Empty();
     Super::Deinitialize();
 }
@@ -66,6 +78,8 @@ bool UMythicWarMapSubsystem::EnsureGridResolved() {
     // Bind to proxy changes the first time we can reach the subsystem (idempotent).
     if (!bBoundToProxies) {
         LWS->OnLivingWorldProxiesChanged.AddDynamic(this, &UMythicWarMapSubsystem::HandleProxiesChanged);
+        TerritoryCellChangedHandle = LWS->OnTerritoryProxyCellChanged.AddUObject(
+            this, &UMythicWarMapSubsystem::HandleTerritoryCellChanged);
         bBoundToProxies = true;
     }
 
@@ -100,6 +114,10 @@ bool UMythicWarMapSubsystem::EnsureGridResolved() {
     const int32 Count = GridW * GridH;
     DominantByCell.Init(0xFF, Count);
     PixelBuffer.Init(Style.UnclaimedColor, Count);
+    CellCountByFaction.Init(0, 256);
+    ClaimedCellCount = 0;
+    // Proxies that replicated before we could bind were never seen cell-by-cell — the first pass reads them all.
+    bNeedsFullRebuild = true;
 
     return true;
 }
@@ -125,7 +143,8 @@ void UMythicWarMapSubsystem::EnsureTexture() {
     WarMapTexture->Filter = TextureFilter::TF_Nearest; // crisp per-cell blocks
     WarMapTexture->NeverStream = true;
     // No AddToRoot needed — WarMapTexture is a UPROPERTY(Transient) on this subsystem, so it is GC-reachable.
-    WarMapTexture->UpdateResource();
+    // Seed mip 0 from the current pixels (region updates made before the texture existed only touched PixelBuffer).
+    UploadTexture();
 }
 
 void UMythicWarMapSubsystem::UploadTexture() {
@@ -148,26 +167,59 @@ void UMythicWarMapSubsystem::UploadTexture() {
     WarMapTexture->UpdateResource();
 }
 
+void UMythicWarMapSubsystem::UploadRegion(const FIntRect& Rect) {
+    if (!WarMapTexture || PixelBuffer.Num() != GridW * GridH || Rect.Area() <= 0) {
+        return;
+    }
+    const int32 RectW = Rect.Width();
+    const int32 RectH = Rect.Height();
+    const int32 RowBytes = RectW * sizeof(FColor);
+
+    // Packed copy of the rect for the render thread (PixelBuffer keeps changing under it); freed by the cleanup callback.
+    uint8* Packed = static_cast<uint8*>(FMemory::Malloc(RowBytes * RectH));
+    for (int32 Row = 0; Row < RectH; ++Row) {
+        const int32 Src = MythicWarMap::CoordToTexelIndex(Rect.Min.X, Rect.Min.Y + Row, GridW);
+        FMemory::Memcpy(Packed + Row * RowBytes, &PixelBuffer[Src], RowBytes);
+    }
+
+    // Keep the CPU mip in step so a later full UpdateResource (or a resource re-create) doesn't resurrect stale texels.
+    if (FTexturePlatformData* PlatformData = WarMapTexture->GetPlatformData()) {
+        if (PlatformData->Mips.Num() > 0) {
+            FTexture2DMipMap& Mip = PlatformData->Mips[0];
+            if (FColor* Dest = static_cast<FColor*>(Mip.BulkData.Lock(LOCK_READ_WRITE))) {
+                for (int32 Row = 0; Row < RectH; ++Row) {
+                    FMemory::Memcpy(&Dest[MythicWarMap::CoordToTexelIndex(Rect.Min.X, Rect.Min.Y + Row, GridW)],
+                                    Packed + Row * RowBytes, RowBytes);
+                }
+            }
+            Mip.BulkData.Unlock();
+        }
+    }
+
+    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(Rect.Min.X, Rect.Min.Y, 0, 0, RectW, RectH);
+    WarMapTexture->UpdateTextureRegions(0, 1, Region, RowBytes, sizeof(FColor), Packed,
+                                        [](uint8* SrcData, const FUpdateTextureRegion2D* Regions) {
+                                            FMemory::Free(SrcData);
+                                            delete Regions;
+                                        });
+}
+
 UTexture2D* UMythicWarMapSubsystem::GetWarMapTexture() {
     if (!EnsureGridResolved()) {
         return nullptr;
     }
     EnsureTexture();
-    if (PixelBuffer.Num() != GridW * GridH) {
-        // First access before any refresh — build once so the texture isn't blank garbage.
+    if (bNeedsFullRebuild || PixelBuffer.Num() != GridW * GridH) {
+        // First access before any refresh — build once now rather than waiting for the next pass.
         RefreshNow();
     }
     return WarMapTexture;
 }
 
 // ─────────────────────────────────────────────────────────────
-// Refresh — accumulate deltas, rebuild pixels, upload, broadcast
+// Full refresh — accumulate every proxy, rebuild all pixels, upload, broadcast
 // ─────────────────────────────────────────────────────────────
 
-void UMythicWarMapSubsystem::HandleProxiesChanged() {
-    RefreshNow();
-}
-
 void UMythicWarMapSubsystem::RefreshNow() {
     if (!EnsureGridResolved()) {
         return;
@@ -198,8 +250,25 @@ void UMythicWarMapSubsystem::RefreshNow() {
         DominantByCell[MythicWarMap::CoordToTexelIndex(X, Y, GridW)] = Item.ControllingFaction.Index;
     }
 
-    const FMythicWarMapStyle PODStyle = Style.ToPOD();
+    // 2) Re-tally the legend counts from the accumulator (incremental from here on).
+    CellCountByFaction.Init(0, 256);
+    ClaimedCellCount = 0;
+    for (const uint8 Idx : DominantByCell) {
+        RecountCell(0xFF, Idx);
+    }
 
+    // 3) Every texel, then one full upload. Pending dirty rects are subsumed.
+    RepaintRegion(FIntRect(0, 0, GridW, GridH), Style.ToPOD());
+    DirtyRects.Reset();
+    bNeedsFullRebuild = false;
+    bMapDataDirty = false;
+    UploadTexture();
+
+    RefreshDiagnostics();
+    OnWarMapChanged.Broadcast();
+}
+
+void UMythicWarMapSubsystem::RepaintRegion(const FIntRect& Rect, const FMythicWarMapStyle& PODStyle) {
     // Neighbor lookup seam for the border pass (reads the accumulator directly).
     auto FactionAt = [this](int32 X, int32 Y) -> uint8 {
         return DominantByCell[MythicWarMap::CoordToTexelIndex(X, Y, GridW)];
@@ -208,9 +277,9 @@ void UMythicWarMapSubsystem::RefreshNow() {
         return ResolveColor(Idx);
     };
 
-    // 2) Base fill, then border darken on claimed border texels.
-    for (int32 Y = 0; Y < GridH; ++Y) {
-        for (int32 X = 0; X < GridW; ++X) {
+    // Base fill, then border darken on claimed border texels.
+    for (int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y) {
+        for (int32 X = Rect.Min.X; X < Rect.Max.X; ++X) {
             const int32 Idx = MythicWarMap::CoordToTexelIndex(X, Y, GridW);
 
             FMythicWarMapCell Cell;
@@ -227,28 +296,109 @@ void UMythicWarMapSubsystem::RefreshNow() {
             PixelBuffer[Idx] = Px;
         }
     }
+}
 
-    UploadTexture();
-
+void UMythicWarMapSubsystem::RefreshDiagnostics() {
     // Cache marker/legend counts for the debugger (cheap recompute).
-    {
-        TArray<FMythicWarMapMarker> Markers;
-        GetMarkers(Markers);
-        LastSettlementMarkerCount = 0;
-        LastEncounterMarkerCount = 0;
-        for (const FMythicWarMapMarker& M : Markers) {
-            if (M.Kind == EMythicWarMapMarkerKind::Encounter) {
-                ++LastEncounterMarkerCount;
-            } else {
-                ++LastSettlementMarkerCount; // Settlement + Capital
-            }
+    TArray<FMythicWarMapMarker> Markers;
+    GetMarkers(Markers);
+    LastSettlementMarkerCount = 0;
+    LastEncounterMarkerCount = 0;
+    for (const FMythicWarMapMarker& M : Markers) {
+        if (M.Kind == EMythicWarMapMarkerKind::Encounter) {
+            ++LastEncounterMarkerCount;
+        } else {
+            ++LastSettlementMarkerCount; // Settlement + Capital
         }
-        TArray<FMythicWarMapLegendEntry> Legend;
-        GetLegendEntries(Legend);
-        LastLegendEntryCount = Legend.Num();
     }
+    TArray<FMythicWarMapLegendEntry> Legend;
+    GetLegendEntries(Legend);
+    LastLegendEntryCount = Legend.Num();
+}
 
-    OnWarMapChanged.Broadcast();
+// ─────────────────────────────────────────────────────────────
+// Incremental path — per-cell deltas, dirty rects, budgeted upload
+// ─────────────────────────────────────────────────────────────
+
+void UMythicWarMapSubsystem::HandleProxiesChanged() {
+    // Markers (settlements / encounters) and the legend are read on demand; just owe the UI one refresh.
+    bMapDataDirty = true;
+}
+
+void UMythicWarMapSubsystem::HandleTerritoryCellChanged(const FMythicTerritoryProxyItem& Item) {
+    if (bNeedsFullRebuild || GridW <= 0 || GridH <= 0 || DominantByCell.Num() != GridW * GridH) {
+        return; // the pending full rebuild reads every proxy, this one included
+    }
+    const int32 X = Item.Cell.X;
+    const int32 Y = Item.Cell.Y;
+    if (X < 0 || X >= GridW || Y < 0 || Y >= GridH) {
+        return;
+    }
+    const int32 Idx = MythicWarMap::CoordToTexelIndex(X, Y, GridW);
+    const uint8 NewFaction = Item.ControllingFaction.Index;
+    const uint8 OldFaction = DominantByCell[Idx];
+    if (OldFaction == NewFaction) {
+        return; // contested-level-only change: nothing on the map moves
+    }
+
+    DominantByCell[Idx] = NewFaction;
+    RecountCell(OldFaction, NewFaction);
+    MythicWarMap::AddDirtyRect(DirtyRects, MythicWarMap::CellDirtyRect(X, Y, GridW, GridH), MaxDirtyRects);
+    bMapDataDirty = true;
+}
+
+void UMythicWarMapSubsystem::RecountCell(uint8 OldFaction, uint8 NewFaction) {
+    if (OldFaction != 0xFF) {
+        --CellCountByFaction[OldFaction];
+        --ClaimedCellCount;
+    }
+    if (NewFaction != 0xFF) {
+        ++CellCountByFaction[NewFaction];
+        ++ClaimedCellCount;
+    }
+}
+
+int32 UMythicWarMapSubsystem::FlushDirtyRects(int32 TexelBudget) {
+    const FMythicWarMapStyle PODStyle = Style.ToPOD();
+    int32 Uploaded = 0;
+    while (!DirtyRects.IsEmpty() && Uploaded < TexelBudget) {
+        FIntRect Rect = DirtyRects.Pop(EAllowShrinking::No);
+
+        // Over budget: take whole rows that fit (at least one, so progress is guaranteed), requeue the remainder.
+        const int32 RowsThatFit = FMath::Max(1, (TexelBudget - Uploaded) / Rect.Width());
+        if (RowsThatFit < Rect.Height()) {
+            DirtyRects.Add(FIntRect(Rect.Min.X, Rect.Min.Y + RowsThatFit, Rect.Max.X, Rect.Max.Y));
+            Rect.Max.Y = Rect.Min.Y + RowsThatFit;
+        }
+
+        // Repainted at upload time from the live accumulator, so repeated flips inside a rect cost one repaint.
+        RepaintRegion(Rect, PODStyle);
+        UploadRegion(Rect);
+        Uploaded += Rect.Area();
+    }
+    return Uploaded;
+}
+
+bool UMythicWarMapSubsystem::Tick(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicWarMap_Tick);
+
+    if (GridW <= 0 || GridH <= 0) {
+        return true; // nothing resolved yet (no screen has asked for the map)
+    }
+    if (bNeedsFullRebuild) {
+        RefreshNow();
+        return true;
+    }
+
+    LastUploadedTexelCount = DirtyRects.IsEmpty() ? 0 : FlushDirtyRects(FMath::Max(1, MaxTexelsUploadedPerFrame));
+
+    // One UI refresh per drained burst, not one per replicated proxy.
+    if (bMapDataDirty && DirtyRects.IsEmpty()) {
+        bMapDataDirty = false;
+        RefreshDiagnostics();
+        OnWarMapChanged.Broadcast();
+    }
+    return true;
 }
 
 // ─────────────────────────────────────────────────────────────
@@ -257,26 +407,22 @@ void UMythicWarMapSubsystem::RefreshNow() {
 
 void UMythicWarMapSubsystem::GetLegendEntries(TArray<FMythicWarMapLegendEntry>& Out) const {
     Out.Reset();
-    if (GridW <= 0 || GridH <= 0 || DominantByCell.Num() != GridW * GridH) {
+    if (GridW <= 0 || GridH <= 0 || CellCountByFaction.Num() != 256) {
         return;
     }
 
-    // Tally controlled cells per faction index from the client accumulator.
-    TMap<uint8, int32> CountByIndex;
-    for (const uint8 Idx : DominantByCell) {
-        if (Idx != 0xFF) {
-            CountByIndex.FindOrAdd(Idx)++;
+    // Controlled cells per faction index, maintained incrementally alongside the accumulator (0xFF = unclaimed).
+    for (int32 Idx = 0; Idx < 0xFF; ++Idx) {
+        const int32 Count = CellCountByFaction[Idx];
+        if (Count <= 0) {
+            continue;
         }
-    }
-
-    Out.Reserve(CountByIndex.Num());
-    for (const TPair<uint8, int32>& Pair : CountByIndex) {
         FMythicWarMapLegendEntry Entry;
-        Entry.FactionId.Index = Pair.Key;
-        Entry.Color = ResolveColor(Pair.Key);
-        Entry.ControlledCellCount = Pair.Value;
-        if (static_cast<int32>(Pair.Key) < CachedInitialFactions.Num()) {
-            Entry.DisplayName = CachedInitialFactions[Pair.Key].DisplayName;
+        Entry.FactionId.Index = static_cast<uint8>(Idx);
+        Entry.Color = ResolveColor(static_cast<uint8>(Idx));
+        Entry.ControlledCellCount = Count;
+        if (Idx < CachedInitialFactions.Num()) {
+            Entry.DisplayName = CachedInitialFactions[Idx].DisplayName;
         }
         Out.Add(Entry);
     }
@@ -345,11 +491,5 @@ FVector2D UMythicWarMapSubsystem::CellToUV(FMythicCellCoord Cell) const {
 }
 
 int32 UMythicWarMapSubsystem::GetAccumulatedClaimedCellCount() const {
-    int32 N = 0;
-    for (const uint8 Idx : DominantByCell) {
-        if (Idx != 0xFF) {
-            ++N;
-        }
-    }
-    return N;
+    return ClaimedCellCount;
 }
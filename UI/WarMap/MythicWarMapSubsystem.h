@@ -2,8 +2,8 @@
 // Builds the strategic war-map UTexture2D from the REPLICATED living-world proxies and exposes a map-data API (texture,
 // legend, markers, player marker, cell->UV). One ULocalPlayerSubsystem per local player (the texture is per-player GPU
 // state). NOTHING here is replicated: the subsystem reads the already-replicated territory/faction/settlement/encounter
-// proxies + the client-loaded settings assets, and rebuilds the texture EVENT-DRIVEN off the subsystem's
-// OnLivingWorldProxiesChanged delegate (never per-frame).
+// proxies + the client-loaded settings assets, and updates the texture EVENT-DRIVEN: each replicated territory cell marks
+// a dirty rect, and a core-ticker pass repaints + uploads only those regions under a per-frame texel budget.
 //
 // Territory proxies are DELTA-only (the server sends a cell once when its dominant faction flips), so the subsystem
 // keeps a persistent DominantByCell accumulator that fills in over time as deltas arrive — a mid-game-joined client
@@ -13,12 +13,14 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Containers/Ticker.h"
 #include "World/LivingWorld/Factions/FactionDatabase.h" // FMythicFactionData (cached InitialFactions copy)
 #include "MythicWarMapTypes.h"
 #include "MythicWarMapSubsystem.generated.h"
 
 class UTexture2D;
 class UMythicLivingWorldSubsystem;
+struct FMythicTerritoryProxyItem;
 
 /** Fired (client-side) after the war-map texture + map data are rebuilt. The screen binds this to refresh. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMythicOnWarMapChanged);
@@ -26,8 +28,14 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMythicOnWarMapChanged);
 /**
  * Per-local-player client subsystem that owns the war-map texture and map-data API. Lazily initializes its grid
  * dimensions / origin / cell size from the territory settings the first time it needs them (client-loaded, not
- * replicated). Binds to the living-world subsystem's proxy-change delegate so the texture is rebuilt exactly when the
- * replicated territory/faction state changes.
+ * replicated).
+ *
+ * Updates are incremental. A full GridW×GridH rebuild + upload (4 MB at 1024², per territory change) now happens only on
+ * first build or an explicit RefreshNow. Otherwise each replicated territory cell (OnTerritoryProxyCellChanged) updates
+ * the accumulator + per-faction legend counts in O(1) and folds its cell ±1 (its own texel + the neighbors whose border
+ * darkening it drives) into a small coalesced dirty-rect set. A core-ticker pass repaints and uploads just those rects
+ * through UpdateTextureRegions, at most MaxTexelsUploadedPerFrame texels per frame; a rect over budget is split by rows
+ * and the rest waits a frame. OnWarMapChanged fires once the set drains (so a burst of deltas is one UI refresh).
  */
 UCLASS()
 class MYTHIC_API UMythicWarMapSubsystem : public ULocalPlayerSubsystem {
@@ -40,7 +48,7 @@ public:
 
     // ─── Change delegate ──────────────────────────────────
 
-    /** Fired after the texture + map data are rebuilt (RefreshNow / a proxy-change). UI binds this. */
+    /** Fired after the texture + map data are refreshed (RefreshNow / once queued proxy changes are uploaded). UI binds this. */
     UPROPERTY(BlueprintAssignable, Category = "War Map")
     FMythicOnWarMapChanged OnWarMapChanged;
 
@@ -73,11 +81,15 @@ public:
     UFUNCTION(BlueprintPure, Category = "War Map")
     FMythicWarMapMarker GetPlayerMarker() const;
 
-    /** Rebuild the texture + accumulators from the current replicated proxies, then broadcast OnWarMapChanged. Bound
-     *  to the living-world subsystem's OnLivingWorldProxiesChanged. Safe to call manually (e.g. on screen open). */
+    /** FULL rebuild of the texture + accumulators from every current replicated proxy (drops any pending dirty rects),
+     *  then broadcast OnWarMapChanged. Runs automatically once the grid resolves; live changes go through the dirty-rect
+     *  path instead. Safe to call manually (e.g. after changing Style). */
     UFUNCTION(BlueprintCallable, Category = "War Map")
     void RefreshNow();
 
+    /** True once the first full build has run (later changes arrive incrementally, so the map is current). */
+    bool HasBuiltMap() const { return GridW > 0 && GridH > 0 && !bNeedsFullRebuild; }
+
     /** Cell coord -> UMG-normalized [0,1]^2 (Y flipped). Thin wrapper over MythicWarMap::CellToNormalized for widget
      *  marker placement / minimap pins. */
     UFUNCTION(BlueprintPure, Category = "War Map")
@@ -87,6 +99,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Map")
     FMythicWarMapStyleBP Style;
 
+    /** Texel budget for incremental (dirty-rect) uploads per frame. Work past it is carried to the next frame. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Map", meta = (ClampMin = "1"))
+    int32 MaxTexelsUploadedPerFrame = 65536;
+
     // ─── Debugger read accessors (server has no war-map; this is the client view) ───
 
     /** Number of cells currently marked claimed in the accumulator (for the gameplay debugger). */
@@ -97,6 +113,10 @@ public:
     int32 GetLastEncounterMarkerCount() const { return LastEncounterMarkerCount; }
     int32 GetLastLegendEntryCount() const { return LastLegendEntryCount; }
 
+    /** Dirty rects still waiting to upload / texels uploaded by the most recent pass (for the gameplay debugger). */
+    int32 GetPendingDirtyRectCount() const { return DirtyRects.Num(); }
+    int32 GetLastUploadedTexelCount() const { return LastUploadedTexelCount; }
+
 private:
     /** Resolve the local UMythicLivingWorldSubsystem (the replicated-proxy cache). Null if unavailable. */
     UMythicLivingWorldSubsystem* GetLivingWorld() const;
@@ -108,16 +128,37 @@ private:
     /** Faction color for a faction index, via the cached InitialFactions list (override-aware). */
     FColor ResolveColor(uint8 FactionIndex) const;
 
-    /** Bound to the living-world subsystem's proxy-change delegate — rebuilds on any proxy change. */
+    /** Bound to the living-world subsystem's proxy-change delegate — flags markers/legend for the next pass' broadcast. */
     UFUNCTION()
     void HandleProxiesChanged();
 
+    /** Bound to OnTerritoryProxyCellChanged — writes the accumulator + legend counts and queues the cell's dirty rect. */
+    void HandleTerritoryCellChanged(const FMythicTerritoryProxyItem& Item);
+
+    /** Core-ticker callback: first full build, then budgeted dirty-rect uploads, then the coalesced broadcast. */
+    bool Tick(float DeltaTime);
+
+    /** Move one cell between faction tallies (Old/New may be 0xFF = unclaimed). */
+    void RecountCell(uint8 OldFaction, uint8 NewFaction);
+
+    /** Repaint PixelBuffer texels inside Rect from the accumulator (fill + border). */
+    void RepaintRegion(const FIntRect& Rect, const FMythicWarMapStyle& PODStyle);
+
+    /** Repaint + upload dirty rects until TexelBudget is spent. Returns texels uploaded. */
+    int32 FlushDirtyRects(int32 TexelBudget);
+
+    /** Recompute the marker/legend counts the debugger shows. */
+    void RefreshDiagnostics();
+
     /** Create the transient texture (BGRA8, nearest, never-stream) sized to the grid. No-op if already created. */
     void EnsureTexture();
 
     /** Re-upload PixelBuffer into the texture's mip 0. */
     void UploadTexture();
 
+    /** Upload just Rect of PixelBuffer (region update; the CPU mip copy is patched to match). */
+    void UploadRegion(const FIntRect& Rect);
+
     // ─── Owned GPU + CPU state ───────────────────────────
 
     /** The war-map texture (transient, client-only). */
@@ -131,6 +172,20 @@ private:
      *  refreshes and fills in as deltas arrive. */
     TArray<uint8> DominantByCell;
 
+    /** Cells held per faction index (256 slots, 0xFF unused) — kept in step with DominantByCell for the legend. */
+    TArray<int32> CellCountByFaction;
+    int32 ClaimedCellCount = 0;
+
+    /** Coalesced regions of PixelBuffer awaiting repaint + upload (MythicWarMap::AddDirtyRect). */
+    TArray<FIntRect> DirtyRects;
+    static constexpr int32 MaxDirtyRects = 32;
+
+    /** A full rebuild is owed (grid just resolved) — incremental cell events are ignored until it runs. */
+    bool bNeedsFullRebuild = false;
+
+    /** Something the UI shows changed since the last OnWarMapChanged. */
+    bool bMapDataDirty = false;
+
     /** Client-side copy of the faction definitions (color + name), loaded once from the faction settings asset. */
     TArray<FMythicFactionData> CachedInitialFactions;
 
@@ -139,11 +194,15 @@ private:
     FVector2D WorldOrigin = FVector2D::ZeroVector;
     float CellWorldSize = 0.0f;
 
-    /** Whether we've bound to the living-world proxy-change delegate yet. */
+    /** Whether we've bound to the living-world proxy-change delegates yet. */
     bool bBoundToProxies = false;
+    FDelegateHandle TerritoryCellChangedHandle;
+
+    FTSTicker::FDelegateHandle TickHandle;
 
     /** Last-refresh diagnostics (debugger). */
     int32 LastSettlementMarkerCount = 0;
     int32 LastEncounterMarkerCount = 0;
     int32 LastLegendEntryCount = 0;
+    int32 LastUploadedTexelCount = 0;
 };
@@ -102,4 +102,62 @@ FColor ResolveFactionColorForId(uint8 FactionIndex, TConstArrayView<FMythicFacti
     return MythicFactionColor::DeterministicColorForId(FactionIndex);
 }
 
+namespace {
+    int64 RectArea(const FIntRect& R) {
+        return static_cast<int64>(FMath::Max(0, R.Max.X - R.Min.X)) * FMath::Max(0, R.Max.Y - R.Min.Y);
+    }
+
+    FIntRect RectUnion(const FIntRect& A, const FIntRect& B) {
+        return FIntRect(FMath::Min(A.Min.X, B.Min.X), FMath::Min(A.Min.Y, B.Min.Y),
+                        FMath::Max(A.Max.X, B.Max.X), FMath::Max(A.Max.Y, B.Max.Y));
+    }
+} // namespace
+
+FIntRect CellDirtyRect(int32 X, int32 Y, int32 W, int32 H) {
+    if (W <= 0 || H <= 0 || X < 0 || X >= W || Y < 0 || Y >= H) {
+        return FIntRect();
+    }
+    return FIntRect(FMath::Max(X - 1, 0), FMath::Max(Y - 1, 0), FMath::Min(X + 2, W), FMath::Min(Y + 2, H));
+}
+
+void AddDirtyRect(TArray<FIntRect>& Rects, const FIntRect& NewRect, int32 MaxRects) {
+    if (RectArea(NewRect) <= 0) {
+        return;
+    }
+
+    // Fold NewRect into any rect it is cheap to share with; each fold can make the grown rect cheap to share with
+    // another, so repeat until a full pass merges nothing.
+    FIntRect Pending = NewRect;
+    bool bMerged = true;
+    while (bMerged) {
+        bMerged = false;
+        for (int32 i = 0; i < Rects.Num(); ++i) {
+            const FIntRect Union = RectUnion(Rects[i], Pending);
+            if (RectArea(Union) <= 2 * (RectArea(Rects[i]) + RectArea(Pending))) {
+                Pending = Union;
+                Rects.RemoveAtSwap(i, EAllowShrinking::No);
+                bMerged = true;
+                break;
+            }
+        }
+    }
+
+    if (Rects.Num() < FMath::Max(MaxRects, 1)) {
+        Rects.Add(Pending);
+        return;
+    }
+
+    // Full: grow whichever existing rect absorbs Pending most cheaply.
+    int32 Best = 0;
+    int64 BestGrowth = TNumericLimits<int64>::Max();
+    for (int32 i = 0; i < Rects.Num(); ++i) {
+        const int64 Growth = RectArea(RectUnion(Rects[i], Pending)) - RectArea(Rects[i]);
+        if (Growth < BestGrowth) {
+            BestGrowth = Growth;
+            Best = i;
+        }
+    }
+    Rects[Best] = RectUnion(Rects[Best], Pending);
+}
+
 } // namespace MythicWarMap
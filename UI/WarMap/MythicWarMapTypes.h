@@ -184,4 +184,19 @@ namespace MythicWarMap {
      * identical in both. Defined in the .cpp (needs the FactionColor + FMythicFactionData headers).
      */
     MYTHIC_API FColor ResolveFactionColorForId(uint8 FactionIndex, TConstArrayView<FMythicFactionData> InitialFactions);
+
+    /**
+     * Texels a single cell's faction flip can repaint: the cell itself plus its 4-neighbors (their border darkening
+     * depends on it), as the bounding rect cell ±1 clipped to the W×H grid. FIntRect convention: Min inclusive, Max
+     * exclusive. Degenerate grid or out-of-bounds cell -> empty rect.
+     */
+    MYTHIC_API FIntRect CellDirtyRect(int32 X, int32 Y, int32 W, int32 H);
+
+    /**
+     * Coalesce NewRect into a dirty-rect set. NewRect merges into an existing rect when their union costs no more than
+     * twice their combined area (neighbors / overlaps fold together, distant changes stay separate); merged rects keep
+     * folding until nothing else qualifies. If the set would exceed MaxRects, NewRect is instead merged into the rect
+     * whose union grows least. Empty rects are ignored. Upload cost stays ~proportional to the texels that changed.
+     */
+    MYTHIC_API void AddDirtyRect(TArray<FIntRect>& Rects, const FIntRect& NewRect, int32 MaxRects);
 } // namespace MythicWarMap
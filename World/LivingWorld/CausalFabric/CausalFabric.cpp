@@ -1,23 +1,108 @@
 // Mythic Living World System — Causal Fabric Implementation
 
 #include "World/LivingWorld/CausalFabric/CausalFabric.h"
+#include "HAL/PlatformTime.h"
+
+// ─── Posting list ─────────────────────────────────────────
+
+void FMythicFabricPostingList::Push(uint32 EventId, double WorldTime) {
+    const double PrevMax = Num() > 0 ? Entries.Last().MaxTimeSoFar : WorldTime;
+    Entries.Add({EventId, FMath::Max(PrevMax, WorldTime)});
+}
+
+void FMythicFabricPostingList::PopThrough(uint32 EvictedId) {
+    while (Front < Entries.Num() && Entries[Front].EventId <= EvictedId) {
+        ++Front;
+    }
+    if (Front == Entries.Num()) {
+        Reset(); // keeps the allocation
+    } else if (Front >= 64 && Front * 2 >= Entries.Num()) {
+        Entries.RemoveAt(0, Front, EAllowShrinking::No);
+        Front = 0;
+    }
+}
+
+int32 FMythicFabricPostingList::FirstAtOrAfter(double MinWorldTime) const {
+    // Lower bound over the non-decreasing MaxTimeSoFar column
+    int32 Lo = 0;
+    int32 Hi = Num();
+    while (Lo < Hi) {
+        const int32 Mid = Lo + (Hi - Lo) / 2;
+        if ((*this)[Mid].MaxTimeSoFar < MinWorldTime) {
+            Lo = Mid + 1;
+        } else {
+            Hi = Mid;
+        }
+    }
+    return Lo;
+}
+
+// ─── Fabric view ──────────────────────────────────────────
+
+int32 FMythicFabricView::EventIdToIndex(uint32 EventId) const {
+    if (EventId == 0 || EventId < BaseEventId || EventId > NewestEventId) {
+        return -1;
+    }
+
+    // Ring index = (Head - (NewestEventId - EventId) - 1) wrapped to capacity
+    const int32 Age = static_cast<int32>(NewestEventId - EventId);
+    if (Age >= Count) {
+        return -1;
+    }
+    const int32 Capacity = Ring.Num();
+    return ((Head - 1 - Age) % Capacity + Capacity) % Capacity;
+}
+
+void FMythicFabricView::IndexEvent(const FMythicWorldEvent &Event) {
+    for (uint32 Bits = Event.CategoryFlags; Bits != 0; Bits &= Bits - 1) {
+        CategoryPostings[FMath::CountTrailingZeros(Bits)].Push(Event.EventId, Event.WorldTime);
+    }
+    if (Event.PrimaryFaction.IsValid()) {
+        FactionPostings[Event.PrimaryFaction.Index].Push(Event.EventId, Event.WorldTime);
+    }
+}
+
+void FMythicFabricView::UnindexEvent(const FMythicWorldEvent &Event) {
+    for (uint32 Bits = Event.CategoryFlags; Bits != 0; Bits &= Bits - 1) {
+        CategoryPostings[FMath::CountTrailingZeros(Bits)].PopThrough(Event.EventId);
+    }
+    if (Event.PrimaryFaction.IsValid()) {
+        FactionPostings[Event.PrimaryFaction.Index].PopThrough(Event.EventId);
+    }
+}
+
+void FMythicFabricView::RebuildPostings() {
+    for (FMythicFabricPostingList &List : CategoryPostings) {
+        List.Reset();
+    }
+    for (FMythicFabricPostingList &List : FactionPostings) {
+        List.Reset();
+    }
+    // Ring order from the oldest live slot is EventId order
+    const int32 Capacity = Ring.Num();
+    for (int32 i = 0; i < Count; ++i) {
+        const int32 Index = ((Head - Count + i) % Capacity + Capacity) % Capacity;
+        if (Ring[Index].EventId > 0) {
+            IndexEvent(Ring[Index]);
+        }
+    }
+}
+
+// ─── Causal fabric ────────────────────────────────────────
 
 void UMythicCausalFabric::Initialize(int32 InCapacity) {
     check(InCapacity > 0);
     Capacity = InCapacity;
 
+    WriteBuffer.Reset();
     WriteBuffer.SetNum(Capacity);
-    ReadBuffer.SetNum(Capacity);
-    WriteSpatialIndex.Empty();
-    ReadSpatialIndex.Empty();
+    WritePrevInCell.Init(0, Capacity);
+    WriteCellNewest.Empty();
     WriteHead = 0;
     WriteCount = 0;
-    ReadHead = 0;
-    ReadCount = 0;
     BaseEventId = 1;
-    ReadBaseEventId = 1;
-    ReadNewestEventId = 0;
     NextEventId.store(1, std::memory_order_relaxed);
+    ResetViews();
 
     UE_LOG(LogMythCausalFabric, Log, TEXT("Causal Fabric initialized with capacity %d"), Capacity);
 }
@@ -28,18 +113,13 @@ uint32 UMythicCausalFabric::AppendEvent(const FMythicWorldEvent &InEvent) {
     FMythicWorldEvent &Slot = WriteBuffer[WriteHead];
 
     // O(1) In-place Pruning:
-    // If the ring is wrapping around, we are about to overwrite the oldest event.
-    // We strictly prune it from the spatial index exactly now.
-    // This is vastly more performant than a periodic "background cleanup" because:
-    // 1. It spreads the cost across individual appends (no latency spikes).
-    // 2. It requires exactly one Map Lookup and one Array RemoveSwap (O(1)).
-    // 3. A periodic cleanup would require iterating the entire Map and all Arrays (O(N) spike).
+    // If the ring is wrapping around, we are about to overwrite the oldest event. Its chain link needs no cleanup (an
+    // evicted id falls outside the ring and ends any walk that reaches it); only a cell whose NEWEST event this is has
+    // no surviving events left, so its head entry is dropped to keep the map bounded by live cells.
     if (WriteCount == Capacity && Slot.EventId > 0) {
-        if (TArray<uint32> *OldCellEvents = WriteSpatialIndex.Find(Slot.Cell)) {
-            OldCellEvents->RemoveSwap(Slot.EventId);
-            if (OldCellEvents->IsEmpty()) {
-                WriteSpatialIndex.Remove(Slot.Cell);
-            }
+        const uint32 *Newest = WriteCellNewest.Find(Slot.Cell);
+        if (Newest && *Newest == Slot.EventId) {
+            WriteCellNewest.Remove(Slot.Cell);
         }
     }
 
@@ -54,8 +134,10 @@ uint32 UMythicCausalFabric::AppendEvent(const FMythicWorldEvent &InEvent) {
         Slot.WorldTime = FPlatformTime::Seconds();
     }
 
-    // Add to spatial index
-    WriteSpatialIndex.FindOrAdd(Slot.Cell).Add(AssignedId);
+    // Link into the cell chain (newest-first)
+    uint32 &CellHead = WriteCellNewest.FindOrAdd(Slot.Cell, 0);
+    WritePrevInCell[WriteHead] = CellHead;
+    CellHead = AssignedId;
 
     WriteHead = (WriteHead + 1) % Capacity;
     WriteCount = FMath::Min(WriteCount + 1, Capacity);
@@ -69,48 +151,143 @@ uint32 UMythicCausalFabric::AppendEvent(const FMythicWorldEvent &InEvent) {
 }
 
 void UMythicCausalFabric::CommitWrites() {
-    // Snapshot the write buffer into the read buffer.
-    // Use an FRWLock to guarantee game thread readers don't see half-copied state.
-    FWriteScopeLock Lock(FabricLock);
-
-    FMemory::Memcpy(ReadBuffer.GetData(), WriteBuffer.GetData(), Capacity * sizeof(FMythicWorldEvent));
-    ReadSpatialIndex = WriteSpatialIndex;
-    ReadHead = WriteHead;
-    ReadCount = WriteCount;
-    // Snapshot the id-translation basis alongside the buffer so reads (under the read lock) stay self-consistent with
-    // the committed ring instead of racing the live, lock-free write-side counters.
-    ReadBaseEventId = BaseEventId;
-    ReadNewestEventId = NextEventId.load(std::memory_order_relaxed) - 1;
+    const FMythicFabricView *Current = Views.GetPublished();
+    if (!Current || Current->NewestEventId == NextEventId.load(std::memory_order_relaxed) - 1) {
+        return; // Nothing appended since the last publish (or not initialized)
+    }
+
+    // The retired view is the only one we may write, and only once no reader pins it. One that still does has outlived
+    // a whole commit interval; skip this publish rather than wait for it or allocate a third ring — the next commit
+    // catches the view up on both ticks' events.
+    TRefCountPtr<FMythicFabricView> Next = Views.TryReuse();
+    if (!Next.IsValid()) {
+        DeferredCommits.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const int32 Published = CatchUpView(*Next);
+
+    const uint64 WaitStart = FPlatformTime::Cycles64();
+    Views.Publish(MoveTemp(Next));
+    CommitLockWaitCycles.fetch_add(FPlatformTime::Cycles64() - WaitStart, std::memory_order_relaxed);
+
+    LastCommitSlotCount.store(Published, std::memory_order_relaxed);
+    constexpr uint64 BytesPerSlot = sizeof(FMythicWorldEvent) + sizeof(uint32);
+    CommittedBytes.fetch_add(static_cast<uint64>(Published) * BytesPerSlot, std::memory_order_relaxed);
+    CommitEpoch.fetch_add(1, std::memory_order_release);
+}
+
+int32 UMythicCausalFabric::CatchUpView(FMythicFabricView &View) const {
+    const uint32 NewestId = NextEventId.load(std::memory_order_relaxed) - 1;
+    const uint32 Behind = NewestId - View.NewestEventId;
+
+    int32 Copied = 0;
+    if (View.Ring.Num() != Capacity || Behind >= static_cast<uint32>(Capacity)) {
+        // A lap or more behind replaces every slot — cheaper to copy the ring and rebuild the posting lists than to
+        // pop/push each one (and the evicted slots are then no longer in oldest-first order).
+        View.Ring.SetNum(Capacity);
+        View.PrevInCell.SetNum(Capacity);
+        FMemory::Memcpy(View.Ring.GetData(), WriteBuffer.GetData(), Capacity * sizeof(FMythicWorldEvent));
+        FMemory::Memcpy(View.PrevInCell.GetData(), WritePrevInCell.GetData(), Capacity * sizeof(uint32));
+        View.CellNewest = WriteCellNewest;
+        Copied = Capacity;
+    } else {
+        // The view is missing exactly the Behind slots ending just before WriteHead — at most two contiguous segments.
+        const int32 Count = static_cast<int32>(Behind);
+        const int32 Start = ((WriteHead - Count) % Capacity + Capacity) % Capacity;
+
+        // Patch the view's cell heads and posting lists slot-by-slot in append order, BEFORE the copy overwrites the
+        // evicted events: drop a head whose event is being evicted, then link the new one. A newly appended id is
+        // always greater than any evicted one, so a later eviction can never drop a head set earlier in this batch.
+        for (int32 i = 0; i < Count; ++i) {
+            const int32 Index = (Start + i) % Capacity;
+            const FMythicWorldEvent &Evicted = View.Ring[Index];
+            if (Evicted.EventId > 0) {
+                const uint32 *Newest = View.CellNewest.Find(Evicted.Cell);
+                if (Newest && *Newest == Evicted.EventId) {
+                    View.CellNewest.Remove(Evicted.Cell);
+                }
+                View.UnindexEvent(Evicted);
+            }
+            const FMythicWorldEvent &Appended = WriteBuffer[Index];
+            View.CellNewest.Add(Appended.Cell, Appended.EventId);
+            View.IndexEvent(Appended);
+        }
+
+        const int32 FirstLen = FMath::Min(Count, Capacity - Start);
+        FMemory::Memcpy(View.Ring.GetData() + Start, WriteBuffer.GetData() + Start,
+                        FirstLen * sizeof(FMythicWorldEvent));
+        FMemory::Memcpy(View.PrevInCell.GetData() + Start, WritePrevInCell.GetData() + Start,
+                        FirstLen * sizeof(uint32));
+        if (FirstLen < Count) {
+            FMemory::Memcpy(View.Ring.GetData(), WriteBuffer.GetData(), (Count - FirstLen) * sizeof(FMythicWorldEvent));
+            FMemory::Memcpy(View.PrevInCell.GetData(), WritePrevInCell.GetData(), (Count - FirstLen) * sizeof(uint32));
+        }
+        Copied = Count;
+    }
+
+    View.Head = WriteHead;
+    View.Count = WriteCount;
+    View.BaseEventId = BaseEventId;
+    View.NewestEventId = NewestId;
+    if (Copied == Capacity) {
+        View.RebuildPostings();
+    }
+    return Copied;
+}
+
+void UMythicCausalFabric::ResetViews() {
+    // Readers still holding an old view keep it alive on their own reference
+    Views.Reset();
+    for (int32 i = 0; i < ViewCount; ++i) {
+        TRefCountPtr<FMythicFabricView> View = new FMythicFabricView();
+        CatchUpView(*View);
+        Views.Publish(MoveTemp(View)); // the previous one is retired, ready for the next commit
+    }
+    CommitEpoch.fetch_add(1, std::memory_order_release);
+}
+
+UMythicCausalFabric::FViewRef UMythicCausalFabric::PinView() const {
+    QueryCount.fetch_add(1, std::memory_order_relaxed);
+    return Views.Acquire();
+}
+
+double UMythicCausalFabric::GetCommitLockWaitSeconds() const {
+    return FPlatformTime::ToSeconds64(CommitLockWaitCycles.load(std::memory_order_relaxed));
 }
 
 const FMythicWorldEvent *UMythicCausalFabric::GetEvent(uint32 EventId) const {
-    FReadScopeLock Lock(FabricLock);
+    const FViewRef View = PinView();
+    if (!View.IsValid()) {
+        return nullptr;
+    }
 
-    const int32 Index = EventIdToIndex(EventId, ReadHead, ReadCount);
+    const int32 Index = View->EventIdToIndex(EventId);
     if (Index < 0) {
         return nullptr;
     }
-    return &ReadBuffer[Index];
+    // The publisher's own reference keeps the view alive past our pin until a later commit recycles it
+    return &View->Ring[Index];
 }
 
 TArray<FMythicWorldEvent> UMythicCausalFabric::GetRecentEvents(int32 MaxCount) const {
-    FReadScopeLock Lock(FabricLock);
+    const FViewRef View = PinView();
 
     TArray<FMythicWorldEvent> Out;
-    const int32 Count = FMath::Min(MaxCount, ReadCount);
+    const int32 Count = View.IsValid() ? FMath::Min(MaxCount, View->Count) : 0;
     if (Count <= 0) {
         return Out;
     }
     Out.Reserve(Count);
 
-    // Copy the window under the read lock so the result never aliases ReadBuffer (which the sim thread's
-    // CommitWrites memcpy-overwrites). Stitch BOTH ring segments so a wrap-straddling window keeps the newest
-    // events instead of dropping the wrapped tail.
-    const int32 StartIndex = ((ReadHead - Count) % Capacity + Capacity) % Capacity;
-    const int32 FirstLen = FMath::Min(Count, Capacity - StartIndex);
-    Out.Append(ReadBuffer.GetData() + StartIndex, FirstLen); // [StartIndex, Capacity)
+    // Stitch BOTH ring segments so a wrap-straddling window keeps the newest events instead of dropping the wrapped
+    // tail.
+    const int32 RingSize = View->Ring.Num();
+    const int32 StartIndex = ((View->Head - Count) % RingSize + RingSize) % RingSize;
+    const int32 FirstLen = FMath::Min(Count, RingSize - StartIndex);
+    Out.Append(View->Ring.GetData() + StartIndex, FirstLen); // [StartIndex, RingSize)
     if (FirstLen < Count) {
-        Out.Append(ReadBuffer.GetData(), Count - FirstLen); // wrapped segment [0, ...)
+        Out.Append(View->Ring.GetData(), Count - FirstLen); // wrapped segment [0, ...)
     }
     return Out;
 }
@@ -122,34 +299,14 @@ void UMythicCausalFabric::QueryEventsByCell(
     int32 MaxResults,
     TArray<FMythicWorldEvent> &OutEvents) const {
     OutEvents.Reset();
-
-    FReadScopeLock Lock(FabricLock);
-
-    if (ReadCount <= 0) {
+    if (MaxResults <= 0) {
         return;
     }
-
-    // O(1) Fast path via spatial index
-    const TArray<uint32> *CellEvents = ReadSpatialIndex.Find(Cell);
-    if (!CellEvents) {
-        return;
-    }
-
-    // The cell's id list is NOT reliably chronological: the in-place RemoveSwap pruning in AppendEvent (on ring wrap)
-    // moves the last element into the pruned slot, scrambling order. So we CANNOT early-break on an out-of-window
-    // event — scan the whole (MaxResults-capped) cell list and filter each by the time window, copying matches by
-    // value (the result must not alias ReadBuffer, which CommitWrites overwrites on the sim thread).
-    for (int32 i = CellEvents->Num() - 1; i >= 0 && OutEvents.Num() < MaxResults; --i) {
-        const uint32 EventId = (*CellEvents)[i];
-        const int32 Index = EventIdToIndex(EventId, ReadHead, ReadCount);
-        if (Index < 0) {
-            continue; // Event was overwritten in the ring buffer
-        }
-        const FMythicWorldEvent &Event = ReadBuffer[Index];
-        if (Event.WorldTime >= MinWorldTime && Event.WorldTime <= MaxWorldTime) {
-            OutEvents.Add(Event);
-        }
-    }
+    // Copy matches by value — the result must not alias the view, which the sim thread recycles once unpinned
+    VisitEventsByCell(Cell, MinWorldTime, MaxWorldTime, [&OutEvents, MaxResults](const FMythicWorldEvent &Event) {
+        OutEvents.Add(Event);
+        return OutEvents.Num() < MaxResults;
+    });
 }
 
 void UMythicCausalFabric::QueryEventsByCategory(
@@ -159,71 +316,191 @@ void UMythicCausalFabric::QueryEventsByCategory(
     int32 MaxResults,
     TArray<FMythicWorldEvent> &OutEvents) const {
     OutEvents.Reset();
+    if (MaxResults <= 0) {
+        return;
+    }
+    VisitEventsByCategory(CategoryMask, MinWorldTime, MaxWorldTime, [&OutEvents, MaxResults](const FMythicWorldEvent &Event) {
+        OutEvents.Add(Event);
+        return OutEvents.Num() < MaxResults;
+    });
+}
 
-    FReadScopeLock Lock(FabricLock);
-
-    if (ReadCount <= 0) {
+void UMythicCausalFabric::QueryEventsByFaction(
+    const FMythicFactionId &Faction,
+    TArray<FMythicWorldEvent> &OutEvents,
+    int32 MaxResults,
+    double MinWorldTime,
+    double MaxWorldTime) const {
+    OutEvents.Reset();
+    if (MaxResults <= 0) {
         return;
     }
+    VisitEventsByFaction(Faction, MinWorldTime, MaxWorldTime, [&OutEvents, MaxResults](const FMythicWorldEvent &Event) {
+        OutEvents.Add(Event);
+        return OutEvents.Num() < MaxResults;
+    });
+}
+
+// ─── Visitor queries ──────────────────────────────────────
+
+int32 UMythicCausalFabric::VisitRecentEvents(int32 MaxCount, FEventVisitor Visitor) const {
+    const FViewRef View = PinView();
+    if (!View.IsValid()) {
+        return 0;
+    }
 
-    // NO early-break on WorldTime: the ring is NOT globally WorldTime-monotonic — events from different producers /
-    // clocks interleave (game-thread events carry game time; sim events were unstamped/zero), so a low-WorldTime
-    // record can sit between high ones and would wrongly truncate a newest-first early-break. Scan the full
-    // (MaxResults-capped) window and filter each. Copy matches by value (the result must not alias ReadBuffer).
-    for (int32 i = 0; i < ReadCount && OutEvents.Num() < MaxResults; ++i) {
-        const int32 Index = ((ReadHead - 1 - i) % Capacity + Capacity) % Capacity;
-        const FMythicWorldEvent &Event = ReadBuffer[Index];
-        if (Event.WorldTime >= MinWorldTime && Event.WorldTime <= MaxWorldTime && (Event.CategoryFlags & CategoryMask) != 0) {
-            OutEvents.Add(Event);
+    const int32 RingSize = View->Ring.Num();
+    const int32 Count = FMath::Min(MaxCount, View->Count);
+    int32 Visited = 0;
+    while (Visited < Count) {
+        const int32 Index = ((View->Head - 1 - Visited) % RingSize + RingSize) % RingSize;
+        ++Visited;
+        if (!Visitor(View->Ring[Index])) {
+            break;
         }
     }
+    return Visited;
 }
 
-int32 UMythicCausalFabric::EventIdToIndex(uint32 EventId, int32 HeadPos, int32 Count) const {
-    if (EventId == 0 || Capacity <= 0) {
-        return -1;
+int32 UMythicCausalFabric::VisitEventsByCell(
+    const FMythicCellCoord &Cell,
+    double MinWorldTime,
+    double MaxWorldTime,
+    FEventVisitor Visitor) const {
+    const FViewRef View = PinView();
+    if (!View.IsValid() || View->Count <= 0) {
+        return 0;
     }
 
-    // Check if this event is still within the COMMITTED read-snapshot range — NOT the live write-side counters, which
-    // the sim thread advances lock-free between a commit and a game-thread read (a logical mismatch + a torn read).
-    const uint32 OldestId = ReadBaseEventId;
-    const uint32 NewestId = ReadNewestEventId;
+    // O(1) Fast path via the cell chain
+    const uint32 *Newest = View->CellNewest.Find(Cell);
+    if (!Newest) {
+        return 0;
+    }
 
-    if (EventId < OldestId || EventId > NewestId) {
-        return -1;
+    // Walk the chain newest-first until it reaches an evicted id (EventIdToIndex < 0) or the visitor stops. The chain
+    // is EventId-ordered but the ring is NOT globally WorldTime-monotonic (producers stamp different clocks), so we
+    // cannot early-break on an out-of-window event — filter each link by the time window instead.
+    int32 Visited = 0;
+    uint32 EventId = *Newest;
+    for (;;) {
+        const int32 Index = View->EventIdToIndex(EventId);
+        if (Index < 0) {
+            break; // Rest of the chain was overwritten in the ring buffer
+        }
+        const FMythicWorldEvent &Event = View->Ring[Index];
+        if (Event.WorldTime >= MinWorldTime && Event.WorldTime <= MaxWorldTime) {
+            ++Visited;
+            if (!Visitor(Event)) {
+                break;
+            }
+        }
+        EventId = View->PrevInCell[Index];
     }
+    return Visited;
+}
 
-    // Ring index = (HeadPos - (NewestId - EventId) - 1) wrapped to capacity
-    const int32 Age = static_cast<int32>(NewestId - EventId);
-    if (Age >= Count) {
-        return -1;
+int32 UMythicCausalFabric::VisitEventsByCategory(
+    uint16 CategoryMask,
+    double MinWorldTime,
+    double MaxWorldTime,
+    FEventVisitor Visitor) const {
+    const FViewRef View = PinView();
+    if (!View.IsValid() || View->Count <= 0) {
+        return 0;
     }
 
-    const int32 Index = ((HeadPos - 1 - Age) % Capacity + Capacity) % Capacity;
-    return Index;
-}
+    // Gather the posting lists of the requested bits, each bounded below by its time index. One bit (the common case)
+    // walks a single list; several bits merge newest-first by EventId, emitting a multi-category event once.
+    struct FCursor {
+        const FMythicFabricPostingList *List;
+        int32 Pos;  // next entry to visit (walks downward)
+        int32 Stop; // first entry the time index admits
+    };
+    TArray<FCursor, TInlineAllocator<FMythicFabricView::CategoryBitCount>> Cursors;
+    for (uint32 Bits = CategoryMask; Bits != 0; Bits &= Bits - 1) {
+        const FMythicFabricPostingList &List = View->CategoryPostings[FMath::CountTrailingZeros(Bits)];
+        const int32 Stop = List.FirstAtOrAfter(MinWorldTime);
+        if (Stop < List.Num()) {
+            Cursors.Add({&List, List.Num() - 1, Stop});
+        }
+    }
 
-void UMythicCausalFabric::QueryEventsByFaction(
-    const FMythicFactionId &Faction,
-    TArray<FMythicWorldEvent> &OutEvents,
-    int32 MaxResults) const {
-    OutEvents.Reset();
+    int32 Visited = 0;
+    if (Cursors.Num() == 1) {
+        VisitPostings(*View, *Cursors[0].List, MinWorldTime, MaxWorldTime, Visitor, Visited);
+        return Visited;
+    }
 
-    FReadScopeLock Lock(FabricLock);
+    // The time index only bounds from below and only up to non-monotonic producers, so each candidate is still checked
+    // against the window.
+    for (;;) {
+        uint32 NewestId = 0;
+        for (const FCursor &C : Cursors) {
+            if (C.Pos >= C.Stop) {
+                NewestId = FMath::Max(NewestId, (*C.List)[C.Pos].EventId);
+            }
+        }
+        if (NewestId == 0) {
+            break;
+        }
+        for (FCursor &C : Cursors) {
+            if (C.Pos >= C.Stop && (*C.List)[C.Pos].EventId == NewestId) {
+                --C.Pos;
+            }
+        }
+        const int32 Index = View->EventIdToIndex(NewestId);
+        if (Index < 0) {
+            continue;
+        }
+        const FMythicWorldEvent &Event = View->Ring[Index];
+        if (Event.WorldTime >= MinWorldTime && Event.WorldTime <= MaxWorldTime) {
+            ++Visited;
+            if (!Visitor(Event)) {
+                break;
+            }
+        }
+    }
+    return Visited;
+}
 
-    if (ReadCount <= 0 || !Faction.IsValid()) {
-        return;
+int32 UMythicCausalFabric::VisitEventsByFaction(
+    const FMythicFactionId &Faction,
+    double MinWorldTime,
+    double MaxWorldTime,
+    FEventVisitor Visitor) const {
+    const FViewRef View = PinView();
+    if (!View.IsValid() || View->Count <= 0 || !Faction.IsValid()) {
+        return 0;
     }
 
-    // Scan from newest to oldest, filtering by PrimaryFaction
-    for (int32 i = 0; i < ReadCount && OutEvents.Num() < MaxResults; ++i) {
-        const int32 Index = ((ReadHead - 1 - i) % Capacity + Capacity) % Capacity;
-        const FMythicWorldEvent &Event = ReadBuffer[Index];
+    int32 Visited = 0;
+    VisitPostings(*View, View->FactionPostings[Faction.Index], MinWorldTime, MaxWorldTime, Visitor, Visited);
+    return Visited;
+}
 
-        if (Event.PrimaryFaction == Faction) {
-            OutEvents.Add(Event);
+bool UMythicCausalFabric::VisitPostings(
+    const FMythicFabricView &View,
+    const FMythicFabricPostingList &List,
+    double MinWorldTime,
+    double MaxWorldTime,
+    FEventVisitor Visitor,
+    int32 &VisitedCount) {
+    const int32 Stop = List.FirstAtOrAfter(MinWorldTime);
+    for (int32 i = List.Num() - 1; i >= Stop; --i) {
+        const int32 Index = View.EventIdToIndex(List[i].EventId);
+        if (Index < 0) {
+            continue; // defensive — eviction pops keep the lists in step with the ring
+        }
+        const FMythicWorldEvent &Event = View.Ring[Index];
+        if (Event.WorldTime >= MinWorldTime && Event.WorldTime <= MaxWorldTime) {
+            ++VisitedCount;
+            if (!Visitor(Event)) {
+                return false;
+            }
         }
     }
+    return true;
 }
 
 void UMythicCausalFabric::Serialize(FArchive &Ar) {
@@ -242,7 +519,6 @@ void UMythicCausalFabric::Serialize(FArchive &Ar) {
             return;
         }
         WriteBuffer.SetNum(Capacity);
-        ReadBuffer.SetNum(Capacity);
     }
 
     Ar << WriteHead;
@@ -251,7 +527,7 @@ void UMythicCausalFabric::Serialize(FArchive &Ar) {
 
     if (Ar.IsLoading()) {
         // Likewise bound the ring cursors read from the stream — a garbage WriteHead/WriteCount would drive
-        // out-of-bounds ring access in CommitWrites / EventIdToIndex below. Valid range is [0, Capacity].
+        // out-of-bounds ring access in CatchUpView / EventIdToIndex below. Valid range is [0, Capacity].
         if (WriteCount < 0 || WriteCount > Capacity || WriteHead < 0 || WriteHead > Capacity) {
             Ar.SetError();
             return;
@@ -287,25 +563,28 @@ void UMythicCausalFabric::Serialize(FArchive &Ar) {
     }
 
     if (Ar.IsLoading()) {
-        WriteSpatialIndex.Empty();
+        WriteCellNewest.Empty();
+        WritePrevInCell.Init(0, Capacity);
 
-        // Rebuild spatial index with correct chronological ordering
-        TArray<FMythicWorldEvent *> ValidEvents;
+        // Rebuild the cell chain with correct chronological ordering
+        TArray<int32> ValidSlots;
         for (int32 i = 0; i < Capacity; ++i) {
             if (WriteBuffer[i].EventId > 0) {
-                ValidEvents.Add(&WriteBuffer[i]);
+                ValidSlots.Add(i);
             }
         }
 
-        ValidEvents.Sort([](const FMythicWorldEvent &A, const FMythicWorldEvent &B) {
-            return A.EventId < B.EventId;
+        ValidSlots.Sort([this](int32 A, int32 B) {
+            return WriteBuffer[A].EventId < WriteBuffer[B].EventId;
         });
 
-        for (const FMythicWorldEvent *Ev : ValidEvents) {
-            WriteSpatialIndex.FindOrAdd(Ev->Cell).Add(Ev->EventId);
+        for (const int32 Slot : ValidSlots) {
+            uint32 &CellHead = WriteCellNewest.FindOrAdd(WriteBuffer[Slot].Cell, 0);
+            WritePrevInCell[Slot] = CellHead;
+            CellHead = WriteBuffer[Slot].EventId;
         }
 
-        // Restore read buffer from loaded write buffer
-        CommitWrites();
+        // Republish both views from the loaded write buffer (whole ring — the old views have no relation to it)
+        ResetViews();
     }
 }
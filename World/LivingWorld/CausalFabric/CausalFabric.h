@@ -1,10 +1,11 @@
 // Mythic Living World System — Causal Fabric
-// Shared, append-only world event log. Lock-free reads from game thread.
+// Shared, append-only world event log. Readers pin an immutable published view; the sim thread never waits on them.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
+#include "World/LivingWorld/MythicSnapshotPublisher.h"
 #include "World/LivingWorld/Morality/MoralSignature.h"
 #include "CausalFabric.generated.h"
 
@@ -87,16 +88,99 @@ namespace EMythicEventCategory {
 }
 
 // ─────────────────────────────────────────────────────────────
-// Cell Event Index Entry — For spatial queries
+// Event Posting List — For category / faction queries
 // ─────────────────────────────────────────────────────────────
 
-/** Maps a cell to a range of events in the ring buffer for spatial queries */
-struct FMythicCellEventRange {
-    /** Index of the oldest event in this cell still in the ring buffer */
-    int32 OldestIndex = -1;
+/**
+ * EventIds of every view-ring event carrying one category bit (or one PrimaryFaction), in append order. The ring
+ * evicts strictly oldest-first, so eviction is a pop from the front and the list always mirrors the live ring exactly.
+ *
+ * Time index: the ring is NOT globally WorldTime-monotonic (game-thread producers stamp game time, sim-thread ones
+ * FPlatformTime), so EventIds cannot be binary-searched by time directly. Each entry instead carries the running MAX
+ * WorldTime of the list up to and including it — non-decreasing by construction, hence binary-searchable. Every entry
+ * before FirstAtOrAfter(MinWorldTime) is provably older than MinWorldTime and is never touched; when producers do stamp
+ * monotonic times (the common case within one clock) the bound is exact.
+ */
+struct FMythicFabricPostingList {
+    struct FEntry {
+        uint32 EventId = 0;
+        double MaxTimeSoFar = 0.0;
+    };
+
+    /** Append a newer event */
+    void Push(uint32 EventId, double WorldTime);
+
+    /** Drop leading entries up to and including EvictedId (the ring evicts oldest-first) */
+    void PopThrough(uint32 EvictedId);
+
+    void Reset() {
+        Entries.Reset();
+        Front = 0;
+    }
+
+    /** Live entry count */
+    int32 Num() const { return Entries.Num() - Front; }
+
+    /** Live entry I (0 = oldest) */
+    const FEntry &operator[](int32 I) const { return Entries[Front + I]; }
+
+    /** First live entry that may have WorldTime >= MinWorldTime (Num() if none) — binary search over MaxTimeSoFar */
+    int32 FirstAtOrAfter(double MinWorldTime) const;
+
+private:
+    TArray<FEntry> Entries;
+
+    /** Entries before Front are evicted; compacted once they make up half the array (amortized O(1) pop) */
+    int32 Front = 0;
+};
+
+// ─────────────────────────────────────────────────────────────
+// Fabric View — One published generation of the read side
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * An immutable copy of the committed ring and its indexes, published through TMythicSnapshotPublisher. Queries pin one
+ * and walk it with no lock held; the sim thread only ever writes a view that is neither published nor pinned.
+ *
+ * The fabric keeps exactly two: CommitWrites catches up the retired one (the slots appended since IT was last
+ * published — the previous commit's and this one's) and publishes it, so a commit copies about twice the events
+ * appended per tick. The live id range is [BaseEventId, NewestEventId]; translation and walks are relative to it.
+ */
+struct FMythicFabricView : public FThreadSafeRefCountedObject {
+    /** Number of category bits (EMythicEventCategory is a uint16 mask) */
+    static constexpr int32 CategoryBitCount = 16;
+
+    /** Committed events, indexed like the write ring (Ring.Num() == the fabric's Capacity) */
+    TArray<FMythicWorldEvent> Ring;
+
+    /**
+     * Cell chain: CellNewest maps a cell to its newest EventId and PrevInCell[slot] holds the previous event in the
+     * same cell (0 = none). A link to an evicted event falls outside [BaseEventId, NewestEventId] and ends the walk.
+     */
+    TMap<FMythicCellCoord, uint32> CellNewest;
+    TArray<uint32> PrevInCell;
 
-    /** Count of events in this cell currently in the buffer */
+    /** Posting lists, one per category bit and one per PrimaryFaction index */
+    FMythicFabricPostingList CategoryPostings[CategoryBitCount];
+    FMythicFabricPostingList FactionPostings[FMythicFactionId::InvalidIndex];
+
+    /** Ring slot one past the newest event, and the number of live events */
+    int32 Head = 0;
     int32 Count = 0;
+
+    /** Live id range (NewestEventId = 0 while empty) */
+    uint32 BaseEventId = 1;
+    uint32 NewestEventId = 0;
+
+    /** Translate an EventId to a ring index. Returns -1 if outside the live range. */
+    int32 EventIdToIndex(uint32 EventId) const;
+
+    /** Posting-list maintenance for one ring event (publisher side, on an unpublished view) */
+    void IndexEvent(const FMythicWorldEvent &Event);
+    void UnindexEvent(const FMythicWorldEvent &Event);
+
+    /** Clear and rebuild every posting list from the ring, oldest-first */
+    void RebuildPostings();
 };
 
 // ─────────────────────────────────────────────────────────────
@@ -107,13 +191,21 @@ struct FMythicCellEventRange {
  * The Causal Fabric is a shared, append-only ring buffer of world events.
  *
  * Threading model:
- * - Background thread (world sim) writes events via AppendEvent()
- * - Game thread reads via query functions (protected by ReadLock)
- * - Double-buffered: background thread writes to the write buffer,
- *   then copies to read buffer during CommitWrites under WriteLock.
+ * - Background thread (world sim) writes events via AppendEvent() into the write ring, which only it touches.
+ * - CommitWrites publishes them as an immutable FMythicFabricView (see there). Publishing is incremental: it copies
+ *   only the slots the retired view is missing and patches that view's cell chain and posting lists for just those
+ *   slots, so its cost scales with the events appended, not with Capacity. Readers that only need to know "did
+ *   anything change" poll GetCommitEpoch() instead of querying at all.
+ * - Queries never block the commit and the commit never blocks a query. Each query pins the published view under the
+ *   publisher's read lock (a pointer copy and an AddRef) and walks it with no lock held; CommitWrites writes only the
+ *   other view, and takes the publisher's write lock only for the pointer swap. A reader may therefore take any lock
+ *   of its own inside a visitor, and may call back into the fabric.
+ * - The one thing a reader can cost the sim is a deferred publish: if a query still pins the retired view when the
+ *   next commit wants to reuse it (i.e. it has outlived a whole commit interval), that commit is skipped rather than
+ *   waited on or given a third ring, and the next one catches up. Counted by GetDeferredCommitCount.
  *
- * Memory: Fixed capacity ring buffer. When full, oldest events are overwritten.
- * Old events past the configurable horizon are considered archived.
+ * Memory: Fixed capacity ring buffer, held three times (write ring + two views). When full, oldest events are
+ * overwritten. Old events past the configurable horizon are considered archived.
  */
 UCLASS()
 class MYTHIC_API UMythicCausalFabric : public UObject {
@@ -128,23 +220,31 @@ public:
     /** Append a new event to the fabric. Returns the assigned EventId. Thread-safe for single writer. */
     uint32 AppendEvent(const FMythicWorldEvent &Event);
 
-    /** Commit pending writes — swaps the read snapshot so game thread sees new events. */
+    /**
+     * Commit pending writes — catches up the retired read view and publishes it so readers see new events. Cost is
+     * O(events appended since that view was last published); a view a lap or more behind is recopied whole. Never
+     * waits for readers (see the class doc for the deferred case).
+     */
     void CommitWrites();
 
-    // ─── Read Interface (Game Thread — Thread-Safe via RWLock) ─────────
+    // ─── Read Interface (Any Thread — Pinned Published View) ─────────
 
-    /** Get an event by ID. Returns nullptr if the event has been overwritten (outside ring). */
+    /**
+     * Get an event by ID. Returns nullptr if the event has been overwritten (outside ring). The pointer is into a
+     * published view and stays valid until the sim thread's next CommitWrites at the earliest — copy the event out to
+     * keep it.
+     */
     const FMythicWorldEvent *GetEvent(uint32 EventId) const;
 
-    /** Get the most recent N events (up to buffer capacity), oldest-first. Returns a COPY taken under the read
-     *  lock — safe to use off the sim thread (the previous TArrayView aliased ReadBuffer, which CommitWrites
-     *  overwrites on the sim thread; it also dropped the wrapped tail on a wrap-straddling window). */
+    /** Get the most recent N events (up to buffer capacity), oldest-first. Returns a COPY out of the pinned view —
+     *  safe to keep on any thread. Stitches both ring segments, so a wrap-straddling window keeps its wrapped tail. */
     TArray<FMythicWorldEvent> GetRecentEvents(int32 MaxCount) const;
 
     /**
-     * Query events in a specific cell within a time range. Budget-capped by MaxResults. Returns value COPIES taken
-     * under the read lock (NOT pointers into ReadBuffer, which CommitWrites memcpy-overwrites on the sim thread — the
-     * off-thread BDI consumer would otherwise read torn data). Mirrors GetRecentEvents/QueryEventsByFaction.
+     * Query events in a specific cell within a time range. Budget-capped by MaxResults. Returns value COPIES (NOT
+     * pointers into the view, which the sim thread recycles once no reader pins it). Mirrors
+     * GetRecentEvents/QueryEventsByFaction. Copy-out wrapper over VisitEventsByCell — prefer the visitor when only a
+     * few fields are read.
      */
     void QueryEventsByCell(
         const FMythicCellCoord &Cell,
@@ -155,7 +255,9 @@ public:
 
     /**
      * Query events matching a category bitmask within a time range. Fast path for processors that need "all combat
-     * events in the last N seconds." Returns value COPIES under the read lock (see QueryEventsByCell).
+     * events in the last N seconds." Returns value COPIES (see QueryEventsByCell), newest-first.
+     * Walks only the posting lists of the bits in CategoryMask (merged by EventId when several bits are set), starting
+     * from the first entry the time index admits — events of other categories are never touched.
      */
     void QueryEventsByCategory(
         uint16 CategoryMask,
@@ -164,28 +266,87 @@ public:
         int32 MaxResults,
         TArray<FMythicWorldEvent> &OutEvents) const;
 
+    // ─── Visitor Interface (zero-copy) ─────────
+
+    /**
+     * Zero-copy counterparts of the queries above. The visitor is called with a reference straight into the pinned
+     * view, newest-first — the view cannot change under the walk and nothing is copied or allocated. Return true to
+     * keep going, false to stop early (budget reached, answer found).
+     *
+     * The reference is only valid inside the call: never store it. A visitor blocks nobody, but one that outlives a
+     * whole commit interval defers the commit after next (GetDeferredCommitCount), so keep the walks budgeted.
+     *
+     * @return Number of events handed to the visitor
+     */
+    using FEventVisitor = TFunctionRef<bool(const FMythicWorldEvent &Event)>;
+
+    int32 VisitRecentEvents(int32 MaxCount, FEventVisitor Visitor) const;
+
+    int32 VisitEventsByCell(
+        const FMythicCellCoord &Cell,
+        double MinWorldTime,
+        double MaxWorldTime,
+        FEventVisitor Visitor) const;
+
+    int32 VisitEventsByCategory(
+        uint16 CategoryMask,
+        double MinWorldTime,
+        double MaxWorldTime,
+        FEventVisitor Visitor) const;
+
+    int32 VisitEventsByFaction(
+        const FMythicFactionId &Faction,
+        double MinWorldTime,
+        double MaxWorldTime,
+        FEventVisitor Visitor) const;
+
     /** Get the total number of events ever recorded (monotonically increasing) */
     uint32 GetTotalEventCount() const { return NextEventId.load(std::memory_order_relaxed); }
 
     /** Get the current buffer capacity */
     int32 GetCapacity() const { return Capacity; }
 
-    /** Thread-safe RW lock for reads/commits */
-    mutable FRWLock FabricLock;
+    /**
+     * Monotonic publish counter, bumped (release) once per CommitWrites that published at least one slot, and on
+     * Initialize/load. A consumer that caches derived data can compare against its last-seen epoch and skip
+     * re-querying entirely.
+     */
+    uint64 GetCommitEpoch() const { return CommitEpoch.load(std::memory_order_acquire); }
+
+    /** Number of ring slots the most recent CommitWrites copied into its view (Capacity for a whole-ring recopy).
+     *  Debug/stats only. */
+    int32 GetLastCommitSlotCount() const { return LastCommitSlotCount.load(std::memory_order_relaxed); }
+
+    /** Bytes copied into read views by every CommitWrites so far (records + cell links). Stats only. */
+    uint64 GetCommittedBytes() const { return CommittedBytes.load(std::memory_order_relaxed); }
+
+    /** Queries served so far (one per call, however many events it visited; the copy-out wrappers count once through
+     *  their visitor). Any thread. Stats only. */
+    uint64 GetQueryCount() const { return QueryCount.load(std::memory_order_relaxed); }
+
+    /** Commits skipped because a reader still pinned the retired view. Any thread. Stats only. */
+    uint64 GetDeferredCommitCount() const { return DeferredCommits.load(std::memory_order_relaxed); }
+
+    /** Seconds CommitWrites has spent acquiring the publisher's write lock for its pointer swap, cumulative (readers
+     *  hold the read side only to pin a view). Stats only. */
+    double GetCommitLockWaitSeconds() const;
 
     /**
-     * Query events where PrimaryFaction matches the given faction.
-     * Scans the read buffer from newest to oldest.
-     * Used by TickCrystallization for cultural memory promotion.
+     * Query events where PrimaryFaction matches the given faction, newest-first.
+     * Walks only that faction's posting list, bounded below by the time index.
      *
      * @param Faction       Faction to filter by
      * @param OutEvents     Output array (cleared before use)
      * @param MaxResults    Budget cap on results
+     * @param MinWorldTime  Optional inclusive time window (default: unbounded)
+     * @param MaxWorldTime
      */
     void QueryEventsByFaction(
         const FMythicFactionId &Faction,
         TArray<FMythicWorldEvent> &OutEvents,
-        int32 MaxResults) const;
+        int32 MaxResults,
+        double MinWorldTime = TNumericLimits<double>::Lowest(),
+        double MaxWorldTime = TNumericLimits<double>::Max()) const;
 
     // ─── Serialization ───────────────────────────────────
 
@@ -205,14 +366,13 @@ private:
     /** Write buffer — only touched by background thread */
     TArray<FMythicWorldEvent> WriteBuffer;
 
-    /** Read buffer — snapshot for game thread, copied on CommitWrites under WriteLock */
-    TArray<FMythicWorldEvent> ReadBuffer;
-
-    /** Spatial index for the write buffer (Cell -> Array of EventIds) */
-    TMap<FMythicCellCoord, TArray<uint32>> WriteSpatialIndex;
-
-    /** Spatial index for the read buffer */
-    TMap<FMythicCellCoord, TArray<uint32>> ReadSpatialIndex;
+    /**
+     * Write-side cell chain (see FMythicFabricView): appending is one map write plus one array write; eviction needs no
+     * pruning of the chain itself, and the map entry is dropped only when its head event is evicted. Views copy the
+     * links of the slots they catch up on and patch their own heads slot-by-slot.
+     */
+    TMap<FMythicCellCoord, uint32> WriteCellNewest;
+    TArray<uint32> WritePrevInCell;
 
     /** Write head position in the ring buffer */
     int32 WriteHead = 0;
@@ -220,27 +380,46 @@ private:
     /** Number of events currently in the write buffer */
     int32 WriteCount = 0;
 
-    /** Read head position — snapshot of WriteHead at last commit */
-    int32 ReadHead = 0;
-
-    /** Number of events in the read buffer */
-    int32 ReadCount = 0;
-
     /**
      * The EventId that corresponds to WriteHead=0 in the current ring.
      * Used to translate EventId → ring index.
      */
     uint32 BaseEventId = 1;
 
+    /** Published read views. Exactly two exist: one published, one retired (caught up by the next commit). */
+    static constexpr int32 ViewCount = 2;
+    TMythicSnapshotPublisher<FMythicFabricView, ViewCount - 1> Views;
+
+    using FViewRef = TMythicSnapshotPublisher<FMythicFabricView, ViewCount - 1>::FReadRef;
+
+    /** Pin the published view for one query (null before Initialize) and count the query */
+    FViewRef PinView() const;
+
+    /** Replace both views with whole-ring copies of the write side (Initialize/load) */
+    void ResetViews();
+
+    /** Bring an unpublished view level with the write side. Returns the number of slots copied. */
+    int32 CatchUpView(FMythicFabricView &View) const;
+
     /**
-     * Committed (read-side) snapshot of the EventId-translation basis, captured in CommitWrites under the write lock
-     * so EventIdToIndex stays consistent with the read buffer. Reading the LIVE BaseEventId/NextEventId from the game
-     * thread raced the lock-free sim-thread AppendEvent (which advances them between a commit and a read), returning
-     * the wrong event or nullptr for a live one — and BaseEventId is non-atomic, so that was also a torn read.
+     * Visit one posting list of View, newest-first, within the time window. Adds to VisitedCount for each event handed
+     * to the visitor; returns false once the visitor asks to stop.
      */
-    uint32 ReadBaseEventId = 1;
-    uint32 ReadNewestEventId = 0;
-
-    /** Translate an EventId to a ring buffer index. Returns -1 if outside current ring. */
-    int32 EventIdToIndex(uint32 EventId, int32 HeadPos, int32 Count) const;
+    static bool VisitPostings(
+        const FMythicFabricView &View,
+        const FMythicFabricPostingList &List,
+        double MinWorldTime,
+        double MaxWorldTime,
+        FEventVisitor Visitor,
+        int32 &VisitedCount);
+
+    /** See GetCommitEpoch / GetLastCommitSlotCount / GetCommittedBytes / GetQueryCount / GetDeferredCommitCount */
+    std::atomic<uint64> CommitEpoch{0};
+    std::atomic<int32> LastCommitSlotCount{0};
+    std::atomic<uint64> CommittedBytes{0};
+    mutable std::atomic<uint64> QueryCount{0};
+    std::atomic<uint64> DeferredCommits{0};
+
+    /** See GetCommitLockWaitSeconds */
+    std::atomic<uint64> CommitLockWaitCycles{0};
 };
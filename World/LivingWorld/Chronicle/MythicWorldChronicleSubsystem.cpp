@@ -76,8 +76,8 @@ void UMythicWorldChronicleSubsystem::HandleWorldSimCommitted() {
     }
 
     // Request EXACTLY the unseen window (capped to the ring), so a burst commit of many events isn't silently
-    // skipped by advancing LastSeenEventId past un-ingested ids. GetRecentEvents returns an owned COPY taken under
-    // the fabric read lock — no aliasing of the sim-thread-written buffer.
+    // skipped by advancing LastSeenEventId past un-ingested ids. GetRecentEvents returns an owned COPY out of
+    // the fabric's pinned view — no aliasing of a view the sim thread later recycles.
     const int32 Unseen = static_cast<int32>((NewestId - 1) - LastSeenEventId);
     const int32 Want = FMath::Min(Unseen, Fabric->GetCapacity());
     const TArray<FMythicWorldEvent> Recent = Fabric->GetRecentEvents(Want);
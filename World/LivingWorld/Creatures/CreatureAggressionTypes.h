@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "World/LivingWorld/Creatures/CreatureSpeciesOccupancy.h" // FMythicSpeciesMask
 #include "CreatureAggressionTypes.generated.h"
 
 /**
@@ -35,11 +36,16 @@ struct MYTHIC_API FMythicCreatureAggressionRow : public FTableRowBase {
  * Flattened, lookup-friendly view of the aggression matrix built ONCE from the DataTable (or left empty when no table
  * is authored). Keyed by a packed (Attacker<<8 | Target) uint16 so a per-tick lookup is a single TMap::Find with no
  * string/row-name hashing. Built by the consumer (CreatureEcologyProcessor) and cached for the matrix's lifetime.
+ * HostileRows mirrors Entries as one species bitset per attacker, so "is anything in this cell a target of mine" is a
+ * mask AND against the cell's occupancy before any value lookup.
  */
 struct FMythicCreatureAggressionMatrix {
     /** Packed key -> aggression. Empty => every cross-species lookup returns the default (0). */
     TMap<uint16, float> Entries;
 
+    /** Attacker species -> every target species it has non-zero aggression toward. 256 rows when built, else empty. */
+    TArray<FMythicSpeciesMask> HostileRows;
+
     static uint16 PackKey(uint8 Attacker, uint8 Target) {
         return static_cast<uint16>((static_cast<uint16>(Attacker) << 8) | static_cast<uint16>(Target));
     }
@@ -52,5 +58,11 @@ struct FMythicCreatureAggressionMatrix {
         return 0.0f;
     }
 
+    /** Target species Attacker is hostile toward (empty row when the matrix is unbuilt). */
+    const FMythicSpeciesMask &GetHostileRow(uint8 Attacker) const {
+        static const FMythicSpeciesMask Empty;
+        return HostileRows.IsValidIndex(Attacker) ? HostileRows[Attacker] : Empty;
+    }
+
     bool IsEmpty() const { return Entries.Num() == 0; }
 };
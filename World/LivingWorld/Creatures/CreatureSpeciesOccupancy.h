@@ -0,0 +1,147 @@
+// Mythic Living World — Creature species occupancy grid
+// Dense per-cell species bitsets over the territory grid, maintained incrementally as creatures change cell / despawn.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "World/LivingWorld/LivingWorldTypes.h" // FMythicCellCoord
+
+/**
+ * A set of creature species — one bit per uint8 SpeciesId (256 bits). Used both as "which species occupy this cell"
+ * (FMythicSpeciesOccupancyGrid) and as "which species is this attacker hostile toward" (an aggression-matrix row), so
+ * a cross-species aggression check is a 4-word AND instead of a per-species hash lookup.
+ */
+struct FMythicSpeciesMask {
+    uint64 Words[4] = {0, 0, 0, 0};
+
+    void Set(uint8 Species) { Words[Species >> 6] |= uint64(1) << (Species & 63); }
+    void Clear(uint8 Species) { Words[Species >> 6] &= ~(uint64(1) << (Species & 63)); }
+    bool Contains(uint8 Species) const { return (Words[Species >> 6] & (uint64(1) << (Species & 63))) != 0; }
+    bool IsEmpty() const { return (Words[0] | Words[1] | Words[2] | Words[3]) == 0; }
+
+    FMythicSpeciesMask operator&(const FMythicSpeciesMask &Other) const {
+        FMythicSpeciesMask Out;
+        for (int32 w = 0; w < 4; ++w) {
+            Out.Words[w] = Words[w] & Other.Words[w];
+        }
+        return Out;
+    }
+
+    /** Call Visitor(SpeciesId) for every set bit, lowest id first. */
+    template <typename FVisitor>
+    void ForEachSpecies(FVisitor &&Visitor) const {
+        for (int32 w = 0; w < 4; ++w) {
+            uint64 Bits = Words[w];
+            while (Bits) {
+                Visitor(static_cast<uint8>(w * 64 + FMath::CountTrailingZeros64(Bits)));
+                Bits &= Bits - 1;
+            }
+        }
+    }
+};
+
+/**
+ * Which creature species occupy each territory cell, kept current incrementally.
+ *
+ * PURPOSE: the ecology processor used to rebuild a TMap<Cell, TSet<Species>> from every creature each tick before the
+ * cross-species aggression pass — O(N) hashing + per-cell set allocations every time, which is why ecology was
+ * throttled. Now occupancy is a flat Width x Height array of FMythicSpeciesMask (32 B/cell) plus a per-(cell, species)
+ * head count, touched only when a creature actually changes cell or despawns.
+ *
+ * MAINTENANCE: the ecology processor Moves/Adds creatures whose Identity.Cell differs from the cell recorded on their
+ * FMythicCreatureFragment (OccupancyCell), and UMythicCreatureOccupancyRemoveObserver Removes despawned ones. A bit is
+ * set while its species' count in the cell is > 0. Counts live in a sparse map keyed by (cell, species) — they are only
+ * read on the Add/Remove edge, never by the per-creature query, which reads the dense mask alone.
+ *
+ * BOUNDS: cells outside [0, Width) x [0, Height) are not tracked (Add returns false and GetMask reads empty), so a
+ * creature off the territory grid simply feels no cross-species aggression — the same as standing alone in a cell.
+ *
+ * Pure data (no UObject, no world). Game-thread only, like FMythicCellSpatialIndex; owned by
+ * UMythicCellEntityIndexSubsystem. Verified by Mythic.LivingWorld.Creatures.SpeciesOccupancy.
+ */
+struct FMythicSpeciesOccupancyGrid {
+    // Size (or re-size) the grid and drop all occupancy. Callers re-Add their creatures afterwards.
+    void Initialize(int32 InWidth, int32 InHeight) {
+        Width = FMath::Max(0, InWidth);
+        Height = FMath::Max(0, InHeight);
+        Masks.Reset();
+        Masks.SetNum(Width * Height);
+        Counts.Reset();
+    }
+
+    void Reset() {
+        Width = 0;
+        Height = 0;
+        Masks.Empty();
+        Counts.Empty();
+    }
+
+    bool IsInitialized() const { return Masks.Num() > 0; }
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    // Flat index of Cell, or INDEX_NONE when it is off the grid.
+    int32 GetCellIndex(const FMythicCellCoord &Cell) const {
+        if (Cell.X < 0 || Cell.Y < 0 || Cell.X >= Width || Cell.Y >= Height) {
+            return INDEX_NONE;
+        }
+        return Cell.Y * Width + Cell.X;
+    }
+
+    // Count one creature of Species in Cell. Returns false (and tracks nothing) when Cell is off the grid.
+    bool Add(const FMythicCellCoord &Cell, uint8 Species) {
+        const int32 Index = GetCellIndex(Cell);
+        if (Index == INDEX_NONE) {
+            return false;
+        }
+        if (++Counts.FindOrAdd(PackKey(Index, Species)) == 1) {
+            Masks[Index].Set(Species);
+        }
+        return true;
+    }
+
+    // Uncount one creature of Species from Cell. Safe on an untracked pair (no-op).
+    void Remove(const FMythicCellCoord &Cell, uint8 Species) {
+        const int32 Index = GetCellIndex(Cell);
+        if (Index == INDEX_NONE) {
+            return;
+        }
+        const uint32 Key = PackKey(Index, Species);
+        uint16 *Count = Counts.Find(Key);
+        if (!Count) {
+            return;
+        }
+        if (--*Count == 0) {
+            Counts.Remove(Key);
+            Masks[Index].Clear(Species);
+        }
+    }
+
+    // Species present in Cell (empty for an off-grid or unoccupied cell).
+    const FMythicSpeciesMask &GetMask(const FMythicCellCoord &Cell) const {
+        static const FMythicSpeciesMask Empty;
+        const int32 Index = GetCellIndex(Cell);
+        return Index == INDEX_NONE ? Empty : Masks[Index];
+    }
+
+    // Creatures of Species counted in Cell.
+    int32 GetCount(const FMythicCellCoord &Cell, uint8 Species) const {
+        const int32 Index = GetCellIndex(Cell);
+        const uint16 *Count = Index == INDEX_NONE ? nullptr : Counts.Find(PackKey(Index, Species));
+        return Count ? *Count : 0;
+    }
+
+private:
+    static uint32 PackKey(int32 CellIndex, uint8 Species) {
+        return (static_cast<uint32>(CellIndex) << 8) | Species;
+    }
+
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Width x Height species bitsets, row-major (Y * Width + X) */
+    TArray<FMythicSpeciesMask> Masks;
+
+    /** (cell index << 8 | species) → creatures of that species in that cell; absent = 0 */
+    TMap<uint32, uint16> Counts;
+};
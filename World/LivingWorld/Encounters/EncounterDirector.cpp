@@ -427,7 +427,8 @@ void UMythicEncounterDirector::SpawnEncounter(
 
         // Batch-create entities
         TArray<FMassEntityHandle> SpawnedEntities;
-        EntityManager.BatchCreateEntities(Archetype, Template.EntityCount, SpawnedEntities);
+        // Held until the fragments below are written — the cell-index observers fire on its release.
+        const TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = EntityManager.BatchCreateEntities(Archetype, Template.EntityCount, SpawnedEntities);
 
         // R18-M7-r1: the registry's global monotonic AllocateSpawnSerial is the shared collision-free NameHash source.
         UMythicPersistentNPCRegistry *Registry = LivingWorld ? LivingWorld->GetPersistentNPCRegistry() : nullptr;
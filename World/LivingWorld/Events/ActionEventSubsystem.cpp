@@ -103,8 +103,12 @@ void UMythicActionEventSubsystem::FlushProcessedEvents() {
     PendingEvents.RemoveAll([](const FMythicPendingActionEvent &Evt) { return Evt.bFullyProcessed; });
 }
 
-void UMythicActionEventSubsystem::FlushProcessedWitnessResults() {
-    PendingWitnessResults.Reset();
+void UMythicActionEventSubsystem::FlushProcessedWitnessResults(int32 NumConsumed) {
+    if (NumConsumed >= PendingWitnessResults.Num()) {
+        PendingWitnessResults.Reset();
+    } else if (NumConsumed > 0) {
+        PendingWitnessResults.RemoveAt(0, NumConsumed, EAllowShrinking::No);
+    }
 }
 
 FMythicCellCoord UMythicActionEventSubsystem::ResolveActorCell(const AActor *Actor) const {
@@ -50,8 +50,9 @@ public:
     /** Get pending witness results for the pressure processor */
     TArray<FMythicWitnessResult> &GetPendingWitnessResults() { return PendingWitnessResults; }
 
-    /** Remove consumed witness results */
-    void FlushProcessedWitnessResults();
+    /** Remove the first NumConsumed witness results. The rest stay queued, in order, for the next pressure pass — a
+     *  budget-capped pass defers reactions, it never drops them. */
+    void FlushProcessedWitnessResults(int32 NumConsumed);
 
     /** Check if there are pending events or witness results to process */
     bool HasPendingWork() const { return PendingEvents.Num() > 0 || PendingWitnessResults.Num() > 0; }
@@ -8,16 +8,13 @@ void UMythicFactionDatabase::Initialize(const UMythicFactionDatabaseSettings *Se
 
     MaxFactions = Settings->MaxFactions;
     WriteFactions.SetNum(MaxFactions);
-    ReadFactions.SetNum(MaxFactions);
 
     const int32 RelationCount = MaxFactions * MaxFactions;
     WriteRelationships.SetNum(RelationCount);
-    ReadRelationships.SetNum(RelationCount);
 
     // Default all relationships to Neutral
     for (int32 i = 0; i < RelationCount; ++i) {
         WriteRelationships[i] = EMythicFactionRelation::Neutral;
-        ReadRelationships[i] = EMythicFactionRelation::Neutral;
     }
 
     // Load initial factions
@@ -47,31 +44,35 @@ void UMythicFactionDatabase::BeginDestroy() {
     // Explicitly empty arrays to ensure FText/struct destruction happens 
     // before the UObject memory is reclaimed
     WriteFactions.Empty();
-    ReadFactions.Empty();
     WriteRelationships.Empty();
-    ReadRelationships.Empty();
+
+    // Unpublish and drop our references. A reader still holding a snapshot keeps it alive on its own ref-count; the
+    // snapshot is plain C++, so it safely outlives this UObject.
+    FScopeLock Lock(&SnapshotLock);
+    Snapshots.Reset();
+}
+
+FMythicFactionSnapshotRef UMythicFactionDatabase::AcquireSnapshot() const {
+    return Snapshots.Acquire();
 }
 
 bool UMythicFactionDatabase::GetFaction(FMythicFactionId Id, FMythicFactionData &OutData) const {
-    if (!Id.IsValid() || Id.Index >= RegisteredCount) {
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    const FMythicFactionData *Data = Snapshot ? Snapshot->GetFaction(Id) : nullptr;
+    if (!Data) {
         return false;
     }
-
-    FScopeLock Lock(&SnapshotLock);
-    OutData = ReadFactions[Id.Index];
+    OutData = *Data;
     return true;
 }
 
 bool UMythicFactionDatabase::GetFactionMoralProfile(FMythicFactionId Id, FMythicFactionMoralProfile &Out) const {
-    if (!Id.IsValid() || Id.Index >= RegisteredCount) {
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    const FMythicFactionMoralProfile *Profile = Snapshot ? Snapshot->GetMoralProfile(Id) : nullptr;
+    if (!Profile) {
         return false;
     }
-    FScopeLock Lock(&SnapshotLock);
-    const FMythicFactionData &Data = ReadFactions[Id.Index];
-    Out.Ideology = Data.Ideology;
-    Out.DisapproveThreshold = Data.DisapproveThreshold;
-    Out.CondemnThreshold = Data.CondemnThreshold;
-    Out.HostileThreshold = Data.HostileThreshold;
+    Out = *Profile;
     return true;
 }
 
@@ -219,20 +220,44 @@ void UMythicFactionDatabase::ForEachAliveFactionMutable(TFunctionRef<void(FMythi
 void UMythicFactionDatabase::CommitWrites() {
     FScopeLock Lock(&SnapshotLock);
 
-    // SAFETY: Use TArray assignment, NOT Memcpy. 
+    const uint64 Epoch = PublishedEpoch.load(std::memory_order_relaxed) + 1;
+
+    // Storage for the new generation: a retired snapshot no reader holds, when there is one.
+    TRefCountPtr<FMythicFactionSnapshot> Next = Snapshots.BeginWrite();
+
+    // SAFETY: Use TArray assignment, NOT Memcpy.
     // FMythicFactionData contains FText which requires copy construction to manage ref-counts.
-    // Memcpy bypasses this, leading to double-free crashes.
-    ReadFactions = WriteFactions;
-    ReadRelationships = WriteRelationships;
+    // Memcpy bypasses this, leading to double-free crashes. Assignment into a recycled snapshot reuses its allocations.
+    FMythicFactionSnapshot &Snapshot = *Next;
+    Snapshot.Epoch = Epoch;
+    Snapshot.RegisteredCount = RegisteredCount.load();
+    Snapshot.MaxFactions = MaxFactions;
+    Snapshot.Factions = WriteFactions;
+    Snapshot.Relationships = WriteRelationships;
+    Snapshot.MoralProfiles.SetNum(WriteFactions.Num(), EAllowShrinking::No);
+    for (int32 i = 0; i < WriteFactions.Num(); ++i) {
+        const FMythicFactionData &Data = WriteFactions[i];
+        FMythicFactionMoralProfile &Profile = Snapshot.MoralProfiles[i];
+        Profile.Ideology = Data.Ideology;
+        Profile.DisapproveThreshold = Data.DisapproveThreshold;
+        Profile.CondemnThreshold = Data.CondemnThreshold;
+        Profile.HostileThreshold = Data.HostileThreshold;
+    }
+
+    Snapshots.Publish(MoveTemp(Next));
+    PublishedEpoch.store(Epoch, std::memory_order_release);
 }
 
 
 bool UMythicFactionDatabase::FindFactionByTag(const FGameplayTag &Tag, FMythicFactionData &OutData, FMythicFactionId *OutId) const {
-    FScopeLock Lock(&SnapshotLock);
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    if (!Snapshot) {
+        return false;
+    }
 
-    for (int32 i = 0; i < RegisteredCount; ++i) {
-        if (ReadFactions[i].FactionTag == Tag) {
-            OutData = ReadFactions[i];
+    for (int32 i = 0; i < Snapshot->RegisteredCount; ++i) {
+        if (Snapshot->Factions[i].FactionTag == Tag) {
+            OutData = Snapshot->Factions[i];
             if (OutId) {
                 OutId->Index = static_cast<uint8>(i);
             }
@@ -243,10 +268,13 @@ bool UMythicFactionDatabase::FindFactionByTag(const FGameplayTag &Tag, FMythicFa
 }
 
 FMythicFactionId UMythicFactionDatabase::FindFactionId(const FGameplayTag &Tag) const {
-    FScopeLock Lock(&SnapshotLock);
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    if (!Snapshot) {
+        return FMythicFactionId();
+    }
 
-    for (int32 i = 0; i < RegisteredCount; ++i) {
-        if (ReadFactions[i].FactionTag == Tag) {
+    for (int32 i = 0; i < Snapshot->RegisteredCount; ++i) {
+        if (Snapshot->Factions[i].FactionTag == Tag) {
             FMythicFactionId Id;
             Id.Index = static_cast<uint8>(i);
             return Id;
@@ -256,25 +284,18 @@ FMythicFactionId UMythicFactionDatabase::FindFactionId(const FGameplayTag &Tag)
 }
 
 EMythicFactionRelation UMythicFactionDatabase::GetRelationship(FMythicFactionId A, FMythicFactionId B) const {
-    if (!A.IsValid() || !B.IsValid() || A.Index >= RegisteredCount || B.Index >= RegisteredCount) {
-        return EMythicFactionRelation::Neutral;
-    }
-
-    if (A == B) {
-        return EMythicFactionRelation::Allied;
-    }
-
-    FScopeLock Lock(&SnapshotLock);
-    return ReadRelationships[RelationIndex(A, B)];
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    return Snapshot ? Snapshot->GetRelationship(A, B) : EMythicFactionRelation::Neutral;
 }
 
 int32 UMythicFactionDatabase::GetActiveFactionCount() const {
-    // Guard the ReadFactions iteration against CommitWrites' `ReadFactions = WriteFactions` reassignment on the sim
-    // thread — every sibling Read-snapshot accessor takes this lock; this method was the lone omission.
-    FScopeLock Lock(&SnapshotLock);
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    if (!Snapshot) {
+        return 0;
+    }
     int32 Count = 0;
-    for (int32 i = 0; i < RegisteredCount; ++i) {
-        if (ReadFactions[i].bAlive) {
+    for (int32 i = 0; i < Snapshot->RegisteredCount; ++i) {
+        if (Snapshot->Factions[i].bAlive) {
             ++Count;
         }
     }
@@ -282,12 +303,16 @@ int32 UMythicFactionDatabase::GetActiveFactionCount() const {
 }
 
 void UMythicFactionDatabase::ForEachAliveFaction(TFunctionRef<void(FMythicFactionId, const FMythicFactionData &)> Callback) const {
-    FScopeLock Lock(&SnapshotLock);
-    for (int32 i = 0; i < RegisteredCount; ++i) {
-        if (ReadFactions[i].bAlive) {
+    // The held snapshot is immutable, so the callback may freely re-enter any read accessor (no lock is held here).
+    const FMythicFactionSnapshotRef Snapshot = AcquireSnapshot();
+    if (!Snapshot) {
+        return;
+    }
+    for (int32 i = 0; i < Snapshot->RegisteredCount; ++i) {
+        if (Snapshot->Factions[i].bAlive) {
             FMythicFactionId Id;
             Id.Index = static_cast<uint8>(i);
-            Callback(Id, ReadFactions[i]);
+            Callback(Id, Snapshot->Factions[i]);
         }
     }
 }
@@ -342,10 +367,8 @@ void UMythicFactionDatabase::Serialize(FArchive &Ar) {
             return;
         }
         WriteFactions.SetNum(MaxFactions);
-        ReadFactions.SetNum(MaxFactions);
         const int32 RelationCount = MaxFactions * MaxFactions;
         WriteRelationships.SetNum(RelationCount);
-        ReadRelationships.SetNum(RelationCount);
     }
 
     // Serialize each faction's data
@@ -427,7 +450,7 @@ void UMythicFactionDatabase::Serialize(FArchive &Ar) {
     }
 
     if (Ar.IsLoading()) {
-        // Commit loaded data to the read buffer
+        // Publish loaded data as a fresh snapshot
         CommitWrites();
     }
 }
@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "World/LivingWorld/LivingWorldTypes.h"
+#include "Templates/RefCounting.h"
+#include "World/LivingWorld/MythicSnapshotPublisher.h"
 #include <atomic>
 
 #include "Engine/DataAsset.h"
@@ -437,6 +439,69 @@ struct FMythicFactionMoralProfile {
     float HostileThreshold = 0.8f;
 };
 
+// ─────────────────────────────────────────────────────────────
+// Faction Snapshot — Immutable published read view
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * One committed generation of the faction database: the faction records, the relationship matrix and the per-faction
+ * moral profiles, frozen together at a CommitWrites. Readers obtain it from UMythicFactionDatabase::AcquireSnapshot with a
+ * pointer copy plus a ref-count bump, then index it freely — no lock held, no per-read copy — for as long as they
+ * hold the reference. A snapshot is never mutated while published or referenced; the publisher only recycles it once
+ * every reader has released it (see CommitWrites). Plain C++ (no USTRUCT): it is a transient read view, never serialized.
+ *
+ * Bounds come from RegisteredCount frozen at commit time, so a faction registered on the sim thread but not yet committed
+ * is invisible here rather than reading a default-constructed (and spuriously alive) slot.
+ */
+class MYTHIC_API FMythicFactionSnapshot : public FThreadSafeRefCountedObject {
+public:
+    /** Monotonic commit generation this snapshot was published at (1 = the Initialize commit) */
+    uint64 Epoch = 0;
+
+    /** Number of factions registered when this snapshot was committed */
+    int32 RegisteredCount = 0;
+
+    /** Matrix stride (UMythicFactionDatabase::MaxFactions at commit time) */
+    int32 MaxFactions = 0;
+
+    /** Faction records, sized MaxFactions; only [0, RegisteredCount) are meaningful */
+    TArray<FMythicFactionData> Factions;
+
+    /** Moral-evaluation subset of Factions, precomputed at commit so the witness path touches 44 bytes, not a whole record */
+    TArray<FMythicFactionMoralProfile> MoralProfiles;
+
+    /** Relationship matrix, MaxFactions x MaxFactions, same layout as the database's write matrix */
+    TArray<EMythicFactionRelation> Relationships;
+
+    bool IsValidFaction(FMythicFactionId Id) const { return Id.IsValid() && Id.Index < RegisteredCount; }
+
+    /** Faction record, or nullptr if the id is invalid or uncommitted */
+    const FMythicFactionData *GetFaction(FMythicFactionId Id) const {
+        return IsValidFaction(Id) ? &Factions[Id.Index] : nullptr;
+    }
+
+    /** Moral profile, or nullptr if the id is invalid or uncommitted */
+    const FMythicFactionMoralProfile *GetMoralProfile(FMythicFactionId Id) const {
+        return IsValidFaction(Id) ? &MoralProfiles[Id.Index] : nullptr;
+    }
+
+    /** Relationship between two factions. Self is Allied; unknown ids are Neutral (matches the database accessor). */
+    EMythicFactionRelation GetRelationship(FMythicFactionId A, FMythicFactionId B) const {
+        if (!IsValidFaction(A) || !IsValidFaction(B)) {
+            return EMythicFactionRelation::Neutral;
+        }
+        if (A == B) {
+            return EMythicFactionRelation::Allied;
+        }
+        const int32 Low = FMath::Min(A.Index, B.Index);
+        const int32 High = FMath::Max(A.Index, B.Index);
+        return Relationships[Low * MaxFactions + High];
+    }
+};
+
+/** Shared read handle to a published faction snapshot. Null only before Initialize / after BeginDestroy. */
+using FMythicFactionSnapshotRef = TRefCountPtr<const FMythicFactionSnapshot>;
+
 // ─────────────────────────────────────────────────────────────
 // Faction Database Settings — Data asset
 // ─────────────────────────────────────────────────────────────
@@ -464,6 +529,10 @@ public:
  * game thread reads from the committed snapshot.
  *
  * Faction relationships are stored as a flat array (NxN matrix, packed upper triangle).
+ *
+ * The read side is an immutable FMythicFactionSnapshot published by CommitWrites through a TMythicSnapshotPublisher. Hot
+ * callers (per-witness, per-promotion) should AcquireSnapshot once per Execute and index it directly; the copy-out
+ * getters below remain for cold callers (one acquire per call).
  */
 UCLASS()
 class MYTHIC_API UMythicFactionDatabase : public UObject {
@@ -519,18 +588,32 @@ public:
     /** Iterate all alive factions in write buffer (background thread only) */
     void ForEachAliveFactionMutable(TFunctionRef<void(FMythicFactionId, FMythicFactionData &)> Callback);
 
-    /** Commit the write buffer — game thread snapshot swap */
+    /**
+     * Commit the write buffer: build a new immutable snapshot and publish it (one pointer swap). The snapshot storage is
+     * recycled from a retired generation once no reader holds it, so the steady state reuses array allocations instead
+     * of allocating per commit. Publishers are serialized by SnapshotLock; readers never take it.
+     */
     void CommitWrites();
 
-    // ─── Read Interface (Game Thread — Lock-Free) ─────────
+    // ─── Read Interface (Game Thread — Snapshot Reads) ─────
+
+    /**
+     * Acquire the current published snapshot: a pointer copy + ref-count increment under the publisher's read lock (see
+     * TMythicSnapshotPublisher; held for those two steps only). The returned handle stays valid and unchanged across any
+     * number of later commits until it is released. Hold it for the duration of one Execute/tick — not across frames —
+     * so retired generations can be recycled. Thread-safe.
+     */
+    FMythicFactionSnapshotRef AcquireSnapshot() const;
+
+    /** Commit generation of the currently published snapshot (0 before Initialize). Thread-safe. */
+    uint64 GetSnapshotEpoch() const { return PublishedEpoch.load(std::memory_order_acquire); }
 
     /** Get faction data by ID (read snapshot). Returns false if ID is invalid. Copies thread-safe snapshot. */
     bool GetFaction(FMythicFactionId Id, FMythicFactionData &OutData) const;
 
     /** Lightweight read: copy ONLY a faction's moral-evaluation fields (ideology + the three severity thresholds) from
-     *  the snapshot. For the hot witness-perception path, which evaluates severity per near-witness — copying the full
-     *  FMythicFactionData there needlessly lengthened the SnapshotLock critical section every faction-DB reader shares.
-     *  Returns false if ID is invalid. Thread-safe (same lock as GetFaction). */
+     *  the snapshot. Per-witness loops should prefer AcquireSnapshot()->GetMoralProfile, which skips the copy and the
+     *  per-call acquire entirely. Returns false if ID is invalid. Thread-safe. */
     bool GetFactionMoralProfile(FMythicFactionId Id, FMythicFactionMoralProfile &Out) const;
 
     /** Get faction by gameplay tag. Linear scan — use sparingly. Copies thread-safe snapshot. Optionally returns ID. */
@@ -579,24 +662,24 @@ private:
     UPROPERTY(Transient)
     TArray<FMythicFactionData> WriteFactions;
 
-    /** Read buffer — game thread snapshot */
-    UPROPERTY(Transient)
-    TArray<FMythicFactionData> ReadFactions;
-
     /** Relationship matrix — flat array, indexed by RelationIndex(A, B) */
     UPROPERTY(Transient)
     TArray<EMythicFactionRelation> WriteRelationships;
 
-    UPROPERTY(Transient)
-    TArray<EMythicFactionRelation> ReadRelationships;
-
     /** Number of factions currently registered. Atomic: the sim thread increments it under SimulationLock (RegisterFaction,
      *  SpawnSplinterFaction), while game-thread accessors (GetFaction/GetActiveFactionCount/ForEachAliveFaction) read it
      *  lock-free — a plain int32 there is a data race (benign-bounded, but real UB). Atomic load/store removes it. */
     std::atomic<int32> RegisteredCount = 0;
 
-    /** Lock protecting the Read snapshots from concurrent modification by CommitWrites */
-    mutable FCriticalSection SnapshotLock;
+    /** Serializes publishers (CommitWrites from the sim thread vs. Initialize/load/seed on the game thread) over the
+     *  publisher side of Snapshots. Readers never take it. */
+    FCriticalSection SnapshotLock;
+
+    /** Published snapshot + up to 4 pooled retired generations (publisher side under SnapshotLock) */
+    TMythicSnapshotPublisher<FMythicFactionSnapshot, 4> Snapshots;
+
+    /** Epoch of the published snapshot; the next commit publishes PublishedEpoch + 1 */
+    std::atomic<uint64> PublishedEpoch{0};
 
     /** Flatten two faction IDs into a relationship matrix index (upper triangle) */
     int32 RelationIndex(FMythicFactionId A, FMythicFactionId B) const {
@@ -4,7 +4,7 @@
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
 #include "World/LivingWorld/Encounters/EncounterDirector.h"
-#include "World/LivingWorld/Settlements/MythicSettlement.h" // FMythicSettlementData (complete type for settlement sync)
+#include "World/LivingWorld/Settlements/SettlementRegistry.h" // FMythicSettlementSnapshot (settlement sync source)
 #include "Net/UnrealNetwork.h"
 #include "World/LivingWorld/LivingWorldSettings.h"
 #include "Engine/GameInstance.h"
@@ -57,6 +57,12 @@ void AMythicLivingWorldReplicator::NotifyClientProxiesChanged() {
     }
 }
 
+void AMythicLivingWorldReplicator::NotifyClientTerritoryCellChanged(const FMythicTerritoryProxyItem &Item) {
+    if (UMythicLivingWorldSubsystem *Sub = ClientSubsystem.Get()) {
+        Sub->OnTerritoryProxyCellChanged.Broadcast(Item);
+    }
+}
+
 const FMythicFactionProxyItem *AMythicLivingWorldReplicator::GetFactionProxy(FMythicFactionId FactionId) const {
     for (const FMythicFactionProxyItem &Item : FactionProxies.Items) {
         if (Item.FactionId == FactionId) {
@@ -92,11 +98,17 @@ void FMythicFactionProxyItem::PreReplicatedRemove(const FMythicFactionProxyArray
 }
 
 void FMythicTerritoryProxyItem::PostReplicatedAdd(const FMythicTerritoryProxyArray &InArraySerializer) {
-    if (InArraySerializer.OwnerReplicator) { InArraySerializer.OwnerReplicator->NotifyClientProxiesChanged(); }
+    if (InArraySerializer.OwnerReplicator) {
+        InArraySerializer.OwnerReplicator->NotifyClientTerritoryCellChanged(*this);
+        InArraySerializer.OwnerReplicator->NotifyClientProxiesChanged();
+    }
 }
 
 void FMythicTerritoryProxyItem::PostReplicatedChange(const FMythicTerritoryProxyArray &InArraySerializer) {
-    if (InArraySerializer.OwnerReplicator) { InArraySerializer.OwnerReplicator->NotifyClientProxiesChanged(); }
+    if (InArraySerializer.OwnerReplicator) {
+        InArraySerializer.OwnerReplicator->NotifyClientTerritoryCellChanged(*this);
+        InArraySerializer.OwnerReplicator->NotifyClientProxiesChanged();
+    }
 }
 
 void FMythicTerritoryProxyItem::PreReplicatedRemove(const FMythicTerritoryProxyArray &InArraySerializer) {
@@ -315,21 +327,17 @@ void AMythicLivingWorldReplicator::SyncProxies(UMythicLivingWorldSubsystem *Subs
     }
 
     // ─── Sync Settlements (added on registration; GoverningFaction / capital can change on conquest) ───
-    // Walk the registry through the subsystem's thread-safe copy-out helpers (the sim thread mutates Settlements under
-    // SimulationLock — CopyAllSettlementIds / CopySettlementById snapshot by value under that lock). Settlement counts
-    // are tiny, so the linear scans / by-value copies are trivial. Settlements persist for the level's life (placed
+    // Read the registry's published snapshot (a pinned pointer copy, no SimulationLock, no per-settlement deep copy of
+    // shops and rasterized cells). The registry only republishes on a real change, so an unchanged epoch skips the pass.
+    // Settlement counts are tiny, so the linear proxy scan is trivial. Settlements persist for the level's life (placed
     // actors), so unlike encounters they are not removed here; only adds + field updates are synced.
-    {
-        TArray<int32> SettlementIds;
-        Subsystem->CopyAllSettlementIds(SettlementIds);
+    const FMythicSettlementSnapshotRef SettlementSnap = Subsystem->AcquireSettlementSnapshot();
+    if (SettlementSnap && SettlementSnap->Epoch != LastSyncedSettlementEpoch) {
+        LastSyncedSettlementEpoch = SettlementSnap->Epoch;
 
         bool bSettlementsChanged = false;
-        for (const int32 SettlementId : SettlementIds) {
-            FMythicSettlementData SData;
-            if (!Subsystem->CopySettlementById(SettlementId, SData)) {
-                continue;
-            }
-
+        for (const FMythicSettlementSnapshotEntry &SData : SettlementSnap->Settlements) {
+            const int32 SettlementId = SData.SettlementId;
             FMythicSettlementProxyItem *Proxy = SettlementProxies.Items.FindByPredicate(
                 [SettlementId](const FMythicSettlementProxyItem &P) { return P.SettlementId == SettlementId; });
 
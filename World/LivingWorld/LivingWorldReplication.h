@@ -265,6 +265,10 @@ public:
     /** Fast lookup for territory proxies */
     TMap<FMythicCellCoord, int32> TerritoryProxyIndex;
 
+    /** SERVER: epoch of the settlement snapshot SettlementProxies last synced from. The settlement registry only
+     *  republishes on a real change, so an equal epoch skips the settlement pass entirely. */
+    uint64 LastSyncedSettlementEpoch = 0;
+
     /** Sync current subsystem state into these arrays (called on Server by Subsystem) */
     void SyncProxies(class UMythicLivingWorldSubsystem *Subsystem);
 
@@ -299,6 +303,10 @@ public:
      *  change delegate so UI/gameplay can react. No-op on the server (it is the source). */
     void NotifyClientProxiesChanged();
 
+    /** Called by the territory item callbacks on the CLIENT with the cell that just replicated in — broadcasts the
+     *  subsystem's per-cell delegate so incremental consumers see exactly which cells changed. */
+    void NotifyClientTerritoryCellChanged(const FMythicTerritoryProxyItem &Item);
+
 private:
     /** CLIENT only: the local subsystem this replicator registers with (so subsystem accessors + delegate work
      *  client-side, where the subsystem otherwise never learns about the server-spawned replicator). */
@@ -98,6 +98,33 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation", meta = (ClampMin = "0.1", ClampMax = "10.0"))
     float SimTickIntervalSeconds = 1.0f;
 
+    /**
+     * Run the sim sub-steps (economy, diplomacy, territory, ideology, …) as a dependency-ordered task graph across
+     * worker cores instead of back to back on the sim thread. Sub-steps only overlap when their declared read/write
+     * sets are disjoint, so the committed result is identical to the serial order. Disable to debug a sub-step in
+     * isolation or on single-core targets.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+    bool bParallelSimPhases = true;
+
+    /**
+     * Seed of the sim's dice (schism ideology mutation, scheme generation and discovery). Each phase draws from its own
+     * stream derived from this seed and the tick index, so a given seed replays the same world whether the sub-steps
+     * run serially or in parallel.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation")
+    int32 SimRandomSeed = 0;
+
+    /**
+     * Max committed fabric events the per-tick event digest walks (newest first). The digest is the single pass that
+     * feeds diplomacy, ideology metabolism and faction evolution; each consumer still applies its own per-pair /
+     * per-faction cap (DiplomacyEventScanCap, IdeologyEventScanCap). Match FabricCapacity to see the whole ring.
+     * Crystallization's culture window (each faction's newest 64 primary events) is read from the faction postings and
+     * is not bounded by this cap.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Simulation", meta = (ClampMin = "64", ClampMax = "65536"))
+    int32 SimEventDigestScanCap = 4096;
+
     // ─── Budget Caps ──────────────────────────────────────
 
     /** Max significance promotions per game frame */
@@ -120,6 +147,34 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets", meta = (ClampMin = "1", ClampMax = "50"))
     int32 MaxPropagationsPerFrame = 10;
 
+    // ─── Adaptive Budgets ─────────────────────────────────
+
+    /**
+     * Let UMythicLivingWorldBudgetSubsystem re-divide the processor caps every frame (witness / pressure evals,
+     * promotions, rescores, placement validations, population / patrol / creature spawns) from measured cost per unit,
+     * backlog and game-thread frame time. The static caps become anchors: each lane stays within
+     * [cap * AdaptiveBudgetFloorScale, cap * AdaptiveBudgetCeilingScale]. Off = the static caps, exactly as authored.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets")
+    bool bAdaptiveBudgets = true;
+
+    /** Game-thread milliseconds per frame the budgeted living-world processors may spend between them */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets", meta = (ClampMin = "0.1", ClampMax = "50.0"))
+    float AdaptiveBudgetMs = 2.0f;
+
+    /** Game-thread frame time the budget is sized for. Faster frames grow it (up to 2x), slower frames shrink it
+     *  (down to 0.25x). 0 = no frame scaling. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+    float AdaptiveBudgetTargetFrameMs = 16.6f;
+
+    /** Fraction of each static cap a lane is always granted, however tight the budget */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float AdaptiveBudgetFloorScale = 0.25f;
+
+    /** Multiple of each static cap a lane may grow to on quiet frames */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Budgets", meta = (ClampMin = "1.0", ClampMax = "16.0"))
+    float AdaptiveBudgetCeilingScale = 4.0f;
+
     // ─── Significance ─────────────────────────────────────
 
     /** Score threshold to promote an NPC from Tier 0 to Tier 1 */
@@ -626,8 +681,9 @@ public:
 
     // ─── Creature Ecology ────────────────────────────────
 
-    /** Interval in seconds between creature ecology processor ticks */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Creature Ecology", meta = (ClampMin = "0.1", ClampMax = "5.0"))
+    /** Interval in seconds between creature ecology processor ticks. 0 = every frame (the pass is incremental: only
+     *  creatures that changed cell touch the species occupancy grid). */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Creature Ecology", meta = (ClampMin = "0.0", ClampMax = "5.0"))
     float CreatureEcologyIntervalSeconds = 0.5f;
 
     /** Cells within which pack members share pressure state */
@@ -674,6 +730,11 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cognitive", meta = (ClampMin = "0.5", ClampMax = "10.0"))
     float CognitiveThinkIntervalMax = 2.0f;
 
+    /** Brains per contiguous batch in a cognition-scheduler think wave. Each batch is one ParallelFor work item —
+     *  larger batches mean less scheduling overhead but coarser load balancing. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cognitive", meta = (ClampMin = "1", ClampMax = "64"))
+    int32 CognitiveThinkBatchSize = 8;
+
     /** Utility margin required to override current intention (prevents flickering). */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Cognitive", meta = (ClampMin = "0.0", ClampMax = "1.0"))
     float DesireHysteresis = 0.2f;
@@ -1076,6 +1137,36 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0", ClampMax = "64"))
     int32 EmbodimentPoolWarmCount = 4;
 
+    /** Game-thread milliseconds per frame the pool warmer may spend spawning + parking actors. The first spawn of a tick
+     *  always runs (so warming progresses even if one spawn exceeds the budget); the overshoot is bounded by one spawn. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0.05", ClampMax = "16.0"))
+    float EmbodimentPoolWarmBudgetMs = 1.0f;
+
+    /** Size each class bucket from the settlement densities + wilderness cells along every player's projected path
+     *  (position + velocity). false => buckets only hold EmbodimentPoolWarmCount plus whatever Release returns. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool")
+    bool bPredictiveEmbodimentPool = true;
+
+    /** How far ahead (seconds of current velocity) the pool predictor projects each player's path. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0.0", ClampMax = "60.0", EditCondition = "bPredictiveEmbodimentPool"))
+    float EmbodimentPoolLookaheadSeconds = 8.0f;
+
+    /** Cells swept either side of each projected path sample (Chebyshev radius). ~ the embodiment radius in cells. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0", ClampMax = "8", EditCondition = "bPredictiveEmbodimentPool"))
+    int32 EmbodimentPoolLookaheadRadiusCells = 2;
+
+    /** Seconds between pool target re-predictions (the warm/trim work itself runs every frame under budget). */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0.1", ClampMax = "10.0", EditCondition = "bPredictiveEmbodimentPool"))
+    float EmbodimentPoolPredictIntervalSeconds = 0.5f;
+
+    /** Trim parked actors above target only while available physical memory is below this (MB). 0 => never trim. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0"))
+    int32 EmbodimentPoolLowMemoryMB = 1024;
+
+    /** A bucket must have seen no Acquire hit / Release for this long before the low-memory trim touches it. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Living World | Embodiment | Pool", meta = (ClampMin = "0.0", ClampMax = "600.0"))
+    float EmbodimentPoolIdleTrimSeconds = 20.0f;
+
     /** Wildlife species table (rowstruct FMythicCreatureSpeciesRow). Null => the built-in code-default species set. */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Creature Ecology")
     TSoftObjectPtr<UDataTable> CreatureSpeciesTable;
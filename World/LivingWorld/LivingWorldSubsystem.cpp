@@ -18,9 +18,39 @@
 #include "Settings/MythicDeveloperSettings.h"
 #include "AI/Party/PartySubsystem.h"
 #include "World/LivingWorld/LivingWorldReplication.h"
+#include "World/LivingWorld/MythicLivingWorldStats.h"
 #include "Async/Async.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("SimulationLock Wait"), STAT_MythicLW_SimLockWait, STATGROUP_MythicLivingWorld);
+
+// ─── SimulationLock wait accounting ──────────────────────────────────────────
+// The sim thread holds SimulationLock for its whole tick, so a game-thread helper that lands mid-tick stalls for the
+// rest of it. The uncontended path is one TryLock; only a real wait is timed.
+
+class UMythicLivingWorldSubsystem::FTimedSimulationLock {
+public:
+    explicit FTimedSimulationLock(UMythicLivingWorldSubsystem &Owner) : Lock(Owner.SimulationLock) {
+        Owner.SimLockAcquires.fetch_add(1, std::memory_order_relaxed);
+        if (!Lock.TryLock()) {
+            SCOPE_CYCLE_COUNTER(STAT_MythicLW_SimLockWait);
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Lock.Lock();
+            Owner.SimLockContended.fetch_add(1, std::memory_order_relaxed);
+            Owner.SimLockWaitCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+        }
+    }
+
+    ~FTimedSimulationLock() { Lock.Unlock(); }
+
+    UE_NONCOPYABLE(FTimedSimulationLock);
+
+private:
+    FCriticalSection &Lock;
+};
 
 bool UMythicLivingWorldSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
     return true;
@@ -59,8 +89,8 @@ void UMythicLivingWorldSubsystem::Initialize(FSubsystemCollectionBase &Collectio
     else {
         StartSimulation();
 
-        // Pre-warm the embodiment actor pool (server-only) so the first town embodies without a cold-spawn hitch.
-        // Behind the loading screen at init; no-op if pooling is disabled.
+        // Queue the embodiment actor pool warm-up (server-only) and start the time-sliced warmer, so the first town
+        // embodies without a cold-spawn hitch. No-op if pooling is disabled.
         WarmEmbodimentPools();
     }
 
@@ -83,6 +113,7 @@ void UMythicLivingWorldSubsystem::WarmEmbodimentPools() {
             HumanoidClass = Loaded;
         }
     }
+    EmbodiedHumanoidClass = HumanoidClass;
     WarmEmbodimentPool(HumanoidClass, Settings->EmbodimentPoolWarmCount);
 
     // Resolve the concrete creature class: EmbodiedCreatureClass soft class wins, else the bare C++ class. A SET-but-
@@ -91,9 +122,18 @@ void UMythicLivingWorldSubsystem::WarmEmbodimentPools() {
     if (!Settings->EmbodiedCreatureClass.IsNull()) {
         CreatureClass = Settings->EmbodiedCreatureClass.LoadSynchronous(); // may be null => MASS-only, skip warming.
     }
+    EmbodiedCreatureClass = CreatureClass;
     if (CreatureClass) {
         WarmEmbodimentPool(CreatureClass, Settings->EmbodimentPoolWarmCount);
     }
+
+    // The warm-up above only queued targets; the ticker does the spawning under the per-frame budget. 0.0f interval =
+    // every game-thread frame. Predict on the first tick so a player spawning into a town sizes the pool immediately.
+    EmbodimentPoolPredictCountdown = 0.0f;
+    if (!EmbodimentPoolTickHandle.IsValid()) {
+        EmbodimentPoolTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UMythicLivingWorldSubsystem::TickEmbodimentPool), 0.0f);
+    }
 }
 
 void UMythicLivingWorldSubsystem::Deinitialize() {
@@ -101,6 +141,11 @@ void UMythicLivingWorldSubsystem::Deinitialize() {
 
     StopSimulation();
 
+    if (EmbodimentPoolTickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(EmbodimentPoolTickHandle);
+        EmbodimentPoolTickHandle.Reset();
+    }
+
     CausalFabric = nullptr;
     FactionDB = nullptr;
     TerritoryGrid = nullptr;
@@ -160,13 +205,15 @@ AMythicNPCCharacter *UMythicLivingWorldSubsystem::AcquireEmbodiedActor(UClass *A
     // Try the free list first (only when pooling is on). Pop from the back (cheap, order-irrelevant) and skip any
     // weak entry that died while parked (level teardown / GC of a stale class bucket).
     if (bPoolingOn) {
-        if (TArray<TWeakObjectPtr<AMythicNPCCharacter>> *Bucket = EmbodimentPool.Find(ActorClass)) {
-            while (Bucket->Num() > 0) {
-                TWeakObjectPtr<AMythicNPCCharacter> Weak = Bucket->Pop(EAllowShrinking::No);
+        if (FEmbodimentPoolBucket *Bucket = EmbodimentPool.Find(ActorClass)) {
+            while (Bucket->Free.Num() > 0) {
+                TWeakObjectPtr<AMythicNPCCharacter> Weak = Bucket->Free.Pop(EAllowShrinking::No);
                 AMythicNPCCharacter *Reused = Weak.Get();
                 if (!IsValid(Reused)) {
                     continue; // parked actor was destroyed out from under the pool — drop it.
                 }
+                ++EmbodimentPoolStats.Hits;
+                Bucket->LastActivitySeconds = FPlatformTime::Seconds();
                 // Un-park: place, reveal, re-enable collision, then run the locked wake re-arm. SweepNoTest because the
                 // placement service already validated this transform as non-overlapping (the caller's FindValidSpawn).
                 Reused->SetActorLocationAndRotation(Loc, Rot, /*bSweep=*/false, nullptr, ETeleportType::TeleportPhysics);
@@ -180,6 +227,9 @@ AMythicNPCCharacter *UMythicLivingWorldSubsystem::AcquireEmbodiedActor(UClass *A
 
     // Cold miss (or pooling disabled): spawn a fresh actor. DeferConstruction is NOT needed — InitializeFromMassEntity
     // runs after this returns, exactly as the original raw-spawn path did.
+    if (bPoolingOn) {
+        ++EmbodimentPoolStats.Misses;
+    }
     FActorSpawnParameters SpawnInfo;
     SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
     return World->SpawnActor<AMythicNPCCharacter>(ActorClass, Loc, Rot, SpawnInfo);
@@ -198,10 +248,11 @@ void UMythicLivingWorldSubsystem::ReleaseEmbodiedActor(FMassEntityHandle Entity,
 
     const bool bPoolingOn = Settings && Settings->bEnableEmbodimentPooling && Settings->EmbodimentPoolMaxPerClass > 0;
     if (bPoolingOn) {
-        TArray<TWeakObjectPtr<AMythicNPCCharacter>> &Bucket = EmbodimentPool.FindOrAdd(Actor->GetClass());
-        if (Bucket.Num() < Settings->EmbodimentPoolMaxPerClass) {
+        FEmbodimentPoolBucket &Bucket = EmbodimentPool.FindOrAdd(Actor->GetClass());
+        if (Bucket.Free.Num() < Settings->EmbodimentPoolMaxPerClass) {
             Actor->SleepToPool(); // full teardown + park (hidden, no collision, no tick, brain stopped/reset).
-            Bucket.Add(Actor);
+            Bucket.Free.Add(Actor);
+            Bucket.LastActivitySeconds = FPlatformTime::Seconds();
             return;
         }
         // Bucket at cap — fall through and really destroy (keeps the pool bounded).
@@ -217,27 +268,204 @@ void UMythicLivingWorldSubsystem::WarmEmbodimentPool(UClass *ActorClass, int32 C
     if (!Settings || !Settings->bEnableEmbodimentPooling || Settings->EmbodimentPoolMaxPerClass <= 0) {
         return; // pooling disabled — nothing to warm.
     }
-    UWorld *World = GetWorld();
+    const UWorld *World = GetWorld();
     if (!World || World->GetNetMode() == NM_Client) {
         return; // server-only — clients embody nothing, so they pre-spawn nothing.
     }
 
-    TArray<TWeakObjectPtr<AMythicNPCCharacter>> &Bucket = EmbodimentPool.FindOrAdd(ActorClass);
-    const int32 Target = FMath::Min(Count, Settings->EmbodimentPoolMaxPerClass);
+    // Only raise the floor; TickEmbodimentPool spawns toward it under the per-frame budget.
+    FEmbodimentPoolBucket &Bucket = EmbodimentPool.FindOrAdd(ActorClass);
+    Bucket.WarmFloor = FMath::Max(Bucket.WarmFloor, FMath::Min(Count, Settings->EmbodimentPoolMaxPerClass));
+}
+
+FMythicEmbodimentDemand UMythicLivingWorldSubsystem::PredictEmbodimentDemand(
+    TFunctionRef<int32(const FMythicCellCoord &)> SettlementDensityAt,
+    const FMythicCellCoord &Origin,
+    const FVector2D &CellVelocity,
+    float LookaheadSeconds,
+    int32 RadiusCells,
+    int32 CreaturesPerWildCell) {
+    FMythicEmbodimentDemand Demand;
+    const int32 Radius = FMath::Max(0, RadiusCells);
+
+    // Sample the projected line at <= 1-cell steps so the swept squares overlap and no cell on the path is skipped.
+    const FVector2D Travel = CellVelocity * FMath::Max(0.0f, LookaheadSeconds);
+    const int32 Steps = FMath::CeilToInt32(FMath::Max(FMath::Abs(Travel.X), FMath::Abs(Travel.Y)));
+
+    TSet<FMythicCellCoord> Swept;
+    for (int32 Step = 0; Step <= Steps; ++Step) {
+        const float Alpha = Steps > 0 ? static_cast<float>(Step) / Steps : 0.0f;
+        const int32 CX = Origin.X + FMath::RoundToInt32(Travel.X * Alpha);
+        const int32 CY = Origin.Y + FMath::RoundToInt32(Travel.Y * Alpha);
+        for (int32 DY = -Radius; DY <= Radius; ++DY) {
+            for (int32 DX = -Radius; DX <= Radius; ++DX) {
+                const FMythicCellCoord Cell(CX + DX, CY + DY);
+                bool bAlreadySwept = false;
+                Swept.Add(Cell, &bAlreadySwept);
+                if (bAlreadySwept) {
+                    continue;
+                }
+                const int32 Density = SettlementDensityAt(Cell);
+                if (Density >= 0) {
+                    Demand.Humanoid += Density;
+                } else {
+                    Demand.Creature += FMath::Max(0, CreaturesPerWildCell);
+                }
+            }
+        }
+    }
+    return Demand;
+}
+
+void UMythicLivingWorldSubsystem::UpdateEmbodimentPoolTargets() {
+    UWorld *World = GetWorld();
+    if (!World || !Settings || !TerritoryGrid || !SettlementRegistry) {
+        return;
+    }
+
+    const float CellSize = FMath::Max(1.0f, TerritoryGrid->GetCellSize());
+    const int32 CreaturesPerWildCell = FMath::RoundToInt32(Settings->MaxCreaturesPerBiomeCell * Settings->CreatureSpawnDensityScale);
+
+    // Densities come from the published settlement snapshot (pinned once per sweep) — no SimulationLock, so a long sim
+    // commit never stalls this game-thread pass. It lags the live registry by at most one commit, which a 0.5s demand
+    // estimate doesn't notice.
+    const FMythicSettlementSnapshotRef Snapshot = AcquireSettlementSnapshot();
+    const auto DensityAt = [&Snapshot](const FMythicCellCoord &Cell) -> int32 {
+        const FMythicSettlementSnapshotEntry *Settlement = Snapshot ? Snapshot->FindAtCell(Cell) : nullptr;
+        return Settlement ? Settlement->MaxPopulationDensity : INDEX_NONE;
+    };
+
+    FMythicEmbodimentDemand Demand;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+        const APlayerController *PC = It->Get();
+        const APawn *Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn) {
+            continue;
+        }
+        const FVector Velocity = Pawn->GetVelocity();
+        const FMythicEmbodimentDemand PlayerDemand = PredictEmbodimentDemand(
+            DensityAt, TerritoryGrid->WorldToCell(Pawn->GetActorLocation()),
+            FVector2D(Velocity.X / CellSize, Velocity.Y / CellSize), Settings->EmbodimentPoolLookaheadSeconds,
+            Settings->EmbodimentPoolLookaheadRadiusCells, CreaturesPerWildCell);
+        Demand.Humanoid += PlayerDemand.Humanoid;
+        Demand.Creature += PlayerDemand.Creature;
+    }
+
+    // Parked actors only need to cover demand the live embodied set doesn't already — and embodiment itself is capped,
+    // so demand beyond the embodied/creature ceilings can never be drawn from the pool.
+    int32 LiveHumanoid = 0;
+    int32 LiveCreature = 0;
+    for (const TPair<FMassEntityHandle, TWeakObjectPtr<AMythicNPCCharacter>> &Pair : EmbodiedActors) {
+        const AMythicNPCCharacter *Actor = Pair.Value.Get();
+        if (!Actor) {
+            continue;
+        }
+        if (EmbodiedCreatureClass && Actor->GetClass() == EmbodiedCreatureClass) {
+            ++LiveCreature;
+        } else if (Actor->GetClass() == EmbodiedHumanoidClass) {
+            ++LiveHumanoid;
+        }
+    }
+    const int32 HumanoidTarget = FMath::Max(0, FMath::Min(Demand.Humanoid, Settings->MaxEmbodiedActors) - LiveHumanoid);
+    const int32 CreatureTarget = FMath::Max(0, FMath::Min(Demand.Creature, Settings->MaxCreatureActors) - LiveCreature);
+
+    if (EmbodiedHumanoidClass) {
+        EmbodimentPool.FindOrAdd(EmbodiedHumanoidClass).PredictedTarget = HumanoidTarget;
+    }
+    if (EmbodiedCreatureClass) {
+        EmbodimentPool.FindOrAdd(EmbodiedCreatureClass).PredictedTarget = CreatureTarget;
+    }
+}
+
+bool UMythicLivingWorldSubsystem::TickEmbodimentPool(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicLivingWorld_EmbodimentPool);
+
+    if (!Settings || !Settings->bEnableEmbodimentPooling || Settings->EmbodimentPoolMaxPerClass <= 0) {
+        return true; // keep the ticker; settings may be hot-toggled back on.
+    }
+    UWorld *World = GetWorld();
+    if (!World || World->GetNetMode() == NM_Client) {
+        return true;
+    }
+
+    if (Settings->bPredictiveEmbodimentPool) {
+        EmbodimentPoolPredictCountdown -= DeltaTime;
+        if (EmbodimentPoolPredictCountdown <= 0.0f) {
+            EmbodimentPoolPredictCountdown = Settings->EmbodimentPoolPredictIntervalSeconds;
+            UpdateEmbodimentPoolTargets();
+        }
+    }
+
+    const int32 MaxPerClass = Settings->EmbodimentPoolMaxPerClass;
+    const double StartSeconds = FPlatformTime::Seconds();
+    const double BudgetSeconds = Settings->EmbodimentPoolWarmBudgetMs * 0.001;
+
+    // Memory pressure is sampled once per tick; the trim pass below only runs under it.
+    const uint64 LowMemoryBytes = static_cast<uint64>(Settings->EmbodimentPoolLowMemoryMB) * 1024ull * 1024ull;
+    const bool bMemoryTight = LowMemoryBytes > 0 && FPlatformMemory::GetStats().AvailablePhysical < LowMemoryBytes;
 
     FActorSpawnParameters SpawnInfo;
     SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-    for (int32 i = Bucket.Num(); i < Target; ++i) {
-        // Park warmed actors out of sight at the origin — they are hidden + collision-disabled immediately by
-        // SleepToPool, so the spawn location is irrelevant (it never renders or collides while parked).
-        AMythicNPCCharacter *Warmed = World->SpawnActor<AMythicNPCCharacter>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo);
-        if (!Warmed) {
-            break; // bad class / spawn failure — stop warming this class.
+    int32 Spawned = 0;
+    bool bBudgetLeft = true;
+    for (TPair<TObjectPtr<UClass>, FEmbodimentPoolBucket> &Pair : EmbodimentPool) {
+        if (!bBudgetLeft) {
+            break;
+        }
+        UClass *ActorClass = Pair.Key;
+        FEmbodimentPoolBucket &Bucket = Pair.Value;
+        if (!ActorClass) {
+            continue;
+        }
+        const int32 Target = Bucket.GetTarget(MaxPerClass);
+
+        // Warm toward target. The first spawn of the tick always runs; after that, stop as soon as the budget is spent.
+        while (Bucket.Free.Num() < Target) {
+            if (Spawned > 0 && FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds) {
+                bBudgetLeft = false;
+                break;
+            }
+            // Park warmed actors out of sight at the origin — they are hidden + collision-disabled immediately by
+            // SleepToPool, so the spawn location is irrelevant (it never renders or collides while parked).
+            AMythicNPCCharacter *Warmed = World->SpawnActor<AMythicNPCCharacter>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo);
+            if (!Warmed) {
+                Bucket.WarmFloor = 0; // bad class / spawn failure — stop warming this class.
+                Bucket.PredictedTarget = 0;
+                break;
+            }
+            Warmed->SleepToPool();
+            Bucket.Free.Add(Warmed);
+            ++Spawned;
+        }
+
+        // Trim: only under memory pressure, only buckets that have gone idle, only down to target, one actor per bucket
+        // per tick (Destroy is cheap next to SpawnActor, but a bulk teardown still shows up as a spike).
+        if (bMemoryTight && Bucket.Free.Num() > Target
+            && FPlatformTime::Seconds() - Bucket.LastActivitySeconds >= Settings->EmbodimentPoolIdleTrimSeconds) {
+            const TWeakObjectPtr<AMythicNPCCharacter> Weak = Bucket.Free.Pop(EAllowShrinking::No);
+            if (AMythicNPCCharacter *Parked = Weak.Get()) {
+                Parked->Destroy();
+                ++EmbodimentPoolStats.Trimmed;
+            }
         }
-        Warmed->SleepToPool();
-        Bucket.Add(Warmed);
     }
+
+    if (Spawned > 0) {
+        const double TickMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+        EmbodimentPoolStats.Warmed += Spawned;
+        EmbodimentPoolStats.WarmMs += TickMs;
+        EmbodimentPoolStats.LastTickWarmMs = TickMs;
+        EmbodimentPoolStats.PeakTickWarmMs = FMath::Max(EmbodimentPoolStats.PeakTickWarmMs, TickMs);
+    }
+
+    const FEmbodimentPoolBucket *Humanoid = EmbodiedHumanoidClass ? EmbodimentPool.Find(EmbodiedHumanoidClass) : nullptr;
+    const FEmbodimentPoolBucket *Creature = EmbodiedCreatureClass ? EmbodimentPool.Find(EmbodiedCreatureClass) : nullptr;
+    EmbodimentPoolStats.HumanoidTarget = Humanoid ? Humanoid->GetTarget(MaxPerClass) : 0;
+    EmbodimentPoolStats.HumanoidParked = Humanoid ? Humanoid->Free.Num() : 0;
+    EmbodimentPoolStats.CreatureTarget = Creature ? Creature->GetTarget(MaxPerClass) : 0;
+    EmbodimentPoolStats.CreatureParked = Creature ? Creature->Free.Num() : 0;
+    return true;
 }
 
 void UMythicLivingWorldSubsystem::SubmitWorldEvent(const FMythicWorldEvent &Event) {
@@ -250,7 +478,7 @@ void UMythicLivingWorldSubsystem::RegisterSettlement(AMythicSettlement *Settleme
         SettlementRegistry = NewObject<UMythicSettlementRegistry>(this);
     }
 
-    FScopeLock Lock(&SimulationLock); // Protect WriteBuffer access
+    FTimedSimulationLock Lock(*this); // Protect WriteBuffer access
 
     const int32 SettlementId = SettlementRegistry->RegisterSettlement(Settlement);
 
@@ -275,6 +503,10 @@ void UMythicLivingWorldSubsystem::RegisterSettlement(AMythicSettlement *Settleme
                    *Data->DisplayName.ToString(), Data->RasterizedCells.Num(), Data->GoverningFaction.Index);
         }
     }
+
+    // Publish the new settlement to snapshot readers now rather than at the next sim commit (which never comes on a
+    // world whose sim hasn't started yet).
+    SettlementRegistry->CommitSnapshot();
 }
 
 void UMythicLivingWorldSubsystem::TransferSettlement(int32 SettlementId, FMythicFactionId NewFaction) {
@@ -282,8 +514,9 @@ void UMythicLivingWorldSubsystem::TransferSettlement(int32 SettlementId, FMythic
         return;
     }
 
-    FScopeLock Lock(&SimulationLock); // Protect WriteBuffer access
+    FTimedSimulationLock Lock(*this); // Protect WriteBuffer access
     SettlementRegistry->TransferSettlement(SettlementId, NewFaction, TerritoryGrid, FactionDB, CausalFabric);
+    SettlementRegistry->CommitSnapshot();
 }
 
 void UMythicLivingWorldSubsystem::ReportLeaderCandidate(FMythicFactionId FactionId, uint32 EntityId, float Score) {
@@ -293,7 +526,7 @@ void UMythicLivingWorldSubsystem::ReportLeaderCandidate(FMythicFactionId Faction
     // Hold the simulation lock: ReportLeaderCandidate read-modify-writes the faction WriteBuffer's leader fields, which
     // the sim thread ALSO writes under this same lock (succession vacancy clear at WorldSimThread::SimTick +
     // AnnihilateFaction). Without the lock, the game-thread nomination races those writes + the CommitWrites snapshot.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     FactionDB->ReportLeaderCandidate(FactionId, EntityId, Score);
 }
 
@@ -311,7 +544,7 @@ void UMythicLivingWorldSubsystem::ReportNpcDeath(FMythicFactionId FactionId, FGa
     // Hold the simulation lock: this read-modify-write of the faction WriteBuffer (Population + Reserves.Arms) + the
     // CommitWrites snapshot publish races the sim thread's faction evolution / economy recompute, which mutate the same
     // buffer under this exact lock. Same lock + commit idiom as ReportLeaderCandidate / RegisterSettlement.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     FMythicFactionData *F = FactionDB->GetFactionMutable(FactionId);
     if (!F) {
         return;
@@ -336,7 +569,7 @@ void UMythicLivingWorldSubsystem::HandleNPCDeathSettlements(uint32 NameHash, dou
     // Hold the simulation lock: HandleNPCDeath iterates the Settlements TMap (role vacation + shop succession), which the
     // sim thread concurrently rehashes/mutates under this same lock (RegisterSettlement Add, TickShopSuccession,
     // TransferSettlement). An unlocked game-thread walk here races a rehash → TMap use-after-free / torn shop reads.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     SettlementRegistry->HandleNPCDeath(NameHash, WorldTime);
 }
 
@@ -348,7 +581,7 @@ bool UMythicLivingWorldSubsystem::CopySettlementAtCell(const FMythicCellCoord &C
     // TMap, whose fields the sim thread writes under this same lock (TransferSettlement→GoverningFaction,
     // TickShopSuccession) and whose buckets RegisterSettlement rehashes. A game-thread reader holding the live pointer
     // would tear a conquest-tick faction read (NPCs stamped to the wrong faction) or dangle across a rehash.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     if (const FMythicSettlementData *Found = SettlementRegistry->GetSettlementAtCell(Cell)) {
         Out = *Found;
         return true;
@@ -356,13 +589,17 @@ bool UMythicLivingWorldSubsystem::CopySettlementAtCell(const FMythicCellCoord &C
     return false;
 }
 
+TRefCountPtr<const FMythicSettlementSnapshot> UMythicLivingWorldSubsystem::AcquireSettlementSnapshot() const {
+    return SettlementRegistry ? SettlementRegistry->AcquireSnapshot() : FMythicSettlementSnapshotRef();
+}
+
 bool UMythicLivingWorldSubsystem::CopySettlementById(int32 SettlementId, FMythicSettlementData &Out) {
     if (!SettlementRegistry) {
         return false;
     }
     // Same SimulationLock copy-out as CopySettlementAtCell, keyed by runtime id: GetSettlementData returns a raw pointer
     // into the live Settlements TMap, which the sim thread mutates/rehashes under this lock.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     if (const FMythicSettlementData *Found = SettlementRegistry->GetSettlementData(SettlementId)) {
         Out = *Found;
         return true;
@@ -378,7 +615,7 @@ void UMythicLivingWorldSubsystem::CopyAllSettlementIds(TArray<int32> &OutIds) {
     // Hold the simulation lock: GetAllSettlementIds does a bare Settlements.GetKeys walk, which the sim thread rehashes
     // under this same lock (RegisterSettlement Add, TransferSettlement→FactionSettlements, TickShopSuccession). An
     // unlocked game-thread enumeration races a rehash → TMap iterator use-after-free.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     SettlementRegistry->GetAllSettlementIds(OutIds);
 }
 
@@ -387,7 +624,7 @@ int32 UMythicLivingWorldSubsystem::GetSettlementCountSafe() {
         return 0;
     }
     // Settlements.Num() is a bare read of the same TMap the sim thread mutates under this lock — guard it.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     return SettlementRegistry->GetSettlementCount();
 }
 
@@ -397,7 +634,7 @@ AMythicSettlement *UMythicLivingWorldSubsystem::GetSettlementActorSafe(int32 Set
     }
     // GetSettlementActor does a bare SettlementActors.Find; that map is rehashed by RegisterSettlement under this lock.
     // The returned actor pointer itself is a UObject (GC-stable for the frame), so only the Find needs the lock.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     return SettlementRegistry->GetSettlementActor(SettlementId);
 }
 
@@ -410,13 +647,30 @@ bool UMythicLivingWorldSubsystem::CopySimDiagnostics(uint64 &OutTickCount, float
     }
     // TickCount is mutated on the background thread inside SimTick under this same lock — guard the read (it is a plain
     // uint64, not atomic). IsRunning() is itself atomic, but we copy it here too so the whole snapshot is consistent.
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
     OutTickCount = SimThread->GetTickCount();
     OutTickIntervalSeconds = SimThread->GetTickIntervalSeconds();
     OutRunning = SimThread->IsRunning();
     return true;
 }
 
+bool UMythicLivingWorldSubsystem::TryCopySimTickTimings(FMythicSimTickTimings &Out) {
+    if (!SimThread.IsValid() || !SimulationLock.TryLock()) {
+        return false;
+    }
+    Out = SimThread->GetLastTickTimings();
+    SimulationLock.Unlock();
+    return true;
+}
+
+FMythicSimLockWaitStats UMythicLivingWorldSubsystem::GetSimLockWaitStats() const {
+    FMythicSimLockWaitStats Out;
+    Out.Acquires = SimLockAcquires.load(std::memory_order_relaxed);
+    Out.Contended = SimLockContended.load(std::memory_order_relaxed);
+    Out.WaitMs = FPlatformTime::ToMilliseconds64(SimLockWaitCycles.load(std::memory_order_relaxed));
+    return Out;
+}
+
 bool UMythicLivingWorldSubsystem::LoadSettings() {
     // Read the settings asset reference from Project Settings > Game > Mythic > Living World
     const UMythicDeveloperSettings *DevSettings = GetDefault<UMythicDeveloperSettings>();
@@ -601,10 +855,10 @@ void UMythicLivingWorldSubsystem::SeedTerritoryFromSettlements() {
     }
 
     {
-        FScopeLock Lock(&SimulationLock); // Protect WriteBuffer access
+        FTimedSimulationLock Lock(*this); // Protect WriteBuffer access
         SettlementRegistry->SeedTerritoryFromSettlements(TerritoryGrid, FactionDB);
 
-        // Commit INSIDE the lock so the full-buffer snapshot copy (ReadFactions = WriteFactions) can't race a sim-thread
+        // Commit INSIDE the lock so the snapshot build (copying WriteFactions) can't race a sim-thread
         // WriteFactions mutation. Same lock ordering the sim thread uses (SimulationLock, then each object's SnapshotLock
         // inside CommitWrites), so no inversion. Mirrors RegisterSettlement; the earlier escape was unintended.
         TerritoryGrid->CommitWrites();
@@ -643,7 +897,7 @@ void UMythicLivingWorldSubsystem::SaveLivingWorld(FArchive &Ar) {
 
     // Pause the simulation thread to get a consistent snapshot
     // SimulationLock prevents the background thread from writing during serialization
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
 
     UE_LOG(LogMythLivingWorld, Log, TEXT("Saving Living World state..."));
 
@@ -731,7 +985,7 @@ void UMythicLivingWorldSubsystem::LoadLivingWorld(FArchive &Ar) {
     }
 
     // Pause the simulation thread during deserialization
-    FScopeLock Lock(&SimulationLock);
+    FTimedSimulationLock Lock(*this);
 
     UE_LOG(LogMythLivingWorld, Log, TEXT("Loading Living World state..."));
 
@@ -758,6 +1012,7 @@ void UMythicLivingWorldSubsystem::LoadLivingWorld(FArchive &Ar) {
 
     if (SettlementRegistry) {
         SettlementRegistry->Serialize(Ar); // restores conquest-mutated GoverningFaction (was lost on reload)
+        SettlementRegistry->CommitSnapshot();
     }
 
     if (UWorld *World = GetGameInstance()->GetWorld()) {
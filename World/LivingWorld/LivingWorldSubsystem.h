@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h" // FTSTicker::FDelegateHandle for the time-sliced embodiment pool warmer
 #include "Mass/EntityHandle.h"
 #include "World/LivingWorld/CausalFabric/CausalFabric.h"
 #include "World/LivingWorld/Simulation/WorldSimThread.h"
@@ -14,6 +15,10 @@
 /** Fired (client-side) when the replicated faction/territory proxies change — for UI to refresh. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMythicOnLivingWorldProxiesChanged);
 
+/** Fired (client-side, native) per territory proxy that replicates in — the changed cell itself, for consumers that
+ *  update incrementally (the war-map texture) instead of re-reading every proxy on OnLivingWorldProxiesChanged. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FMythicOnTerritoryProxyCellChanged, const FMythicTerritoryProxyItem & /*Item*/);
+
 class AMythicNPCCharacter;
 class UMythicLivingWorldSettings;
 class UMythicCausalFabric;
@@ -21,6 +26,7 @@ class UMythicFactionDatabase;
 class UMythicTerritoryGrid;
 class UMythicSettlementRegistry;
 struct FMythicSettlementData;
+class FMythicSettlementSnapshot;
 class AMythicSettlement;
 class UMythicPersistentNPCRegistry;
 class UMythicDesignerSpawnerRegistry;
@@ -29,6 +35,87 @@ class UMythicTerritoryGridSettings;
 class UMythicSocialGraph;
 class UMythicSchemeEngine;
 
+/** Predicted embodied-actor demand per pool archetype along a player's projected path (see PredictEmbodimentDemand). */
+struct FMythicEmbodimentDemand {
+    /** Settlement-cell population (sum of MaxPopulationDensity over distinct settlement cells swept) */
+    int32 Humanoid = 0;
+
+    /** Wilderness-cell creature population (CreaturesPerWildCell per distinct non-settlement cell swept) */
+    int32 Creature = 0;
+};
+
+/** Embodiment pool counters, surfaced by the gameplay debugger. Cumulative since Initialize unless noted. */
+struct FMythicEmbodimentPoolStats {
+    /** AcquireEmbodiedActor served from a parked actor */
+    int32 Hits = 0;
+
+    /** AcquireEmbodiedActor fell back to SpawnActor (pooling on, bucket empty) */
+    int32 Misses = 0;
+
+    /** Actors spawned + parked by the time-sliced warmer */
+    int32 Warmed = 0;
+
+    /** Parked actors destroyed by the low-memory idle trim */
+    int32 Trimmed = 0;
+
+    /** Total game-thread milliseconds spent warming */
+    double WarmMs = 0.0;
+
+    /** Warm milliseconds spent on the most recent warmer tick that did any work */
+    double LastTickWarmMs = 0.0;
+
+    /** Largest single-tick warm cost seen (budget overshoot is bounded by one spawn) */
+    double PeakTickWarmMs = 0.0;
+
+    /** Latest predicted per-class pool targets (humanoid, creature) */
+    int32 HumanoidTarget = 0;
+    int32 CreatureTarget = 0;
+
+    /** Parked actors currently in the humanoid / creature buckets */
+    int32 HumanoidParked = 0;
+    int32 CreatureParked = 0;
+};
+
+/** Significance promotion/demotion counters, written by UMythicSignificanceProcessor and surfaced by the gameplay
+ *  debugger. Cumulative since Initialize unless noted. */
+struct FMythicSignificanceStats {
+    /** Tier0->Tier1/Tier2 and Tier1->Tier2 promotions */
+    int32 Promotions = 0;
+
+    /** Threshold demotions (Tier1->Tier0, Tier2->Tier1) plus perma-dead dehydrations */
+    int32 Demotions = 0;
+
+    /** Holders displaced from a full cap by a stronger candidate (also counted in Demotions) */
+    int32 Swaps = 0;
+
+    /** Qualifying promotion candidates on the most recent pass */
+    int32 LastCandidates = 0;
+
+    /** Candidates still qualifying but unpromoted after the most recent pass (budget/cap-bound promotion latency) */
+    int32 LastBacklog = 0;
+
+    /** Game-thread milliseconds of the most recent promotion/demotion pass, and the largest seen */
+    double LastPassMs = 0.0;
+    double PeakPassMs = 0.0;
+
+    /** Completed promotion/demotion passes (telemetry detects a new pass by this changing) */
+    int32 Passes = 0;
+
+    /** Entities per EMythicSignificanceTier at the start of the most recent pass (before its promotions/demotions) */
+    int32 TierPopulation[4] = {};
+};
+
+/** SimulationLock acquisitions by the subsystem's locked helpers and how long they waited on the sim thread. Cumulative
+ *  since Initialize; sampled by the living-world telemetry (stat MythicLivingWorld). */
+struct FMythicSimLockWaitStats {
+    uint64 Acquires = 0;
+
+    /** Acquisitions that found the lock held (the sim thread mid-tick) and had to wait */
+    uint64 Contended = 0;
+
+    double WaitMs = 0.0;
+};
+
 /**
  * Central coordinator for the Living World System.
  * As a GameInstanceSubsystem, it lives for the entire game session.
@@ -71,6 +158,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Living World")
     FMythicOnLivingWorldProxiesChanged OnLivingWorldProxiesChanged;
 
+    /** CLIENT-side: fired for each territory proxy added/changed by replication, before OnLivingWorldProxiesChanged. */
+    FMythicOnTerritoryProxyCellChanged OnTerritoryProxyCellChanged;
+
     /** Called by AMythicLivingWorldReplicator::BeginPlay on the CLIENT to link itself (server sets it at spawn).
      *  Pass nullptr on the replicator's EndPlay to unlink. Broadcasts OnLivingWorldProxiesChanged on link. */
     void RegisterClientReplicator(AMythicLivingWorldReplicator *InReplicator);
@@ -184,12 +274,35 @@ public:
     void ReleaseEmbodiedActor(FMassEntityHandle Entity, AMythicNPCCharacter *Actor);
 
     /**
-     * Pre-spawn Count actors of ActorClass, park them (SleepToPool), and push onto the free list — so the first town's
-     * embodiment pays no cold-spawn hitch. Called once per resolved class at subsystem init. Respects the per-class cap
-     * and the pooling kill-switch (no-op if pooling is disabled). Server-only (no parked actors on a pure client).
+     * Request that ActorClass's bucket hold at least Count parked actors. The actors are spawned + parked (SleepToPool)
+     * by the pool warmer under EmbodimentPoolWarmBudgetMs per frame, not synchronously — a 40-actor warm-up no longer
+     * hitches. Raises the bucket's floor (never lowers it). Respects the per-class cap and the pooling kill-switch (no-op
+     * if pooling is disabled). Server-only (no parked actors on a pure client).
      */
     void WarmEmbodimentPool(UClass *ActorClass, int32 Count);
 
+    /** Pool hit/miss/warm counters + current targets (game thread). */
+    const FMythicEmbodimentPoolStats &GetEmbodimentPoolStats() const { return EmbodimentPoolStats; }
+
+    /** Significance promotion/demotion counters (game thread). */
+    const FMythicSignificanceStats &GetSignificanceStats() const { return SignificanceStats; }
+    FMythicSignificanceStats &GetMutableSignificanceStats() { return SignificanceStats; }
+
+    /**
+     * Predict embodied-actor demand along a projected path: sample the straight line from Origin along CellVelocity
+     * (cells/second) for LookaheadSeconds at one-cell steps, take the square of RadiusCells around each sample, and sum
+     * over the DISTINCT cells swept — SettlementDensityAt(Cell) >= 0 adds that settlement density to the humanoid
+     * demand, INDEX_NONE (wilderness) adds CreaturesPerWildCell to the creature demand. Pure + static so the sizing rule
+     * is unit-testable without a registry full of settlement actors.
+     */
+    static FMythicEmbodimentDemand PredictEmbodimentDemand(
+        TFunctionRef<int32(const FMythicCellCoord &)> SettlementDensityAt,
+        const FMythicCellCoord &Origin,
+        const FVector2D &CellVelocity,
+        float LookaheadSeconds,
+        int32 RadiusCells,
+        int32 CreaturesPerWildCell);
+
     // ─── Event Writing (from Game Thread) ─────────────────
 
     /**
@@ -255,6 +368,14 @@ public:
      */
     bool CopySettlementAtCell(const FMythicCellCoord &Cell, FMythicSettlementData &Out);
 
+    /**
+     * Pinned read of the published cell→settlement snapshot (see FMythicSettlementSnapshot) — a pointer copy under the
+     * publisher's read lock, no SimulationLock, no per-cell deep copy. Per-cell spawner loops should acquire once per
+     * Execute and index it. The snapshot lags live registry state by at most one sim commit. Null before any settlement
+     * registers.
+     */
+    TRefCountPtr<const FMythicSettlementSnapshot> AcquireSettlementSnapshot() const;
+
     /**
      * Thread-safe copy-out of the settlement with a given runtime SettlementId (the by-ID sibling of CopySettlementAtCell).
      * Takes SimulationLock + copies BY VALUE — GetSettlementData returns a raw pointer into the live Settlements TMap.
@@ -291,6 +412,16 @@ public:
      */
     bool CopySimDiagnostics(uint64 &OutTickCount, float &OutTickIntervalSeconds, bool &OutRunning);
 
+    /**
+     * Non-blocking copy-out of the sim thread's last tick timings (telemetry). TryLocks SimulationLock — a sampler that
+     * polls every frame must never itself wait out a sim tick — so it returns false while the sim thread is mid-tick, or
+     * if there is no sim thread; the caller just tries again next frame.
+     */
+    bool TryCopySimTickTimings(FMythicSimTickTimings &Out);
+
+    /** Lock-wait counters of the SimulationLock-guarded helpers above (any thread). */
+    FMythicSimLockWaitStats GetSimLockWaitStats() const;
+
     // ─── Save/Load ───────────────────────────────────────
 
     /**
@@ -332,22 +463,68 @@ private:
     void SeedTerritoryFromSettlements();
 
     /** Resolve the embodied humanoid + creature classes from settings (mirroring the ActorSpawnProcessor's resolve
-     *  order) and pre-warm EmbodimentPoolWarmCount parked actors of each at init, so the first town has no cold-spawn
-     *  hitch. Server-only; no-op if pooling is disabled. Called once from Initialize after the sim is started. */
+     *  order), queue EmbodimentPoolWarmCount parked actors of each, and start the pool warmer ticker. Server-only; no-op
+     *  if pooling is disabled. Called once from Initialize after the sim is started. */
     void WarmEmbodimentPools();
 
+    /**
+     * Pool warmer (core ticker, game thread). Every EmbodimentPoolPredictIntervalSeconds it re-predicts each class's
+     * target from the players' projected paths; every frame it spawns + parks toward the targets until
+     * EmbodimentPoolWarmBudgetMs is spent, and — only while available physical memory is under
+     * EmbodimentPoolLowMemoryMB — destroys parked actors above target in buckets idle for EmbodimentPoolIdleTrimSeconds.
+     */
+    bool TickEmbodimentPool(float DeltaTime);
+
+    /** Recompute PredictedTarget for the humanoid + creature buckets from every player's position + velocity. */
+    void UpdateEmbodimentPoolTargets();
+
     /** Callback when the background thread completes a commit */
     void OnSimCommitted();
 
     /** Reverse link entity->embodied cognitive actor; server-only, populated by the MASS->actor bridge. */
     TMap<FMassEntityHandle, TWeakObjectPtr<AMythicNPCCharacter>> EmbodiedActors;
 
+    /** One class bucket of the embodiment pool: the free list plus the warmer's sizing state. */
+    struct FEmbodimentPoolBucket {
+        /** Parked actors available for reuse */
+        TArray<TWeakObjectPtr<AMythicNPCCharacter>> Free;
+
+        /** Explicit floor requested through WarmEmbodimentPool (init warm count) */
+        int32 WarmFloor = 0;
+
+        /** Latest path-predicted target (0 until the first prediction, or for classes the predictor doesn't size) */
+        int32 PredictedTarget = 0;
+
+        /** FPlatformTime::Seconds of the last Acquire hit or Release into this bucket — drives the idle trim */
+        double LastActivitySeconds = 0.0;
+
+        int32 GetTarget(int32 MaxPerClass) const { return FMath::Min(FMath::Max(WarmFloor, PredictedTarget), MaxPerClass); }
+    };
+
     /** Class-keyed free list of PARKED (hidden, non-colliding, non-ticking, brain-stopped) embodied actors available
      *  for reuse. Game-thread only, no lock. The key TObjectPtr<UClass> keeps the class alive; the values are weak so a
      *  parked actor destroyed out-from-under us (level teardown) is skipped rather than handed out dangling. Not a
      *  UPROPERTY (the value is a TArray of weak ptrs, which a UPROPERTY can't reflect) — that is fine: parked actors are
      *  hidden, not unreferenced, so they are not GC candidates, and the weak guard covers the teardown edge anyway. */
-    TMap<TObjectPtr<UClass>, TArray<TWeakObjectPtr<AMythicNPCCharacter>>> EmbodimentPool;
+    TMap<TObjectPtr<UClass>, FEmbodimentPoolBucket> EmbodimentPool;
+
+    /** Concrete classes resolved by WarmEmbodimentPools — the two buckets the predictor sizes. Creature may be null
+     *  (designer set an unloadable soft class => creatures are MASS-only). */
+    UPROPERTY()
+    TObjectPtr<UClass> EmbodiedHumanoidClass;
+
+    UPROPERTY()
+    TObjectPtr<UClass> EmbodiedCreatureClass;
+
+    /** Core-ticker handle for TickEmbodimentPool; removed in Deinitialize */
+    FTSTicker::FDelegateHandle EmbodimentPoolTickHandle;
+
+    /** Seconds until the next UpdateEmbodimentPoolTargets */
+    float EmbodimentPoolPredictCountdown = 0.0f;
+
+    FMythicEmbodimentPoolStats EmbodimentPoolStats;
+
+    FMythicSignificanceStats SignificanceStats;
 
     // ─── Owned Data ───────────────────────────────────────
 
@@ -404,4 +581,13 @@ private:
 
     /** Global lock for simulation state (Write Buffers). Held by SimThread during tick, GameThread during writes. */
     FCriticalSection SimulationLock;
+
+    /** Scope lock over SimulationLock that charges any wait to the counters below. Every game-side acquisition in the
+     *  subsystem goes through it (defined in the .cpp). */
+    class FTimedSimulationLock;
+
+    /** See GetSimLockWaitStats */
+    std::atomic<uint64> SimLockAcquires{0};
+    std::atomic<uint64> SimLockContended{0};
+    std::atomic<uint64> SimLockWaitCycles{0};
 };
@@ -0,0 +1,57 @@
+// Mythic Living World — Cell Entity Index Subsystem Implementation
+
+#include "World/LivingWorld/MythicCellEntityIndexSubsystem.h"
+#include "Engine/World.h"
+
+bool UMythicCellEntityIndexSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UMythicCellEntityIndexSubsystem::Deinitialize() {
+    Index.Reset();
+    SpeciesOccupancy.Reset();
+    FightTargetHolders.Empty();
+    FightTargetOf.Empty();
+    Super::Deinitialize();
+}
+
+void UMythicCellEntityIndexSubsystem::AddEntity(FMassEntityHandle Entity, const FMythicCellCoord &Cell, EMythicCellEntityCategory Categories) {
+    Index.Insert(Cell, Entity, Categories);
+}
+
+void UMythicCellEntityIndexSubsystem::RemoveEntity(FMassEntityHandle Entity) {
+    Index.Remove(Entity);
+    SetFightTarget(Entity, INDEX_NONE);
+}
+
+void UMythicCellEntityIndexSubsystem::MoveEntity(FMassEntityHandle Entity, const FMythicCellCoord &NewCell) {
+    Index.Move(Entity, NewCell);
+}
+
+void UMythicCellEntityIndexSubsystem::SetFightTarget(FMassEntityHandle Entity, int32 TargetEntity) {
+    int32 *Current = FightTargetOf.Find(Entity);
+    if ((Current ? *Current : INDEX_NONE) == TargetEntity) {
+        return;
+    }
+    if (Current) {
+        TArray<FMassEntityHandle> &Holders = FightTargetHolders.FindChecked(*Current);
+        Holders.RemoveSingleSwap(Entity, EAllowShrinking::No);
+        if (Holders.IsEmpty()) {
+            FightTargetHolders.Remove(*Current);
+        }
+    }
+    if (TargetEntity == INDEX_NONE) {
+        FightTargetOf.Remove(Entity);
+        return;
+    }
+    FightTargetOf.Add(Entity, TargetEntity);
+    FightTargetHolders.FindOrAdd(TargetEntity).Add(Entity);
+}
+
+TConstArrayView<FMassEntityHandle> UMythicCellEntityIndexSubsystem::GetFightTargetHolders(int32 TargetEntity) const {
+    const TArray<FMassEntityHandle> *Holders = FightTargetHolders.Find(TargetEntity);
+    return Holders ? TConstArrayView<FMassEntityHandle>(*Holders) : TConstArrayView<FMassEntityHandle>();
+}
@@ -0,0 +1,75 @@
+// Mythic Living World — Cell Entity Index Subsystem
+// One shared, incrementally maintained cell→entity index for every living-world MASS processor.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "World/LivingWorld/MythicCellSpatialIndex.h"
+#include "World/LivingWorld/Creatures/CreatureSpeciesOccupancy.h"
+#include "MythicCellEntityIndexSubsystem.generated.h"
+
+/**
+ * Owns the world's FMythicCellSpatialIndex over every entity carrying FMythicIdentityFragment.
+ *
+ * Previously the witness processor rebuilt a private index from scratch whenever events were pending, and the
+ * population / group / territory-patrol / creature spawners each walked their whole population every tick just to
+ * count entities per cell. Now the index is kept current as things change, and those processors only read it:
+ *
+ * - Create / destroy: UMythicCellIndexAddObserver / UMythicCellIndexRemoveObserver (MASS observers on
+ *   FMythicIdentityFragment) insert and remove entities, tagging each with its archetype's EMythicCellEntityCategory.
+ *   Observers run when the creation context is released, so every BatchCreateEntities site holds that context until it
+ *   has written Identity.Cell — otherwise the entity would be indexed at the default cell.
+ * - Cell changes: the two runtime Identity.Cell writers (AMythicAIController::RefreshLiveCell for embodied NPCs, the
+ *   traveler route processor for off-screen travelers) call MoveEntity alongside the write.
+ *
+ * Also keeps the fight-target holder index (FMythicPsychodynamicFragment::FightTargetEntity → the entities holding it)
+ * so mob formation can reach every ally on a crowded target without sweeping the hydrated set. Whatever writes
+ * FightTargetEntity calls SetFightTarget alongside the write; RemoveEntity drops a destroyed holder.
+ *
+ * Also owns the creature species occupancy grid (FMythicSpeciesOccupancyGrid): the ecology processor sizes it from the
+ * territory grid and moves creatures in it, UMythicCreatureOccupancyRemoveObserver drops despawned ones.
+ *
+ * Game-thread only (all writers and readers are game-thread processors, observers or actors). Created for every game
+ * world, like the party subsystem and the cognition scheduler.
+ */
+UCLASS()
+class MYTHIC_API UMythicCellEntityIndexSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    /** Read-only view for range queries and per-cell counts */
+    const FMythicCellSpatialIndex &GetIndex() const { return Index; }
+
+    /** Index a newly created entity (create observer) */
+    void AddEntity(FMassEntityHandle Entity, const FMythicCellCoord &Cell, EMythicCellEntityCategory Categories);
+
+    /** Drop a destroyed entity (destroy observer) */
+    void RemoveEntity(FMassEntityHandle Entity);
+
+    /** Re-bucket an entity whose Identity.Cell just changed. Call next to every runtime Identity.Cell write. */
+    void MoveEntity(FMassEntityHandle Entity, const FMythicCellCoord &NewCell);
+
+    /** Record Entity's new FightTargetEntity (INDEX_NONE clears it). Call next to every FightTargetEntity write. */
+    void SetFightTarget(FMassEntityHandle Entity, int32 TargetEntity);
+
+    /** Entities currently recorded as holding TargetEntity, in no particular order */
+    TConstArrayView<FMassEntityHandle> GetFightTargetHolders(int32 TargetEntity) const;
+
+    /** Per-cell creature species bitsets (ecology processor + creature remove observer) */
+    FMythicSpeciesOccupancyGrid &GetSpeciesOccupancy() { return SpeciesOccupancy; }
+    const FMythicSpeciesOccupancyGrid &GetSpeciesOccupancy() const { return SpeciesOccupancy; }
+
+private:
+    FMythicCellSpatialIndex Index;
+    FMythicSpeciesOccupancyGrid SpeciesOccupancy;
+
+    /** Fight target entity index → holders, and the reverse for O(1) retarget / removal */
+    TMap<int32, TArray<FMassEntityHandle>> FightTargetHolders;
+    TMap<FMassEntityHandle, int32> FightTargetOf;
+};
@@ -4,42 +4,104 @@
 #include "Mass/EntityHandle.h"
 #include "World/LivingWorld/LivingWorldTypes.h" // FMythicCellCoord (hashable: used as TMap/TSet key elsewhere)
 
+/**
+ * Population classes an indexed entity belongs to, captured from its archetype tags when it is indexed. The living-world
+ * archetypes fix these tags at creation (no processor adds/removes them later), so they never need refreshing.
+ * Consumers count with a required + excluded mask, e.g. the ambient census is NPC without Traveler/Encounter.
+ */
+enum class EMythicCellEntityCategory : uint8 {
+    None = 0,
+    NPC = 1 << 0,       // FMythicNPCTag
+    Traveler = 1 << 1,  // FMythicTravelerTag
+    Encounter = 1 << 2, // FMythicEncounterEntityTag
+    Creature = 1 << 3,  // FMythicCreatureTag
+};
+ENUM_CLASS_FLAGS(EMythicCellEntityCategory)
+
 /**
  * Broad-phase cell -> entity spatial index for the living-world MASS entity set.
  *
- * PURPOSE: several living-world systems currently sweep EVERY entity to answer a spatial question — the witness-
- * perception scan walks all entities per crime event to find those near the event cell (O(events x N)), and the
- * population spawner walks all entities to count per-cell density (O(N)). This index replaces those full sweeps with
- * a single O(N) rebuild per tick (Reset + Insert per entity) plus O((2r+1)^2) range queries / O(1) per-cell counts.
+ * PURPOSE: several living-world systems used to sweep EVERY entity to answer a spatial question — the witness-
+ * perception scan walked all entities per crime event to find those near the event cell (O(events x N)), and each
+ * spawner walked all entities to count per-cell density (O(N) per spawner tick). This index answers both with
+ * O((2r+1)^2) range queries and O(bucket) per-cell counts.
  *
- * ARCHITECTURE: pure data (no UObject, no world, no replication, no MASS processing) — owned by a manager/subsystem
- * that rebuilds it each tick from a MASS query and handed to the consumers. Server-side only (the living-world sim is
- * server-authoritative; nothing here replicates). Stores FMassEntityHandle payloads; the caller resolves fragments
- * from the handle exactly as it does today.
+ * MAINTENANCE: incremental. UMythicCellEntityIndexSubsystem owns the world's instance; Insert/Remove are driven by the
+ * identity-fragment observers on entity create/destroy, and Move by the (two) runtime Identity.Cell writers. Each entity
+ * is indexed at most once — the entity → cell map makes Remove/Move O(bucket) without the caller knowing the old cell.
+ * Reset + Insert still works as a from-scratch rebuild (tests, or a consumer owning a private instance).
+ *
+ * ARCHITECTURE: pure data (no UObject, no world, no replication, no MASS processing). Server-side only (the living-world
+ * sim is server-authoritative; nothing here replicates). Game-thread only — every writer and reader is a game-thread
+ * processor, observer or actor. Stores FMassEntityHandle payloads; the caller resolves fragments from the handle.
  *
  * QueryRange is BROAD-PHASE: it returns every entity whose cell is within a Chebyshev (square) radius of the center.
  * The caller then applies the precise distance test it already performs (Manhattan hearing range, circular spawn
  * radius, etc.) on the much smaller candidate set. This mirrors the standard broad/narrow-phase split and keeps the
- * exact gameplay semantics the callers already have.
- *
- * NOTE: this is the data-structure prerequisite. Wiring the witness processor + population spawner to consume it is
- * the next iteration (see BACKLOG). Verified here by FLivingWorldSpatialIndexQueryTest (Mythic.LivingWorld.SpatialIndex).
+ * exact gameplay semantics the callers already have. Verified by Mythic.LivingWorld.SpatialIndex.*.
  */
 struct FMythicCellSpatialIndex {
     // Clear all buckets for a fresh rebuild, RETAINING the map keys + per-bucket array allocations (TArray::Reset keeps
-    // slack) so a per-tick rebuild does not churn allocations. Stale empty buckets are harmless (GetCellCount/QueryRange
-    // treat them as empty); the key set is bounded by the number of distinct cells ever occupied.
+    // slack) so a rebuild does not churn allocations. Stale empty buckets are harmless (GetCellCount/QueryRange treat
+    // them as empty); the key set is bounded by the number of distinct cells ever occupied.
     void Reset() {
-        for (TPair<FMythicCellCoord, TArray<FMassEntityHandle>> &Pair : CellBuckets) {
+        for (TPair<FMythicCellCoord, TArray<FEntry>> &Pair : CellBuckets) {
             Pair.Value.Reset();
         }
-        TotalEntities = 0;
+        EntityCells.Reset();
+    }
+
+    // Index one entity at its cell. O(1) amortized. Re-inserting an already-indexed entity moves it (never duplicates).
+    void Insert(const FMythicCellCoord &Cell, FMassEntityHandle Entity,
+                EMythicCellEntityCategory Categories = EMythicCellEntityCategory::None) {
+        if (EntityCells.Contains(Entity)) {
+            Remove(Entity);
+        }
+        CellBuckets.FindOrAdd(Cell).Add(FEntry{Entity, Categories});
+        EntityCells.Add(Entity, Cell);
+    }
+
+    // Drop an entity from the index. O(bucket). Returns false if it was not indexed.
+    bool Remove(FMassEntityHandle Entity) {
+        FMythicCellCoord Cell;
+        if (!EntityCells.RemoveAndCopyValue(Entity, Cell)) {
+            return false;
+        }
+        if (TArray<FEntry> *Bucket = CellBuckets.Find(Cell)) {
+            for (int32 i = 0; i < Bucket->Num(); ++i) {
+                if ((*Bucket)[i].Entity == Entity) {
+                    Bucket->RemoveAtSwap(i, EAllowShrinking::No);
+                    break;
+                }
+            }
+        }
+        return true;
     }
 
-    // Index one entity at its cell. O(1) amortized.
-    void Insert(const FMythicCellCoord &Cell, FMassEntityHandle Entity) {
-        CellBuckets.FindOrAdd(Cell).Add(Entity);
-        ++TotalEntities;
+    // Re-bucket an indexed entity whose Identity.Cell changed. O(bucket); a same-cell move is free. Returns false (and
+    // indexes nothing) if the entity is not indexed — the create observer owns insertion, a mover never adds.
+    bool Move(FMassEntityHandle Entity, const FMythicCellCoord &NewCell) {
+        FMythicCellCoord *CellPtr = EntityCells.Find(Entity);
+        if (!CellPtr) {
+            return false;
+        }
+        if (*CellPtr == NewCell) {
+            return true;
+        }
+        TArray<FEntry> *OldBucket = CellBuckets.Find(*CellPtr);
+        EMythicCellEntityCategory Categories = EMythicCellEntityCategory::None;
+        if (OldBucket) {
+            for (int32 i = 0; i < OldBucket->Num(); ++i) {
+                if ((*OldBucket)[i].Entity == Entity) {
+                    Categories = (*OldBucket)[i].Categories;
+                    OldBucket->RemoveAtSwap(i, EAllowShrinking::No);
+                    break;
+                }
+            }
+        }
+        *CellPtr = NewCell;
+        CellBuckets.FindOrAdd(NewCell).Add(FEntry{Entity, Categories});
+        return true;
     }
 
     // Append every indexed entity within Chebyshev radius RadiusCells of Center to OutEntities (broad phase — the
@@ -50,8 +112,10 @@ struct FMythicCellSpatialIndex {
         }
         for (int32 DY = -RadiusCells; DY <= RadiusCells; ++DY) {
             for (int32 DX = -RadiusCells; DX <= RadiusCells; ++DX) {
-                if (const TArray<FMassEntityHandle> *Bucket = CellBuckets.Find(FMythicCellCoord(Center.X + DX, Center.Y + DY))) {
-                    OutEntities.Append(*Bucket);
+                if (const TArray<FEntry> *Bucket = CellBuckets.Find(FMythicCellCoord(Center.X + DX, Center.Y + DY))) {
+                    for (const FEntry &Entry : *Bucket) {
+                        OutEntities.Add(Entry.Entity);
+                    }
                 }
             }
         }
@@ -59,14 +123,40 @@ struct FMythicCellSpatialIndex {
 
     // Number of entities indexed in exactly this cell (for the per-cell population census). 0 if the cell is empty.
     int32 GetCellCount(const FMythicCellCoord &Cell) const {
-        const TArray<FMassEntityHandle> *Bucket = CellBuckets.Find(Cell);
+        const TArray<FEntry> *Bucket = CellBuckets.Find(Cell);
         return Bucket ? Bucket->Num() : 0;
     }
 
-    // Total entities indexed across all cells since the last Reset.
-    int32 Num() const { return TotalEntities; }
+    // Entities in this cell carrying ALL of Required and NONE of Excluded. O(bucket) — buckets are capped by the
+    // per-cell population limits, so this is a handful of byte tests.
+    int32 GetCellCount(const FMythicCellCoord &Cell, EMythicCellEntityCategory Required, EMythicCellEntityCategory Excluded) const {
+        const TArray<FEntry> *Bucket = CellBuckets.Find(Cell);
+        if (!Bucket) {
+            return 0;
+        }
+        int32 Count = 0;
+        for (const FEntry &Entry : *Bucket) {
+            if (EnumHasAllFlags(Entry.Categories, Required) && !EnumHasAnyFlags(Entry.Categories, Excluded)) {
+                ++Count;
+            }
+        }
+        return Count;
+    }
+
+    // Is this entity indexed, and if so where.
+    const FMythicCellCoord *FindCell(FMassEntityHandle Entity) const { return EntityCells.Find(Entity); }
+
+    // Total entities currently indexed.
+    int32 Num() const { return EntityCells.Num(); }
 
 private:
-    TMap<FMythicCellCoord, TArray<FMassEntityHandle>> CellBuckets;
-    int32 TotalEntities = 0;
+    struct FEntry {
+        FMassEntityHandle Entity;
+        EMythicCellEntityCategory Categories = EMythicCellEntityCategory::None;
+    };
+
+    TMap<FMythicCellCoord, TArray<FEntry>> CellBuckets;
+
+    /** Entity → its bucket, so Remove/Move never need the caller's idea of the old cell. */
+    TMap<FMassEntityHandle, FMythicCellCoord> EntityCells;
 };
@@ -0,0 +1,216 @@
+// Mythic Living World — Budget Governor Implementation
+// Measured cost per unit + backlog per lane, one priority-ordered split of the frame-scaled budget per frame.
+
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h"
+#include "World/LivingWorld/LivingWorldSubsystem.h"
+#include "World/LivingWorld/LivingWorldSettings.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+// ─────────────────────────────────────────────────────────────
+// Subsystem Lifecycle
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLivingWorldBudgetSubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UMythicLivingWorldBudgetSubsystem::Initialize(FSubsystemCollectionBase &Collection) {
+    Super::Initialize(Collection);
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMythicLivingWorldBudgetSubsystem::Tick), 0.0f);
+}
+
+void UMythicLivingWorldBudgetSubsystem::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    for (FLaneState &State : LaneStates) {
+        State = FLaneState();
+    }
+    bAdapting = false;
+
+    Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// Processor interface
+// ─────────────────────────────────────────────────────────────
+
+int32 UMythicLivingWorldBudgetSubsystem::GetBudget(EMythicLivingWorldBudgetLane Lane, int32 StaticCap) {
+    FLaneState &State = LaneStates[static_cast<int32>(Lane)];
+    State.StaticCap = StaticCap;
+    if (!State.bSeen) {
+        State.bSeen = true;
+        State.Demand = StaticCap; // until the first report, assume the authored cap is what the lane needs
+        State.LastReportSeconds = FPlatformTime::Seconds();
+    }
+    if (!bAdapting || State.Granted <= 0) {
+        State.Granted = StaticCap;
+    }
+    return State.Granted;
+}
+
+void UMythicLivingWorldBudgetSubsystem::ReportWork(EMythicLivingWorldBudgetLane Lane, int32 UnitsDone, int32 Backlog, double Seconds) {
+    FLaneState &State = LaneStates[static_cast<int32>(Lane)];
+    State.Demand = FMath::Max(0, UnitsDone) + FMath::Max(0, Backlog);
+    State.UnitsDone = FMath::Max(0, UnitsDone);
+    ++State.Reports;
+    State.LastReportSeconds = FPlatformTime::Seconds();
+    if (UnitsDone > 0) {
+        const float Sample = static_cast<float>(Seconds * 1000.0 / UnitsDone);
+        State.CostMsPerUnit = State.CostMsPerUnit > 0.0f ? FMath::Lerp(State.CostMsPerUnit, Sample, CostSmoothing) : Sample;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Pure helpers
+// ─────────────────────────────────────────────────────────────
+
+const TCHAR *UMythicLivingWorldBudgetSubsystem::GetLaneName(EMythicLivingWorldBudgetLane Lane) {
+    switch (Lane) {
+    case EMythicLivingWorldBudgetLane::WitnessEvals:
+        return TEXT("Witness");
+    case EMythicLivingWorldBudgetLane::PressureEvals:
+        return TEXT("Pressure");
+    case EMythicLivingWorldBudgetLane::Promotions:
+        return TEXT("Promote");
+    case EMythicLivingWorldBudgetLane::Rescores:
+        return TEXT("Rescore");
+    case EMythicLivingWorldBudgetLane::PlacementValidations:
+        return TEXT("Placement");
+    case EMythicLivingWorldBudgetLane::Spawns:
+        return TEXT("Spawn");
+    case EMythicLivingWorldBudgetLane::PatrolSpawns:
+        return TEXT("PatrolSpawn");
+    case EMythicLivingWorldBudgetLane::CreatureSpawns:
+        return TEXT("CreatureSpawn");
+    default:
+        return TEXT("?");
+    }
+}
+
+int32 UMythicLivingWorldBudgetSubsystem::GetLanePriority(EMythicLivingWorldBudgetLane Lane) {
+    switch (Lane) {
+    case EMythicLivingWorldBudgetLane::WitnessEvals:
+    case EMythicLivingWorldBudgetLane::PressureEvals:
+        return 3; // reactions to what the player just did
+    case EMythicLivingWorldBudgetLane::Promotions:
+    case EMythicLivingWorldBudgetLane::Rescores:
+    case EMythicLivingWorldBudgetLane::PlacementValidations:
+        return 2; // bodies near the player
+    default:
+        return 1; // population top-up — can always wait a frame
+    }
+}
+
+float UMythicLivingWorldBudgetSubsystem::ComputeEffectiveBudgetMs(float BudgetMs, float TargetFrameMs, float FrameMs) {
+    if (TargetFrameMs <= 0.0f || FrameMs <= 0.0f) {
+        return BudgetMs;
+    }
+    return BudgetMs * FMath::Clamp(TargetFrameMs / FrameMs, MinFrameScale, MaxFrameScale);
+}
+
+void UMythicLivingWorldBudgetSubsystem::ComputeLaneLimits(int32 StaticCap, float FloorScale, float CeilingScale, int32 &OutFloor,
+                                                          int32 &OutCeiling) {
+    OutFloor = FMath::Max(1, FMath::FloorToInt32(StaticCap * FloorScale));
+    OutCeiling = FMath::Max(OutFloor, FMath::FloorToInt32(StaticCap * CeilingScale));
+}
+
+float UMythicLivingWorldBudgetSubsystem::DistributeBudgets(TConstArrayView<FMythicBudgetLaneInput> Lanes, float BudgetMs,
+                                                           TArrayView<int32> OutBudgets) {
+    check(OutBudgets.Num() == Lanes.Num());
+
+    // Floors first: guaranteed, and only the part a lane will actually use is charged against the budget.
+    float SpentMs = 0.0f;
+    TArray<int32, TInlineAllocator<static_cast<int32>(EMythicLivingWorldBudgetLane::Count)>> Order;
+    for (int32 i = 0; i < Lanes.Num(); ++i) {
+        const FMythicBudgetLaneInput &Lane = Lanes[i];
+        OutBudgets[i] = Lane.Floor;
+        SpentMs += FMath::Max(0.0f, Lane.CostMsPerUnit) * FMath::Min(Lane.Floor, Lane.Demand);
+        if (Lane.Demand > Lane.Floor && Lane.Ceiling > Lane.Floor) {
+            Order.Add(i);
+        }
+    }
+
+    Order.Sort([&Lanes](int32 A, int32 B) {
+        if (Lanes[A].Priority != Lanes[B].Priority) {
+            return Lanes[A].Priority > Lanes[B].Priority;
+        }
+        const int32 BacklogA = Lanes[A].Demand - Lanes[A].Floor;
+        const int32 BacklogB = Lanes[B].Demand - Lanes[B].Floor;
+        return BacklogA != BacklogB ? BacklogA > BacklogB : A < B;
+    });
+
+    // Then the remainder, in serving order.
+    for (const int32 i : Order) {
+        const FMythicBudgetLaneInput &Lane = Lanes[i];
+        const int32 Wanted = FMath::Min(Lane.Demand, Lane.Ceiling) - Lane.Floor;
+        int32 Extra = Wanted;
+        if (Lane.CostMsPerUnit > 0.0f) {
+            const float RemainingMs = BudgetMs - SpentMs;
+            if (RemainingMs <= 0.0f) {
+                break;
+            }
+            Extra = FMath::Min(Wanted, FMath::FloorToInt32(RemainingMs / Lane.CostMsPerUnit));
+            SpentMs += Extra * Lane.CostMsPerUnit;
+        }
+        OutBudgets[i] += Extra;
+    }
+    return SpentMs;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Tick — re-divide the budget
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLivingWorldBudgetSubsystem::Tick(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicLivingWorldBudget_Tick);
+
+    const UWorld *World = GetWorld();
+    const UGameInstance *GI = World ? World->GetGameInstance() : nullptr;
+    const UMythicLivingWorldSubsystem *LWS = GI ? GI->GetSubsystem<UMythicLivingWorldSubsystem>() : nullptr;
+    const UMythicLivingWorldSettings *Settings = LWS ? LWS->GetSettings() : nullptr;
+    if (!Settings || !Settings->bAdaptiveBudgets) {
+        bAdapting = false;
+        return true;
+    }
+
+    // Game-thread work time, not wall time: an idle dedicated server sleeping out its tick rate has plenty of headroom.
+    // Fall back to the frame delta where the engine doesn't publish it.
+    const float FrameMs = GGameThreadTime > 0 ? static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)) : DeltaTime * 1000.0f;
+    SmoothedFrameMs = SmoothedFrameMs > 0.0f ? FMath::Lerp(SmoothedFrameMs, FrameMs, FrameSmoothing) : FrameMs;
+    EffectiveBudgetMs = ComputeEffectiveBudgetMs(Settings->AdaptiveBudgetMs, Settings->AdaptiveBudgetTargetFrameMs, SmoothedFrameMs);
+
+    const double NowSeconds = FPlatformTime::Seconds();
+    constexpr int32 NumLanes = static_cast<int32>(EMythicLivingWorldBudgetLane::Count);
+    FMythicBudgetLaneInput Inputs[NumLanes];
+    int32 Budgets[NumLanes] = {};
+    for (int32 l = 0; l < NumLanes; ++l) {
+        const FLaneState &State = LaneStates[l];
+        FMythicBudgetLaneInput &Input = Inputs[l];
+        if (!State.bSeen) {
+            continue; // all zero: no floor, no demand, no cost
+        }
+        ComputeLaneLimits(State.StaticCap, Settings->AdaptiveBudgetFloorScale, Settings->AdaptiveBudgetCeilingScale, Input.Floor,
+                          Input.Ceiling);
+        Input.CostMsPerUnit = State.CostMsPerUnit;
+        Input.Demand = NowSeconds - State.LastReportSeconds <= DemandExpirySeconds ? State.Demand : 0;
+        Input.Priority = GetLanePriority(static_cast<EMythicLivingWorldBudgetLane>(l));
+    }
+    ProjectedMs = DistributeBudgets(Inputs, EffectiveBudgetMs, Budgets);
+
+    for (int32 l = 0; l < NumLanes; ++l) {
+        if (LaneStates[l].bSeen) {
+            LaneStates[l].Granted = Budgets[l];
+        }
+    }
+    bAdapting = true;
+    return true;
+}
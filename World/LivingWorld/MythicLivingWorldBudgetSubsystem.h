@@ -0,0 +1,160 @@
+// Mythic Living World — Budget Governor
+// Re-divides the living-world processors' per-frame work caps every frame from measured cost, backlog and frame time.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "MythicLivingWorldBudgetSubsystem.generated.h"
+
+/** The processor work caps the governor owns — one per budgeted loop, named after the setting it adapts. */
+enum class EMythicLivingWorldBudgetLane : uint8 {
+    WitnessEvals,         // MaxWitnessEvalsPerFrame — witness perception
+    PressureEvals,        // MaxPressureEvalsPerFrame — pressure processor
+    Promotions,           // MaxPromotionsPerFrame — significance promotions
+    Rescores,             // MaxRescoresPerFrame — significance rescoring
+    PlacementValidations, // MaxPlacementValidationsPerTick — actor spawn placement
+    Spawns,               // MaxSpawnsPerTick — population spawner
+    PatrolSpawns,         // MaxPatrolSpawnsPerTick — territory patrol spawner
+    CreatureSpawns,       // MaxCreatureSpawnsPerTick — creature spawner
+    Count
+};
+
+/** One lane's input to UMythicLivingWorldBudgetSubsystem::DistributeBudgets. */
+struct FMythicBudgetLaneInput {
+    /** Smoothed measured cost of one unit of work (ms). <= 0 = not measured yet, treated as free. */
+    float CostMsPerUnit = 0.0f;
+
+    /** Units the lane wants this frame (its last pass's work + backlog). */
+    int32 Demand = 0;
+
+    /** Always granted, whatever the millisecond budget says */
+    int32 Floor = 0;
+
+    /** Never exceeded, however much budget is spare */
+    int32 Ceiling = 0;
+
+    /** Higher is served first */
+    int32 Priority = 0;
+};
+
+/**
+ * Living-World Budget Governor — adapts the static per-frame caps (MaxWitnessEvalsPerFrame, MaxSpawnsPerTick, ...) to
+ * the machine and the moment instead of one hand-tuned number per cap.
+ *
+ * Each budgeted processor asks GetBudget(Lane, StaticCap) for its cap at the start of a pass and ReportWork()s what it
+ * did (units, units left waiting, seconds) at the end — timing the same region its TRACE_CPUPROFILER_EVENT_SCOPE
+ * marks. Once per frame the governor then:
+ *
+ * - smooths each lane's cost per unit of work;
+ * - scales the total living-world budget (AdaptiveBudgetMs) by frame headroom — up to 2x on frames well under
+ *   AdaptiveBudgetTargetFrameMs, down to 0.25x when the game thread runs long (combat spikes);
+ * - hands every lane its floor, then spends what is left on lanes with backlog in priority order (see
+ *   GetLanePriority), each up to its ceiling.
+ *
+ * Floors and ceilings are the static settings scaled by AdaptiveBudgetFloorScale / AdaptiveBudgetCeilingScale, so the
+ * authored caps still anchor every lane. With bAdaptiveBudgets off (or before the first frame) GetBudget returns the
+ * static cap unchanged.
+ *
+ * Game-thread only (every budgeted processor runs on the game thread). Created for every game world.
+ */
+UCLASS()
+class MYTHIC_API UMythicLivingWorldBudgetSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    //~ End USubsystem Interface
+
+    /** This frame's cap for Lane. StaticCap is the authored setting — returned as-is while adaptation is off. */
+    int32 GetBudget(EMythicLivingWorldBudgetLane Lane, int32 StaticCap);
+
+    /** A pass of Lane did UnitsDone units in Seconds and left Backlog units waiting.
+     *
+     *  Most passes stop walking (chunks, spawn rings, queued requests) the moment their budget is spent, so they can't
+     *  count what remained. Such a pass reports its spent cap as Backlog — "as much again" — whenever the budget ran
+     *  out, and 0 when it finished with budget to spare. Passes that can count their leftovers report them exactly. */
+    void ReportWork(EMythicLivingWorldBudgetLane Lane, int32 UnitsDone, int32 Backlog, double Seconds);
+
+    /** Current cap handed to Lane (debug/stats) */
+    int32 GetLaneBudget(EMythicLivingWorldBudgetLane Lane) const { return LaneStates[static_cast<int32>(Lane)].Granted; }
+
+    /** Smoothed cost of one unit of Lane's work, ms (debug/stats) */
+    float GetLaneCostMs(EMythicLivingWorldBudgetLane Lane) const { return LaneStates[static_cast<int32>(Lane)].CostMsPerUnit; }
+
+    /** Units Lane last asked for (debug/stats) */
+    int32 GetLaneDemand(EMythicLivingWorldBudgetLane Lane) const { return LaneStates[static_cast<int32>(Lane)].Demand; }
+
+    /** Units Lane's most recent pass actually did, and how many passes it has reported (telemetry) */
+    int32 GetLaneUnitsDone(EMythicLivingWorldBudgetLane Lane) const { return LaneStates[static_cast<int32>(Lane)].UnitsDone; }
+    int32 GetLaneReportCount(EMythicLivingWorldBudgetLane Lane) const { return LaneStates[static_cast<int32>(Lane)].Reports; }
+
+    /** Is the governor overriding the static caps? (debug/stats) */
+    bool IsAdapting() const { return bAdapting; }
+
+    /** Frame-scaled living-world budget and the ms the current grants are projected to cost (debug/stats) */
+    float GetEffectiveBudgetMs() const { return EffectiveBudgetMs; }
+    float GetProjectedMs() const { return ProjectedMs; }
+
+    // ─── Pure helpers (static for tests) ─────────────────
+
+    /** Weight of a sample in the per-lane cost and frame-time averages */
+    static constexpr float CostSmoothing = 0.2f;
+    static constexpr float FrameSmoothing = 0.1f;
+
+    /** A lane that hasn't reported for this long (event-driven and idle, or switched off) stops claiming budget */
+    static constexpr double DemandExpirySeconds = 2.0;
+
+    /** Bounds of the frame-headroom scale applied to AdaptiveBudgetMs */
+    static constexpr float MinFrameScale = 0.25f;
+    static constexpr float MaxFrameScale = 2.0f;
+
+    /** Short display name (debugger, CSV columns) */
+    static const TCHAR *GetLaneName(EMythicLivingWorldBudgetLane Lane);
+
+    /** Serving order when budget is short: reactive sim (witness, pressure) before embodiment before spawning. */
+    static int32 GetLanePriority(EMythicLivingWorldBudgetLane Lane);
+
+    /** BudgetMs scaled by TargetFrameMs / FrameMs, clamped to [MinFrameScale, MaxFrameScale]. Unknown frame time (or
+     *  no target) leaves it unscaled. */
+    static float ComputeEffectiveBudgetMs(float BudgetMs, float TargetFrameMs, float FrameMs);
+
+    /** Floor = StaticCap * FloorScale (at least 1), ceiling = StaticCap * CeilingScale (at least the floor). */
+    static void ComputeLaneLimits(int32 StaticCap, float FloorScale, float CeilingScale, int32 &OutFloor, int32 &OutCeiling);
+
+    /**
+     * Split BudgetMs across Lanes. Every lane gets its floor; the remainder goes to lanes whose demand exceeds their
+     * floor, highest priority first (larger backlog first within a priority), each up to min(demand, ceiling) or as many
+     * units as the remaining ms buys. Writes one cap per lane to OutBudgets and returns the projected cost in ms (floors
+     * count only up to demand — unused floor costs nothing).
+     */
+    static float DistributeBudgets(TConstArrayView<FMythicBudgetLaneInput> Lanes, float BudgetMs, TArrayView<int32> OutBudgets);
+
+private:
+    /** Core-ticker callback: re-divide the budget for the coming frame */
+    bool Tick(float DeltaTime);
+
+    struct FLaneState {
+        int32 StaticCap = 0;
+        int32 Granted = 0;
+        int32 Demand = 0;
+        int32 UnitsDone = 0;
+        int32 Reports = 0;
+        float CostMsPerUnit = 0.0f;
+        double LastReportSeconds = 0.0;
+        bool bSeen = false; // asked for a budget at least once (processors that never run stay out of the split)
+    };
+
+    FLaneState LaneStates[static_cast<int32>(EMythicLivingWorldBudgetLane::Count)];
+
+    float SmoothedFrameMs = 0.0f;
+    float EffectiveBudgetMs = 0.0f;
+    float ProjectedMs = 0.0f;
+    bool bAdapting = false;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
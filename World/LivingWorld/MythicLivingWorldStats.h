@@ -0,0 +1,89 @@
+// Mythic Living World — Stats
+// The `stat MythicLivingWorld` group, the MythicLivingWorld CSV category, and the fixed-bucket histogram the telemetry
+// sampler keeps for soak runs.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("MythicLivingWorld"), STATGROUP_MythicLivingWorld, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MYTHIC_API, MythicLivingWorld);
+
+/**
+ * Log2-bucketed histogram of a non-negative measurement (ms, KB, entities per pass). Bucket 0 holds [0, Base), bucket b
+ * holds [Base * 2^(b-1), Base * 2^b), and the last bucket is open-ended — so 16 buckets at Base 1/16 ms cover 0..1 s
+ * with the same relative resolution at every scale. Fixed size, no allocation: cheap enough to feed every frame for the
+ * length of a soak run, and percentiles are read back as bucket upper bounds (conservative, never optimistic).
+ *
+ * Pure data. Verified by Mythic.LivingWorld.PerfHistogram.
+ */
+struct FMythicPerfHistogram {
+    static constexpr int32 NumBuckets = 16;
+
+    explicit FMythicPerfHistogram(double InBase = 1.0) : Base(InBase > 0.0 ? InBase : 1.0) {}
+
+    void Reset() {
+        FMemory::Memzero(Counts);
+        Count = 0;
+        Sum = 0.0;
+        Max = 0.0;
+    }
+
+    void Add(double Value) {
+        Value = FMath::Max(0.0, Value);
+        ++Counts[GetBucketIndex(Value)];
+        ++Count;
+        Sum += Value;
+        Max = FMath::Max(Max, Value);
+    }
+
+    int32 GetBucketIndex(double Value) const {
+        int32 Bucket = 0;
+        for (double Bound = Base; Bucket < NumBuckets - 1 && Value >= Bound; Bound *= 2.0) {
+            ++Bucket;
+        }
+        return Bucket;
+    }
+
+    /** Exclusive upper bound of a bucket (the last bucket's is the largest sample seen) */
+    double GetBucketUpperBound(int32 Bucket) const {
+        return Bucket >= NumBuckets - 1 ? Max : Base * FMath::Pow(2.0, static_cast<double>(Bucket));
+    }
+
+    /** Upper bound of the bucket holding the Fraction-th sample (0.5 = median, 0.99 = p99), capped at the maximum */
+    double GetPercentile(double Fraction) const {
+        if (Count == 0) {
+            return 0.0;
+        }
+        const int64 Rank = FMath::Clamp<int64>(FMath::CeilToInt64(Fraction * Count), 1, Count);
+        int64 Seen = 0;
+        for (int32 b = 0; b < NumBuckets; ++b) {
+            Seen += Counts[b];
+            if (Seen >= Rank) {
+                return FMath::Min(GetBucketUpperBound(b), Max);
+            }
+        }
+        return Max;
+    }
+
+    int64 GetCount() const { return Count; }
+    double GetMean() const { return Count > 0 ? Sum / Count : 0.0; }
+    double GetMax() const { return Max; }
+    int64 GetBucketCount(int32 Bucket) const { return Counts[Bucket]; }
+
+    /** "n=… mean=… p50=… p95=… p99=… max=…" for logs */
+    FString ToSummaryString() const {
+        return FString::Printf(TEXT("n=%lld mean=%.3f p50=%.3f p95=%.3f p99=%.3f max=%.3f"), Count, GetMean(),
+                               GetPercentile(0.5), GetPercentile(0.95), GetPercentile(0.99), Max);
+    }
+
+private:
+    double Base = 1.0;
+    int64 Counts[NumBuckets] = {};
+    int64 Count = 0;
+    double Sum = 0.0;
+    double Max = 0.0;
+};
@@ -0,0 +1,310 @@
+// Mythic Living World — Telemetry Implementation
+// Cumulative counters → per-frame / per-tick deltas → stat group, CSV columns and histograms.
+
+#include "World/LivingWorld/MythicLivingWorldTelemetrySubsystem.h"
+#include "World/LivingWorld/LivingWorldSubsystem.h"
+#include "World/LivingWorld/LivingWorldTypes.h"
+#include "World/LivingWorld/CausalFabric/CausalFabric.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+CSV_DEFINE_CATEGORY_MODULE(MYTHIC_API, MythicLivingWorld, true);
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Sim tick (ms, last)"), STAT_MythicLW_SimTickMs, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Sim commit (ms, last)"), STAT_MythicLW_SimCommitMs, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("SimulationLock wait (ms, frame)"), STAT_MythicLW_SimLockWaitMs, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SimulationLock contended (frame)"), STAT_MythicLW_SimLockContended, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Fabric appends/s"), STAT_MythicLW_FabricAppendRate, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Fabric commit (KB, last)"), STAT_MythicLW_FabricCommitKB, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fabric queries (frame)"), STAT_MythicLW_FabricQueries, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fabric deferred commits (frame)"), STAT_MythicLW_FabricDeferredCommits, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Fabric commit wait (ms, last)"), STAT_MythicLW_FabricCommitWaitMs, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier0 ambient"), STAT_MythicLW_Tier0, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier1 reactive"), STAT_MythicLW_Tier1, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier2 cognitive"), STAT_MythicLW_Tier2, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier3 persistent"), STAT_MythicLW_Tier3, STATGROUP_MythicLivingWorld);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Embodiment pool hit rate"), STAT_MythicLW_PoolHitRate, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Witness evals"), STAT_MythicLW_WitnessDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Witness budget"), STAT_MythicLW_WitnessBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pressure evals"), STAT_MythicLW_PressureDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pressure budget"), STAT_MythicLW_PressureBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Promotions"), STAT_MythicLW_PromoteDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Promotion budget"), STAT_MythicLW_PromoteBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rescores"), STAT_MythicLW_RescoreDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rescore budget"), STAT_MythicLW_RescoreBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Placement validations"), STAT_MythicLW_PlacementDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Placement budget"), STAT_MythicLW_PlacementBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns"), STAT_MythicLW_SpawnDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn budget"), STAT_MythicLW_SpawnBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Patrol spawns"), STAT_MythicLW_PatrolDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Patrol spawn budget"), STAT_MythicLW_PatrolBudget, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Creature spawns"), STAT_MythicLW_CreatureDone, STATGROUP_MythicLivingWorld);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Creature spawn budget"), STAT_MythicLW_CreatureBudget, STATGROUP_MythicLivingWorld);
+
+// ─────────────────────────────────────────────────────────────
+// Subsystem Lifecycle
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLivingWorldTelemetrySubsystem::ShouldCreateSubsystem(UObject *Outer) const {
+    if (const UWorld *World = Cast<UWorld>(Outer)) {
+        return World->IsGameWorld();
+    }
+    return false;
+}
+
+void UMythicLivingWorldTelemetrySubsystem::Initialize(FSubsystemCollectionBase &Collection) {
+    Super::Initialize(Collection);
+
+#if CSV_PROFILER
+    for (int32 l = 0; l < NumLanes; ++l) {
+        const TCHAR *LaneName = UMythicLivingWorldBudgetSubsystem::GetLaneName(static_cast<EMythicLivingWorldBudgetLane>(l));
+        LaneCsvNames[l][0] = FName(FString::Printf(TEXT("Lane_%s_Done"), LaneName));
+        LaneCsvNames[l][1] = FName(FString::Printf(TEXT("Lane_%s_Budget"), LaneName));
+    }
+#endif
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UMythicLivingWorldTelemetrySubsystem::Tick), 0.0f);
+}
+
+void UMythicLivingWorldTelemetrySubsystem::Deinitialize() {
+    if (TickHandle.IsValid()) {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+
+    // End of a session / soak run: leave the distributions in the log.
+    if (SimTickMs.GetCount() > 0 || SimLockWaitMs.GetCount() > 0) {
+        DumpHistograms();
+    }
+
+    Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// Histograms
+// ─────────────────────────────────────────────────────────────
+
+void UMythicLivingWorldTelemetrySubsystem::DumpHistograms() const {
+    const auto Line = [](const TCHAR *Name, const FMythicPerfHistogram &Histogram) {
+        if (Histogram.GetCount() > 0) {
+            UE_LOG(LogMythLivingWorld, Log, TEXT("  %-28s %s"), Name, *Histogram.ToSummaryString());
+        }
+    };
+
+    UE_LOG(LogMythLivingWorld, Log, TEXT("Living-world perf histograms:"));
+    Line(TEXT("SimTick ms"), SimTickMs);
+    Line(TEXT("SimCommit ms"), SimCommitMs);
+    for (int32 p = 0; p < SimPhaseMs.Num(); ++p) {
+        Line(*FString::Printf(TEXT("Sim %s ms"), SimPhaseNames[p]), SimPhaseMs[p]);
+    }
+    Line(TEXT("SimulationLock wait ms/frame"), SimLockWaitMs);
+    Line(TEXT("Fabric commit KB/tick"), FabricCommitKB);
+    Line(TEXT("Fabric queries/frame"), FabricQueriesPerFrame);
+    Line(TEXT("Fabric commit wait ms/tick"), FabricCommitWaitMs);
+    Line(TEXT("Significance pass ms"), SignificancePassMs);
+    for (int32 l = 0; l < NumLanes; ++l) {
+        const TCHAR *LaneName = UMythicLivingWorldBudgetSubsystem::GetLaneName(static_cast<EMythicLivingWorldBudgetLane>(l));
+        Line(*FString::Printf(TEXT("%s units/pass"), LaneName), LaneUnits[l]);
+    }
+}
+
+void UMythicLivingWorldTelemetrySubsystem::ResetHistograms() {
+    SimTickMs.Reset();
+    SimCommitMs.Reset();
+    for (FMythicPerfHistogram &Histogram : SimPhaseMs) {
+        Histogram.Reset();
+    }
+    SimLockWaitMs.Reset();
+    FabricCommitKB.Reset();
+    FabricQueriesPerFrame.Reset();
+    FabricCommitWaitMs.Reset();
+    SignificancePassMs.Reset();
+    for (FMythicPerfHistogram &Histogram : LaneUnits) {
+        Histogram.Reset();
+    }
+}
+
+void UMythicLivingWorldTelemetrySubsystem::BindSimPhases(const FMythicSimTickTimings &Timings) {
+    SimPhaseNames = Timings.PhaseNames;
+    SimPhaseMs.Reset();
+    SimPhaseMs.Init(FMythicPerfHistogram(1.0 / 16.0), SimPhaseNames.Num());
+#if CSV_PROFILER
+    SimPhaseCsvNames.Reset();
+    for (const TCHAR *Name : SimPhaseNames) {
+        SimPhaseCsvNames.Add(FName(FString::Printf(TEXT("Sim_%s_Ms"), Name)));
+    }
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────
+// Tick — sample and publish
+// ─────────────────────────────────────────────────────────────
+
+bool UMythicLivingWorldTelemetrySubsystem::Tick(float DeltaTime) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicLivingWorldTelemetry_Tick);
+
+    const UWorld *World = GetWorld();
+    const UGameInstance *GI = World ? World->GetGameInstance() : nullptr;
+    UMythicLivingWorldSubsystem *LWS = GI ? GI->GetSubsystem<UMythicLivingWorldSubsystem>() : nullptr;
+    if (!LWS || !LWS->IsSystemActive()) {
+        return true;
+    }
+    const UMythicCausalFabric *Fabric = LWS->GetCausalFabric();
+    const double NowSeconds = FPlatformTime::Seconds();
+
+    // ─── Cumulative readings ───
+    const FMythicSimLockWaitStats Lock = LWS->GetSimLockWaitStats();
+    const uint64 FabricQueries = Fabric ? Fabric->GetQueryCount() : 0;
+    const uint32 FabricEvents = Fabric ? Fabric->GetTotalEventCount() : 0;
+    const uint64 FabricBytes = Fabric ? Fabric->GetCommittedBytes() : 0;
+    const uint64 FabricDeferredCommits = Fabric ? Fabric->GetDeferredCommitCount() : 0;
+    const double FabricCommitWaitSeconds = Fabric ? Fabric->GetCommitLockWaitSeconds() : 0.0;
+    if (!bPrimed) {
+        // First frame only establishes the baselines — everything before it (load, warm-up) is not a frame's worth.
+        LastLockContended = Lock.Contended;
+        LastLockWaitMs = Lock.WaitMs;
+        LastFabricQueries = FabricQueries;
+        LastFabricEvents = FabricEvents;
+        LastFabricBytes = FabricBytes;
+        LastFabricDeferredCommits = FabricDeferredCommits;
+        LastFabricCommitWaitSeconds = FabricCommitWaitSeconds;
+        LastSimTickSeconds = NowSeconds;
+        LastSignificancePasses = LWS->GetSignificanceStats().Passes;
+        bPrimed = true;
+        return true;
+    }
+
+    // ─── SimulationLock (this frame) ───
+    Latest.SimLockWaitMs = static_cast<float>(Lock.WaitMs - LastLockWaitMs);
+    Latest.SimLockContended = static_cast<int32>(Lock.Contended - LastLockContended);
+    LastLockWaitMs = Lock.WaitMs;
+    LastLockContended = Lock.Contended;
+    SimLockWaitMs.Add(Latest.SimLockWaitMs);
+
+    // ─── Fabric queries (this frame) ───
+    Latest.FabricQueries = static_cast<int32>(FabricQueries - LastFabricQueries);
+    LastFabricQueries = FabricQueries;
+    FabricQueriesPerFrame.Add(Latest.FabricQueries);
+    Latest.FabricDeferredCommits = static_cast<int32>(FabricDeferredCommits - LastFabricDeferredCommits);
+    LastFabricDeferredCommits = FabricDeferredCommits;
+
+    // ─── Sim tick (when a new one has completed) ───
+    if (LWS->TryCopySimTickTimings(SimTimings) && SimTimings.Serial != Latest.SimTickSerial) {
+        if (SimPhaseNames.Num() != SimTimings.PhaseNames.Num()) {
+            BindSimPhases(SimTimings);
+        }
+        Latest.SimTickSerial = SimTimings.Serial;
+        Latest.SimTickMs = SimTimings.TotalMs;
+        Latest.SimCommitMs = SimTimings.CommitMs;
+        SimTickMs.Add(SimTimings.TotalMs);
+        SimCommitMs.Add(SimTimings.CommitMs);
+        for (int32 p = 0; p < SimTimings.PhaseMs.Num(); ++p) {
+            SimPhaseMs[p].Add(SimTimings.PhaseMs[p]);
+        }
+
+        // Fabric appends drain and commit once per sim tick, so rate and commit size are per-tick measurements too.
+        const double Interval = NowSeconds - LastSimTickSeconds;
+        Latest.FabricAppendsPerSecond = Interval > 0.0 ? static_cast<float>((FabricEvents - LastFabricEvents) / Interval) : 0.0f;
+        Latest.FabricCommitKB = static_cast<float>((FabricBytes - LastFabricBytes) / 1024.0);
+        FabricCommitKB.Add(Latest.FabricCommitKB);
+        Latest.FabricCommitWaitMs = static_cast<float>((FabricCommitWaitSeconds - LastFabricCommitWaitSeconds) * 1000.0);
+        FabricCommitWaitMs.Add(Latest.FabricCommitWaitMs);
+        LastFabricEvents = FabricEvents;
+        LastFabricBytes = FabricBytes;
+        LastFabricCommitWaitSeconds = FabricCommitWaitSeconds;
+        LastSimTickSeconds = NowSeconds;
+
+#if CSV_PROFILER
+        const uint32 CsvCategory = CSV_CATEGORY_INDEX(MythicLivingWorld);
+        for (int32 p = 0; p < SimTimings.PhaseMs.Num(); ++p) {
+            FCsvProfiler::RecordCustomStat(SimPhaseCsvNames[p], CsvCategory, SimTimings.PhaseMs[p], ECsvCustomStatOp::Set);
+        }
+#endif
+        CSV_CUSTOM_STAT(MythicLivingWorld, SimTickMs, Latest.SimTickMs, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(MythicLivingWorld, SimCommitMs, Latest.SimCommitMs, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(MythicLivingWorld, FabricAppendsPerSec, Latest.FabricAppendsPerSecond, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(MythicLivingWorld, FabricCommitKB, Latest.FabricCommitKB, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(MythicLivingWorld, FabricCommitWaitMs, Latest.FabricCommitWaitMs, ECsvCustomStatOp::Set);
+    }
+
+    // ─── Significance tiers + pass cost ───
+    const FMythicSignificanceStats &Sig = LWS->GetSignificanceStats();
+    FMemory::Memcpy(Latest.TierPopulation, Sig.TierPopulation, sizeof(Latest.TierPopulation));
+    if (Sig.Passes != LastSignificancePasses) {
+        LastSignificancePasses = Sig.Passes;
+        SignificancePassMs.Add(Sig.LastPassMs);
+    }
+
+    // ─── Embodiment pool ───
+    const FMythicEmbodimentPoolStats &Pool = LWS->GetEmbodimentPoolStats();
+    const int32 Acquires = Pool.Hits + Pool.Misses;
+    Latest.EmbodimentPoolHitRate = Acquires > 0 ? static_cast<float>(Pool.Hits) / Acquires : -1.0f;
+
+    // ─── Budget lanes: units each processor touched vs. what it was allowed ───
+    if (const UMythicLivingWorldBudgetSubsystem *Budgets = World->GetSubsystem<UMythicLivingWorldBudgetSubsystem>()) {
+        for (int32 l = 0; l < NumLanes; ++l) {
+            const EMythicLivingWorldBudgetLane Lane = static_cast<EMythicLivingWorldBudgetLane>(l);
+            const int32 Reports = Budgets->GetLaneReportCount(Lane);
+            if (Reports == LastLaneReports[l]) {
+                continue; // no pass since the last sample
+            }
+            LastLaneReports[l] = Reports;
+            LaneUnits[l].Add(Budgets->GetLaneUnitsDone(Lane));
+#if CSV_PROFILER
+            FCsvProfiler::RecordCustomStat(LaneCsvNames[l][0], CSV_CATEGORY_INDEX(MythicLivingWorld), Budgets->GetLaneUnitsDone(Lane),
+                                           ECsvCustomStatOp::Set);
+            FCsvProfiler::RecordCustomStat(LaneCsvNames[l][1], CSV_CATEGORY_INDEX(MythicLivingWorld), Budgets->GetLaneBudget(Lane),
+                                           ECsvCustomStatOp::Set);
+#endif
+        }
+
+#if STATS
+        using ELane = EMythicLivingWorldBudgetLane;
+        SET_DWORD_STAT(STAT_MythicLW_WitnessDone, Budgets->GetLaneUnitsDone(ELane::WitnessEvals));
+        SET_DWORD_STAT(STAT_MythicLW_WitnessBudget, Budgets->GetLaneBudget(ELane::WitnessEvals));
+        SET_DWORD_STAT(STAT_MythicLW_PressureDone, Budgets->GetLaneUnitsDone(ELane::PressureEvals));
+        SET_DWORD_STAT(STAT_MythicLW_PressureBudget, Budgets->GetLaneBudget(ELane::PressureEvals));
+        SET_DWORD_STAT(STAT_MythicLW_PromoteDone, Budgets->GetLaneUnitsDone(ELane::Promotions));
+        SET_DWORD_STAT(STAT_MythicLW_PromoteBudget, Budgets->GetLaneBudget(ELane::Promotions));
+        SET_DWORD_STAT(STAT_MythicLW_RescoreDone, Budgets->GetLaneUnitsDone(ELane::Rescores));
+        SET_DWORD_STAT(STAT_MythicLW_RescoreBudget, Budgets->GetLaneBudget(ELane::Rescores));
+        SET_DWORD_STAT(STAT_MythicLW_PlacementDone, Budgets->GetLaneUnitsDone(ELane::PlacementValidations));
+        SET_DWORD_STAT(STAT_MythicLW_PlacementBudget, Budgets->GetLaneBudget(ELane::PlacementValidations));
+        SET_DWORD_STAT(STAT_MythicLW_SpawnDone, Budgets->GetLaneUnitsDone(ELane::Spawns));
+        SET_DWORD_STAT(STAT_MythicLW_SpawnBudget, Budgets->GetLaneBudget(ELane::Spawns));
+        SET_DWORD_STAT(STAT_MythicLW_PatrolDone, Budgets->GetLaneUnitsDone(ELane::PatrolSpawns));
+        SET_DWORD_STAT(STAT_MythicLW_PatrolBudget, Budgets->GetLaneBudget(ELane::PatrolSpawns));
+        SET_DWORD_STAT(STAT_MythicLW_CreatureDone, Budgets->GetLaneUnitsDone(ELane::CreatureSpawns));
+        SET_DWORD_STAT(STAT_MythicLW_CreatureBudget, Budgets->GetLaneBudget(ELane::CreatureSpawns));
+#endif
+    }
+
+    // ─── Per-frame publish ───
+    SET_FLOAT_STAT(STAT_MythicLW_SimTickMs, Latest.SimTickMs);
+    SET_FLOAT_STAT(STAT_MythicLW_SimCommitMs, Latest.SimCommitMs);
+    SET_FLOAT_STAT(STAT_MythicLW_SimLockWaitMs, Latest.SimLockWaitMs);
+    SET_DWORD_STAT(STAT_MythicLW_SimLockContended, Latest.SimLockContended);
+    SET_FLOAT_STAT(STAT_MythicLW_FabricAppendRate, Latest.FabricAppendsPerSecond);
+    SET_FLOAT_STAT(STAT_MythicLW_FabricCommitKB, Latest.FabricCommitKB);
+    SET_DWORD_STAT(STAT_MythicLW_FabricQueries, Latest.FabricQueries);
+    SET_DWORD_STAT(STAT_MythicLW_FabricDeferredCommits, Latest.FabricDeferredCommits);
+    SET_FLOAT_STAT(STAT_MythicLW_FabricCommitWaitMs, Latest.FabricCommitWaitMs);
+    SET_DWORD_STAT(STAT_MythicLW_Tier0, Latest.TierPopulation[0]);
+    SET_DWORD_STAT(STAT_MythicLW_Tier1, Latest.TierPopulation[1]);
+    SET_DWORD_STAT(STAT_MythicLW_Tier2, Latest.TierPopulation[2]);
+    SET_DWORD_STAT(STAT_MythicLW_Tier3, Latest.TierPopulation[3]);
+    SET_FLOAT_STAT(STAT_MythicLW_PoolHitRate, FMath::Max(0.0f, Latest.EmbodimentPoolHitRate));
+
+    CSV_CUSTOM_STAT(MythicLivingWorld, SimLockWaitMs, Latest.SimLockWaitMs, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, SimLockContended, Latest.SimLockContended, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, FabricQueries, Latest.FabricQueries, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, FabricDeferredCommits, Latest.FabricDeferredCommits, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, Tier0, Latest.TierPopulation[0], ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, Tier1, Latest.TierPopulation[1], ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, Tier2, Latest.TierPopulation[2], ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, Tier3, Latest.TierPopulation[3], ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(MythicLivingWorld, PoolHitRate, FMath::Max(0.0f, Latest.EmbodimentPoolHitRate), ECsvCustomStatOp::Set);
+    return true;
+}
@@ -0,0 +1,133 @@
+// Mythic Living World — Telemetry
+// Per-frame sampler behind `stat MythicLivingWorld`, the MythicLivingWorld CSV category and the soak-test histograms.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "World/LivingWorld/MythicLivingWorldStats.h"
+#include "World/LivingWorld/MythicLivingWorldBudgetSubsystem.h" // EMythicLivingWorldBudgetLane
+#include "World/LivingWorld/Simulation/WorldSimThread.h"        // FMythicSimTickTimings
+#include "MythicLivingWorldTelemetrySubsystem.generated.h"
+
+/** The most recent sampled values — what the stat group, the CSV columns and the gameplay debugger show. */
+struct FMythicLivingWorldTelemetry {
+    // ─── Sim thread (most recent completed tick) ───
+    uint64 SimTickSerial = 0;
+    float SimTickMs = 0.0f;
+    float SimCommitMs = 0.0f;
+
+    // ─── SimulationLock, game side (this frame) ───
+    float SimLockWaitMs = 0.0f;
+    int32 SimLockContended = 0;
+
+    // ─── Causal fabric ───
+    /** Events appended per second over the most recent sim tick interval */
+    float FabricAppendsPerSecond = 0.0f;
+
+    /** Read-side bytes the most recent sim tick's commit copied */
+    float FabricCommitKB = 0.0f;
+
+    /** Fabric queries this frame (all threads) */
+    int32 FabricQueries = 0;
+
+    /** Fabric commits skipped this frame because a reader still pinned the retired view */
+    int32 FabricDeferredCommits = 0;
+
+    /** Time the most recent sim tick's commit waited on the fabric publisher's swap lock */
+    float FabricCommitWaitMs = 0.0f;
+
+    // ─── Population ───
+    /** Entities per significance tier, as of the latest significance pass */
+    int32 TierPopulation[4] = {};
+
+    /** Cumulative embodiment pool hits / acquires; < 0 until the first acquire */
+    float EmbodimentPoolHitRate = -1.0f;
+};
+
+/**
+ * Living-World Telemetry — one game-thread sampler for the living world's perf counters, so the counters themselves
+ * stay a relaxed atomic increment (fabric, SimulationLock) or a plain field the owner already writes (sim tick timings,
+ * significance / embodiment-pool stats, budget lanes).
+ *
+ * Every frame it turns the cumulative counters into per-frame / per-tick deltas and publishes them three ways:
+ * - `stat MythicLivingWorld` (float/DWORD counters next to the sim thread's and the lock wait's cycle stats);
+ * - the MythicLivingWorld CSV category (per sub-step sim ms and per-lane units/budget as extra columns);
+ * - FMythicPerfHistogram per measurement, kept for the life of the world and logged at teardown (and by the
+ *   MythLivingWorldPerf cheat) — a soak run's log then carries its p50/p95/p99 for regression comparison.
+ *
+ * The sim timings are copied with a TryLock: on a frame where the sim thread is mid-tick the sampler simply waits for a
+ * later frame rather than adding to the lock wait it is measuring. Created for every game world; on a client with no
+ * active living world it samples nothing.
+ */
+UCLASS()
+class MYTHIC_API UMythicLivingWorldTelemetrySubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    //~ Begin USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool ShouldCreateSubsystem(UObject *Outer) const override;
+    //~ End USubsystem Interface
+
+    /** Latest sampled values (debug/stats) */
+    const FMythicLivingWorldTelemetry &GetLatest() const { return Latest; }
+
+    /** Histograms since Initialize or the last ResetHistograms (debug/stats) */
+    const FMythicPerfHistogram &GetSimTickHistogram() const { return SimTickMs; }
+    const FMythicPerfHistogram &GetSimLockWaitHistogram() const { return SimLockWaitMs; }
+
+    /** Log every histogram with samples to LogMythLivingWorld */
+    void DumpHistograms() const;
+
+    /** Start a fresh measurement window (e.g. after a soak run's warm-up) */
+    void ResetHistograms();
+
+private:
+    /** Core-ticker callback: sample, publish, histogram */
+    bool Tick(float DeltaTime);
+
+    /** Size the per-phase histograms (and CSV column names) to the sim thread's phase table on first sight */
+    void BindSimPhases(const FMythicSimTickTimings &Timings);
+
+    static constexpr int32 NumLanes = static_cast<int32>(EMythicLivingWorldBudgetLane::Count);
+
+    FMythicLivingWorldTelemetry Latest;
+
+    // ─── Histograms ───
+    FMythicPerfHistogram SimTickMs{1.0 / 16.0};
+    FMythicPerfHistogram SimCommitMs{1.0 / 16.0};
+    TArray<FMythicPerfHistogram> SimPhaseMs;
+    TArray<const TCHAR *> SimPhaseNames;
+    FMythicPerfHistogram SimLockWaitMs{1.0 / 16.0}; // per frame, zero frames included
+    FMythicPerfHistogram FabricCommitKB{1.0};       // per sim tick
+    FMythicPerfHistogram FabricQueriesPerFrame{1.0};
+    FMythicPerfHistogram FabricCommitWaitMs{1.0 / 64.0}; // per sim tick
+    FMythicPerfHistogram SignificancePassMs{1.0 / 16.0};
+    FMythicPerfHistogram LaneUnits[NumLanes];       // units done per reported pass
+
+    // ─── Previous cumulative readings (deltas) ───
+    bool bPrimed = false;
+    uint64 LastLockContended = 0;
+    double LastLockWaitMs = 0.0;
+    uint64 LastFabricQueries = 0;
+    uint64 LastFabricDeferredCommits = 0;
+    double LastFabricCommitWaitSeconds = 0.0;
+    uint32 LastFabricEvents = 0;
+    uint64 LastFabricBytes = 0;
+    double LastSimTickSeconds = 0.0;
+    int32 LastSignificancePasses = 0;
+    int32 LastLaneReports[NumLanes] = {};
+
+    /** Reused copy-out buffer for TryCopySimTickTimings */
+    FMythicSimTickTimings SimTimings;
+
+#if CSV_PROFILER
+    TArray<FName> SimPhaseCsvNames;
+    FName LaneCsvNames[NumLanes][2]; // units done, budget
+#endif
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
@@ -0,0 +1,114 @@
+// Mythic Living World — Snapshot Publisher
+// One published immutable, ref-counted read view at a time; shared by the faction database, the settlement registry
+// and the causal fabric.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h" // FRWLock (PublishLock)
+#include "Misc/ScopeRWLock.h"
+#include "Templates/RefCounting.h"
+
+/**
+ * Publishes immutable snapshots (an FThreadSafeRefCountedObject subclass) from one publisher to any number of readers,
+ * and recycles retired snapshot storage once nothing can reach it.
+ *
+ * READERS: Acquire() takes PublishLock's read side for exactly the pointer copy and its AddRef — never for the read
+ * itself — so a reader cannot be caught holding a loaded-but-not-yet-pinned pointer while the publisher retires it.
+ * The publisher takes the write side only to swap the pointer. Readers index the returned snapshot with no lock held.
+ *
+ * RECYCLING: a reference can only be obtained through the published slot, so once a snapshot has been swapped out and
+ * its ref-count drops back to 1 (the pool's own) no reader holds it and none can acquire it again — BeginWrite may hand
+ * its storage to the next generation immediately. Up to MaxPooled free snapshots are kept; 0 disables pooling (each
+ * generation is a fresh allocation and a retired one dies with its last reader).
+ *
+ * The publisher side (BeginWrite / Publish / Reset / GetPublished) is not internally serialized: the owner calls it
+ * from one thread at a time (its own publisher lock, or SimulationLock). Verified by Mythic.LivingWorld.SnapshotPublisher.
+ */
+template <typename SnapshotType, int32 MaxPooled = 0>
+class TMythicSnapshotPublisher {
+public:
+    /** Reader handle: the snapshot stays alive and unchanged until released */
+    using FReadRef = TRefCountPtr<const SnapshotType>;
+
+    /** Current published snapshot, pinned. Null before the first Publish / after Reset. Thread-safe. */
+    FReadRef Acquire() const {
+        FReadScopeLock Lock(PublishLock);
+        return FReadRef(Published.GetReference());
+    }
+
+    /** Storage for the next generation: a retired snapshot no reader holds (previous contents intact — overwrite every
+     *  field), else a new one. Also releases free pool entries beyond MaxPooled. Publisher side. */
+    TRefCountPtr<SnapshotType> BeginWrite() {
+        TRefCountPtr<SnapshotType> Next;
+        int32 FreeCount = 0;
+        for (int32 i = Retired.Num() - 1; i >= 0; --i) {
+            if (Retired[i]->GetRefCount() != 1) {
+                continue; // a reader still holds it; it stays pooled until released
+            }
+            if (!Next.IsValid()) {
+                Next = MoveTemp(Retired[i]);
+                Retired.RemoveAtSwap(i, EAllowShrinking::No);
+            } else if (++FreeCount > MaxPooled) {
+                Retired.RemoveAtSwap(i, EAllowShrinking::No);
+            }
+        }
+        if (!Next.IsValid()) {
+            Next = new SnapshotType();
+        }
+        return Next;
+    }
+
+    /** BeginWrite without the allocation: a retired snapshot no reader holds (previous contents intact), or null while
+     *  every retired one is still pinned. For owners that pre-publish a fixed set of large snapshots and would rather
+     *  publish late than allocate another. Publisher side. */
+    TRefCountPtr<SnapshotType> TryReuse() {
+        for (int32 i = Retired.Num() - 1; i >= 0; --i) {
+            if (Retired[i]->GetRefCount() == 1) {
+                TRefCountPtr<SnapshotType> Next = MoveTemp(Retired[i]);
+                Retired.RemoveAtSwap(i, EAllowShrinking::No);
+                return Next;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Make Next the published snapshot. The write lock orders every field written into Next before readers see it. */
+    void Publish(TRefCountPtr<SnapshotType> Next) {
+        {
+            FWriteScopeLock Lock(PublishLock);
+            Swap(Published, Next);
+        }
+        if constexpr (MaxPooled > 0) {
+            if (Next.IsValid()) {
+                Retired.Add(MoveTemp(Next));
+            }
+        }
+        // Unpooled: our reference to the replaced snapshot drops here; readers still holding it keep it alive.
+    }
+
+    /** Unpublish and drop the pool. Readers holding a snapshot keep it alive on their own reference. Publisher side. */
+    void Reset() {
+        TRefCountPtr<SnapshotType> Old;
+        {
+            FWriteScopeLock Lock(PublishLock);
+            Swap(Published, Old);
+        }
+        Retired.Empty();
+    }
+
+    /** The published snapshot as the publisher sees it (e.g. to derive the next epoch). Publisher side. */
+    const SnapshotType *GetPublished() const { return Published.GetReference(); }
+
+    /** Retired snapshots currently pooled (held by readers or free) (tests/stats) */
+    int32 GetRetiredCount() const { return Retired.Num(); }
+
+private:
+    /** Guards Published for the pointer copy + AddRef (readers) and the swap (publisher) — nothing else */
+    mutable FRWLock PublishLock;
+
+    TRefCountPtr<SnapshotType> Published;
+
+    /** Replaced snapshots kept for reuse (publisher side) */
+    TArray<TRefCountPtr<SnapshotType>> Retired;
+};
@@ -5,6 +5,8 @@
 #include "World/LivingWorld/Factions/FactionDatabase.h"
 #include "World/LivingWorld/CausalFabric/CausalFabric.h"
 #include "World/LivingWorld/MythicTags_LivingWorld.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 
 int32 UMythicSettlementRegistry::RegisterSettlement(AMythicSettlement *Settlement) {
     if (!Settlement) {
@@ -47,6 +49,7 @@ int32 UMythicSettlementRegistry::RegisterSettlement(AMythicSettlement *Settlemen
     }
 
     FactionSettlements.FindOrAdd(StoredData.GoverningFaction).Add(AssignedId);
+    bSnapshotDirty = true;
 
     UE_LOG(LogMythSettlement, Log, TEXT("Registered settlement '%s' (ID=%d, Faction=%d, Cells=%d)"),
            *StoredData.DisplayName.ToString(), AssignedId, StoredData.GoverningFaction.Index, StoredData.RasterizedCells.Num());
@@ -95,6 +98,7 @@ void UMythicSettlementRegistry::UnregisterSettlement(AMythicSettlement *Settleme
 
     Settlements.Remove(FoundId);
     SettlementActors.Remove(FoundId);
+    bSnapshotDirty = true;
 }
 
 const FMythicSettlementData *UMythicSettlementRegistry::GetSettlementData(int32 SettlementId) const {
@@ -102,6 +106,8 @@ const FMythicSettlementData *UMythicSettlementRegistry::GetSettlementData(int32
 }
 
 FMythicSettlementData *UMythicSettlementRegistry::GetMutableSettlementData(int32 SettlementId) {
+    // The caller may edit any published field through this pointer — republish conservatively.
+    bSnapshotDirty = true;
     return Settlements.Find(SettlementId);
 }
 
@@ -135,6 +141,80 @@ void UMythicSettlementRegistry::GetAllSettlementIds(TArray<int32> &OutIds) const
     Settlements.GetKeys(OutIds);
 }
 
+// ─── Published Snapshot ──────────────────────────────
+
+const FMythicSettlementSnapshotEntry *FMythicSettlementSnapshot::FindById(int32 SettlementId) const {
+    const int32 Index = Algo::LowerBoundBy(Settlements, SettlementId, &FMythicSettlementSnapshotEntry::SettlementId);
+    return Settlements.IsValidIndex(Index) && Settlements[Index].SettlementId == SettlementId ? &Settlements[Index] : nullptr;
+}
+
+void UMythicSettlementRegistry::CommitSnapshot() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicSettlementRegistry_CommitSnapshot);
+
+    if (!bSnapshotDirty) {
+        return; // settlements change on registration/conquest only — most sim ticks publish nothing.
+    }
+    bSnapshotDirty = false;
+
+    TRefCountPtr<FMythicSettlementSnapshot> Next = Snapshots.BeginWrite();
+    const FMythicSettlementSnapshot *Previous = Snapshots.GetPublished();
+    Next->Epoch = Previous ? Previous->Epoch + 1 : 1;
+
+    // Ascending id order so FindById can binary-search; this is also registration order.
+    TArray<int32> OrderedIds;
+    Settlements.GetKeys(OrderedIds);
+    OrderedIds.Sort();
+    Next->Settlements.Reserve(OrderedIds.Num());
+    Next->Cells.Reserve(CellToSettlement.Num());
+
+    TArray<FMythicSpawnPoint> CellPoints;
+    for (const int32 SettlementId : OrderedIds) {
+        const FMythicSettlementData &Data = Settlements[SettlementId];
+        const int32 SettlementIndex = Next->Settlements.AddDefaulted();
+        FMythicSettlementSnapshotEntry &Entry = Next->Settlements[SettlementIndex];
+        Entry.SettlementId = SettlementId;
+        Entry.GoverningFaction = Data.GoverningFaction;
+        Entry.MaxPopulationDensity = Data.MaxPopulationDensity;
+        Entry.Economy = Data.Economy;
+        Entry.bIsCapital = Data.bIsCapital;
+        Entry.bIsHostileCamp = Data.bIsHostileCamp;
+        Entry.CenterCell = Data.CenterCell;
+        Entry.SettlementTag = Data.SettlementTag;
+        Entry.DisplayName = Data.DisplayName;
+
+        // Stable sort keeps each cell's points in their original relative order, which the spawner's deterministic
+        // NameHash % count pick depends on.
+        CellPoints = Data.SpawnPoints;
+        Algo::StableSort(CellPoints, [](const FMythicSpawnPoint &A, const FMythicSpawnPoint &B) {
+            return A.Cell.X != B.Cell.X ? A.Cell.X < B.Cell.X : A.Cell.Y < B.Cell.Y;
+        });
+
+        for (const FMythicCellCoord &Cell : Data.RasterizedCells) {
+            const int32 *OwnerId = CellToSettlement.Find(Cell);
+            if (!OwnerId || *OwnerId != SettlementId || Next->Cells.Contains(Cell)) {
+                continue; // another settlement claimed it first (or a duplicate rasterized cell).
+            }
+            FMythicSettlementSnapshot::FCellEntry &CellEntry = Next->Cells.Add(Cell);
+            CellEntry.SettlementIndex = SettlementIndex;
+            CellEntry.FirstSpawnPoint = Next->SpawnPoints.Num();
+            const int32 First = Algo::LowerBound(CellPoints, Cell, [](const FMythicSpawnPoint &P, const FMythicCellCoord &C) {
+                return P.Cell.X != C.X ? P.Cell.X < C.X : P.Cell.Y < C.Y;
+            });
+            for (int32 i = First; i < CellPoints.Num() && CellPoints[i].Cell == Cell; ++i) {
+                Next->SpawnPoints.Add(CellPoints[i]);
+            }
+            CellEntry.NumSpawnPoints = Next->SpawnPoints.Num() - CellEntry.FirstSpawnPoint;
+            ++Entry.CellCount;
+        }
+    }
+
+    Snapshots.Publish(MoveTemp(Next));
+}
+
+FMythicSettlementSnapshotRef UMythicSettlementRegistry::AcquireSnapshot() const {
+    return Snapshots.Acquire();
+}
+
 void UMythicSettlementRegistry::HandleNPCDeath(uint32 DeadEntityId, double DeathTime) {
     if (DeadEntityId == 0) {
         return;
@@ -235,6 +315,7 @@ void UMythicSettlementRegistry::TransferSettlement(
 
     // Update settlement data
     Data->GoverningFaction = NewFaction;
+    bSnapshotDirty = true;
 
     // Re-seed territory cells to new faction
     if (TerritoryGrid) {
@@ -420,6 +501,7 @@ void UMythicSettlementRegistry::Serialize(FArchive &Ar) {
 void UMythicSettlementRegistry::RebuildIndices() {
     CellToSettlement.Reset();
     FactionSettlements.Reset();
+    bSnapshotDirty = true;
 
     // Iterate in SettlementId (registration) order so the CellToSettlement first-claim-wins below resolves a cell
     // contested by two settlements the SAME way RegisterSettlement did at registration (SettlementRegistry.cpp:44).
@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "World/LivingWorld/Settlements/MythicSettlement.h"
+#include "World/LivingWorld/MythicSnapshotPublisher.h"
 #include "SettlementRegistry.generated.h"
 
 class UMythicCausalFabric;
@@ -12,6 +13,77 @@ class UMythicTerritoryGrid;
 class UMythicFactionDatabase;
 
 
+// ─────────────────────────────────────────────────────────────
+// Settlement Snapshot — Immutable published read view
+// ─────────────────────────────────────────────────────────────
+
+/** The per-settlement fields game-thread spawners and the war-map replication read. Everything else (shops, the
+ *  rasterized cell list, the actor link) stays in the live registry behind SimulationLock. */
+struct FMythicSettlementSnapshotEntry {
+    int32 SettlementId = INDEX_NONE;
+    FMythicFactionId GoverningFaction;
+    int32 MaxPopulationDensity = 0;
+    EMythicSettlementEconomy Economy = EMythicSettlementEconomy::Generic;
+    bool bIsCapital = false;
+    bool bIsHostileCamp = false;
+    FMythicCellCoord CenterCell;
+    FGameplayTag SettlementTag;
+    FText DisplayName;
+
+    /** Cells this settlement owns in the cell map (first-claim-wins, so may be fewer than its RasterizedCells) */
+    int32 CellCount = 0;
+};
+
+/**
+ * Read-only cell→settlement view published by UMythicSettlementRegistry::CommitSnapshot at the end of each sim commit
+ * (and after every game-thread registry mutation). Readers pin it via AcquireSnapshot (TMythicSnapshotPublisher) and index it
+ * without SimulationLock — a long sim tick no longer stalls the spawners that used to copy settlements out under it.
+ * Immutable once published; plain C++ (no USTRUCT), never serialized.
+ *
+ * Spawn points are regrouped per owned cell (stable, so per-cell order matches the settlement's SpawnPoints order),
+ * letting the population spawner pick an anchor from a contiguous slice instead of scanning the settlement's full list.
+ */
+class MYTHIC_API FMythicSettlementSnapshot : public FThreadSafeRefCountedObject {
+public:
+    /** Per-cell record: owning settlement + its spawn-point slice */
+    struct FCellEntry {
+        int32 SettlementIndex = INDEX_NONE;
+        int32 FirstSpawnPoint = 0;
+        int32 NumSpawnPoints = 0;
+    };
+
+    /** Monotonic publish generation (1 = first publish) */
+    uint64 Epoch = 0;
+
+    /** One entry per registered settlement, ascending SettlementId */
+    TArray<FMythicSettlementSnapshotEntry> Settlements;
+
+    /** Owned cell → entry */
+    TMap<FMythicCellCoord, FCellEntry> Cells;
+
+    /** Spawn points of every owned cell, contiguous per cell (see FCellEntry) */
+    TArray<FMythicSpawnPoint> SpawnPoints;
+
+    /** Settlement owning Cell, or nullptr for a non-settlement cell */
+    const FMythicSettlementSnapshotEntry *FindAtCell(const FMythicCellCoord &Cell) const {
+        const FCellEntry *Entry = Cells.Find(Cell);
+        return Entry ? &Settlements[Entry->SettlementIndex] : nullptr;
+    }
+
+    /** Settlement by runtime id (binary search), or nullptr */
+    const FMythicSettlementSnapshotEntry *FindById(int32 SettlementId) const;
+
+    /** Generated spawn points inside Cell (empty for a non-settlement cell or one with none) */
+    TConstArrayView<FMythicSpawnPoint> GetSpawnPointsInCell(const FMythicCellCoord &Cell) const {
+        const FCellEntry *Entry = Cells.Find(Cell);
+        return Entry ? TConstArrayView<FMythicSpawnPoint>(SpawnPoints.GetData() + Entry->FirstSpawnPoint, Entry->NumSpawnPoints)
+                     : TConstArrayView<FMythicSpawnPoint>();
+    }
+};
+
+/** Shared read handle to a published settlement snapshot. Null until the first CommitSnapshot. */
+using FMythicSettlementSnapshotRef = TRefCountPtr<const FMythicSettlementSnapshot>;
+
 /**
  * Central registry for all active settlements in the world.
  *
@@ -57,6 +129,19 @@ public:
     /** Get all registered settlement IDs */
     void GetAllSettlementIds(TArray<int32> &OutIds) const;
 
+    // ─── Published Snapshot (game-thread reads without SimulationLock) ──
+
+    /**
+     * Publish a fresh FMythicSettlementSnapshot if anything a snapshot carries changed since the last publish (register,
+     * unregister, transfer, mutable access, load patch); otherwise a no-op. CALLER HOLDS
+     * SimulationLock — the sim thread from CommitAllSnapshots, the game thread from the subsystem's locked mutators.
+     */
+    void CommitSnapshot();
+
+    /** Pointer copy + AddRef under the publisher's read lock (never SimulationLock). Hold for one Execute/tick, not
+     *  across frames. Null before the first publish. Thread-safe. */
+    FMythicSettlementSnapshotRef AcquireSnapshot() const;
+
     // ─── Shop Succession (Phase 7) ───────────────────────
 
     /**
@@ -172,4 +257,11 @@ private:
 
     /** Rebuild the cell→settlement and faction→settlements indices from scratch */
     void RebuildIndices();
+
+    /** Set by every mutation a published snapshot would reflect; cleared by CommitSnapshot */
+    bool bSnapshotDirty = true;
+
+    /** Published snapshot (publisher side under SimulationLock). Unpooled: settlements change rarely, so each publish
+     *  builds fresh storage and a replaced generation dies with its last reader. */
+    TMythicSnapshotPublisher<FMythicSettlementSnapshot> Snapshots;
 };
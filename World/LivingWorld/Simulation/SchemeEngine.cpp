@@ -42,7 +42,7 @@ void UMythicSchemeEngine::Initialize(
 // Background Thread Tick
 // ─────────────────────────────────────────────────────────────
 
-void UMythicSchemeEngine::TickSchemes(float SimDeltaTime, uint32 SimTickIndex) {
+void UMythicSchemeEngine::TickSchemes(float SimDeltaTime, uint32 SimTickIndex, FRandomStream &Random) {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicSchemeEngine_Tick);
 
     if (!FactionDB || !Fabric) {
@@ -51,7 +51,7 @@ void UMythicSchemeEngine::TickSchemes(float SimDeltaTime, uint32 SimTickIndex) {
 
     // Generate new schemes periodically (not every tick)
     if (SimTickIndex % GenerationTickInterval == 0) {
-        GenerateSchemes(SimDeltaTime, SimTickIndex);
+        GenerateSchemes(SimDeltaTime, SimTickIndex, Random);
     }
 
     // Progress all active schemes
@@ -67,7 +67,7 @@ void UMythicSchemeEngine::TickSchemes(float SimDeltaTime, uint32 SimTickIndex) {
                 continue;
             }
 
-            ProgressScheme(Scheme, SimDeltaTime);
+            ProgressScheme(Scheme, SimDeltaTime, Random);
         }
     }
 }
@@ -76,7 +76,7 @@ void UMythicSchemeEngine::TickSchemes(float SimDeltaTime, uint32 SimTickIndex) {
 // Scheme Generation
 // ─────────────────────────────────────────────────────────────
 
-void UMythicSchemeEngine::GenerateSchemes(float SimDeltaTime, uint32 SimTickIndex) {
+void UMythicSchemeEngine::GenerateSchemes(float SimDeltaTime, uint32 SimTickIndex, FRandomStream &Random) {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicSchemeEngine_Generate);
 
     FScopeLock Lock(&SchemeLock);
@@ -127,12 +127,12 @@ void UMythicSchemeEngine::GenerateSchemes(float SimDeltaTime, uint32 SimTickInde
         // Base probability scales with faction population and military strength
         const float MilitaryBoost = FactionData.MilitaryStrength * SchemeBaseProbability;
 
-        if (FMath::FRand() > SchemeBaseProbability + MilitaryBoost) {
+        if (Random.FRand() > SchemeBaseProbability + MilitaryBoost) {
             continue;
         }
 
         // Pick a random eligible scheme type
-        const int32 TypeIndex = FMath::RandRange(0, EligibleTypes.Num() - 1);
+        const int32 TypeIndex = Random.RandRange(0, EligibleTypes.Num() - 1);
         const EMythicSchemeType SchemeType = EligibleTypes[TypeIndex];
 
         // Find a valid target faction (hostile or unfriendly)
@@ -336,12 +336,12 @@ float UMythicSchemeEngine::CalculateDetectionRisk(const FMythicScheme &Scheme, i
 // Scheme Progression
 // ─────────────────────────────────────────────────────────────
 
-void UMythicSchemeEngine::ProgressScheme(FMythicScheme &Scheme, float SimDeltaTime) {
+void UMythicSchemeEngine::ProgressScheme(FMythicScheme &Scheme, float SimDeltaTime, FRandomStream &Random) {
     // Progress toward completion
     Scheme.Progress += Scheme.ProgressRate * SimDeltaTime;
 
     // Detection roll
-    if (FMath::FRand() < Scheme.DetectionRisk * SimDeltaTime) {
+    if (Random.FRand() < Scheme.DetectionRisk * SimDeltaTime) {
         OnSchemeDiscovered(Scheme);
         return;
     }
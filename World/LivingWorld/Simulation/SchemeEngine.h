@@ -20,6 +20,7 @@ class UMythicLivingWorldSettings;
  * - TickSchemes() called from WorldSimThread::SimTick() — background thread only
  * - Reads from FactionDB, TerritoryGrid (lock-free snapshots from game thread)
  * - Writes completed scheme events to CausalFabric (single writer, safe)
+ * - Rolls dice only from the FRandomStream the caller passes in (the sim's per-tick Schemes stream) — never FMath::FRand
  * - Exposes read-only game thread query via GetActiveSchemes() + GetSchemesFence()
  *
  * Performance:
@@ -49,8 +50,9 @@ public:
      * Progress all active schemes. Called from WorldSimThread.
      * @param SimDeltaTime   Simulation delta time (seconds in game time)
      * @param SimTickIndex   Monotonic tick counter (for generation throttle)
+     * @param Random         This tick's scheme stream (generation and detection rolls); seeded by the caller
      */
-    void TickSchemes(float SimDeltaTime, uint32 SimTickIndex);
+    void TickSchemes(float SimDeltaTime, uint32 SimTickIndex, FRandomStream &Random);
 
     // ─── Game Thread Queries ──────────────────────────────
 
@@ -82,7 +84,7 @@ private:
      * Evaluate each faction and potentially generate new schemes.
      * Budget-capped: max 1 new scheme per N sim ticks.
      */
-    void GenerateSchemes(float SimDeltaTime, uint32 SimTickIndex);
+    void GenerateSchemes(float SimDeltaTime, uint32 SimTickIndex, FRandomStream &Random);
 
     /**
      * Determine which scheme types are available for a faction based on its state.
@@ -106,7 +108,7 @@ private:
     /**
      * Progress a single scheme and handle state transitions.
      */
-    void ProgressScheme(FMythicScheme &Scheme, float SimDeltaTime);
+    void ProgressScheme(FMythicScheme &Scheme, float SimDeltaTime, FRandomStream &Random);
 
     /**
      * Execute a completed scheme — write event to causal fabric and apply effects.
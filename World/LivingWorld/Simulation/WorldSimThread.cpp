@@ -10,7 +10,30 @@
 #include "World/LivingWorld/Morality/MoralSignature.h"
 #include "World/LivingWorld/MythicTags_LivingWorld.h"
 #include "World/LivingWorld/Simulation/SchemeEngine.h"
+#include "World/LivingWorld/MythicLivingWorldStats.h"
 #include "HAL/PlatformProcess.h"
+#include "Tasks/Task.h"
+
+// Sim-thread cycle stats (stat MythicLivingWorld). The game-thread sampler publishes the last tick's totals alongside.
+DECLARE_CYCLE_STAT(TEXT("Sim Tick"), STAT_MythicSim_Tick, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim EventDigest"), STAT_MythicSim_EventDigest, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim Economy"), STAT_MythicSim_Economy, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim Population"), STAT_MythicSim_Population, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim Diplomacy"), STAT_MythicSim_Diplomacy, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim TerritoryPropagation"), STAT_MythicSim_Territory, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim TerritoryCensus"), STAT_MythicSim_TerritoryCensus, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim IdeologyMetabolism"), STAT_MythicSim_Ideology, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim FactionEvolution"), STAT_MythicSim_FactionEvolution, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim Schemes"), STAT_MythicSim_Schemes, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim Crystallization"), STAT_MythicSim_Crystallization, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim HistoryAppend"), STAT_MythicSim_HistoryAppend, STATGROUP_MythicLivingWorld);
+DECLARE_CYCLE_STAT(TEXT("Sim CommitSnapshots"), STAT_MythicSim_Commit, STATGROUP_MythicLivingWorld);
+
+/** Per-phase salts for MakeSimPhaseRandom — one per phase that rolls, so no two phases draw the same sequence. */
+namespace MythicSimRandomSalt {
+    constexpr uint32 FactionEvolution = 0x46457630; // 'FEv0'
+    constexpr uint32 Schemes = 0x53636830;          // 'Sch0'
+}
 
 FMythicWorldSimThread::FMythicWorldSimThread() {}
 
@@ -40,11 +63,96 @@ void FMythicWorldSimThread::Setup(
     SchemeEngine = InSchemeEngine;
     PendingEvents = InPendingEvents;
     PendingEventsMutex = InPendingEventsMutex;
+    SimSeed = Settings ? Settings->SimRandomSeed : 0;
 
     // Init trade volume matrix
     MaxFactions = FactionDB ? FactionDB->GetMaxFactions() : 0;
     if (MaxFactions > 0) {
         TradeVolume.SetNumZeroed(MaxFactions * MaxFactions);
+
+        EventDigest.PairScore.SetNumZeroed(MaxFactions * MaxFactions);
+        EventDigest.PairCount.SetNumZeroed(MaxFactions * MaxFactions);
+        EventDigest.IdeologyVectorSum.SetNumZeroed(MaxFactions * MoralAxisCount);
+        EventDigest.IdeologyCount.SetNumZeroed(MaxFactions);
+        EventDigest.DivergenceVectorSum.SetNumZeroed(MaxFactions * MoralAxisCount);
+        EventDigest.DivergenceCount.SetNumZeroed(MaxFactions);
+        EventDigest.CultureTotal.SetNumZeroed(MaxFactions);
+        EventDigest.CultureCombat.SetNumZeroed(MaxFactions);
+        EventDigest.CultureTrade.SetNumZeroed(MaxFactions);
+        EventDigest.CultureDiplomacy.SetNumZeroed(MaxFactions);
+    }
+
+    // ── Phase table (canonical serial order) ──
+    // Footprints are deliberately conservative: a missing bit here is a data race, an extra one only costs overlap.
+    // Anything that can register a faction writes FactionLifecycle, which every phase reads — so registration is
+    // always a full barrier. Every AppendEvent caller writes FabricAppend, which keeps EventIds in serial order.
+    using namespace EMythicSimResource;
+    SimPhases = {
+        {TEXT("EventDigest"), &FMythicWorldSimThread::TickEventDigest,
+         FabricSnapshot,
+         EventDigest},
+        {TEXT("Economy"), &FMythicWorldSimThread::TickEconomy,
+         FactionLifecycle | FactionBehavior | FactionPopulation | FactionCellCount | FactionIdeology | Relationships,
+         FactionEconomy | TradeVolume},
+        {TEXT("Population"), &FMythicWorldSimThread::TickPopulation,
+         FactionBehavior | FactionEconomy | FactionCellCount | FactionIdeology,
+         FactionPopulation | FactionLifecycle | FactionEconomy | FactionCellCount | FactionLeadership | Relationships |
+         FabricAppend},
+        {TEXT("Diplomacy"), &FMythicWorldSimThread::TickDiplomacy,
+         FactionLifecycle | FactionBehavior | FactionIdeology | TradeVolume | EventDigest,
+         Relationships | FabricAppend},
+        {TEXT("TerritoryPropagation"), &FMythicWorldSimThread::TickTerritoryPropagation,
+         0,
+         TerritoryWrite},
+        {TEXT("TerritoryCensus"), &FMythicWorldSimThread::TickTerritoryCensus,
+         FactionLifecycle | TerritoryWrite,
+         FactionCellCount},
+        {TEXT("IdeologyMetabolism"), &FMythicWorldSimThread::TickIdeologyMetabolism,
+         FactionLifecycle | FactionBehavior | FactionCellCount | TradeVolume | EventDigest,
+         FactionIdeology},
+        {TEXT("FactionEvolution"), &FMythicWorldSimThread::TickFactionEvolution,
+         FactionEconomy | FactionPopulation | FactionBehavior | FactionIdeology | FactionCellCount | Relationships |
+         TerritorySnapshot | EventDigest,
+         FactionLifecycle | FactionBehavior | FactionPopulation | FactionEconomy | FactionIdeology | FactionCellCount |
+         Relationships | FabricAppend},
+        {TEXT("Schemes"), &FMythicWorldSimThread::TickSchemeEngine,
+         FactionLifecycle | FactionBehavior | FactionEconomy | FactionPopulation | FactionCellCount | Relationships |
+         TerritorySnapshot,
+         FactionEconomy | FactionPopulation | FactionCellCount | FactionLeadership | Relationships | TerritoryWrite |
+         FabricAppend},
+        {TEXT("Crystallization"), &FMythicWorldSimThread::TickCrystallization,
+         FactionLifecycle | EventDigest,
+         FactionIdeology | FactionLeadership},
+        {TEXT("HistoryAppend"), &FMythicWorldSimThread::TickHistoryAppend,
+         FactionLifecycle | FactionEconomy | FactionPopulation,
+         FactionDistress | FabricAppend},
+    };
+    BuildSimPhasePrerequisites(SimPhases, SimPhasePrerequisites);
+
+    LastTickTimings = FMythicSimTickTimings();
+    LastTickTimings.PhaseMs.SetNumZeroed(SimPhases.Num());
+    for (const FSimPhase &Phase : SimPhases) {
+        LastTickTimings.PhaseNames.Add(Phase.Name);
+    }
+}
+
+bool FMythicWorldSimThread::DoSimPhasesConflict(uint32 ReadsA, uint32 WritesA, uint32 ReadsB, uint32 WritesB) {
+    // Write/write, write/read and read/write all order the pair; read/read commutes.
+    return (WritesA & (ReadsB | WritesB)) != 0 || (ReadsA & WritesB) != 0;
+}
+
+void FMythicWorldSimThread::BuildSimPhasePrerequisites(TConstArrayView<FSimPhase> Phases, TArray<TArray<int32>> &OutPrerequisites) {
+    OutPrerequisites.Reset();
+    OutPrerequisites.SetNum(Phases.Num());
+
+    // Only EARLIER phases can be prerequisites, so the graph is acyclic by construction and every conflicting pair
+    // resolves in canonical order. Transitive edges are kept — they are free to wait on and the table is tiny.
+    for (int32 j = 0; j < Phases.Num(); ++j) {
+        for (int32 i = 0; i < j; ++i) {
+            if (DoSimPhasesConflict(Phases[i].Reads, Phases[i].Writes, Phases[j].Reads, Phases[j].Writes)) {
+                OutPrerequisites[j].Add(i);
+            }
+        }
     }
 }
 
@@ -118,22 +226,16 @@ void FMythicWorldSimThread::Exit() {
 
 void FMythicWorldSimThread::SimTick() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_SimTick);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Tick);
 
     FScopeLock Lock(SimulationLock);
 
     if (!Settings || !FactionDB) {
         return;
     }
+    const double TickStartSeconds = FPlatformTime::Seconds();
 
-    TickEconomy();
-    TickPopulation();
-    TickDiplomacy();
-    TickTerritoryPropagation();
-    TickIdeologyMetabolism();
-    TickFactionEvolution();
-    TickSchemeEngine();
-    TickCrystallization();
-    TickHistoryAppend();
+    RunSimPhases();
 
     if (SettlementRegistry) {
         // Use true platform time for accurate shop succession
@@ -160,14 +262,61 @@ void FMythicWorldSimThread::SimTick() {
     }
 
     // Commit all write buffers to game-thread-readable snapshots
+    const double CommitStartSeconds = FPlatformTime::Seconds();
     CommitAllSnapshots();
 
+    const double TickEndSeconds = FPlatformTime::Seconds();
+    LastTickTimings.CommitMs = static_cast<float>((TickEndSeconds - CommitStartSeconds) * 1000.0);
+    LastTickTimings.TotalMs = static_cast<float>((TickEndSeconds - TickStartSeconds) * 1000.0);
+    ++LastTickTimings.Serial;
+
     // Broadcast commit event (runs on background thread, listeners must dispatch if they need GameThread)
     OnWorldSimCommitted.Broadcast();
 }
 
+void FMythicWorldSimThread::RunSimPhases() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Phases);
+
+    if (!Settings->bParallelSimPhases || SimPhases.Num() != SimPhasePrerequisites.Num()) {
+        for (int32 i = 0; i < SimPhases.Num(); ++i) {
+            RunTimedPhase(i);
+        }
+        return;
+    }
+
+    // Launch every phase up front with its conflicting predecessors as prerequisites, then join. The sim thread keeps
+    // holding SimulationLock for the whole graph, so the workers inherit its exclusive access to the write buffers;
+    // the declared footprints guarantee no two concurrent phases touch the same state.
+    TArray<UE::Tasks::FTask, TInlineAllocator<16>> PhaseTasks;
+    PhaseTasks.Reserve(SimPhases.Num());
+    for (int32 i = 0; i < SimPhases.Num(); ++i) {
+        TArray<UE::Tasks::FTask, TInlineAllocator<16>> Prerequisites;
+        for (const int32 PrereqIndex : SimPhasePrerequisites[i]) {
+            Prerequisites.Add(PhaseTasks[PrereqIndex]);
+        }
+
+        PhaseTasks.Add(UE::Tasks::Launch(
+            SimPhases[i].Name,
+            [this, i]() { RunTimedPhase(i); },
+            UE::Tasks::Prerequisites(Prerequisites),
+            UE::Tasks::ETaskPriority::BackgroundHigh
+            ));
+    }
+
+    UE::Tasks::Wait(PhaseTasks);
+}
+
+void FMythicWorldSimThread::RunTimedPhase(int32 Index) {
+    const double StartSeconds = FPlatformTime::Seconds();
+    (this->*SimPhases[Index].Tick)();
+    if (LastTickTimings.PhaseMs.IsValidIndex(Index)) {
+        LastTickTimings.PhaseMs[Index] = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    }
+}
+
 void FMythicWorldSimThread::CommitAllSnapshots() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_CommitSnapshots);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Commit);
 
     if (Fabric) {
         Fabric->CommitWrites();
@@ -178,6 +327,134 @@ void FMythicWorldSimThread::CommitAllSnapshots() {
     if (TerritoryGrid) {
         TerritoryGrid->CommitWrites();
     }
+    if (SettlementRegistry) {
+        SettlementRegistry->CommitSnapshot();
+    }
+}
+
+// ─────────────────────────────────────────────────────────────
+// TickEventDigest — One pass over recent fabric events for the whole tick
+// ─────────────────────────────────────────────────────────────
+
+namespace MythicSimEventWindows {
+    /** Look-back windows (seconds, FPlatformTime clock — the one AppendEvent stamps sim events with). */
+    constexpr double Diplomacy = 60.0;
+    constexpr double Ideology = 30.0;
+    constexpr double Divergence = 60.0;
+
+    /** Newest PrimaryFaction events per faction that crystallization judges culture from. */
+    constexpr int32 CultureEvents = 64;
+}
+
+float FMythicWorldSimThread::DiplomacyEventContribution(uint16 CategoryFlags, float Significance) {
+    // Combat events hurt the relationship, trade/diplomacy help (at half weight).
+    return (CategoryFlags & EMythicEventCategory::Combat) ? -Significance : Significance * 0.5f;
+}
+
+FRandomStream FMythicWorldSimThread::MakeSimPhaseRandom(int32 Seed, uint64 SimTickIndex, uint32 PhaseSalt) {
+    const uint32 TickSeed = HashCombine(GetTypeHash(Seed), GetTypeHash(SimTickIndex));
+    return FRandomStream(static_cast<int32>(HashCombine(TickSeed, PhaseSalt)));
+}
+
+void FMythicWorldSimThread::TickEventDigest() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_EventDigest);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_EventDigest);
+
+    FSimEventDigest &D = EventDigest;
+    FMemory::Memzero(D.PairScore.GetData(), D.PairScore.Num() * sizeof(float));
+    FMemory::Memzero(D.PairCount.GetData(), D.PairCount.Num() * sizeof(int32));
+    FMemory::Memzero(D.IdeologyVectorSum.GetData(), D.IdeologyVectorSum.Num() * sizeof(float));
+    FMemory::Memzero(D.IdeologyCount.GetData(), D.IdeologyCount.Num() * sizeof(int32));
+    FMemory::Memzero(D.DivergenceVectorSum.GetData(), D.DivergenceVectorSum.Num() * sizeof(float));
+    FMemory::Memzero(D.DivergenceCount.GetData(), D.DivergenceCount.Num() * sizeof(int32));
+    FMemory::Memzero(D.CultureTotal.GetData(), D.CultureTotal.Num() * sizeof(int32));
+    FMemory::Memzero(D.CultureCombat.GetData(), D.CultureCombat.Num() * sizeof(int32));
+    FMemory::Memzero(D.CultureTrade.GetData(), D.CultureTrade.Num() * sizeof(int32));
+    FMemory::Memzero(D.CultureDiplomacy.GetData(), D.CultureDiplomacy.Num() * sizeof(int32));
+
+    if (!Fabric || MaxFactions <= 0) {
+        return;
+    }
+
+    // One zero-copy pass over the newest window, newest-first, so every per-pair / per-faction cap keeps the MOST
+    // RECENT events — the same preference the old per-consumer queries had. No early-break on WorldTime: the ring is
+    // not globally time-monotonic (see QueryEventsByCategory), so each consumer filters its own window per event.
+    // The visitor walks the fabric's pinned view; it is released before this thread's own CommitWrites, after the
+    // phase graph, so the digest can never defer a commit.
+
+    const double Now = FPlatformTime::Seconds();
+    const double DiplomacyMin = Now - MythicSimEventWindows::Diplomacy;
+    const double IdeologyMin = Now - MythicSimEventWindows::Ideology;
+    const double DivergenceMin = Now - MythicSimEventWindows::Divergence;
+    constexpr uint16 DiplomacyMask = EMythicEventCategory::Combat | EMythicEventCategory::Trade | EMythicEventCategory::Diplomacy;
+
+    const int32 PairCap = Settings->DiplomacyEventScanCap;
+    const int32 FactionCap = Settings->IdeologyEventScanCap;
+
+    Fabric->VisitRecentEvents(Settings->SimEventDigestScanCap, [&](const FMythicWorldEvent &Event) {
+        const int32 P = Event.PrimaryFaction.IsValid() ? Event.PrimaryFaction.Index : INDEX_NONE;
+        const int32 S = Event.SecondaryFaction.IsValid() ? Event.SecondaryFaction.Index : INDEX_NONE;
+        const bool bPrimaryOk = P != INDEX_NONE && P < MaxFactions;
+        const bool bSecondaryOk = S != INDEX_NONE && S < MaxFactions;
+        const bool bInFuture = Event.WorldTime > Now;
+
+        // ── Diplomacy: pair matrix (symmetric, upper-triangle index like the relationship matrix) ──
+        if (bPrimaryOk && bSecondaryOk && P != S && !bInFuture && Event.WorldTime >= DiplomacyMin &&
+            (Event.CategoryFlags & DiplomacyMask) != 0) {
+            const int32 PairIdx = FMath::Min(P, S) * MaxFactions + FMath::Max(P, S);
+            if (D.PairCount[PairIdx] < PairCap) {
+                D.PairScore[PairIdx] += DiplomacyEventContribution(Event.CategoryFlags, Event.Significance);
+                ++D.PairCount[PairIdx];
+            }
+        }
+
+        // ── Ideology metabolism: significant events involving the faction on either side ──
+        if (!bInFuture && Event.WorldTime >= IdeologyMin && Event.Significance >= Settings->DriftMinSignificance) {
+            const int32 Involved[2] = {bPrimaryOk ? P : INDEX_NONE, (bSecondaryOk && S != P) ? S : INDEX_NONE};
+            for (const int32 F : Involved) {
+                if (F == INDEX_NONE || D.IdeologyCount[F] >= FactionCap) {
+                    continue;
+                }
+                float *Sum = &D.IdeologyVectorSum[F * MoralAxisCount];
+                for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
+                    Sum[Axis] += Event.MoralVector.AxisValues[Axis] * Event.Significance;
+                }
+                ++D.IdeologyCount[F];
+            }
+        }
+
+        if (!bPrimaryOk) {
+            return true;
+        }
+
+        // ── Faction evolution: internal divergence from the faction's own (primary) recent events ──
+        if (!bInFuture && Event.WorldTime >= DivergenceMin && D.DivergenceCount[P] < FactionCap) {
+            float *Sum = &D.DivergenceVectorSum[P * MoralAxisCount];
+            for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
+                Sum[Axis] += Event.MoralVector.AxisValues[Axis];
+            }
+            ++D.DivergenceCount[P];
+        }
+
+        return true;
+    });
+
+    // ── Crystallization: category mix of each faction's newest primary events (no time window) ──
+    // Walked from the faction's own posting list, not the capped scan above: the culture window is the faction's newest
+    // CultureEvents events anywhere in the ring, as the per-faction query it replaces had it, so a quiet faction's
+    // history is not cut off by SimEventDigestScanCap newer events from busier ones. At most CultureEvents per faction.
+    const double Unbounded = TNumericLimits<double>::Max();
+    for (int32 P = 0; P < MaxFactions; ++P) {
+        FMythicFactionId FId;
+        FId.Index = static_cast<uint8>(P);
+        Fabric->VisitEventsByFaction(FId, -Unbounded, Unbounded, [&D, P](const FMythicWorldEvent &Event) {
+            ++D.CultureTotal[P];
+            D.CultureCombat[P] += (Event.CategoryFlags & EMythicEventCategory::Combat) != 0 ? 1 : 0;
+            D.CultureTrade[P] += (Event.CategoryFlags & EMythicEventCategory::Trade) != 0 ? 1 : 0;
+            D.CultureDiplomacy[P] += (Event.CategoryFlags & EMythicEventCategory::Diplomacy) != 0 ? 1 : 0;
+            return D.CultureTotal[P] < MythicSimEventWindows::CultureEvents;
+        });
+    }
 }
 
 // ─────────────────────────────────────────────────────────────
@@ -186,6 +463,7 @@ void FMythicWorldSimThread::CommitAllSnapshots() {
 
 void FMythicWorldSimThread::TickEconomy() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Economy);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Economy);
 
     const int32 FactionCount = FactionDB->GetRegisteredCount();
     const float RefCells = static_cast<float>(Settings->ReferenceCellCount);
@@ -358,6 +636,7 @@ void FMythicWorldSimThread::TickEconomy() {
 
 void FMythicWorldSimThread::TickPopulation() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Population);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Population);
 
     const int32 FactionCount = FactionDB->GetRegisteredCount();
 
@@ -559,6 +838,7 @@ int32 FMythicWorldSimThread::ComputeCappedSpawnPopulation(int32 CurrentPop, int3
 
 void FMythicWorldSimThread::TickDiplomacy() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Diplomacy);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Diplomacy);
 
     const int32 FactionCount = FactionDB->GetRegisteredCount();
 
@@ -594,36 +874,10 @@ void FMythicWorldSimThread::TickDiplomacy() {
             const float TradeBA = TradeVolume[j * MaxFactions + i];
             const float EconDep = (TradeAB + TradeBA) * 0.5f;
 
-            // ── Recent event score ──
-            float EventScore = 0.0f;
-            if (Fabric) {
-                TArray<FMythicWorldEvent> RecentEvents;
-                const double CurrentTime = FPlatformTime::Seconds();
-                Fabric->QueryEventsByCategory(
-                    EMythicEventCategory::Combat | EMythicEventCategory::Trade | EMythicEventCategory::Diplomacy,
-                    CurrentTime - 60.0, CurrentTime,
-                    Settings->DiplomacyEventScanCap,
-                    RecentEvents
-                    );
-
-                for (const FMythicWorldEvent &EventRef : RecentEvents) {
-                    const FMythicWorldEvent *Event = &EventRef;
-                    const bool bInvolvesBoth =
-                        (Event->PrimaryFaction == IdA && Event->SecondaryFaction == IdB) ||
-                        (Event->PrimaryFaction == IdB && Event->SecondaryFaction == IdA);
-                    if (!bInvolvesBoth) {
-                        continue;
-                    }
-
-                    // Combat events hurt relationship, trade/diplomacy help
-                    if (Event->CategoryFlags & EMythicEventCategory::Combat) {
-                        EventScore -= Event->Significance;
-                    }
-                    else {
-                        EventScore += Event->Significance * 0.5f;
-                    }
-                }
-            }
+            // ── Recent event score (pre-aggregated once per tick by TickEventDigest) ──
+            const float EventScore = EventDigest.PairScore.IsValidIndex(i * MaxFactions + j)
+                ? EventDigest.PairScore[i * MaxFactions + j]
+                : 0.0f;
 
             // ── Composite score ──
             const float Score = -(IdeologyDist * Settings->IdeologyWeight)
@@ -658,10 +912,20 @@ void FMythicWorldSimThread::TickDiplomacy() {
 
 void FMythicWorldSimThread::TickTerritoryPropagation() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Territory);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Territory);
 
     if (TerritoryGrid) {
         TerritoryGrid->PropagateInfluence();
+    }
+}
+
+void FMythicWorldSimThread::TickTerritoryCensus() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_TerritoryCensus);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_TerritoryCensus);
 
+    // Split from TickTerritoryPropagation so the (grid-only) propagation can overlap the faction-economy chain; only
+    // this reconciliation touches faction data.
+    if (TerritoryGrid) {
         // Reconcile each faction's ControlledCellCount with the emergent grid ownership — the grid is the single source
         // of truth for territory. ControlledCellCount drives economy supply, population capacity, spawn rates, and the
         // annihilation gate (ControlledCellCount<=0), but is otherwise only mutated by discrete settlement/scheme events;
@@ -687,13 +951,13 @@ void FMythicWorldSimThread::TickTerritoryPropagation() {
 
 void FMythicWorldSimThread::TickIdeologyMetabolism() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Ideology);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Ideology);
 
     if (!Fabric) {
         return;
     }
 
     const int32 FactionCount = FactionDB->GetRegisteredCount();
-    const double CurrentTime = FPlatformTime::Seconds();
 
     for (int32 i = 0; i < FactionCount; ++i) {
         FMythicFactionData *F = FactionDB->GetFactionMutableByIndex(i);
@@ -701,36 +965,10 @@ void FMythicWorldSimThread::TickIdeologyMetabolism() {
             continue;
         }
 
-        FMythicFactionId FId;
-        FId.Index = static_cast<uint8>(i);
-
-        // Query recent significant events involving this faction
-        TArray<FMythicWorldEvent> RecentEvents;
-        Fabric->QueryEventsByCategory(
-            0xFFFF, // All categories
-            CurrentTime - 30.0, CurrentTime,
-            Settings->IdeologyEventScanCap,
-            RecentEvents
-            );
-
-        // Accumulate the moral vector of events involving this faction
-        float AccumulatedVector[MoralAxisCount] = {};
-        int32 RelevantEventCount = 0;
-
-        for (const FMythicWorldEvent &EventRef : RecentEvents) {
-            const FMythicWorldEvent *Event = &EventRef;
-            if (Event->Significance < Settings->DriftMinSignificance) {
-                continue;
-            }
-            if (Event->PrimaryFaction != FId && Event->SecondaryFaction != FId) {
-                continue;
-            }
-
-            for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
-                AccumulatedVector[Axis] += Event->MoralVector.AxisValues[Axis] * Event->Significance;
-            }
-            ++RelevantEventCount;
-        }
+        // Significance-weighted moral vector of recent events involving this faction (TickEventDigest)
+        const bool bInDigest = i < MaxFactions;
+        const int32 RelevantEventCount = bInDigest ? EventDigest.IdeologyCount[i] : 0;
+        const float *AccumulatedVector = bInDigest ? &EventDigest.IdeologyVectorSum[i * MoralAxisCount] : nullptr;
 
         // Drift ideology toward the accumulated event vector
         if (RelevantEventCount > 0) {
@@ -783,8 +1021,10 @@ void FMythicWorldSimThread::TickIdeologyMetabolism() {
 
 void FMythicWorldSimThread::TickFactionEvolution() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_FactionEvolution);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_FactionEvolution);
 
     const int32 FactionCount = FactionDB->GetRegisteredCount();
+    FRandomStream Random = MakeSimPhaseRandom(SimSeed, TickCount, MythicSimRandomSalt::FactionEvolution);
 
     // Track recently annihilated factions for absorption
     TArray<int32> AnnihilatedIndices;
@@ -908,39 +1148,17 @@ void FMythicWorldSimThread::TickFactionEvolution() {
         // 2. Internal tension check (variance in recent fabric events)
 
         float InternalDivergence = 0.0f;
-        if (Fabric) {
-            TArray<FMythicWorldEvent> FactionEvents;
-            const double CurrentTime = FPlatformTime::Seconds();
-            Fabric->QueryEventsByCategory(
-                0xFFFF, CurrentTime - 60.0, CurrentTime,
-                Settings->IdeologyEventScanCap,
-                FactionEvents
-                );
-
-            // Measure variance of moral vectors in events involving this faction
-            float MeanVector[MoralAxisCount] = {};
-            int32 EventCount = 0;
-            for (const FMythicWorldEvent &EventRef : FactionEvents) {
-                const FMythicWorldEvent *Event = &EventRef;
-                if (Event->PrimaryFaction != FId) {
-                    continue;
-                }
-                for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
-                    MeanVector[Axis] += Event->MoralVector.AxisValues[Axis];
-                }
-                ++EventCount;
-            }
-
+        if (Fabric && i < MaxFactions) {
+            // Mean moral vector of recent events this faction perpetrated (TickEventDigest) vs. its stated ideology
+            const int32 EventCount = EventDigest.DivergenceCount[i];
             if (EventCount > 1) {
                 const float InvCount = 1.0f / static_cast<float>(EventCount);
-                for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
-                    MeanVector[Axis] *= InvCount;
-                }
+                const float *VectorSum = &EventDigest.DivergenceVectorSum[i * MoralAxisCount];
 
                 // Compute distance between event mean and faction ideology
                 for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
                     const EMythicMoralAxis AxisEnum = static_cast<EMythicMoralAxis>(Axis);
-                    const float Delta = MeanVector[Axis] - F->Ideology.GetAxis(AxisEnum);
+                    const float Delta = VectorSum[Axis] * InvCount - F->Ideology.GetAxis(AxisEnum);
                     InternalDivergence += Delta * Delta;
                 }
                 InternalDivergence = FMath::Sqrt(InternalDivergence);
@@ -969,7 +1187,7 @@ void FMythicWorldSimThread::TickFactionEvolution() {
             NewFaction.Ideology = F->Ideology;
             for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
                 const EMythicMoralAxis AxisEnum = static_cast<EMythicMoralAxis>(Axis);
-                const float Mutation = FMath::FRandRange(
+                const float Mutation = Random.FRandRange(
                     -Settings->SchismIdeologyMutation,
                     Settings->SchismIdeologyMutation
                     );
@@ -1140,14 +1358,17 @@ void FMythicWorldSimThread::TickFactionEvolution() {
 
 void FMythicWorldSimThread::TickSchemeEngine() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Schemes);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Schemes);
 
     if (SchemeEngine) {
-        SchemeEngine->TickSchemes(1.0f, static_cast<uint32>(TickCount));
+        FRandomStream Random = MakeSimPhaseRandom(SimSeed, TickCount, MythicSimRandomSalt::Schemes);
+        SchemeEngine->TickSchemes(1.0f, static_cast<uint32>(TickCount), Random);
     }
 }
 
 void FMythicWorldSimThread::TickCrystallization() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_Crystallization);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_Crystallization);
 
     // Phase 6: Full Crystallization Pipeline
     // Runs every sim tick on the background thread. Three passes:
@@ -1179,47 +1400,23 @@ void FMythicWorldSimThread::TickCrystallization() {
             continue;
         }
 
-        FMythicFactionId FId;
-        FId.Index = static_cast<uint8>(i);
-
         // ─── Pass 1: Cultural Memory Promotion ───────────────
         // Scan recent CausalFabric events for this faction.
         // Count event categories and accumulate moral vectors.
         // When a category appears frequently enough, it represents a culturally
         // significant pattern. Drift the faction's ideology toward that pattern.
 
-        TArray<FMythicWorldEvent> RecentEvents;
-        Fabric->QueryEventsByFaction(FId, RecentEvents, 64); // Last 64 events
-
-        if (RecentEvents.Num() >= 8) {
-            // Count events by category
-            int32 CombatCount = 0;
-            int32 EconomyCount = 0;
-            int32 DiplomacyCount = 0;
-            float CombatMoralSum[MoralAxisCount] = {};
-            float EconomyMoralSum[MoralAxisCount] = {};
-
-            for (const FMythicWorldEvent &Event : RecentEvents) {
-                if ((Event.CategoryFlags & EMythicEventCategory::Combat) != 0) {
-                    ++CombatCount;
-                    for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
-                        CombatMoralSum[Axis] += Event.MoralVector.AxisValues[Axis];
-                    }
-                }
-                if ((Event.CategoryFlags & EMythicEventCategory::Trade) != 0) {
-                    ++EconomyCount;
-                    for (int32 Axis = 0; Axis < MoralAxisCount; ++Axis) {
-                        EconomyMoralSum[Axis] += Event.MoralVector.AxisValues[Axis];
-                    }
-                }
-                if ((Event.CategoryFlags & EMythicEventCategory::Diplomacy) != 0) {
-                    ++DiplomacyCount;
-                }
-            }
+        // Category mix of this faction's newest primary events, tallied once per tick by TickEventDigest.
+        const int32 TotalCount = (i < MaxFactions) ? EventDigest.CultureTotal[i] : 0;
+
+        if (TotalCount >= 8) {
+            const int32 CombatCount = EventDigest.CultureCombat[i];
+            const int32 EconomyCount = EventDigest.CultureTrade[i];
+            const int32 DiplomacyCount = EventDigest.CultureDiplomacy[i];
 
             // Cultural promotion threshold: if >50% of recent events are combat,
             // the faction is developing a warrior culture. Drift Violence tolerance up.
-            const float TotalEvents = static_cast<float>(RecentEvents.Num());
+            const float TotalEvents = static_cast<float>(TotalCount);
             constexpr float CulturalThreshold = 0.5f;
             constexpr float CulturalDriftRate = 0.02f;
 
@@ -1231,7 +1428,7 @@ void FMythicWorldSimThread::TickCrystallization() {
                 F->bIdeologyDirty = true;
 
                 UE_LOG(LogMythWorldSim, Verbose, TEXT("Crystallization: Faction '%s' warrior culture drift (combat=%d/%d)"),
-                       *F->DisplayName.ToString(), CombatCount, RecentEvents.Num());
+                       *F->DisplayName.ToString(), CombatCount, TotalCount);
             }
 
             if (static_cast<float>(EconomyCount) / TotalEvents > CulturalThreshold) {
@@ -1242,7 +1439,7 @@ void FMythicWorldSimThread::TickCrystallization() {
                 F->bIdeologyDirty = true;
 
                 UE_LOG(LogMythWorldSim, Verbose, TEXT("Crystallization: Faction '%s' merchant culture drift (economy=%d/%d)"),
-                       *F->DisplayName.ToString(), EconomyCount, RecentEvents.Num());
+                       *F->DisplayName.ToString(), EconomyCount, TotalCount);
             }
 
             if (static_cast<float>(DiplomacyCount) / TotalEvents > CulturalThreshold) {
@@ -1281,6 +1478,7 @@ void FMythicWorldSimThread::TickCrystallization() {
 
 void FMythicWorldSimThread::TickHistoryAppend() {
     TRACE_CPUPROFILER_EVENT_SCOPE(MythicWorldSim_HistoryAppend);
+    SCOPE_CYCLE_COUNTER(STAT_MythicSim_HistoryAppend);
 
     // Phase 6: Write significant sim-generated state changes as causal fabric events
     // so that NPCs become aware of macro-level world changes through the standard
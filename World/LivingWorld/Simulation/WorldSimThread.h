@@ -22,6 +22,50 @@ enum class EMythicFactionRelation : uint8;
 
 DECLARE_MULTICAST_DELEGATE(FOnWorldSimCommitted);
 
+/** Wall-clock cost of the most recent sim tick, whole and per sub-step. Written by the sim thread under SimulationLock. */
+struct FMythicSimTickTimings {
+    /** Bumped once per completed SimTick — a reader that sees the same value again has nothing new */
+    uint64 Serial = 0;
+
+    /** SimTick with SimulationLock held (phases + settlement ticks + pending-event drain + commit) */
+    float TotalMs = 0.0f;
+
+    /** CommitAllSnapshots alone */
+    float CommitMs = 0.0f;
+
+    /** One entry per phase, in canonical order; names are the phase table's (static literals) */
+    TArray<float> PhaseMs;
+    TArray<const TCHAR *> PhaseNames;
+};
+
+// ─────────────────────────────────────────────────────────────
+// Sim Phase Graph — declared read/write sets per sub-step
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Shared state a sim sub-step may touch, as a bitmask. Each phase declares what it reads and writes; two phases may
+ * only overlap when neither writes anything the other touches. The committed snapshots (fabric published view,
+ * territory ReadBuffer) are read-only for the whole graph — CommitAllSnapshots runs after it drains. Randomness is not
+ * a shared resource: each phase that rolls draws from its own per-tick stream (MakeSimPhaseRandom).
+ */
+namespace EMythicSimResource {
+    constexpr uint32 FactionEconomy = 1 << 0;     // Supply / Demand / Reserves / Prices / MilitaryStrength
+    constexpr uint32 FactionPopulation = 1 << 1;  // Population, bHasBeenPopulated, LastAlivePopulation
+    constexpr uint32 FactionLifecycle = 1 << 2;   // bAlive, Status, registration of new factions (RegisteredCount)
+    constexpr uint32 FactionBehavior = 1 << 3;    // bControlsTerritory / bHasEconomy / bCanNegotiate / … flags
+    constexpr uint32 FactionIdeology = 1 << 4;    // Ideology, bIdeologyDirty
+    constexpr uint32 FactionCellCount = 1 << 5;   // ControlledCellCount
+    constexpr uint32 FactionLeadership = 1 << 6;  // LeaderEntityId, LeaderSignificanceScore
+    constexpr uint32 FactionDistress = 1 << 7;    // bFamineActive / bWeaknessActive edge latches
+    constexpr uint32 Relationships = 1 << 8;      // faction relationship matrix (write side)
+    constexpr uint32 TradeVolume = 1 << 9;        // sim-private pairwise trade accumulator
+    constexpr uint32 TerritoryWrite = 1 << 10;    // territory grid WriteBuffer + DirtyCells
+    constexpr uint32 TerritorySnapshot = 1 << 11; // territory grid committed ReadBuffer (read-only inside the graph)
+    constexpr uint32 FabricAppend = 1 << 12;      // causal fabric write ring (single-writer AppendEvent)
+    constexpr uint32 FabricSnapshot = 1 << 13;    // causal fabric published view (read-only inside the graph)
+    constexpr uint32 EventDigest = 1 << 15;       // per-tick faction/pair aggregation of recent fabric events
+}
+
 /**
  * Dedicated background thread for world simulation.
  *
@@ -29,6 +73,11 @@ DECLARE_MULTICAST_DELEGATE(FOnWorldSimCommitted);
  * Runs: economy, population, diplomacy, territory propagation, ideology metabolism,
  * scheme engine, crystallization, history append.
  *
+ * The sub-steps form a phase graph: each declares its EMythicSimResource read/write set, and a phase only waits on
+ * the earlier phases it conflicts with. Independent phases (e.g. territory propagation vs. the economy → population →
+ * diplomacy chain) run as parallel tasks; conflicting ones keep the canonical serial order, so a tick's result is
+ * identical to running them back to back.
+ *
  * After each tick, commits all write buffers so game thread gets fresh snapshots.
  * Never blocks the game thread — all shared data uses double-buffered reads.
  */
@@ -37,6 +86,8 @@ class MYTHIC_API FMythicWorldSimThread : public FRunnable {
     friend class FLivingWorldSimEconomyTest;
     friend class FLivingWorldSimPopulationTest;
     friend class FLivingWorldSimDiplomacyTest;
+    friend class FLivingWorldSimPhaseGraphDeterminismTest;
+    friend class FLivingWorldSimEventDigestTest;
 #endif
 
 public:
@@ -80,6 +131,9 @@ public:
     /** Configured real-time interval between sim ticks (seconds). Set once at Setup; safe to read under SimulationLock. */
     float GetTickIntervalSeconds() const { return TickIntervalSeconds; }
 
+    /** Timings of the most recent tick (telemetry). Caller MUST hold the SimulationLock, like GetTickCount. */
+    const FMythicSimTickTimings &GetLastTickTimings() const { return LastTickTimings; }
+
     // ─── FRunnable Interface ──────────────────────────────
 
     virtual bool Init() override;
@@ -122,6 +176,33 @@ public:
      *  unit testing. */
     static float DriftTowardClamped(float Current, float Target, float Rate);
 
+    /** One fabric event's contribution to a faction pair's diplomacy score: Combat hurts (-Significance), Trade /
+     *  Diplomacy help (+Significance/2). Single source for the per-tick pair matrix. Pure + static for unit testing. */
+    static float DiplomacyEventContribution(uint16 CategoryFlags, float Significance);
+
+    /** The random stream one phase draws from this tick, seeded from (sim seed, tick, phase salt). Phases never share
+     *  a stream, so a phase's rolls don't depend on which phases ran before it or beside it on another worker — the
+     *  same seed replays the same world serial or parallel. Pure + static for unit testing. */
+    static FRandomStream MakeSimPhaseRandom(int32 Seed, uint64 SimTickIndex, uint32 PhaseSalt);
+
+    // ── Phase graph ──
+
+    /** One sim sub-step plus its declared footprint (EMythicSimResource bits). */
+    struct FSimPhase {
+        const TCHAR *Name = nullptr;
+        void (FMythicWorldSimThread::*Tick)() = nullptr;
+        uint32 Reads = 0;
+        uint32 Writes = 0;
+    };
+
+    /** Whether two phases must keep their serial order: one writes something the other reads or writes. Phases that
+     *  don't conflict commute, so running them concurrently gives the same result as the serial order. Pure. */
+    static bool DoSimPhasesConflict(uint32 ReadsA, uint32 WritesA, uint32 ReadsB, uint32 WritesB);
+
+    /** For each phase (in canonical serial order), the indices of the EARLIER phases it must wait for — every earlier
+     *  phase it conflicts with. Pure + static so the derived graph is unit-testable independent of the task system. */
+    static void BuildSimPhasePrerequisites(TConstArrayView<FSimPhase> Phases, TArray<TArray<int32>> &OutPrerequisites);
+
 private:
     /** Perform one simulation tick. Called on the background thread. */
     void SimTick();
@@ -129,12 +210,17 @@ private:
     /** Commit all write buffers so game thread gets fresh data */
     void CommitAllSnapshots();
 
+    /** Run the sub-step phase graph — as prerequisite-ordered tasks (bParallelSimPhases) or back to back. */
+    void RunSimPhases();
+
     // ─── Simulation sub-steps ─────────────────────────────
 
+    void TickEventDigest();
     void TickEconomy();
     void TickPopulation();
     void TickDiplomacy();
     void TickTerritoryPropagation();
+    void TickTerritoryCensus();
     void TickIdeologyMetabolism();
     void TickFactionEvolution();
     void TickSchemeEngine();
@@ -152,9 +238,12 @@ private:
     /** Real-time interval between simulation ticks (seconds) */
     float TickIntervalSeconds = 1.0f;
 
-    /** Monotonically increasing tick counter for diagnostics */
+    /** Monotonically increasing tick counter (diagnostics; also keys each tick's phase random streams) */
     uint64 TickCount = 0;
 
+    /** Seed of every phase's random stream (LivingWorldSettings::SimRandomSeed, read in Setup) */
+    int32 SimSeed = 0;
+
     // ─── References to shared data (NOT owned) ────────────
 
     UMythicCausalFabric *Fabric = nullptr;
@@ -173,4 +262,43 @@ private:
      */
     TArray<float> TradeVolume;
     int32 MaxFactions = 0;
+
+    /**
+     * Per-tick aggregation of recent fabric events, built by ONE newest-first pass over the committed read snapshot in
+     * TickEventDigest. Replaces the per-pair / per-faction fabric queries diplomacy, ideology metabolism, faction
+     * evolution and crystallization used to issue (O(F² × cap) event copies out of the fabric). Dense, indexed by
+     * FMythicFactionId.Index (pairs as Low * MaxFactions + High, like the relationship matrix). Background thread only.
+     */
+    struct FSimEventDigest {
+        /** Summed DiplomacyEventContribution of recent Combat/Trade/Diplomacy events between each faction pair. */
+        TArray<float> PairScore;
+        /** Events folded into PairScore per pair (capped at DiplomacyEventScanCap). */
+        TArray<int32> PairCount;
+
+        /** Significance-weighted moral vector sum of recent significant events involving each faction [F × axis]. */
+        TArray<float> IdeologyVectorSum;
+        TArray<int32> IdeologyCount;
+
+        /** Unweighted moral vector sum of recent events where each faction is the PrimaryFaction [F × axis]. */
+        TArray<float> DivergenceVectorSum;
+        TArray<int32> DivergenceCount;
+
+        /** Category tallies over each faction's newest PrimaryFaction events (crystallization window). Read from the
+         *  faction's posting list, so unlike the fields above it reaches past SimEventDigestScanCap. */
+        TArray<int32> CultureTotal;
+        TArray<int32> CultureCombat;
+        TArray<int32> CultureTrade;
+        TArray<int32> CultureDiplomacy;
+    };
+    FSimEventDigest EventDigest;
+
+    /** Canonical sub-step table + its derived prerequisite lists. Built once in Setup (immutable afterwards). */
+    TArray<FSimPhase> SimPhases;
+    TArray<TArray<int32>> SimPhasePrerequisites;
+
+    /** See GetLastTickTimings. PhaseMs is sized in Setup; each phase task writes only its own slot. */
+    FMythicSimTickTimings LastTickTimings;
+
+    /** Run SimPhases[Index] and record its wall time */
+    void RunTimedPhase(int32 Index);
 };
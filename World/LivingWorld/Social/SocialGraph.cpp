@@ -1,5 +1,5 @@
 // Mythic Living World — Social Graph Implementation
-// Sparse adjacency list with lazy decay, budget-capped pruning, and O(1) entity lookup.
+// Slot-indexed edge blocks with lazy decay, budget-capped pruning, and O(1) entity lookup.
 
 #include "World/LivingWorld/Social/SocialGraph.h"
 
@@ -12,16 +12,77 @@ DEFINE_LOG_CATEGORY(LogMythSocialGraph);
 // ─────────────────────────────────────────────────────────────
 
 void UMythicSocialGraph::Initialize(int32 InMaxEdgesPerEntity, float InPruneStrengthThreshold, float InEdgeDecayRate) {
+    FWriteScopeLock Lock(GraphLock);
+
     MaxEdgesPerEntity = FMath::Clamp(InMaxEdgesPerEntity, 1, 32);
     PruneStrengthThreshold = FMath::Max(InPruneStrengthThreshold, 0.001f);
     EdgeDecayRate = FMath::Max(InEdgeDecayRate, 0.0f);
-    PruneIteratorIndex = 0;
+    PruneCursor = 0;
+
+    // Block size is baked into every slot's pool offset, so storage starts over.
+    SlotByEntity.Reset();
+    SlotOwners.Reset();
+    SlotEdgeCounts.Reset();
+    EdgePool.Reset();
+    FreeSlots.Reset();
+    TotalEdgeCount = 0;
 
     UE_LOG(LogMythSocialGraph, Log,
            TEXT("SocialGraph initialized: MaxEdges=%d, PruneThreshold=%.3f, DecayRate=%.4f"),
            MaxEdgesPerEntity, PruneStrengthThreshold, EdgeDecayRate);
 }
 
+// ─────────────────────────────────────────────────────────────
+// Slot storage
+// ─────────────────────────────────────────────────────────────
+
+int32 UMythicSocialGraph::FindSlot(FMassEntityHandle Source) const {
+    const int32 *Slot = SlotByEntity.Find(Source);
+    return Slot ? *Slot : INDEX_NONE;
+}
+
+int32 UMythicSocialGraph::FindOrAddSlot(FMassEntityHandle Source) {
+    if (const int32 *Existing = SlotByEntity.Find(Source)) {
+        return *Existing;
+    }
+
+    int32 Slot;
+    if (FreeSlots.Num() > 0) {
+        Slot = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else {
+        Slot = SlotOwners.AddDefaulted();
+        SlotEdgeCounts.Add(0);
+        EdgePool.AddDefaulted(MaxEdgesPerEntity);
+    }
+    SlotOwners[Slot] = Source;
+    SlotEdgeCounts[Slot] = 0;
+    SlotByEntity.Add(Source, Slot);
+    return Slot;
+}
+
+void UMythicSocialGraph::ReleaseSlot(int32 Slot) {
+    SlotByEntity.Remove(SlotOwners[Slot]);
+    SlotOwners[Slot] = FMassEntityHandle();
+    SlotEdgeCounts[Slot] = 0;
+    FreeSlots.Add(Slot);
+}
+
+void UMythicSocialGraph::RemoveEdgeAt(int32 Slot, int32 EdgeIndex) {
+    const int32 Start = BlockStart(Slot);
+    const int32 Last = SlotEdgeCounts[Slot] - 1;
+    if (EdgeIndex != Last) {
+        EdgePool[Start + EdgeIndex] = EdgePool[Start + Last];
+    }
+    --SlotEdgeCounts[Slot];
+    --TotalEdgeCount;
+
+    // Clean up empty entries
+    if (SlotEdgeCounts[Slot] == 0) {
+        ReleaseSlot(Slot);
+    }
+}
+
 // ─────────────────────────────────────────────────────────────
 // Edge CRUD
 // ─────────────────────────────────────────────────────────────
@@ -41,10 +102,13 @@ void UMythicSocialGraph::AddOrStrengthenEdge(
         return;
     }
 
-    TArray<FMythicSocialEdge> &Edges = AdjacencyMap.FindOrAdd(Source);
+    const int32 Slot = FindOrAddSlot(Source);
+    const int32 Start = BlockStart(Slot);
+    const int32 Count = SlotEdgeCounts[Slot];
 
     // Check if edge already exists — strengthen it
-    for (FMythicSocialEdge &Edge : Edges) {
+    for (int32 i = 0; i < Count; ++i) {
+        FMythicSocialEdge &Edge = EdgePool[Start + i];
         if (Edge.TargetEntity == Target) {
             // Refresh interaction time and boost strength (clamped to 1.0)
             Edge.Strength = FMath::Min(Edge.Strength + InitStrength, 1.0f);
@@ -54,25 +118,27 @@ void UMythicSocialGraph::AddOrStrengthenEdge(
         }
     }
 
-    // New edge — check capacity
-    if (Edges.Num() >= MaxEdgesPerEntity) {
-        // Evict weakest edge (with decay applied)
-        int32 WeakestIndex = 0;
-        float WeakestStrength = ApplyDecay(Edges[0], WorldTime, EdgeDecayRate);
+    // New edge — a full block evicts its weakest edge (with decay applied) and reuses the entry
+    int32 EdgeIndex = Count;
+    if (Count >= MaxEdgesPerEntity) {
+        EdgeIndex = 0;
+        float WeakestStrength = ApplyDecay(EdgePool[Start], WorldTime, EdgeDecayRate);
 
-        for (int32 i = 1; i < Edges.Num(); ++i) {
-            const float DecayedStrength = ApplyDecay(Edges[i], WorldTime, EdgeDecayRate);
+        for (int32 i = 1; i < Count; ++i) {
+            const float DecayedStrength = ApplyDecay(EdgePool[Start + i], WorldTime, EdgeDecayRate);
             if (DecayedStrength < WeakestStrength) {
                 WeakestStrength = DecayedStrength;
-                WeakestIndex = i;
+                EdgeIndex = i;
             }
         }
-
-        Edges.RemoveAtSwap(WeakestIndex);
+    }
+    else {
+        ++SlotEdgeCounts[Slot];
+        ++TotalEdgeCount;
     }
 
     // Add new edge
-    FMythicSocialEdge &NewEdge = Edges.AddDefaulted_GetRef();
+    FMythicSocialEdge &NewEdge = EdgePool[Start + EdgeIndex];
     NewEdge.TargetEntity = Target;
     NewEdge.Relation = Relation;
     NewEdge.Strength = FMath::Clamp(InitStrength, 0.0f, 1.0f);
@@ -82,19 +148,15 @@ void UMythicSocialGraph::AddOrStrengthenEdge(
 
 bool UMythicSocialGraph::RemoveEdge(FMassEntityHandle Source, FMassEntityHandle Target) {
     FWriteScopeLock Lock(GraphLock);
-    TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Source);
-    if (!Edges) {
+    const int32 Slot = FindSlot(Source);
+    if (Slot == INDEX_NONE) {
         return false;
     }
 
-    for (int32 i = 0; i < Edges->Num(); ++i) {
-        if ((*Edges)[i].TargetEntity == Target) {
-            Edges->RemoveAtSwap(i);
-
-            // Clean up empty entries
-            if (Edges->Num() == 0) {
-                AdjacencyMap.Remove(Source);
-            }
+    const int32 Start = BlockStart(Slot);
+    for (int32 i = 0; i < SlotEdgeCounts[Slot]; ++i) {
+        if (EdgePool[Start + i].TargetEntity == Target) {
+            RemoveEdgeAt(Slot, i);
             return true;
         }
     }
@@ -110,33 +172,35 @@ void UMythicSocialGraph::RemoveAllEdges(FMassEntityHandle Entity, TArray<FMassEn
     OutSeveredConnections.Reset();
 
     // Remove outgoing edges
-    if (TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Entity)) {
-        for (const FMythicSocialEdge &Edge : *Edges) {
-            OutSeveredConnections.Add(Edge.TargetEntity);
+    const int32 OwnSlot = FindSlot(Entity);
+    if (OwnSlot != INDEX_NONE) {
+        const int32 Start = BlockStart(OwnSlot);
+        for (int32 i = 0; i < SlotEdgeCounts[OwnSlot]; ++i) {
+            OutSeveredConnections.Add(EdgePool[Start + i].TargetEntity);
         }
-        AdjacencyMap.Remove(Entity);
+        TotalEdgeCount -= SlotEdgeCounts[OwnSlot];
+        ReleaseSlot(OwnSlot);
     }
 
-    // Remove incoming edges (Entity appears as target in other entities' lists)
-    // This is O(n×m) where n=entities, m=edges per entity, but:
+    // Remove incoming edges (Entity appears as target in other entities' blocks)
+    // This is O(n×m) where n=slots, m=edges per slot, but:
     // - Only called on entity death (rare)
-    // - Typical graph is sparse (100 entities × 8 edges = 800 checks)
-    for (auto It = AdjacencyMap.CreateIterator(); It; ++It) {
-        TArray<FMythicSocialEdge> &Edges = It->Value;
-        for (int32 i = Edges.Num() - 1; i >= 0; --i) {
-            if (Edges[i].TargetEntity == Entity) {
+    // - It is one linear pass over the contiguous edge pool
+    for (int32 Slot = 0; Slot < SlotOwners.Num(); ++Slot) {
+        if (SlotEdgeCounts[Slot] == 0) {
+            continue; // free slot
+        }
+        const FMassEntityHandle Owner = SlotOwners[Slot];
+        const int32 Start = BlockStart(Slot);
+        for (int32 i = SlotEdgeCounts[Slot] - 1; i >= 0; --i) {
+            if (EdgePool[Start + i].TargetEntity == Entity) {
                 // This source entity lost a connection — notify for Grief
-                if (!OutSeveredConnections.Contains(It->Key)) {
-                    OutSeveredConnections.Add(It->Key);
+                if (!OutSeveredConnections.Contains(Owner)) {
+                    OutSeveredConnections.Add(Owner);
                 }
-                Edges.RemoveAtSwap(i);
+                RemoveEdgeAt(Slot, i); // releases the slot once its last edge goes (only possible at i == 0)
             }
         }
-
-        // Clean up empty adjacency entries
-        if (Edges.Num() == 0) {
-            It.RemoveCurrent();
-        }
     }
 }
 
@@ -148,16 +212,17 @@ int32 UMythicSocialGraph::GetEdges(FMassEntityHandle Source, double WorldTime, T
     FReadScopeLock Lock(GraphLock);
     OutEdges.Reset();
 
-    const TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Source);
-    if (!Edges) {
+    const int32 Slot = FindSlot(Source);
+    if (Slot == INDEX_NONE) {
         return 0;
     }
 
-    OutEdges.Reserve(Edges->Num());
-    for (const FMythicSocialEdge &Edge : *Edges) {
-        FMythicSocialEdge DecayedEdge = Edge;
+    const int32 Start = BlockStart(Slot);
+    OutEdges.Reserve(SlotEdgeCounts[Slot]);
+    for (int32 i = 0; i < SlotEdgeCounts[Slot]; ++i) {
+        const FMythicSocialEdge &Edge = EdgePool[Start + i];
+        FMythicSocialEdge &DecayedEdge = OutEdges.Add_GetRef(Edge);
         DecayedEdge.Strength = ApplyDecay(Edge, WorldTime, EdgeDecayRate);
-        OutEdges.Add(DecayedEdge);
     }
 
     return OutEdges.Num();
@@ -171,30 +236,53 @@ int32 UMythicSocialGraph::GetEdgesByRelation(
     FReadScopeLock Lock(GraphLock);
     OutEdges.Reset();
 
-    const TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Source);
-    if (!Edges) {
+    const int32 Slot = FindSlot(Source);
+    if (Slot == INDEX_NONE) {
         return 0;
     }
 
-    for (const FMythicSocialEdge &Edge : *Edges) {
+    const int32 Start = BlockStart(Slot);
+    for (int32 i = 0; i < SlotEdgeCounts[Slot]; ++i) {
+        const FMythicSocialEdge &Edge = EdgePool[Start + i];
         if (Edge.Relation == Relation) {
-            FMythicSocialEdge DecayedEdge = Edge;
+            FMythicSocialEdge &DecayedEdge = OutEdges.Add_GetRef(Edge);
             DecayedEdge.Strength = ApplyDecay(Edge, WorldTime, EdgeDecayRate);
-            OutEdges.Add(DecayedEdge);
         }
     }
 
     return OutEdges.Num();
 }
 
+int32 UMythicSocialGraph::VisitEdges(FMassEntityHandle Source, double WorldTime, FEdgeVisitor Visitor) const {
+    FReadScopeLock Lock(GraphLock);
+
+    const int32 Slot = FindSlot(Source);
+    if (Slot == INDEX_NONE) {
+        return 0;
+    }
+
+    const int32 Start = BlockStart(Slot);
+    int32 Visited = 0;
+    for (int32 i = 0; i < SlotEdgeCounts[Slot]; ++i) {
+        const FMythicSocialEdge &Edge = EdgePool[Start + i];
+        ++Visited;
+        if (!Visitor(Edge, ApplyDecay(Edge, WorldTime, EdgeDecayRate))) {
+            break;
+        }
+    }
+    return Visited;
+}
+
 bool UMythicSocialGraph::HasEdge(FMassEntityHandle Source, FMassEntityHandle Target, double WorldTime, FMythicSocialEdge &OutEdge) const {
     FReadScopeLock Lock(GraphLock);
-    const TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Source);
-    if (!Edges) {
+    const int32 Slot = FindSlot(Source);
+    if (Slot == INDEX_NONE) {
         return false;
     }
 
-    for (const FMythicSocialEdge &Edge : *Edges) {
+    const int32 Start = BlockStart(Slot);
+    for (int32 i = 0; i < SlotEdgeCounts[Slot]; ++i) {
+        const FMythicSocialEdge &Edge = EdgePool[Start + i];
         if (Edge.TargetEntity == Target) {
             OutEdge = Edge;
             OutEdge.Strength = ApplyDecay(Edge, WorldTime, EdgeDecayRate);
@@ -207,19 +295,15 @@ bool UMythicSocialGraph::HasEdge(FMassEntityHandle Source, FMassEntityHandle Tar
 
 int32 UMythicSocialGraph::GetTotalEdgeCount() const {
     FReadScopeLock Lock(GraphLock);
-    int32 Total = 0;
-    for (const auto &Pair : AdjacencyMap) {
-        Total += Pair.Value.Num();
-    }
-    return Total;
+    return TotalEdgeCount;
 }
 
 int32 UMythicSocialGraph::GetEntityCount() const {
-    // Read-lock before AdjacencyMap.Num(): the BDI cognition worker Adds/Removes/rehashes this map off the game thread
+    // Read-lock before SlotByEntity.Num(): the BDI cognition worker Adds/Removes/rehashes this map off the game thread
     // (AddOrStrengthenEdge / RemoveEdge / RemoveAllEdges / PruneStaleEdges all take the write lock), so a bare unlocked
     // .Num() read races a concurrent rehash. Mirrors GetTotalEdgeCount.
     FReadScopeLock Lock(GraphLock);
-    return AdjacencyMap.Num();
+    return SlotByEntity.Num();
 }
 
 // ─────────────────────────────────────────────────────────────
@@ -231,58 +315,44 @@ int32 UMythicSocialGraph::PruneStaleEdges(double WorldTime, int32 MaxEntitiesPer
 
     FWriteScopeLock Lock(GraphLock);
 
-    if (AdjacencyMap.Num() == 0) {
+    const int32 NumSlots = SlotOwners.Num();
+    if (TotalEdgeCount == 0 || NumSlots == 0) {
         return 0;
     }
 
     int32 TotalPruned = 0;
     int32 EntitiesProcessed = 0;
 
-    // Convert to array for stable indexed iteration
-    TArray<FMassEntityHandle> Keys;
-    AdjacencyMap.GetKeys(Keys);
-
-    if (Keys.Num() == 0) {
-        return 0;
-    }
+    // Wrap the cursor (the pool never shrinks, but Initialize can reset it)
+    PruneCursor = PruneCursor % NumSlots;
 
-    // Wrap the iterator index
-    PruneIteratorIndex = PruneIteratorIndex % Keys.Num();
-
-    for (int32 i = 0; i < Keys.Num() && EntitiesProcessed < MaxEntitiesPerCall; ++i) {
-        const int32 CurrentIndex = (PruneIteratorIndex + i) % Keys.Num();
-        const FMassEntityHandle &Key = Keys[CurrentIndex];
-
-        TArray<FMythicSocialEdge> *Edges = AdjacencyMap.Find(Key);
-        if (!Edges) {
+    // At most one lap per call; free slots are skipped without spending budget
+    for (int32 Visited = 0; Visited < NumSlots && EntitiesProcessed < MaxEntitiesPerCall; ++Visited) {
+        const int32 Slot = PruneCursor;
+        PruneCursor = (PruneCursor + 1) % NumSlots;
+        if (SlotEdgeCounts[Slot] == 0) {
             continue;
         }
 
-        // Prune edges below threshold (iterate backwards for safe removal)
-        for (int32 j = Edges->Num() - 1; j >= 0; --j) {
-            const float DecayedStrength = ApplyDecay((*Edges)[j], WorldTime, EdgeDecayRate);
+        // Prune edges below threshold (iterate backwards for safe swap-removal)
+        const int32 Start = BlockStart(Slot);
+        for (int32 j = SlotEdgeCounts[Slot] - 1; j >= 0; --j) {
+            FMythicSocialEdge &Edge = EdgePool[Start + j];
+            const float DecayedStrength = ApplyDecay(Edge, WorldTime, EdgeDecayRate);
             if (DecayedStrength < PruneStrengthThreshold) {
-                Edges->RemoveAtSwap(j);
+                RemoveEdgeAt(Slot, j); // releases the slot once its last edge goes
                 ++TotalPruned;
             }
             else {
                 // Write back decayed strength (lazy decay materialization)
-                (*Edges)[j].Strength = DecayedStrength;
-                (*Edges)[j].LastInteractionTime = WorldTime;
+                Edge.Strength = DecayedStrength;
+                Edge.LastInteractionTime = WorldTime;
             }
         }
 
-        // Remove empty adjacency entries
-        if (Edges->Num() == 0) {
-            AdjacencyMap.Remove(Key);
-        }
-
         ++EntitiesProcessed;
     }
 
-    // Advance iterator for next call
-    PruneIteratorIndex = (PruneIteratorIndex + EntitiesProcessed) % FMath::Max(Keys.Num(), 1);
-
     return TotalPruned;
 }
 
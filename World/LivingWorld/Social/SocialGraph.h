@@ -1,5 +1,5 @@
 // Mythic Living World — Social Graph
-// Shared sparse adjacency list for NPC-to-NPC relationships.
+// Shared slot-indexed adjacency for NPC-to-NPC relationships.
 // Used by BDI brain, party system, belief propagation, and crime reporting.
 
 #pragma once
@@ -66,7 +66,7 @@ struct FMythicSocialEdge {
 };
 
 // ─────────────────────────────────────────────────────────────
-// Social Graph — Sparse adjacency list
+// Social Graph — Slot-indexed adjacency
 // ─────────────────────────────────────────────────────────────
 
 /**
@@ -75,15 +75,18 @@ struct FMythicSocialEdge {
  *
  * Threading:
  * - Guarded by GraphLock (FRWLock): read-lock on the query path, write-lock on mutation. The BDI cognition worker
- *   thread calls GetEdges/GetEdgesByRelation off the game thread, so the lock IS required for safe concurrent access
- *   (mirrors UMythicCausalFabric's FabricLock). Game-thread event processors take the write lock.
+ *   thread calls GetEdges/GetEdgesByRelation off the game thread, so the lock IS required for safe concurrent access.
+ *   Game-thread event processors take the write lock.
  *
  * Performance:
- * - TMap<FMassEntityHandle, TArray<FMythicSocialEdge>> — O(1) entity lookup
- * - Fixed max edges per entity prevents unbounded growth
- * - Budget-capped pruning prevents frame spikes
- * - Total memory: ~24B per edge × MaxEdges × active entity count
- *   At 100 active entities × 8 max edges = ~19KB
+ * - Each entity with edges owns a dense SLOT (TMap<FMassEntityHandle, int32> lookup, O(1)); a slot's edges live in a
+ *   fixed block of MaxEdgesPerEntity entries inside one contiguous EdgePool, so walking an entity's edges — or the whole
+ *   graph — is a linear read with no per-entity heap allocation. Emptied slots go on a free-list and are reused.
+ * - VisitEdges hands out decayed strengths without copying anything; the GetEdges family copies for callers that need
+ *   to hold the edges past the lock.
+ * - Budget-capped pruning walks slots with a persistent cursor (no key snapshot per call)
+ * - Total memory: ~24B per edge × MaxEdges × slot count (blocks are reserved whole)
+ *   At 10K slots × 8 max edges = ~1.9MB
  *
  * Lifecycle:
  * - Edges created by event processors (witness → social interaction)
@@ -169,6 +172,20 @@ public:
         double WorldTime,
         TArray<FMythicSocialEdge> &OutEdges) const;
 
+    /**
+     * Zero-copy counterpart of GetEdges. The visitor gets each outgoing edge of Source straight from the edge pool, with
+     * its lazily decayed strength alongside (the stored Edge.Strength is the last materialized value — use Strength).
+     * Runs under the read lock. Return true to keep going, false to stop early (budget reached, answer found).
+     *
+     * The reference is only valid inside the call: never store it, and never call back into the graph from a visitor
+     * (FRWLock is not reentrant).
+     *
+     * @return Number of edges handed to the visitor
+     */
+    using FEdgeVisitor = TFunctionRef<bool(const FMythicSocialEdge &Edge, float Strength)>;
+
+    int32 VisitEdges(FMassEntityHandle Source, double WorldTime, FEdgeVisitor Visitor) const;
+
     /**
      * Check if a specific edge exists between two entities.
      * @param OutEdge  If found, filled with the edge data (with decay applied)
@@ -182,7 +199,7 @@ public:
     int32 GetTotalEdgeCount() const;
 
     /** Get number of entities that have at least one edge. Read-locks GraphLock (the BDI cognition worker mutates
-     *  AdjacencyMap off the game thread) — defined in the .cpp so it can lock, matching GetTotalEdgeCount. */
+     *  the slot map off the game thread) — defined in the .cpp so it can lock, matching GetTotalEdgeCount. */
     int32 GetEntityCount() const;
 
     // ─── Maintenance ──────────────────────────────────────
@@ -198,11 +215,39 @@ public:
     int32 PruneStaleEdges(double WorldTime, int32 MaxEntitiesPerCall = 10);
 
 private:
-    /** Sparse adjacency: entity → outgoing edges. TArray per entity (small, cache-friendly). */
-    TMap<FMassEntityHandle, TArray<FMythicSocialEdge>> AdjacencyMap;
+    /** Slot of Source, or INDEX_NONE. Caller holds GraphLock. */
+    int32 FindSlot(FMassEntityHandle Source) const;
+
+    /** Slot for Source, taking one off the free-list (or growing the pool by one block) if it has none. Write lock held. */
+    int32 FindOrAddSlot(FMassEntityHandle Source);
+
+    /** Return an emptied slot to the free-list. Write lock held. */
+    void ReleaseSlot(int32 Slot);
+
+    /** Swap-remove edge EdgeIndex (block-relative) from Slot's block; releases the slot when it empties. Write lock held. */
+    void RemoveEdgeAt(int32 Slot, int32 EdgeIndex);
+
+    /** First pool index of Slot's edge block */
+    FORCEINLINE int32 BlockStart(int32 Slot) const { return Slot * MaxEdgesPerEntity; }
+
+    /** Entity → slot (only entities with at least one edge hold a slot) */
+    TMap<FMassEntityHandle, int32> SlotByEntity;
+
+    /** Per slot: owning entity (unset handle = free slot) and live edge count, packed parallel to the blocks */
+    TArray<FMassEntityHandle> SlotOwners;
+    TArray<uint8> SlotEdgeCounts;
+
+    /** MaxEdgesPerEntity entries per slot; slot S's live edges are [S × Max, S × Max + SlotEdgeCounts[S]) */
+    TArray<FMythicSocialEdge> EdgePool;
+
+    /** Released slots, reused before the pool grows */
+    TArray<int32> FreeSlots;
+
+    /** Live edges across every slot (kept in step with SlotEdgeCounts) */
+    int32 TotalEdgeCount = 0;
 
-    /** Guards AdjacencyMap — the BDI cognition worker reads (GetEdges) off the game thread while game-thread
-     *  processors mutate. Read-locked on queries, write-locked on mutation. mutable so const queries can lock. */
+    /** Guards the slot storage — the BDI cognition worker reads (GetEdges / VisitEdges) off the game thread while
+     *  game-thread processors mutate. Read-locked on queries, write-locked on mutation. mutable so const queries can lock. */
     mutable FRWLock GraphLock;
 
     /** Max outgoing edges per entity */
@@ -214,8 +259,8 @@ private:
     /** Strength decay per second of world time */
     float EdgeDecayRate = 0.001f;
 
-    /** Round-robin iterator for budget-capped pruning */
-    int32 PruneIteratorIndex = 0;
+    /** Next slot the budget-capped prune pass visits (wraps over SlotOwners) */
+    int32 PruneCursor = 0;
 
 public:
     /** Apply lazy exponential decay to an edge's strength: S × e^(-rate·Δt); returns the strength unchanged when the
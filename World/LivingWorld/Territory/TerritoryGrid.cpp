@@ -1,6 +1,7 @@
 // Mythic Living World System — Territory Grid Implementation
 
 #include "World/LivingWorld/Territory/TerritoryGrid.h"
+#include "Async/ParallelFor.h"
 
 void UMythicTerritoryGrid::Initialize(const UMythicTerritoryGridSettings *Settings) {
     check(Settings);
@@ -11,6 +12,8 @@ void UMythicTerritoryGrid::Initialize(const UMythicTerritoryGridSettings *Settin
     WorldOrigin = Settings->WorldOrigin;
     InfluenceBleedRate = Settings->InfluenceBleedRate;
     MinControlThreshold = Settings->MinControlThreshold;
+    ParallelPropagationMinCells = Settings->ParallelPropagationMinCells;
+    bIncrementalPropagation = Settings->bIncrementalPropagation;
 
     // Cache the immutable biome settings so GetBiomeAtCell stays lock-free + allocation-free.
     BiomeWorldSeed = Settings->BiomeWorldSeed;
@@ -22,6 +25,9 @@ void UMythicTerritoryGrid::Initialize(const UMythicTerritoryGridSettings *Settin
     ReadBuffer.SetNum(TotalCells);
     DirtyCells.Init(false, TotalCells);
     ReadDirtyCells.Init(false, TotalCells);
+    PropagationScratch.SetNumUninitialized(TotalCells);
+    PropagationSeeds.Init(false, TotalCells); // an all-empty grid is already settled
+    ActiveCells.Init(false, TotalCells);
 
     // 256 max factions per FMythicFactionId (uint8 index)
     WriteFactionCells.SetNum(256);
@@ -41,6 +47,7 @@ void UMythicTerritoryGrid::SetCellInfluence(const FMythicCellCoord &Coord, FMyth
     Cell.DominantFaction = Faction;
     Cell.Influence = FMath::Clamp(Influence, 0.0f, 1.0f);
     DirtyCells[Index] = true;
+    PropagationSeeds[Index] = true;
 }
 
 void UMythicTerritoryGrid::SetCellPlayerOwned(const FMythicCellCoord &Coord, bool bOwned, uint8 PlayerIndex) {
@@ -53,143 +60,293 @@ void UMythicTerritoryGrid::SetCellPlayerOwned(const FMythicCellCoord &Coord, boo
     Cell.bPlayerOwned = bOwned;
     Cell.OwningPlayerIndex = PlayerIndex;
     DirtyCells[Index] = true;
+    PropagationSeeds[Index] = true;
 }
 
-void UMythicTerritoryGrid::PropagateInfluence() {
-    TRACE_CPUPROFILER_EVENT_SCOPE(MythicTerritoryGrid_PropagateInfluence);
-
-    // Territory propagation: influence bleeds from owned cells into neighbors.
-    // Three behaviors:
-    //   1. Empty cells — strongest adjacent faction above threshold claims them
-    //   2. Same-faction neighbors — reinforce (increase influence)
-    //   3. Different-faction neighbors — erode (decrease influence, can flip ownership)
-    //
-    // Iterates all cells — ~16K cells at 128×128, each with 4 neighbor checks.
-    // Uses a small per-cell faction map (max 4 entries from 4 neighbors).
-    // Cost: ~1-2ms worst case (only runs on background thread every 5-30s)
-
-    struct FCellUpdate {
+namespace {
+    /** Incoming influence from one faction via a cell's neighbors. Max 4 neighbors → max 4 distinct factions. */
+    struct FFactionBleed {
         FMythicFactionId Faction;
-        float Influence;
+        float TotalInfluence;
     };
 
-    const int32 TotalCells = Width * Height;
-    TArray<FCellUpdate> Updates;
-    Updates.SetNumUninitialized(TotalCells);
-
-    for (int32 Y = 0; Y < Height; ++Y) {
-        for (int32 X = 0; X < Width; ++X) {
-            const int32 Index = Y * Width + X;
-            const FMythicTerritoryCell &Cell = WriteBuffer[Index];
-
-            // Track incoming influence from each faction via neighbors
-            // Max 4 neighbors → max 4 distinct factions (use inline allocation)
-            struct FFactionBleed {
-                FMythicFactionId Faction;
-                float TotalInfluence;
-            };
-            FFactionBleed FactionBleeds[4];
-            int32 BleedCount = 0;
-
-            const int32 Neighbors[4][2] = {{X - 1, Y}, {X + 1, Y}, {X, Y - 1}, {X, Y + 1}};
-
-            for (const auto &N : Neighbors) {
-                if (N[0] < 0 || N[0] >= Width || N[1] < 0 || N[1] >= Height) {
-                    continue;
-                }
+    /** Fold one neighbor into the cell's per-faction bleed table */
+    FORCEINLINE void AccumulateBleed(const FMythicTerritoryCell &Neighbor, float BleedRate, FFactionBleed (&Bleeds)[4], int32 &BleedCount) {
+        if (!Neighbor.DominantFaction.IsValid() || Neighbor.Influence <= 0.0f) {
+            return;
+        }
 
-                const int32 NIdx = N[1] * Width + N[0];
-                const FMythicTerritoryCell &Neighbor = WriteBuffer[NIdx];
+        // Accumulate bleed per faction
+        for (int32 b = 0; b < BleedCount; ++b) {
+            if (Bleeds[b].Faction == Neighbor.DominantFaction) {
+                Bleeds[b].TotalInfluence += Neighbor.Influence * BleedRate;
+                return;
+            }
+        }
+        if (BleedCount < 4) {
+            Bleeds[BleedCount].Faction = Neighbor.DominantFaction;
+            Bleeds[BleedCount].TotalInfluence = Neighbor.Influence * BleedRate;
+            ++BleedCount;
+        }
+    }
 
-                if (!Neighbor.DominantFaction.IsValid() || Neighbor.Influence <= 0.0f) {
-                    continue;
+    /** Claim / reinforce / erode one cell from its bleed table, then apply the clamp + control threshold */
+    FORCEINLINE void ResolveCell(
+        const FMythicTerritoryCell &Cell,
+        const FFactionBleed (&Bleeds)[4],
+        int32 BleedCount,
+        float ControlThreshold,
+        FMythicFactionId &OutFaction,
+        float &OutInfluence) {
+        // No averaging by neighbor count — bleed rate already controls per-neighbor
+        // contribution. More faction neighbors → more total bleed, which correctly
+        // models stronger influence from faction clusters.
+        FMythicFactionId UpdateFaction;
+        float UpdateInfluence;
+
+        if (!Cell.DominantFaction.IsValid()) {
+            // ─── Empty cell: strongest adjacent faction claims it ───
+            float BestInfluence = 0.0f;
+            FMythicFactionId BestFaction;
+            for (int32 b = 0; b < BleedCount; ++b) {
+                if (Bleeds[b].TotalInfluence > BestInfluence) {
+                    BestInfluence = Bleeds[b].TotalInfluence;
+                    BestFaction = Bleeds[b].Faction;
                 }
+            }
 
-                // Accumulate bleed per faction
-                bool bFound = false;
-                for (int32 b = 0; b < BleedCount; ++b) {
-                    if (FactionBleeds[b].Faction == Neighbor.DominantFaction) {
-                        FactionBleeds[b].TotalInfluence += Neighbor.Influence * InfluenceBleedRate;
-                        bFound = true;
-                        break;
-                    }
+            UpdateFaction = BestFaction;
+            UpdateInfluence = BestInfluence;
+        }
+        else {
+            // ─── Owned cell: reinforce from allies, erode from enemies ───
+            float Reinforcement = 0.0f;
+            float Erosion = 0.0f;
+
+            for (int32 b = 0; b < BleedCount; ++b) {
+                if (Bleeds[b].Faction == Cell.DominantFaction) {
+                    Reinforcement += Bleeds[b].TotalInfluence;
                 }
-                if (!bFound && BleedCount < 4) {
-                    FactionBleeds[BleedCount].Faction = Neighbor.DominantFaction;
-                    FactionBleeds[BleedCount].TotalInfluence = Neighbor.Influence * InfluenceBleedRate;
-                    ++BleedCount;
+                else {
+                    Erosion += Bleeds[b].TotalInfluence;
                 }
             }
 
-            // No averaging by neighbor count — bleed rate already controls per-neighbor
-            // contribution. More faction neighbors → more total bleed, which correctly
-            // models stronger influence from faction clusters.
+            const float NewInfluence = Cell.Influence + Reinforcement - Erosion;
+            UpdateInfluence = NewInfluence;
+            UpdateFaction = Cell.DominantFaction;
 
-            if (!Cell.DominantFaction.IsValid()) {
-                // ─── Empty cell: strongest adjacent faction claims it ───
-                float BestInfluence = 0.0f;
+            // If eroded below zero, the strongest attacker claims it
+            if (NewInfluence <= 0.0f) {
+                float BestAttacker = 0.0f;
                 FMythicFactionId BestFaction;
                 for (int32 b = 0; b < BleedCount; ++b) {
-                    if (FactionBleeds[b].TotalInfluence > BestInfluence) {
-                        BestInfluence = FactionBleeds[b].TotalInfluence;
-                        BestFaction = FactionBleeds[b].Faction;
+                    if (Bleeds[b].Faction != Cell.DominantFaction) {
+                        if (Bleeds[b].TotalInfluence > BestAttacker) {
+                            BestAttacker = Bleeds[b].TotalInfluence;
+                            BestFaction = Bleeds[b].Faction;
+                        }
                     }
                 }
+                UpdateFaction = BestFaction;
+                UpdateInfluence = BestAttacker;
+            }
+        }
+
+        const float ClampedInfluence = FMath::Clamp(UpdateInfluence, 0.0f, 1.0f);
+        const bool bAboveThreshold = ClampedInfluence >= ControlThreshold && UpdateFaction.IsValid();
+
+        OutFaction = bAboveThreshold ? UpdateFaction : FMythicFactionId();
+        OutInfluence = bAboveThreshold ? ClampedInfluence : 0.0f;
+    }
+}
+
+void UMythicTerritoryGrid::PropagateInfluence() {
+    TRACE_CPUPROFILER_EVENT_SCOPE(MythicTerritoryGrid_PropagateInfluence);
+
+    // Territory propagation: influence bleeds from owned cells into neighbors.
+    // Three behaviors:
+    //   1. Empty cells — strongest adjacent faction claims it
+    //   2. Same-faction neighbors — reinforce (increase influence)
+    //   3. Different-faction neighbors — erode (decrease influence, can flip ownership)
+    //
+    // Every cell is evaluated from the PREVIOUS state (WriteBuffer is read-only during evaluation, results go to the
+    // scratch), so cells are independent and bands can run on any thread in any order with a bit-identical result.
+    // ~16K cells at 128×128 stay single-threaded; a 1024×1024 map splits into 256 bands per pass.
 
-                Updates[Index].Faction = BestFaction;
-                Updates[Index].Influence = BestInfluence;
+    const int32 TotalCells = Width * Height;
+    if (TotalCells <= 0) {
+        return;
+    }
+    if (PropagationScratch.Num() != TotalCells) {
+        PropagationScratch.SetNumUninitialized(TotalCells);
+    }
+
+    // ── Active frontier ──
+    // A cell's next state is a pure function of itself + its 4 neighbors. If none of those changed since the previous
+    // tick, re-evaluating would reproduce its current value — so only the seeds' closed 4-neighborhoods need work. Once
+    // the frontier covers a good fraction of the map, the plain sweep is cheaper than walking bits.
+    bool bFullSweep = !bIncrementalPropagation;
+    int32 ActiveCount = TotalCells;
+    if (!bFullSweep) {
+        ActiveCells.Init(false, TotalCells);
+        ActiveCount = 0;
+        for (TConstSetBitIterator<> It(PropagationSeeds); It; ++It) {
+            const int32 Index = It.GetIndex();
+            const int32 X = Index % Width;
+            const int32 Y = Index / Width;
+            ActiveCells[Index] = true;
+            if (X > 0) {
+                ActiveCells[Index - 1] = true;
+            }
+            if (X < Width - 1) {
+                ActiveCells[Index + 1] = true;
+            }
+            if (Y > 0) {
+                ActiveCells[Index - Width] = true;
             }
-            else {
-                // ─── Owned cell: reinforce from allies, erode from enemies ───
-                float Reinforcement = 0.0f;
-                float Erosion = 0.0f;
+            if (Y < Height - 1) {
+                ActiveCells[Index + Width] = true;
+            }
+        }
+        ActiveCount = ActiveCells.CountSetBits();
+        bFullSweep = ActiveCount * 4 > TotalCells;
+    }
+    LastPropagationCellCount = bFullSweep ? TotalCells : ActiveCount;
+    PropagationSeeds.Init(false, TotalCells); // re-seeded by this tick's apply pass
+    if (LastPropagationCellCount == 0) {
+        return; // settled map: nothing can change
+    }
 
-                for (int32 b = 0; b < BleedCount; ++b) {
-                    if (FactionBleeds[b].Faction == Cell.DominantFaction) {
-                        Reinforcement += FactionBleeds[b].TotalInfluence;
-                    }
-                    else {
-                        Erosion += FactionBleeds[b].TotalInfluence;
-                    }
-                }
+    const int32 NumBands = FMath::DivideAndRoundUp(TotalCells, PropagationBandCells);
+    const EParallelForFlags Flags = (LastPropagationCellCount >= ParallelPropagationMinCells && NumBands > 1)
+                                        ? EParallelForFlags::None
+                                        : EParallelForFlags::ForceSingleThread;
+
+    ParallelFor(NumBands, [this, TotalCells, bFullSweep](int32 Band) {
+        const int32 Begin = Band * PropagationBandCells;
+        EvaluatePropagationBand(Begin, FMath::Min(Begin + PropagationBandCells, TotalCells), bFullSweep);
+    }, Flags);
+
+    // Apply only after EVERY band has evaluated (ParallelFor returns when all bands are done) — applying a band early
+    // would feed this tick's result into a neighbor band's evaluation.
+    ParallelFor(NumBands, [this, TotalCells, bFullSweep](int32 Band) {
+        const int32 Begin = Band * PropagationBandCells;
+        ApplyPropagationBand(Begin, FMath::Min(Begin + PropagationBandCells, TotalCells), bFullSweep);
+    }, Flags);
+}
 
-                float NewInfluence = Cell.Influence + Reinforcement - Erosion;
-                Updates[Index].Influence = NewInfluence;
-                Updates[Index].Faction = Cell.DominantFaction;
-
-                // If eroded below zero, the strongest attacker claims it
-                if (NewInfluence <= 0.0f) {
-                    float BestAttacker = 0.0f;
-                    FMythicFactionId BestFaction;
-                    for (int32 b = 0; b < BleedCount; ++b) {
-                        if (FactionBleeds[b].Faction != Cell.DominantFaction) {
-                            if (FactionBleeds[b].TotalInfluence > BestAttacker) {
-                                BestAttacker = FactionBleeds[b].TotalInfluence;
-                                BestFaction = FactionBleeds[b].Faction;
-                            }
-                        }
-                    }
-                    Updates[Index].Faction = BestFaction;
-                    Updates[Index].Influence = BestAttacker;
-                }
+void UMythicTerritoryGrid::EvaluatePropagationBand(int32 Begin, int32 End, bool bFullSweep) {
+    if (bFullSweep) {
+        int32 X = Begin % Width;
+        int32 Y = Begin / Width;
+        for (int32 Index = Begin; Index < End; ++Index) {
+            EvaluatePropagationCell(Index, X, Y);
+            if (++X == Width) {
+                X = 0;
+                ++Y;
+            }
+        }
+        return;
+    }
+    for (TConstSetBitIterator<> It(ActiveCells, Begin); It && It.GetIndex() < End; ++It) {
+        const int32 Index = It.GetIndex();
+        EvaluatePropagationCell(Index, Index % Width, Index / Width);
+    }
+}
+
+void UMythicTerritoryGrid::ApplyPropagationBand(int32 Begin, int32 End, bool bFullSweep) {
+    if (bFullSweep) {
+        for (int32 Index = Begin; Index < End; ++Index) {
+            ApplyPropagationCell(Index);
+        }
+        return;
+    }
+    // Only frontier cells were evaluated — the rest of the scratch is stale and must not be applied.
+    for (TConstSetBitIterator<> It(ActiveCells, Begin); It && It.GetIndex() < End; ++It) {
+        ApplyPropagationCell(It.GetIndex());
+    }
+}
+
+void UMythicTerritoryGrid::EvaluatePropagationCell(int32 Index, int32 X, int32 Y) {
+    const FMythicTerritoryCell *Cells = WriteBuffer.GetData();
+    const float BleedRate = InfluenceBleedRate;
+
+    FFactionBleed Bleeds[4];
+    int32 BleedCount = 0;
+
+    if (X > 0 && X < Width - 1 && Y > 0 && Y < Height - 1) {
+        // Interior cell: all four neighbors in bounds, no per-neighbor bounds checks. Order matches the general
+        // path — (X-1,Y), (X+1,Y), (X,Y-1), (X,Y+1) — so float accumulation is identical.
+        const FMythicTerritoryCell &L = Cells[Index - 1];
+        const FMythicTerritoryCell &R = Cells[Index + 1];
+        const FMythicTerritoryCell &D = Cells[Index - Width];
+        const FMythicTerritoryCell &U = Cells[Index + Width];
+        const FMythicFactionId F = L.DominantFaction;
+
+        // Fast path: all four neighbors held by one faction — the saturated interior a settled map is mostly made
+        // of. One bleed entry, summed straight through without the per-faction table search.
+        if (F.IsValid() && R.DominantFaction == F && D.DominantFaction == F && U.DominantFaction == F &&
+            L.Influence > 0.0f && R.Influence > 0.0f && D.Influence > 0.0f && U.Influence > 0.0f) {
+            float Total = L.Influence * BleedRate;
+            Total += R.Influence * BleedRate;
+            Total += D.Influence * BleedRate;
+            Total += U.Influence * BleedRate;
+            Bleeds[0].Faction = F;
+            Bleeds[0].TotalInfluence = Total;
+            BleedCount = 1;
+        }
+        else {
+            AccumulateBleed(L, BleedRate, Bleeds, BleedCount);
+            AccumulateBleed(R, BleedRate, Bleeds, BleedCount);
+            AccumulateBleed(D, BleedRate, Bleeds, BleedCount);
+            AccumulateBleed(U, BleedRate, Bleeds, BleedCount);
+        }
+    }
+    else {
+        const int32 Neighbors[4][2] = {{X - 1, Y}, {X + 1, Y}, {X, Y - 1}, {X, Y + 1}};
+        for (const auto &N : Neighbors) {
+            if (N[0] >= 0 && N[0] < Width && N[1] >= 0 && N[1] < Height) {
+                AccumulateBleed(Cells[N[1] * Width + N[0]], BleedRate, Bleeds, BleedCount);
             }
         }
     }
 
-    // Apply updates
-    for (int32 i = 0; i < TotalCells; ++i) {
-        const float ClampedInfluence = FMath::Clamp(Updates[i].Influence, 0.0f, 1.0f);
-        const bool bAboveThreshold = ClampedInfluence >= MinControlThreshold && Updates[i].Faction.IsValid();
+    FPropagatedCell &Out = PropagationScratch[Index];
+    ResolveCell(Cells[Index], Bleeds, BleedCount, MinControlThreshold, Out.Faction, Out.Influence);
+}
 
-        const FMythicFactionId NewFaction = bAboveThreshold ? Updates[i].Faction : FMythicFactionId();
-        const float NewInfluence = bAboveThreshold ? ClampedInfluence : 0.0f;
+void UMythicTerritoryGrid::ApplyPropagationCell(int32 Index) {
+    const FPropagatedCell &Update = PropagationScratch[Index];
+    FMythicTerritoryCell &Cell = WriteBuffer[Index];
+    if (Cell.DominantFaction != Update.Faction || Cell.Influence != Update.Influence) {
+        Cell.DominantFaction = Update.Faction;
+        Cell.Influence = Update.Influence;
+        // Band-aligned to 32 cells: no other band touches these bits' words
+        DirtyCells[Index] = true;
+        PropagationSeeds[Index] = true;
+    }
+}
 
-        if (WriteBuffer[i].DominantFaction != NewFaction || WriteBuffer[i].Influence != NewInfluence) {
-            WriteBuffer[i].DominantFaction = NewFaction;
-            WriteBuffer[i].Influence = NewInfluence;
-            DirtyCells[i] = true;
+void UMythicTerritoryGrid::EvaluateCellReference(
+    const FMythicTerritoryCell *Cells,
+    int32 GridWidth,
+    int32 GridHeight,
+    int32 X,
+    int32 Y,
+    float BleedRate,
+    float ControlThreshold,
+    FMythicFactionId &OutFaction,
+    float &OutInfluence) {
+    FFactionBleed Bleeds[4];
+    int32 BleedCount = 0;
+    const int32 Neighbors[4][2] = {{X - 1, Y}, {X + 1, Y}, {X, Y - 1}, {X, Y + 1}};
+    for (const auto &N : Neighbors) {
+        if (N[0] >= 0 && N[0] < GridWidth && N[1] >= 0 && N[1] < GridHeight) {
+            AccumulateBleed(Cells[N[1] * GridWidth + N[0]], BleedRate, Bleeds, BleedCount);
         }
     }
+    ResolveCell(Cells[Y * GridWidth + X], Bleeds, BleedCount, ControlThreshold, OutFaction, OutInfluence);
 }
 
 void UMythicTerritoryGrid::GetWriteCellCounts(TArray<int32> &OutCountsByFactionIndex) const {
@@ -417,6 +574,8 @@ void UMythicTerritoryGrid::Serialize(FArchive &Ar) {
         ReadBuffer.SetNum(SafeTotal);
         DirtyCells.Init(false, SafeTotal);
         ReadDirtyCells.Init(false, SafeTotal);
+        PropagationSeeds.Init(true, SafeTotal); // loaded state is arbitrary: the first tick re-evaluates everything
+        ActiveCells.Init(false, SafeTotal);
     }
 
     const int32 TotalCells = static_cast<int32>(TotalCells64);
@@ -66,6 +66,23 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = "0.0", ClampMax = "1.0"))
     float MinControlThreshold = 0.1f;
 
+    /**
+     * Grids with at least this many cells run influence propagation as parallel bands across worker threads; smaller
+     * grids stay single-threaded, where task dispatch would cost more than the sweep. 0 = always parallel.
+     * The result is bit-identical either way (every cell reads only the previous tick's state).
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = "0"))
+    int32 ParallelPropagationMinCells = 65536;
+
+    /**
+     * Re-evaluate only the active frontier each propagation tick: cells whose own or 4-neighbor state changed since the
+     * previous tick (by propagation or by SetCellInfluence / SetCellPlayerOwned). A cell's next state depends only on
+     * that neighborhood, so every skipped cell provably keeps its value — same outcome as the full sweep, at a cost
+     * proportional to contested borders instead of map area. Falls back to a full sweep when the frontier is large.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+    bool bIncrementalPropagation = true;
+
     // ─── Biome (procedural, immutable) ────────────────────
     // Biomes are a PURE deterministic function of (CellX, CellY, BiomeWorldSeed) — never simulated, never mutated.
     // They classify wilderness for wildlife selection. Change the seed to reshuffle the whole world's terrain.
@@ -95,7 +112,8 @@ public:
  * - Game thread reads from a committed snapshot (lock-free)
  * - Double-buffered like the Causal Fabric
  *
- * Memory: ~6 bytes per cell × 128×128 = ~98KB per buffer × 2 = ~196KB total
+ * Memory: ~6 bytes per cell × 128×128 = ~98KB per buffer × 2 = ~196KB total, plus an 8-byte-per-cell persistent
+ * propagation scratch (~128KB at 128×128, 8MB at the 1024×1024 maximum).
  */
 UCLASS()
 class MYTHIC_API UMythicTerritoryGrid : public UObject {
@@ -117,9 +135,33 @@ public:
      * Run one tick of influence propagation.
      * Each cell bleeds influence to its 4-neighbors at the configured rate.
      * Called by the world sim background thread.
+     *
+     * Two passes over fixed-size cell bands, each pass a ParallelFor on large grids: evaluate every cell from the
+     * current write buffer into the persistent PropagationScratch, then apply the scratch back (marking DirtyCells).
+     * Evaluation reads only the previous tick's state, so band scheduling cannot change the result.
+     *
+     * With bIncrementalPropagation, only the active frontier (see the settings doc) is evaluated and applied.
      */
     void PropagateInfluence();
 
+    /** Cells the last PropagateInfluence evaluated (== Width*Height for a full sweep). Sim thread / debug only. */
+    int32 GetLastPropagationCellCount() const { return LastPropagationCellCount; }
+
+    /**
+     * Reference evaluation of one cell — the general (any neighbor mix) path PropagateInfluence's fast path must match
+     * bit-for-bit. Returns the post-threshold faction/influence the cell would take this tick. Pure + static for tests.
+     */
+    static void EvaluateCellReference(
+        const FMythicTerritoryCell *Cells,
+        int32 GridWidth,
+        int32 GridHeight,
+        int32 X,
+        int32 Y,
+        float BleedRate,
+        float ControlThreshold,
+        FMythicFactionId &OutFaction,
+        float &OutInfluence);
+
     /** Commit the write buffer — swaps the read snapshot for game thread. */
     void CommitWrites();
 
@@ -193,6 +235,9 @@ private:
     FVector2D WorldOrigin = FVector2D::ZeroVector;
     float InfluenceBleedRate = 0.05f;
     float MinControlThreshold = 0.1f;
+    int32 ParallelPropagationMinCells = 65536;
+    bool bIncrementalPropagation = true;
+    int32 LastPropagationCellCount = 0;
 
     // ─── Biome cache (immutable after Initialize) ─────────
     uint32 BiomeWorldSeed = 0;
@@ -238,6 +283,46 @@ private:
      *  tick's DirtyCells in; GetChangedCells (game thread) drains it. Mutable so the const drain can clear it. */
     mutable TBitArray<> ReadDirtyCells;
 
+    /** Post-threshold propagation result for one cell */
+    struct FPropagatedCell {
+        FMythicFactionId Faction;
+        float Influence;
+    };
+
+    /**
+     * Persistent propagation scratch (one entry per cell) — the "back buffer" PropagateInfluence evaluates into before
+     * applying. Kept across ticks so propagation never allocates; sim thread only.
+     */
+    TArray<FPropagatedCell> PropagationScratch;
+
+    /**
+     * Cells per propagation band. A multiple of 32 so no two bands ever share a DirtyCells word — the apply pass can
+     * then set dirty bits from several threads without atomics.
+     */
+    static constexpr int32 PropagationBandCells = 4096;
+
+    /**
+     * Cells whose state changed since the last PropagateInfluence — by its apply pass or by a SetCell* writer. The next
+     * propagation's active frontier is these plus their 4-neighbors. Same external SimulationLock discipline as DirtyCells
+     * (but never cleared by CommitWrites: it tracks propagation ticks, not commits).
+     */
+    TBitArray<> PropagationSeeds;
+
+    /** Active frontier of the current PropagateInfluence (dilated PropagationSeeds); read-only during the band passes */
+    TBitArray<> ActiveCells;
+
+    /** Evaluate one cell into PropagationScratch (reads WriteBuffer only) */
+    void EvaluatePropagationCell(int32 Index, int32 X, int32 Y);
+
+    /** Evaluate cells [Begin, End) — all of them, or only the ActiveCells among them */
+    void EvaluatePropagationBand(int32 Begin, int32 End, bool bFullSweep);
+
+    /** Apply PropagationScratch [Begin, End) to WriteBuffer (same cell selection), marking changed cells dirty + seeds */
+    void ApplyPropagationBand(int32 Begin, int32 End, bool bFullSweep);
+
+    /** Apply one evaluated cell */
+    void ApplyPropagationCell(int32 Index);
+
     /** Flatten 2D coord to 1D index */
     int32 CoordToIndex(const FMythicCellCoord &Coord) const {
         return static_cast<int32>(Coord.Y) * Width + static_cast<int32>(Coord.X);